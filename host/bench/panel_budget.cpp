@@ -0,0 +1,314 @@
+// Display-efficiency budgets for the ST7796 path, checked without hardware.
+//
+//   panel_budget [--json OUT] [--png DIR] [--trace]
+//
+// The vendored driver (main/esp_lcd_st7796.c) runs over panel_recorder's
+// esp_lcd panel IO, configured as tpager_display.cpp does, and each
+// scenario's tx_param/tx_color traffic is compared with an upper bound on
+// SPI bytes and draw calls. With LVGL, terminal-style updates are rendered
+// through a partial-mode display flushing into the panel the way
+// esp_lvgl_port does. Exits 1 when any scenario is over budget, so the
+// numbers can only get worse deliberately: lower a bound when an
+// optimisation lands.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_st7796.h"
+#include "panel_recorder.hpp"
+
+#if defined(POCKETSSH_HOST_LVGL)
+#include "headless_display.hpp"
+#include "screen_view.hpp"
+#include "vt_screen.hpp"
+#endif
+
+namespace {
+
+// Mirrors tpager_display.cpp.
+constexpr int kHRes = 480;
+constexpr int kVRes = 222;
+constexpr int kGapY = 49;
+constexpr int kBufferLines = 40;
+constexpr uint32_t kPclkHz = 40 * 1000 * 1000;
+
+// CASET + RASET (command and 4 parameter bytes each) + the RAMWR command.
+constexpr uint64_t kDrawFramingBytes = 5 + 5 + 1;
+constexpr uint64_t kFrameBytes = static_cast<uint64_t>(kHRes) * kVRes * 2;
+constexpr uint32_t kFrameChunks = (kVRes + kBufferLines - 1) / kBufferLines;
+
+struct Budget {
+    const char *name;
+    uint64_t max_wire_bytes;
+    uint32_t max_draws;
+};
+
+// Bring-up is SWRESET, SLPOUT, MADCTL, COLMOD, the 12-entry vendor table,
+// INVON, two MADCTL updates and DISPON: 69 bytes today.
+constexpr Budget kBringUp = {"bringup", 80, 0};
+// A full screen in esp_lvgl_port's 40-line chunks.
+constexpr Budget kFullFrame = {"full_frame", kFrameBytes + kFrameChunks * kDrawFramingBytes, kFrameChunks};
+// One 12 px text row across the screen, e.g. the status bar.
+constexpr Budget kTextRow = {"text_row", kHRes * 12 * 2 + kDrawFramingBytes, 1};
+#if defined(POCKETSSH_HOST_LVGL)
+// Terminal updates go through SSHTerminal::show_screen(): the vt_screen
+// rows that changed, each set on its own label of the session view. An
+// echoed key redraws its row only, at most 12 px of montserrat_10 like the
+// status bar row, in one draw or two where the row straddles a flush
+// chunk. A scroll moves every row up, so a new line or a burst redraws the
+// whole view, border included: a full frame.
+constexpr int kRowLines = 12;
+constexpr Budget kKeystroke = {"keystroke", kHRes * kRowLines * 2 + 2 * kDrawFramingBytes, 2};
+constexpr Budget kNewLine = {"new_line", kFrameBytes + kFrameChunks * kDrawFramingBytes, kFrameChunks};
+constexpr Budget kBurst = {"burst_4k", kFrameBytes + kFrameChunks * kDrawFramingBytes, kFrameChunks};
+#endif
+
+struct Options {
+    std::string json_path;
+    std::string png_dir;
+    bool trace = false;
+};
+
+struct Result {
+    Budget budget;
+    panel_recorder::Totals totals;
+    uint32_t draws = 0;
+    bool over = false;
+};
+
+struct Bench {
+    Options opts;
+    esp_lcd_panel_io_handle_t io = nullptr;
+    esp_lcd_panel_handle_t panel = nullptr;
+    std::vector<Result> results;
+};
+
+// Close a scenario that began at transfer index `mark`.
+void finish(Bench *bench, const Budget &budget, size_t mark)
+{
+    Result r;
+    r.budget = budget;
+    r.totals = panel_recorder::totals(bench->io, mark);
+    r.draws = r.totals.color_calls;
+    r.over = r.totals.wire_bytes() > budget.max_wire_bytes || r.draws > budget.max_draws;
+    bench->results.push_back(r);
+
+    if (bench->opts.trace) {
+        std::printf("-- %s\n", budget.name);
+        panel_recorder::dump(bench->io, stdout, mark);
+    }
+    if (!bench->opts.png_dir.empty()) {
+        const std::string path = bench->opts.png_dir + "/" + budget.name + ".png";
+        panel_recorder::Window visible;
+        visible.y0 = kGapY;
+        visible.x1 = kHRes - 1;
+        visible.y1 = kGapY + kVRes - 1;
+        panel_recorder::write_png(bench->io, path.c_str(), &visible);
+    }
+}
+
+bool bring_up(Bench *bench)
+{
+    bench->io = panel_recorder::create();
+    const size_t mark = panel_recorder::transfers(bench->io).size();
+
+    esp_lcd_panel_dev_config_t cfg = {};
+    cfg.reset_gpio_num = -1;
+    cfg.rgb_endian = LCD_RGB_ENDIAN_RGB;
+    cfg.bits_per_pixel = 16;
+    if (esp_lcd_new_panel_st7796(bench->io, &cfg, &bench->panel) != ESP_OK ||
+        esp_lcd_panel_reset(bench->panel) != ESP_OK || esp_lcd_panel_init(bench->panel) != ESP_OK ||
+        esp_lcd_panel_invert_color(bench->panel, true) != ESP_OK ||
+        esp_lcd_panel_swap_xy(bench->panel, true) != ESP_OK ||
+        esp_lcd_panel_mirror(bench->panel, true, true) != ESP_OK ||
+        esp_lcd_panel_set_gap(bench->panel, 0, kGapY) != ESP_OK ||
+        esp_lcd_panel_disp_on_off(bench->panel, true) != ESP_OK) {
+        std::fprintf(stderr, "panel bring-up failed\n");
+        return false;
+    }
+    finish(bench, kBringUp, mark);
+    return true;
+}
+
+// Eight vertical colour bars, flushed in buffer-sized chunks.
+void full_frame(Bench *bench)
+{
+    static const uint16_t kBars[] = {0xFFFF, 0xFFE0, 0x07FF, 0x07E0, 0xF81F, 0xF800, 0x001F, 0x0000};
+    std::vector<uint8_t> chunk(static_cast<size_t>(kHRes) * kBufferLines * 2);
+    const size_t mark = panel_recorder::transfers(bench->io).size();
+    for (int y = 0; y < kVRes; y += kBufferLines) {
+        const int lines = std::min(kBufferLines, kVRes - y);
+        for (int row = 0; row < lines; ++row) {
+            for (int x = 0; x < kHRes; ++x) {
+                const uint16_t c = kBars[x * 8 / kHRes];
+                uint8_t *p = &chunk[(static_cast<size_t>(row) * kHRes + x) * 2];
+                p[0] = static_cast<uint8_t>(c >> 8);
+                p[1] = static_cast<uint8_t>(c);
+            }
+        }
+        esp_lcd_panel_draw_bitmap(bench->panel, 0, y, kHRes, y + lines, chunk.data());
+    }
+    finish(bench, kFullFrame, mark);
+}
+
+void text_row(Bench *bench)
+{
+    std::vector<uint8_t> row(static_cast<size_t>(kHRes) * 12 * 2, 0x00);
+    const size_t mark = panel_recorder::transfers(bench->io).size();
+    esp_lcd_panel_draw_bitmap(bench->panel, 0, 0, kHRes, 12, row.data());
+    finish(bench, kTextRow, mark);
+}
+
+#if defined(POCKETSSH_HOST_LVGL)
+// A full-screen session view styled like SSHTerminal's.
+void terminal_updates(Bench *bench)
+{
+    lv_display_t *display = headless_display::create_panel(kHRes, kVRes, kBufferLines, bench->panel);
+    lv_display_set_default(display);
+    lv_obj_t *screen = lv_display_get_screen_active(display);
+    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+    static screen_view::View view;
+    lv_obj_t *column = view.create(screen);
+    lv_obj_set_size(column, kHRes, kVRes);
+    lv_obj_set_style_bg_color(column, lv_color_black(), 0);
+    lv_obj_set_style_text_color(column, lv_color_hex(0xF7FFF9), 0);
+    lv_obj_set_style_text_font(column, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_border_color(column, lv_color_hex(0x48A878), 0);
+    lv_obj_set_style_border_width(column, 1, 0);
+    lv_obj_set_scrollbar_mode(column, LV_SCROLLBAR_MODE_OFF);
+    view.set_shown(true);
+
+    // Session output parsed into the grid, then shown as show_screen() does.
+    static vt_screen::Screen grid;
+    static vt_screen::Frame frame;
+    auto show = [&](const std::string &output) {
+        grid.feed(output.data(), output.size());
+        grid.take_frame(&frame);
+        view.apply(frame);
+        headless_display::refresh(display);
+    };
+
+    std::string screenful;
+    for (int i = 0; i < 40; ++i) {
+        char line[64];
+        std::snprintf(line, sizeof(line), "drwxr-xr-x  2 user user 4096 Oct 18 12:%02d dir%02d\r\n", i % 60, i);
+        screenful += line;
+    }
+    show(screenful + "$ ");
+
+    size_t mark = panel_recorder::transfers(bench->io).size();
+    show("l");
+    finish(bench, kKeystroke, mark);
+
+    mark = panel_recorder::transfers(bench->io).size();
+    show("s\r\nREADME.md  main  host\r\n$ ");
+    finish(bench, kNewLine, mark);
+
+    std::string burst;
+    while (burst.size() < 4096) {
+        burst += screenful;
+    }
+    burst.resize(4096);
+    mark = panel_recorder::transfers(bench->io).size();
+    show(burst);
+    finish(bench, kBurst, mark);
+}
+#endif
+
+bool parse_args(int argc, char **argv, Options *opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            opts->json_path = argv[++i];
+        } else if (arg == "--png" && i + 1 < argc) {
+            opts->png_dir = argv[++i];
+        } else if (arg == "--trace") {
+            opts->trace = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+double wire_ms(uint64_t bytes)
+{
+    return bytes * 8.0 * 1000.0 / kPclkHz;
+}
+
+void print_table(const std::vector<Result> &results)
+{
+    std::printf("%-12s %6s %6s %9s %9s %8s %9s %5s %s\n", "SCENARIO", "CMDS", "DRAWS", "COLOR_B", "WIRE_B", "WIRE_MS",
+                "BUDGET_B", "MAX_D", "");
+    for (const Result &r : results) {
+        std::printf("%-12s %6" PRIu32 " %6" PRIu32 " %9" PRIu64 " %9" PRIu64 " %8.2f %9" PRIu64 " %5" PRIu32 " %s\n",
+                    r.budget.name, r.totals.commands, r.draws, r.totals.color_bytes, r.totals.wire_bytes(),
+                    wire_ms(r.totals.wire_bytes()), r.budget.max_wire_bytes, r.budget.max_draws,
+                    r.over ? "OVER" : "ok");
+    }
+}
+
+bool write_json(const std::string &path, const std::vector<Result> &results)
+{
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) {
+        std::perror(path.c_str());
+        return false;
+    }
+    std::fprintf(f, "{\n  \"build\": \"%s\",\n  \"pclk_hz\": %" PRIu32 ",\n  \"scenarios\": [", POCKETSSH_VERSION,
+                 kPclkHz);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        std::fprintf(f,
+                     "%s\n    {\"name\": \"%s\", \"commands\": %" PRIu32 ", \"draws\": %" PRIu32
+                     ", \"param_bytes\": %" PRIu64 ", \"color_bytes\": %" PRIu64 ", \"wire_bytes\": %" PRIu64
+                     ", \"budget_bytes\": %" PRIu64 ", \"budget_draws\": %" PRIu32 ", \"over\": %s}",
+                     i == 0 ? "" : ",", r.budget.name, r.totals.commands, r.draws, r.totals.param_bytes,
+                     r.totals.color_bytes, r.totals.wire_bytes(), r.budget.max_wire_bytes, r.budget.max_draws,
+                     r.over ? "true" : "false");
+    }
+    std::fprintf(f, "\n  ]\n}\n");
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Bench bench;
+    if (!parse_args(argc, argv, &bench.opts)) {
+        std::fprintf(stderr, "usage: panel_budget [--json OUT] [--png DIR] [--trace]\n");
+        return 2;
+    }
+
+    if (!bring_up(&bench)) {
+        return 1;
+    }
+    full_frame(&bench);
+    text_row(&bench);
+#if defined(POCKETSSH_HOST_LVGL)
+    terminal_updates(&bench);
+#endif
+
+    esp_lcd_panel_del(bench.panel);
+    esp_lcd_panel_io_del(bench.io);
+
+    print_table(bench.results);
+    if (!bench.opts.json_path.empty() && !write_json(bench.opts.json_path, bench.results)) {
+        return 1;
+    }
+    for (const Result &r : bench.results) {
+        if (r.over) {
+            return 1;
+        }
+    }
+    return 0;
+}
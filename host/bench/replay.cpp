@@ -0,0 +1,413 @@
+// Replay captured terminal streams through the receive pipeline.
+//
+//   replay [--chunk N] [--drain-every K] [--max-moved-per-byte X]
+//          [--keystrokes N] [--max-keystroke-bytes X] [--json OUT] STREAM...
+//
+// Each stream is cut into N-byte reads (default 1024, the channel read size)
+// and fed to vt_screen::Screen::feed() straight from the read buffer, the
+// way SSHTerminal::process_received_data() does. Every K reads (default 1)
+// the channel is treated as drained and a frame is taken, as one kScreen
+// nudge from receive_session() on EAGAIN ends in show_screen().
+//
+// Per stream it reports wall and CPU time, bytes/s (input bytes over CPU
+// time), cell writes, renders (frames taken) and render bytes. Bytes moved
+// are counted per input byte for two pipelines:
+//
+//   screen   receive path: the read buffer and one cell write per printable
+//            byte; a row that scrolls off stays in the grid as scrollback.
+//            Render: the changed rows copied out of the grid, then into
+//            their labels, paid once per frame whatever the input rate.
+//   text     the terminal_text path it replaced: read buffer, strip_ansi()
+//            into the pending string (plus the memmove when the bound
+//            trims it), then per flushed byte the substr() piece, the UI
+//            message text, the queue send and receive copies and
+//            lv_textarea_add_text(). Only text bytes are counted.
+//
+// With --max-moved-per-byte, exits 1 when a stream's screen path, receive
+// and render together, moves more than X bytes per input byte.
+//
+// With --keystrokes N a "keystroke" row is added: a full screen, then N
+// one-byte echo reads at a prompt on the bottom row, each drained and
+// rendered on its own as typing is. Its per-byte columns are per
+// keystroke, and --max-keystroke-bytes bounds the screen path's total.
+//
+// With LVGL the widget is SSHTerminal's screen_view::View on the headless
+// display, given each frame, and display frames, flushed pixels and an SPI
+// byte estimate (RGB565 pixels plus the CASET/RASET/RAMWR framing of each
+// flush) are reported too.
+//
+// Wall and CPU time cover the screen path. The text path runs afterwards for
+// its byte counts only; the shim sleeps a real 10 ms tick in each of its
+// vTaskDelay(1) yields.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "esp_timer.h"
+#include "terminal_text.hpp"
+#include "vt_screen.hpp"
+
+#if defined(POCKETSSH_HOST_LVGL)
+#include "headless_display.hpp"
+#include "screen_view.hpp"
+#endif
+
+namespace {
+
+constexpr size_t kDefaultChunk = 1024;
+// Copies a flushed byte goes through after the pending string in the text
+// path: substr() piece, UI message, queue send, queue receive, widget.
+constexpr uint64_t kTextFlushCopies = 5;
+#if defined(POCKETSSH_HOST_LVGL)
+constexpr int32_t kDisplayWidth = 480;
+constexpr int32_t kDisplayHeight = 222;
+// Per flush: CASET, RASET, RAMWR opcodes plus two 4-byte windows.
+constexpr uint64_t kFlushFramingBytes = 3 + 8;
+
+// A session view filling the display, shown.
+screen_view::View *create_view()
+{
+    static screen_view::View view;
+    lv_obj_clean(lv_screen_active());
+    view = screen_view::View();
+    lv_obj_t *column = view.create(lv_screen_active());
+    lv_obj_set_size(column, kDisplayWidth, kDisplayHeight);
+    view.set_shown(true);
+    return &view;
+}
+#endif
+
+struct Options {
+    size_t chunk = kDefaultChunk;
+    size_t drain_every = 1;
+    double max_moved_per_byte = 0;  // 0: report only
+    size_t keystrokes = 0;
+    double max_keystroke_bytes = 0;  // 0: report only
+    std::string json_path;
+    std::vector<std::string> streams;
+};
+
+struct Result {
+    std::string name;
+    uint64_t bytes = 0;
+    uint64_t cells = 0;
+    uint32_t renders = 0;
+    uint64_t render_bytes = 0;
+    uint64_t screen_moved = 0;  // receive path only
+    uint64_t text_moved = 0;
+    double wall_s = 0;
+    double cpu_s = 0;
+    uint32_t frames = 0;
+    uint64_t pixels = 0;
+    uint64_t spi_bytes = 0;
+    double limit = 0;  // bound on total_per_byte(), 0: none
+
+    double screen_per_byte() const { return bytes > 0 ? static_cast<double>(screen_moved) / bytes : 0.0; }
+    double render_per_byte() const { return bytes > 0 ? 2.0 * render_bytes / bytes : 0.0; }
+    double total_per_byte() const { return screen_per_byte() + render_per_byte(); }
+    double text_per_byte() const { return bytes > 0 ? static_cast<double>(text_moved) / bytes : 0.0; }
+    bool over() const { return limit > 0 && total_per_byte() > limit; }
+};
+
+struct TextSink {
+    uint64_t flushed = 0;
+};
+
+double cpu_seconds()
+{
+    timespec ts = {};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+bool count_sink(const char *text, void *ctx)
+{
+    static_cast<TextSink *>(ctx)->flushed += std::strlen(text);
+    return true;
+}
+
+bool read_stream(const std::string &path, std::string *out)
+{
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        std::perror(path.c_str());
+        return false;
+    }
+    char chunk[4096];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out->append(chunk, n);
+    }
+    std::fclose(f);
+    return true;
+}
+
+std::string stream_name(const std::string &path)
+{
+    const size_t slash = path.find_last_of('/');
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    const size_t dot = name.rfind('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+// The terminal_text pipeline, counting the bytes each stage copies.
+uint64_t replay_text(const Options &opts, const std::string &data)
+{
+    std::string pending;
+    TextSink sink;
+    uint64_t moved = 0;
+    size_t reads = 0;
+    for (size_t offset = 0; offset < data.size(); offset += opts.chunk) {
+        const size_t len = std::min(opts.chunk, data.size() - offset);
+        moved += len;
+        const size_t before = pending.size();
+        terminal_text::strip_ansi(data.data() + offset, len, &pending);
+        moved += pending.size() - before;
+        if (pending.size() > terminal_text::kPendingMax) {
+            pending.erase(0, pending.size() - terminal_text::kPendingKeep);
+            moved += terminal_text::kPendingKeep;
+        }
+        if (++reads % opts.drain_every == 0 || offset + len == data.size()) {
+            const uint64_t flushed_before = sink.flushed;
+            terminal_text::flush(&pending, count_sink, &sink);
+            moved += (sink.flushed - flushed_before) * kTextFlushCopies + pending.size();
+        }
+    }
+    return moved;
+}
+
+Result replay(const Options &opts, const std::string &path, const std::string &data)
+{
+    Result result;
+    result.name = stream_name(path);
+    result.bytes = data.size();
+
+#if defined(POCKETSSH_HOST_LVGL)
+    static lv_display_t *display = headless_display::create(kDisplayWidth, kDisplayHeight);
+    screen_view::View *view = create_view();
+    headless_display::refresh(display);
+    const headless_display::Stats before = headless_display::stats(display);
+#endif
+
+    static vt_screen::Screen screen;
+    static vt_screen::Frame frame;
+    screen = vt_screen::Screen();
+    // Stands in for g_rx_buffer: each read lands here and is parsed in place.
+    std::vector<char> read_buffer(opts.chunk);
+
+    const int64_t wall_start = esp_timer_get_time();
+    const double cpu_start = cpu_seconds();
+    size_t reads = 0;
+    for (size_t offset = 0; offset < data.size(); offset += opts.chunk) {
+        const size_t len = std::min(opts.chunk, data.size() - offset);
+        std::memcpy(read_buffer.data(), data.data() + offset, len);
+        screen.feed(read_buffer.data(), len);
+        if (++reads % opts.drain_every == 0 || offset + len == data.size()) {
+            if (screen.dirty()) {
+                screen.take_frame(&frame);
+#if defined(POCKETSSH_HOST_LVGL)
+                view->apply(frame);
+                headless_display::refresh(display);
+#endif
+            }
+        }
+    }
+    result.cpu_s = cpu_seconds() - cpu_start;
+    result.wall_s = (esp_timer_get_time() - wall_start) / 1e6;
+
+    const vt_screen::Stats &stats = screen.stats();
+    result.cells = stats.cell_writes;
+    result.renders = stats.renders;
+    result.render_bytes = stats.render_bytes;
+    result.screen_moved = stats.bytes_in + stats.cell_writes;
+    result.text_moved = replay_text(opts, data);
+    result.limit = opts.max_moved_per_byte;
+
+#if defined(POCKETSSH_HOST_LVGL)
+    const headless_display::Stats after = headless_display::stats(display);
+    result.frames = after.flushes - before.flushes;
+    result.pixels = after.pixels - before.pixels;
+    result.spi_bytes = result.pixels * 2 + result.frames * kFlushFramingBytes;
+#endif
+    return result;
+}
+
+// Typing at a shell prompt below a full screen: every echoed byte is its own
+// read, and the channel drains after each, so each one costs a frame. The
+// line wraps and scrolls once it is full, as typing does.
+Result replay_keystrokes(const Options &opts)
+{
+    Result result;
+    result.name = "keystroke";
+    result.bytes = opts.keystrokes;
+
+#if defined(POCKETSSH_HOST_LVGL)
+    static lv_display_t *display = headless_display::create(kDisplayWidth, kDisplayHeight);
+    screen_view::View *view = create_view();
+#endif
+
+    static vt_screen::Screen screen;
+    static vt_screen::Frame frame;
+    screen = vt_screen::Screen();
+    std::string page;
+    for (uint16_t row = 0; row < vt_screen::kRows; ++row) {
+        page.append(vt_screen::kCols - 1, static_cast<char>('a' + row % 26));
+        page.append("\r\n");
+    }
+    page.append("$ ");
+    screen.feed(page.data(), page.size());
+    screen.take_frame(&frame);
+#if defined(POCKETSSH_HOST_LVGL)
+    view->apply(frame);
+    headless_display::refresh(display);
+    const headless_display::Stats before = headless_display::stats(display);
+#endif
+    const vt_screen::Stats start = screen.stats();
+
+    const std::string typed(opts.keystrokes, 'x');
+    const int64_t wall_start = esp_timer_get_time();
+    const double cpu_start = cpu_seconds();
+    for (const char key : typed) {
+        screen.feed(&key, 1);
+        screen.take_frame(&frame);
+#if defined(POCKETSSH_HOST_LVGL)
+        view->apply(frame);
+        headless_display::refresh(display);
+#endif
+    }
+    result.cpu_s = cpu_seconds() - cpu_start;
+    result.wall_s = (esp_timer_get_time() - wall_start) / 1e6;
+
+    const vt_screen::Stats &stats = screen.stats();
+    result.cells = stats.cell_writes - start.cell_writes;
+    result.renders = stats.renders - start.renders;
+    result.render_bytes = stats.render_bytes - start.render_bytes;
+    result.screen_moved = (stats.bytes_in - start.bytes_in) + result.cells;
+    Options per_key = opts;
+    per_key.chunk = 1;
+    per_key.drain_every = 1;
+    result.text_moved = replay_text(per_key, typed);
+    result.limit = opts.max_keystroke_bytes;
+
+#if defined(POCKETSSH_HOST_LVGL)
+    const headless_display::Stats after = headless_display::stats(display);
+    result.frames = after.flushes - before.flushes;
+    result.pixels = after.pixels - before.pixels;
+    result.spi_bytes = result.pixels * 2 + result.frames * kFlushFramingBytes;
+#endif
+    return result;
+}
+
+bool parse_args(int argc, char **argv, Options *opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--chunk" && i + 1 < argc) {
+            opts->chunk = std::max(1L, std::strtol(argv[++i], nullptr, 10));
+        } else if (arg == "--drain-every" && i + 1 < argc) {
+            opts->drain_every = std::max(1L, std::strtol(argv[++i], nullptr, 10));
+        } else if (arg == "--max-moved-per-byte" && i + 1 < argc) {
+            opts->max_moved_per_byte = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--keystrokes" && i + 1 < argc) {
+            opts->keystrokes = std::max(0L, std::strtol(argv[++i], nullptr, 10));
+        } else if (arg == "--max-keystroke-bytes" && i + 1 < argc) {
+            opts->max_keystroke_bytes = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--json" && i + 1 < argc) {
+            opts->json_path = argv[++i];
+        } else if (arg.rfind("--", 0) == 0) {
+            return false;
+        } else {
+            opts->streams.push_back(arg);
+        }
+    }
+    return !opts->streams.empty() || opts->keystrokes > 0;
+}
+
+void print_table(const Options &opts, const std::vector<Result> &results)
+{
+    std::printf("chunk %zu B, drain every %zu read(s); bytes moved per input byte\n", opts.chunk,
+                opts.drain_every);
+    std::printf("%-16s %8s %8s %7s %8s %10s %7s %7s %8s %7s %6s %10s\n", "STREAM", "BYTES", "CELLS", "RENDERS",
+                "WALL_S", "CPU_B/S", "SCREEN", "+RENDER", "TOTAL", "TEXT", "FRAMES", "SPI_B");
+    for (const Result &r : results) {
+        std::printf("%-16s %8" PRIu64 " %8" PRIu64 " %7" PRIu32 " %8.3f %10.0f %7.2f %7.2f %8.2f %7.2f %6" PRIu32
+                    " %10" PRIu64 "%s\n",
+                    r.name.c_str(), r.bytes, r.cells, r.renders, r.wall_s, r.cpu_s > 0 ? r.bytes / r.cpu_s : 0.0,
+                    r.screen_per_byte(), r.render_per_byte(), r.total_per_byte(), r.text_per_byte(), r.frames,
+                    r.spi_bytes, r.over() ? "  OVER" : "");
+    }
+}
+
+bool write_json(const Options &opts, const std::vector<Result> &results)
+{
+    FILE *f = std::fopen(opts.json_path.c_str(), "w");
+    if (f == nullptr) {
+        std::perror(opts.json_path.c_str());
+        return false;
+    }
+    std::fprintf(f,
+                 "{\n  \"build\": \"%s\",\n  \"chunk\": %zu,\n  \"drain_every\": %zu,\n"
+                 "  \"max_moved_per_byte\": %.2f,\n  \"max_keystroke_bytes\": %.1f,\n",
+                 POCKETSSH_VERSION, opts.chunk, opts.drain_every, opts.max_moved_per_byte, opts.max_keystroke_bytes);
+#if defined(POCKETSSH_HOST_LVGL)
+    std::fprintf(f, "  \"renderer\": \"lvgl\",\n");
+#else
+    std::fprintf(f, "  \"renderer\": \"none\",\n");
+#endif
+    std::fprintf(f, "  \"streams\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        std::fprintf(f,
+                     "%s\n    {\"name\": \"%s\", \"bytes\": %" PRIu64 ", \"cells\": %" PRIu64
+                     ", \"renders\": %" PRIu32 ", \"render_bytes\": %" PRIu64
+                     ", \"wall_s\": %.4f, \"cpu_s\": %.4f, \"bytes_per_s\": %.0f"
+                     ", \"screen_moved_per_byte\": %.3f, \"render_moved_per_byte\": %.3f"
+                     ", \"total_moved_per_byte\": %.3f, \"text_moved_per_byte\": %.3f, \"frames\": %" PRIu32
+                     ", \"pixels\": %" PRIu64 ", \"spi_bytes\": %" PRIu64 ", \"over\": %s}",
+                     i == 0 ? "" : ",", r.name.c_str(), r.bytes, r.cells, r.renders, r.render_bytes, r.wall_s,
+                     r.cpu_s, r.cpu_s > 0 ? r.bytes / r.cpu_s : 0.0, r.screen_per_byte(), r.render_per_byte(),
+                     r.total_per_byte(), r.text_per_byte(), r.frames, r.pixels, r.spi_bytes,
+                     r.over() ? "true" : "false");
+    }
+    std::fprintf(f, "\n  ]\n}\n");
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_args(argc, argv, &opts)) {
+        std::fprintf(stderr,
+                     "usage: replay [--chunk N] [--drain-every K] [--max-moved-per-byte X] [--keystrokes N] "
+                     "[--max-keystroke-bytes X] [--json OUT] STREAM...\n");
+        return 2;
+    }
+
+    std::vector<Result> results;
+    for (const std::string &path : opts.streams) {
+        std::string data;
+        if (!read_stream(path, &data)) {
+            return 1;
+        }
+        results.push_back(replay(opts, path, data));
+    }
+    if (opts.keystrokes > 0) {
+        results.push_back(replay_keystrokes(opts));
+    }
+
+    print_table(opts, results);
+    if (!opts.json_path.empty() && !write_json(opts, results)) {
+        return 1;
+    }
+    const bool over = std::any_of(results.begin(), results.end(), [](const Result &r) { return r.over(); });
+    return over ? 1 : 0;
+}
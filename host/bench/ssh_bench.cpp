@@ -0,0 +1,485 @@
+// End-to-end benchmark of the SSH receive pipeline against a real sshd.
+//
+//   ssh_bench --host H --port P --user U --key PEM [--bulk FILE]...
+//             [--lines N] [--json OUT]
+//
+// Session setup and the receive loop mirror SSHTerminal::connect_with_key(),
+// ssh_open_channel() and receive_session(): a non-blocking libssh2 session,
+// a vt100 PTY shell, 1 KB channel reads, and the same work_budget slicing
+// (2 ms slices, a tick's sleep after 100 ms without the channel running
+// dry). Output
+// is parsed from the read buffer into a vt_screen::Screen, which is rendered
+// on the 1 s display cadence and whenever the channel runs dry, the text
+// the widget would have been given being counted. The FreeRTOS shim keeps
+// the device's 10 ms tick, so a budget sleep costs what it costs on the
+// ESP32-S3.
+//
+// Reported:
+//   handshake_ms, auth_ms        libssh2_session_handshake / publickey auth
+//   first_prompt_ms              connect start to the first output ending in
+//                                a prompt character
+//   bulk[]                       `cat FILE` per --bulk: wire bytes, seconds,
+//                                bytes/s, bytes rendered for the display,
+//                                budget yields and sleeps
+//   echo_us                      PocketSSH sends a line on Enter, so echo
+//                                latency is per line: write "#kN\n" until the
+//                                PTY echoes it back
+//
+// sshd_bench.sh starts a private sshd on 127.0.0.1 and runs this.
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <netinet/in.h>
+#include <string>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "libssh2.h"
+#include "vt_screen.hpp"
+#include "work_budget.hpp"
+
+namespace {
+
+constexpr const char *kTag = "ssh_bench";
+constexpr size_t kReadBuffer = 1024;            // g_rx_buffer in ssh_terminal.cpp
+constexpr int64_t kDisplayIntervalMs = 1000;    // process_received_data() flush cadence
+constexpr uint32_t kRxSliceUs = 2000;           // receive_session() budget
+constexpr uint32_t kRxBusyLimitUs = 100 * 1000;
+constexpr int kConnectRetries = 50;             // sshd may still be starting
+constexpr int64_t kPromptTimeoutUs = 10 * 1000000;
+constexpr int64_t kBulkTimeoutUs = 600 * 1000000LL;
+constexpr int64_t kEchoTimeoutUs = 5 * 1000000;
+// Split so the PTY's echo of the command line never contains the marker.
+constexpr const char *kDoneCommand = "echo __BENCH_\"\"DONE__";
+constexpr const char *kDoneMarker = "__BENCH_DONE__";
+
+struct Options {
+    std::string host = "127.0.0.1";
+    int port = 22;
+    std::string user;
+    std::string key_path;
+    std::vector<std::string> bulk_files;
+    int echo_lines = 50;
+    std::string json_path;
+};
+
+struct BulkResult {
+    std::string file;
+    uint64_t wire_bytes = 0;
+    uint64_t display_bytes = 0;
+    uint32_t yields = 0;
+    uint32_t sleeps = 0;
+    double seconds = 0;
+};
+
+int64_t now_us()
+{
+    return esp_timer_get_time();
+}
+
+// One session and the state receive_session() keeps, plus a rolling tail of
+// raw output so a phase can wait for a marker split across reads.
+class Session {
+public:
+    ~Session()
+    {
+        if (channel_ != nullptr) {
+            libssh2_channel_free(channel_);
+        }
+        if (session_ != nullptr) {
+            libssh2_session_disconnect(session_, "Normal Shutdown");
+            libssh2_session_free(session_);
+        }
+        if (socket_ >= 0) {
+            close(socket_);
+        }
+    }
+
+    bool connect(const Options &opts, const std::string &key, int64_t *handshake_us, int64_t *auth_us)
+    {
+        sockaddr_in sin = {};
+        sin.sin_family = AF_INET;
+        sin.sin_port = htons(static_cast<uint16_t>(opts.port));
+        if (inet_pton(AF_INET, opts.host.c_str(), &sin.sin_addr) != 1) {
+            ESP_LOGE(kTag, "host must be an IPv4 literal: %s", opts.host.c_str());
+            return false;
+        }
+        for (int attempt = 0; attempt < kConnectRetries; ++attempt) {
+            socket_ = socket(AF_INET, SOCK_STREAM, 0);
+            if (::connect(socket_, reinterpret_cast<sockaddr *>(&sin), sizeof(sin)) == 0) {
+                break;
+            }
+            close(socket_);
+            socket_ = -1;
+            vTaskDelay(pdMS_TO_TICKS(100));
+        }
+        if (socket_ < 0) {
+            ESP_LOGE(kTag, "connect %s:%d failed (errno=%d)", opts.host.c_str(), opts.port, errno);
+            return false;
+        }
+
+        session_ = libssh2_session_init();
+        if (session_ == nullptr) {
+            return false;
+        }
+        libssh2_session_set_blocking(session_, 0);
+
+        int rc;
+        int64_t start = now_us();
+        while ((rc = libssh2_session_handshake(session_, socket_)) == LIBSSH2_ERROR_EAGAIN);
+        *handshake_us = now_us() - start;
+        if (rc != 0) {
+            ESP_LOGE(kTag, "handshake failed: %d", rc);
+            return false;
+        }
+
+        start = now_us();
+        while ((rc = libssh2_userauth_publickey_frommemory(session_, opts.user.c_str(), opts.user.size(), nullptr, 0,
+                                                            key.data(), key.size(), nullptr)) ==
+               LIBSSH2_ERROR_EAGAIN);
+        *auth_us = now_us() - start;
+        if (rc != 0) {
+            char *msg = nullptr;
+            libssh2_session_last_error(session_, &msg, nullptr, 0);
+            ESP_LOGE(kTag, "publickey auth failed: %s (%d)", msg, rc);
+            return false;
+        }
+
+        while ((channel_ = libssh2_channel_open_session(session_)) == nullptr &&
+               libssh2_session_last_error(session_, nullptr, nullptr, 0) == LIBSSH2_ERROR_EAGAIN) {
+            wait_socket(100);
+        }
+        if (channel_ == nullptr) {
+            ESP_LOGE(kTag, "channel open failed");
+            return false;
+        }
+        while ((rc = libssh2_channel_request_pty_ex(channel_, "vt100", 5, nullptr, 0, vt_screen::kCols,
+                                                    vt_screen::kRows, 0, 0)) == LIBSSH2_ERROR_EAGAIN) {
+            wait_socket(100);
+        }
+        if (rc == 0) {
+            while ((rc = libssh2_channel_shell(channel_)) == LIBSSH2_ERROR_EAGAIN) {
+                wait_socket(100);
+            }
+        }
+        if (rc != 0) {
+            ESP_LOGE(kTag, "pty/shell request failed: %d", rc);
+            return false;
+        }
+        return true;
+    }
+
+    // Mirrors SSHTerminal::send_command(): retry EAGAIN with a tick yield.
+    bool write(const std::string &data)
+    {
+        size_t written = 0;
+        int retries = 0;
+        while (written < data.size() && retries < 20) {
+            const ssize_t n = libssh2_channel_write(channel_, data.data() + written, data.size() - written);
+            if (n == LIBSSH2_ERROR_EAGAIN) {
+                retries++;
+                vTaskDelay(1);
+                continue;
+            }
+            if (n < 0) {
+                return false;
+            }
+            written += static_cast<size_t>(n);
+            retries = 0;
+        }
+        return written == data.size();
+    }
+
+    // Run the receive loop until `done` holds for the raw output seen so far
+    // or `timeout_us` passes. `done` sees a bounded tail of the stream.
+    template <typename Done>
+    bool receive_until(Done done, int64_t timeout_us)
+    {
+        const int64_t deadline = now_us() + timeout_us;
+        work_budget::Budget budget(kRxSliceUs, kRxBusyLimitUs);
+        budget.start();
+        while (now_us() < deadline) {
+            const ssize_t rc = libssh2_channel_read(channel_, buffer_, sizeof(buffer_) - 1);
+            if (rc > 0) {
+                wire_bytes_ += static_cast<uint64_t>(rc);
+                buffer_[rc] = '\0';
+                tail_.append(buffer_, static_cast<size_t>(rc));
+                process_received_data(buffer_, static_cast<size_t>(rc));
+                const bool finished = done(tail_);
+                if (tail_.size() > kReadBuffer) {
+                    tail_.erase(0, tail_.size() - kReadBuffer);
+                }
+                if (finished) {
+                    return true;
+                }
+            } else if (rc == LIBSSH2_ERROR_EAGAIN) {
+                flush_display_buffer();
+                wait_socket(100);
+                budget.start();
+            } else {
+                ESP_LOGE(kTag, "read error: %d", static_cast<int>(rc));
+                return false;
+            }
+            if (libssh2_channel_eof(channel_)) {
+                return false;
+            }
+            switch (budget.checkpoint()) {
+            case work_budget::Action::kYield:
+                yields_++;
+                break;
+            case work_budget::Action::kSleep:
+                sleeps_++;
+                break;
+            case work_budget::Action::kNone:
+                break;
+            }
+        }
+        return false;
+    }
+
+    bool receive_marker(const char *marker, int64_t timeout_us)
+    {
+        const bool found = receive_until(
+            [marker](std::string &tail) {
+                const size_t pos = tail.find(marker);
+                if (pos == std::string::npos) {
+                    return false;
+                }
+                tail.erase(0, pos + std::strlen(marker));
+                return true;
+            },
+            timeout_us);
+        flush_display_buffer();
+        return found;
+    }
+
+    uint64_t wire_bytes() const { return wire_bytes_; }
+    uint64_t display_bytes() const { return display_bytes_; }
+    uint32_t yields() const { return yields_; }
+    uint32_t sleeps() const { return sleeps_; }
+    void reset_counters()
+    {
+        wire_bytes_ = 0;
+        display_bytes_ = 0;
+        yields_ = 0;
+        sleeps_ = 0;
+        tail_.clear();
+    }
+
+private:
+    void wait_socket(int timeout_ms)
+    {
+        fd_set readfd;
+        FD_ZERO(&readfd);
+        FD_SET(socket_, &readfd);
+        timeval timeout = {timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+        select(socket_ + 1, &readfd, nullptr, nullptr, &timeout);
+    }
+
+    // SSHTerminal::process_received_data() without the widget.
+    void process_received_data(const char *data, size_t len)
+    {
+        screen_.feed(data, len);
+        if (now_us() / 1000 - last_display_update_ms_ >= kDisplayIntervalMs) {
+            flush_display_buffer();
+        }
+    }
+
+    // flush_display_buffer() and the show_screen() its nudge leads to.
+    void flush_display_buffer()
+    {
+        if (screen_.dirty()) {
+            display_bytes_ += screen_.render(screen_text_, sizeof(screen_text_));
+        }
+        last_display_update_ms_ = now_us() / 1000;
+    }
+
+    int socket_ = -1;
+    LIBSSH2_SESSION *session_ = nullptr;
+    LIBSSH2_CHANNEL *channel_ = nullptr;
+    char buffer_[kReadBuffer];
+    vt_screen::Screen screen_;
+    char screen_text_[vt_screen::kRenderMax];
+    std::string tail_;
+    int64_t last_display_update_ms_ = 0;
+    uint64_t wire_bytes_ = 0;
+    uint64_t display_bytes_ = 0;
+    uint32_t yields_ = 0;
+    uint32_t sleeps_ = 0;
+};
+
+bool ends_with_prompt(const std::string &tail)
+{
+    size_t end = tail.size();
+    while (end > 0 && tail[end - 1] == ' ') {
+        --end;
+    }
+    return end > 0 && std::strchr("$#>%", tail[end - 1]) != nullptr;
+}
+
+bool read_file(const std::string &path, std::string *out)
+{
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    char chunk[4096];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        out->append(chunk, n);
+    }
+    std::fclose(f);
+    return true;
+}
+
+uint32_t percentile(std::vector<uint32_t> sorted, uint32_t pct)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    const size_t rank = (sorted.size() * pct + 99) / 100;
+    return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+}
+
+bool parse_args(int argc, char **argv, Options *opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const char *value = argv[++i];
+        if (arg == "--host") {
+            opts->host = value;
+        } else if (arg == "--port") {
+            opts->port = std::atoi(value);
+        } else if (arg == "--user") {
+            opts->user = value;
+        } else if (arg == "--key") {
+            opts->key_path = value;
+        } else if (arg == "--bulk") {
+            opts->bulk_files.push_back(value);
+        } else if (arg == "--lines") {
+            opts->echo_lines = std::max(1, std::atoi(value));
+        } else if (arg == "--json") {
+            opts->json_path = value;
+        } else {
+            return false;
+        }
+    }
+    return !opts->user.empty() && !opts->key_path.empty() && opts->port > 0;
+}
+
+void write_json(FILE *f, int64_t handshake_us, int64_t auth_us, int64_t first_prompt_us,
+                const std::vector<BulkResult> &bulk, const std::vector<uint32_t> &echo_us)
+{
+    std::vector<uint32_t> sorted = echo_us;
+    std::sort(sorted.begin(), sorted.end());
+    std::fprintf(f, "{\n  \"build\": \"%s\",\n", POCKETSSH_VERSION);
+    std::fprintf(f, "  \"tick_hz\": %d,\n", configTICK_RATE_HZ);
+    std::fprintf(f, "  \"handshake_ms\": %.3f,\n  \"auth_ms\": %.3f,\n  \"first_prompt_ms\": %.3f,\n",
+                 handshake_us / 1000.0, auth_us / 1000.0, first_prompt_us / 1000.0);
+    std::fprintf(f, "  \"bulk\": [");
+    for (size_t i = 0; i < bulk.size(); ++i) {
+        const BulkResult &r = bulk[i];
+        std::fprintf(f,
+                     "%s\n    {\"file\": \"%s\", \"wire_bytes\": %" PRIu64 ", \"display_bytes\": %" PRIu64
+                     ", \"seconds\": %.3f, \"bytes_per_s\": %.0f, \"yields\": %" PRIu32
+                     ", \"sleeps\": %" PRIu32 "}",
+                     i == 0 ? "" : ",", r.file.c_str(), r.wire_bytes, r.display_bytes, r.seconds,
+                     r.seconds > 0 ? r.wire_bytes / r.seconds : 0.0, r.yields, r.sleeps);
+    }
+    std::fprintf(f, "%s],\n", bulk.empty() ? "" : "\n  ");
+    std::fprintf(f,
+                 "  \"echo_us\": {\"count\": %zu, \"p50\": %" PRIu32 ", \"p90\": %" PRIu32 ", \"p99\": %" PRIu32
+                 ", \"max\": %" PRIu32 "}\n}\n",
+                 sorted.size(), percentile(sorted, 50), percentile(sorted, 90), percentile(sorted, 99),
+                 sorted.empty() ? 0 : sorted.back());
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_args(argc, argv, &opts)) {
+        std::fprintf(stderr,
+                     "usage: ssh_bench --host H --port P --user U --key PEM [--bulk FILE]... [--lines N] "
+                     "[--json OUT]\n");
+        return 2;
+    }
+    std::string key;
+    if (!read_file(opts.key_path, &key)) {
+        std::perror(opts.key_path.c_str());
+        return 1;
+    }
+    if (libssh2_init(0) != 0) {
+        return 1;
+    }
+
+    int64_t handshake_us = 0;
+    int64_t auth_us = 0;
+    std::vector<BulkResult> bulk;
+    std::vector<uint32_t> echo_us;
+    int exit_code = 1;
+    {
+        Session session;
+        const int64_t connect_start = now_us();
+        if (!session.connect(opts, key, &handshake_us, &auth_us)) {
+            libssh2_exit();
+            return 1;
+        }
+        if (!session.receive_until(ends_with_prompt, kPromptTimeoutUs)) {
+            ESP_LOGE(kTag, "no prompt within %" PRId64 " s", kPromptTimeoutUs / 1000000);
+            libssh2_exit();
+            return 1;
+        }
+        const int64_t first_prompt_us = now_us() - connect_start;
+
+        bool ok = true;
+        for (const std::string &file : opts.bulk_files) {
+            session.reset_counters();
+            const int64_t start = now_us();
+            ok = session.write("cat '" + file + "'; " + kDoneCommand + "\n") &&
+                 session.receive_marker(kDoneMarker, kBulkTimeoutUs);
+            if (!ok) {
+                ESP_LOGE(kTag, "bulk %s did not complete", file.c_str());
+                break;
+            }
+            bulk.push_back({file, session.wire_bytes(), session.display_bytes(), session.yields(), session.sleeps(),
+                            (now_us() - start) / 1e6});
+        }
+
+        for (int i = 0; ok && i < opts.echo_lines; ++i) {
+            char line[32];
+            std::snprintf(line, sizeof(line), "#k%d", i);
+            const int64_t start = now_us();
+            ok = session.write(std::string(line) + "\n") && session.receive_marker(line, kEchoTimeoutUs);
+            echo_us.push_back(static_cast<uint32_t>(now_us() - start));
+        }
+
+        if (ok) {
+            FILE *out = opts.json_path.empty() ? stdout : std::fopen(opts.json_path.c_str(), "w");
+            if (out != nullptr) {
+                write_json(out, handshake_us, auth_us, first_prompt_us, bulk, echo_us);
+                if (out != stdout) {
+                    std::fclose(out);
+                }
+                exit_code = 0;
+            }
+        }
+    }
+    libssh2_exit();
+    return exit_code;
+}
@@ -0,0 +1,309 @@
+// Microbenchmarks for the ssh_config parser and alias resolution.
+//
+//   ssh_config_bench [--min-ms N] [--json OUT]
+//
+// Configs are generated in memory at 10 to 10,000 hosts in three shapes:
+//   plain       one literal alias per Host block, one IdentityFile
+//   wildcards   aliases plus FQDN forms, a group block with globs and a
+//               negation every 10 hosts, and a trailing `Host *`
+//   identities  eight quoted IdentityFile paths per host
+// and run through ssh_config::parse() (reported as MB/s) and resolve() for
+// a first, middle and last alias and a miss (ns and allocations per lookup).
+// wildcard_match() and split_quoted_arguments() are timed on their own with
+// inputs from the command path. Allocations are operator new calls in this
+// process; each case repeats until it has run for --min-ms (default 200).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "ssh_config.hpp"
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+}  // namespace
+
+void *operator new(size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+constexpr int kHostCounts[] = {10, 100, 1000, 10000};
+constexpr const char *kProfiles[] = {"plain", "wildcards", "identities"};
+
+struct Options {
+    double min_ms = 200;
+    std::string json_path;
+};
+
+struct Measure {
+    double ns_per_op = 0;
+    double allocs_per_op = 0;
+};
+
+struct ConfigResult {
+    std::string profile;
+    int hosts = 0;
+    size_t bytes = 0;
+    double parse_mb_s = 0;
+    double parse_allocs = 0;
+    Measure hit;
+    Measure miss;
+};
+
+struct MicroResult {
+    std::string name;
+    Measure measure;
+};
+
+// Results land here so the timed calls are not optimised away.
+volatile uint64_t sink = 0;
+
+// Run `op` in growing batches until min_ms has elapsed.
+template <typename Op>
+Measure measure(const Options &opts, Op op)
+{
+    using Clock = std::chrono::steady_clock;
+    op();  // warm-up
+    uint64_t runs = 0;
+    uint64_t batch = 1;
+    const uint64_t allocs_before = g_allocations.load();
+    const Clock::time_point start = Clock::now();
+    double elapsed_ms = 0;
+    while (elapsed_ms < opts.min_ms) {
+        for (uint64_t i = 0; i < batch; ++i) {
+            op();
+        }
+        runs += batch;
+        batch *= 2;
+        elapsed_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+    Measure m;
+    m.ns_per_op = elapsed_ms * 1e6 / runs;
+    m.allocs_per_op = static_cast<double>(g_allocations.load() - allocs_before) / runs;
+    return m;
+}
+
+std::string generate(const std::string &profile, int hosts)
+{
+    std::string out = "# generated: " + profile + "\nServerAliveInterval 30\nConnectTimeout 10\n\n";
+    char line[256];
+    for (int i = 0; i < hosts; ++i) {
+        if (profile == "wildcards") {
+            std::snprintf(line, sizeof(line), "Host web-%d web-%d.dc%d.example.com\n", i, i, i % 16);
+        } else {
+            std::snprintf(line, sizeof(line), "Host host%d\n", i);
+        }
+        out += line;
+        std::snprintf(line, sizeof(line), "    HostName 10.%d.%d.%d\n    User deploy\n    Port %d\n", (i >> 16) & 255,
+                      (i >> 8) & 255, i & 255, 2200 + i % 100);
+        out += line;
+        if (profile == "identities") {
+            for (int k = 0; k < 8; ++k) {
+                std::snprintf(line, sizeof(line), "    IdentityFile \"~/.ssh/team keys/host%d_%d.pem\"\n", i, k);
+                out += line;
+            }
+            out += "    IdentitiesOnly yes\n";
+        } else {
+            std::snprintf(line, sizeof(line), "    IdentityFile ~/.ssh/host%d.pem  # per-host key\n", i);
+            out += line;
+        }
+        if (profile == "wildcards" && i % 10 == 9) {
+            std::snprintf(line, sizeof(line),
+                          "Host *.dc%d.example.com web-%d? !*.bastion.* db-?\?-%d\n    User ops\n"
+                          "    StrictHostKeyChecking accept-new\n",
+                          i % 16, i / 10, i);
+            out += line;
+        }
+        out += "\n";
+    }
+    if (profile == "wildcards") {
+        out += "Host *\n    IdentityFile ~/.ssh/fallback.pem\n    ServerAliveCountMax 3\n";
+    }
+    return out;
+}
+
+bool parse_buffer(const std::string &text, ssh_config::Config *config)
+{
+    FILE *f = fmemopen(const_cast<char *>(text.data()), text.size(), "r");
+    if (f == nullptr) {
+        return false;
+    }
+    const bool ok = ssh_config::parse(f, config);
+    std::fclose(f);
+    return ok;
+}
+
+ConfigResult bench_config(const Options &opts, const std::string &profile, int hosts)
+{
+    ConfigResult r;
+    r.profile = profile;
+    r.hosts = hosts;
+    const std::string text = generate(profile, hosts);
+    r.bytes = text.size();
+
+    ssh_config::Config config;
+    const Measure parse = measure(opts, [&] {
+        parse_buffer(text, &config);
+        sink += config.host_blocks.size();
+    });
+    r.parse_mb_s = text.size() / (parse.ns_per_op / 1e9) / 1e6;
+    r.parse_allocs = parse.allocs_per_op;
+
+    const std::vector<std::string> &aliases = config.aliases;
+    const std::string hits[] = {aliases.front(), aliases[aliases.size() / 2], aliases.back()};
+    size_t next = 0;
+    r.hit = measure(opts, [&] {
+        ssh_config::Resolved resolved;
+        sink += ssh_config::resolve(config, hits[next++ % 3], &resolved) ? resolved.identity_files.size() : 0;
+    });
+    r.miss = measure(opts, [&] {
+        ssh_config::Resolved resolved;
+        sink += ssh_config::resolve(config, "no-such-host", &resolved) ? 1 : 0;
+    });
+    return r;
+}
+
+std::vector<MicroResult> bench_micro(const Options &opts)
+{
+    struct WildcardCase {
+        const char *name;
+        const char *pattern;
+        const char *candidate;
+    };
+    static const WildcardCase kWildcards[] = {
+        {"wildcard literal", "host4821", "host4821"},
+        {"wildcard suffix", "*.dc7.example.com", "web-4821.dc7.example.com"},
+        {"wildcard backtrack", "*a*b*c*d", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaabcx"},
+        {"wildcard miss", "db-?\?-42", "web-4821.dc7.example.com"},
+    };
+    struct SplitCase {
+        const char *name;
+        const char *input;
+        size_t start;
+    };
+    static const SplitCase kSplits[] = {
+        {"split connect", "connect \"My Home WiFi\" 'pa ss word'", 8},
+        {"split sshkey", "sshkey 192.168.1.100 22 pi default.pem", 7},
+    };
+
+    std::vector<MicroResult> results;
+    for (const WildcardCase &c : kWildcards) {
+        const std::string pattern = c.pattern;
+        const std::string candidate = c.candidate;
+        results.push_back({c.name, measure(opts, [&] { sink += ssh_config::wildcard_match(pattern, candidate); })});
+    }
+    for (const SplitCase &c : kSplits) {
+        const std::string input = c.input;
+        results.push_back(
+            {c.name, measure(opts, [&] { sink += ssh_config::split_quoted_arguments(input, c.start).size(); })});
+    }
+    return results;
+}
+
+bool parse_args(int argc, char **argv, Options *opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--min-ms" && i + 1 < argc) {
+            opts->min_ms = std::max(1.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--json" && i + 1 < argc) {
+            opts->json_path = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_tables(const std::vector<ConfigResult> &configs, const std::vector<MicroResult> &micro)
+{
+    std::printf("%-10s %6s %9s %9s %11s %12s %10s %12s %10s\n", "PROFILE", "HOSTS", "BYTES", "PARSE_MB/S",
+                "PARSE_ALLOC", "HIT_NS", "HIT_ALLOC", "MISS_NS", "MISS_ALLOC");
+    for (const ConfigResult &r : configs) {
+        std::printf("%-10s %6d %9zu %9.2f %11.0f %12.0f %10.0f %12.0f %10.0f\n", r.profile.c_str(), r.hosts, r.bytes,
+                    r.parse_mb_s, r.parse_allocs, r.hit.ns_per_op, r.hit.allocs_per_op, r.miss.ns_per_op,
+                    r.miss.allocs_per_op);
+    }
+    std::printf("\n%-20s %10s %8s\n", "CALL", "NS", "ALLOCS");
+    for (const MicroResult &r : micro) {
+        std::printf("%-20s %10.1f %8.1f\n", r.name.c_str(), r.measure.ns_per_op, r.measure.allocs_per_op);
+    }
+}
+
+bool write_json(const std::string &path, const std::vector<ConfigResult> &configs,
+                const std::vector<MicroResult> &micro)
+{
+    FILE *f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) {
+        std::perror(path.c_str());
+        return false;
+    }
+    std::fprintf(f, "{\n  \"build\": \"%s\",\n  \"configs\": [", POCKETSSH_VERSION);
+    for (size_t i = 0; i < configs.size(); ++i) {
+        const ConfigResult &r = configs[i];
+        std::fprintf(f,
+                     "%s\n    {\"profile\": \"%s\", \"hosts\": %d, \"bytes\": %zu, \"parse_mb_s\": %.3f"
+                     ", \"parse_allocs\": %.0f, \"hit_ns\": %.0f, \"hit_allocs\": %.1f, \"miss_ns\": %.0f"
+                     ", \"miss_allocs\": %.1f}",
+                     i == 0 ? "" : ",", r.profile.c_str(), r.hosts, r.bytes, r.parse_mb_s, r.parse_allocs,
+                     r.hit.ns_per_op, r.hit.allocs_per_op, r.miss.ns_per_op, r.miss.allocs_per_op);
+    }
+    std::fprintf(f, "\n  ],\n  \"calls\": [");
+    for (size_t i = 0; i < micro.size(); ++i) {
+        std::fprintf(f, "%s\n    {\"name\": \"%s\", \"ns\": %.1f, \"allocs\": %.1f}", i == 0 ? "" : ",",
+                     micro[i].name.c_str(), micro[i].measure.ns_per_op, micro[i].measure.allocs_per_op);
+    }
+    std::fprintf(f, "\n  ]\n}\n");
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Options opts;
+    if (!parse_args(argc, argv, &opts)) {
+        std::fprintf(stderr, "usage: ssh_config_bench [--min-ms N] [--json OUT]\n");
+        return 2;
+    }
+
+    std::vector<ConfigResult> configs;
+    for (const char *profile : kProfiles) {
+        for (const int hosts : kHostCounts) {
+            configs.push_back(bench_config(opts, profile, hosts));
+        }
+    }
+    const std::vector<MicroResult> micro = bench_micro(opts);
+
+    print_tables(configs, micro);
+    if (!opts.json_path.empty() && !write_json(opts.json_path, configs, micro)) {
+        return 1;
+    }
+    return 0;
+}
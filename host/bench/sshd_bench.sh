@@ -0,0 +1,57 @@
+#!/bin/sh
+# Run ssh_bench against a throwaway sshd on 127.0.0.1.
+#
+#   host/bench/sshd_bench.sh <build-dir>/ssh_bench [out.json] [MB sizes...]
+#
+# Generates host and user keys, 1/10/100 MB text files (base64, 76-column
+# lines) and an sshd_config in a temp dir, starts sshd as the current user
+# (no PAM, key auth only) and removes everything on exit. SSHD_PORT and
+# SSHD override the port (default 22022) and the sshd binary.
+set -eu
+
+BENCH=${1:?usage: sshd_bench.sh <ssh_bench> [out.json] [MB sizes...]}
+OUT=${2:-ssh_bench.json}
+[ $# -ge 2 ] && shift 2 || shift $#
+SIZES=${*:-1 10 100}
+PORT=${SSHD_PORT:-22022}
+SSHD=${SSHD:-$(command -v sshd || echo /usr/sbin/sshd)}
+
+WORK=$(mktemp -d)
+SSHD_PID=
+cleanup() {
+    [ -n "$SSHD_PID" ] && kill "$SSHD_PID" 2>/dev/null || true
+    rm -rf "$WORK"
+}
+trap cleanup EXIT INT TERM
+
+ssh-keygen -q -t ed25519 -N '' -f "$WORK/host_key"
+# PEM RSA, the format the device loads from /sdcard/ssh_keys.
+ssh-keygen -q -t rsa -b 2048 -m PEM -N '' -f "$WORK/user_key"
+cp "$WORK/user_key.pub" "$WORK/authorized_keys"
+
+cat > "$WORK/sshd_config" <<CONF
+Port $PORT
+ListenAddress 127.0.0.1
+HostKey $WORK/host_key
+PidFile $WORK/sshd.pid
+AuthorizedKeysFile $WORK/authorized_keys
+PubkeyAuthentication yes
+PasswordAuthentication no
+KbdInteractiveAuthentication no
+UsePAM no
+StrictModes no
+LogLevel ERROR
+CONF
+
+BULK_ARGS=
+for mb in $SIZES; do
+    base64 /dev/urandom | head -c $((mb * 1048576)) > "$WORK/bulk_${mb}mb.txt"
+    BULK_ARGS="$BULK_ARGS --bulk $WORK/bulk_${mb}mb.txt"
+done
+
+"$SSHD" -D -e -f "$WORK/sshd_config" &
+SSHD_PID=$!
+
+# shellcheck disable=SC2086
+"$BENCH" --host 127.0.0.1 --port "$PORT" --user "$(id -un)" --key "$WORK/user_key" $BULK_ARGS --json "$OUT"
+echo "wrote $OUT"
@@ -0,0 +1,67 @@
+#!/bin/sh
+# Regenerate the replay corpus: real terminal output captured through a PTY
+# with `script`, as an 80x24 vt100 (the PTY type SSHTerminal requests).
+# Each stream is capped at 64 KB to keep the repo small.
+#
+#   host/corpus/capture.sh [out-dir]
+set -eu
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$HERE/../.." && pwd)
+OUT=${1:-$HERE}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT INT TERM
+export TERM=vt100
+
+capture() {
+    name=$1
+    shift
+    timeout 30 script -q -c "stty cols 80 rows 24; $*" --log-out "$WORK/raw" </dev/null >/dev/null || true
+    # Drop script's "Script started/done" lines.
+    sed '1d;$d' "$WORK/raw" | head -c 65536 > "$OUT/$name.bin"
+    echo "$name.bin: $(wc -c < "$OUT/$name.bin") bytes"
+}
+
+cat > "$WORK/broken.c" <<'SRC'
+#include <stdio.h>
+struct point { int x, y; };
+int area(struct point *p) { return p->x * p->z; }
+int main(void) {
+    unsigned n = -1;
+    int values[4];
+    for (int i = 0; i <= 4; i++) values[i] = i;
+    printf("%s\n", n);
+    return area(NULL) + undefined_call(values);
+}
+SRC
+
+capture git_log_color "git -C '$REPO' --no-pager log --color=always --stat -40"
+capture gcc_diagnostics "cd '$WORK' && gcc -fdiagnostics-color=always -Wall -Wextra -c broken.c -o /dev/null"
+capture ls_color "ls -la --color=always /usr/include /usr/include/linux"
+# top restricted to a few processes of our own so the capture is stable and
+# shows nothing of the host it ran on.
+timeout 10 sh -c 'while :; do :; done' &
+BUSY=$!
+sleep 30 &
+IDLE=$!
+capture top "top -d 0.3 -n 6 -p $BUSY,$IDLE"
+kill "$BUSY" "$IDLE" 2>/dev/null || true
+
+cp "$REPO/main/terminal_text.cpp" "$WORK/edit.cpp"
+cat > "$WORK/edit.vim" <<'VIM'
+set number hlsearch
+syntax on
+redraw!
+/vTaskDelay
+redraw!
+normal! ddpkyyP
+redraw!
+normal! Go// edited in the corpus capture
+redraw!
+normal! gg
+redraw!
+normal! 40j
+redraw!
+q!
+VIM
+capture vim_edit "cd '$WORK' && vim -u NONE -N -n -i NONE -S edit.vim edit.cpp"
@@ -0,0 +1,344 @@
+#include "panel_recorder.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <string>
+
+#include "esp_lcd_panel_commands.h"
+
+namespace panel_recorder {
+namespace {
+
+constexpr uint16_t kGramSide = std::max(kGramWidth, kGramHeight);
+
+struct State {
+    std::vector<Transfer> transfers;
+    std::vector<uint16_t> gram = std::vector<uint16_t>(static_cast<size_t>(kGramSide) * kGramSide, 0);
+    Window window;
+    uint8_t madctl = 0;
+    uint8_t colmod = 0x55;
+    // RAMWR write pointer inside `window`, and a half-received pixel.
+    uint16_t x = 0;
+    uint16_t y = 0;
+    bool has_high = false;
+    uint8_t high = 0;
+};
+
+// esp_lcd_panel_io_t first, so the handle converts back to the recorder.
+struct Io {
+    esp_lcd_panel_io_t base;
+    State *state;
+};
+static_assert(offsetof(Io, base) == 0, "Io handle must start with esp_lcd_panel_io_t");
+
+State &state_of(esp_lcd_panel_io_handle_t io)
+{
+    return *reinterpret_cast<Io *>(io)->state;
+}
+
+uint16_t address_columns(const State &s)
+{
+    return (s.madctl & LCD_CMD_MV_BIT) ? kGramHeight : kGramWidth;
+}
+
+uint16_t address_rows(const State &s)
+{
+    return (s.madctl & LCD_CMD_MV_BIT) ? kGramWidth : kGramHeight;
+}
+
+Window decode_range(const uint8_t *p, bool columns, Window window)
+{
+    const uint16_t start = static_cast<uint16_t>(p[0] << 8 | p[1]);
+    const uint16_t end = static_cast<uint16_t>(p[2] << 8 | p[3]);
+    if (columns) {
+        window.x0 = start;
+        window.x1 = end;
+    } else {
+        window.y0 = start;
+        window.y1 = end;
+    }
+    return window;
+}
+
+void write_pixels(State &s, const uint8_t *data, size_t len)
+{
+    if (s.colmod != 0x55 || s.window.width() == 0 || s.window.height() == 0) {
+        return;
+    }
+    const uint16_t cols = address_columns(s);
+    const uint16_t rows = address_rows(s);
+    for (size_t i = 0; i < len; ++i) {
+        if (!s.has_high) {
+            s.high = data[i];
+            s.has_high = true;
+            continue;
+        }
+        s.has_high = false;
+        if (s.x < cols && s.y < rows) {
+            s.gram[static_cast<size_t>(s.y) * kGramSide + s.x] = static_cast<uint16_t>(s.high << 8 | data[i]);
+        }
+        // The controller wraps to the next row, then back to the top.
+        if (++s.x > s.window.x1) {
+            s.x = s.window.x0;
+            if (++s.y > s.window.y1) {
+                s.y = s.window.y0;
+            }
+        }
+    }
+}
+
+esp_err_t tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    State &s = state_of(io);
+    const auto *p = static_cast<const uint8_t *>(param);
+    if (param_size > 0 && p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    switch (lcd_cmd) {
+    case LCD_CMD_CASET:
+    case LCD_CMD_RASET:
+        if (param_size != 4) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        s.window = decode_range(p, lcd_cmd == LCD_CMD_CASET, s.window);
+        break;
+    case LCD_CMD_MADCTL:
+        if (param_size >= 1) {
+            s.madctl = p[0];
+        }
+        break;
+    case LCD_CMD_COLMOD:
+        if (param_size >= 1) {
+            s.colmod = p[0];
+        }
+        break;
+    default:
+        break;
+    }
+
+    Transfer t;
+    t.cmd = lcd_cmd;
+    t.bytes = static_cast<uint32_t>(param_size);
+    t.window = s.window;
+    s.transfers.push_back(t);
+    return ESP_OK;
+}
+
+esp_err_t tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    State &s = state_of(io);
+    if (color_size > 0 && color == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (lcd_cmd == LCD_CMD_RAMWR) {
+        s.x = s.window.x0;
+        s.y = s.window.y0;
+        s.has_high = false;
+    }
+    write_pixels(s, static_cast<const uint8_t *>(color), color_size);
+
+    Transfer t;
+    t.cmd = lcd_cmd;
+    t.color = true;
+    t.bytes = static_cast<uint32_t>(color_size);
+    t.window = s.window;
+    s.transfers.push_back(t);
+    return ESP_OK;
+}
+
+esp_err_t del(esp_lcd_panel_io_t *io)
+{
+    auto *handle = reinterpret_cast<Io *>(io);
+    delete handle->state;
+    delete handle;
+    return ESP_OK;
+}
+
+void put_u32(std::string *out, uint32_t v)
+{
+    out->push_back(static_cast<char>(v >> 24));
+    out->push_back(static_cast<char>(v >> 16));
+    out->push_back(static_cast<char>(v >> 8));
+    out->push_back(static_cast<char>(v));
+}
+
+uint32_t crc32(const std::string &data, size_t from)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = from; i < data.size(); ++i) {
+        crc ^= static_cast<uint8_t>(data[i]);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+void put_chunk(std::string *png, const char *type, const std::string &payload)
+{
+    put_u32(png, static_cast<uint32_t>(payload.size()));
+    const size_t start = png->size();
+    png->append(type, 4);
+    png->append(payload);
+    put_u32(png, crc32(*png, start));
+}
+
+// zlib stream of stored (uncompressed) deflate blocks: no dependency, and
+// the files stay small enough at this resolution.
+std::string zlib_stored(const std::string &raw)
+{
+    constexpr size_t kBlockMax = 65535;
+    std::string out = "\x78\x01";
+    size_t offset = 0;
+    do {
+        const size_t len = std::min(kBlockMax, raw.size() - offset);
+        const bool last = offset + len == raw.size();
+        out.push_back(last ? 1 : 0);
+        out.push_back(static_cast<char>(len & 0xFF));
+        out.push_back(static_cast<char>(len >> 8));
+        out.push_back(static_cast<char>(~len & 0xFF));
+        out.push_back(static_cast<char>((~len >> 8) & 0xFF));
+        out.append(raw, offset, len);
+        offset += len;
+    } while (offset < raw.size());
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (const char c : raw) {
+        a = (a + static_cast<uint8_t>(c)) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_u32(&out, b << 16 | a);
+    return out;
+}
+
+}  // namespace
+
+esp_lcd_panel_io_handle_t create()
+{
+    auto *handle = new Io();
+    handle->base.tx_param = tx_param;
+    handle->base.tx_color = tx_color;
+    handle->base.del = del;
+    handle->state = new State();
+    return &handle->base;
+}
+
+const std::vector<Transfer> &transfers(esp_lcd_panel_io_handle_t io)
+{
+    return state_of(io).transfers;
+}
+
+Totals totals(esp_lcd_panel_io_handle_t io, size_t since)
+{
+    const std::vector<Transfer> &all = state_of(io).transfers;
+    Totals t;
+    for (size_t i = since; i < all.size(); ++i) {
+        const Transfer &tr = all[i];
+        if (tr.cmd >= 0) {
+            t.commands++;
+        }
+        if (tr.color) {
+            t.color_calls++;
+            t.color_bytes += tr.bytes;
+        } else {
+            t.param_calls++;
+            t.param_bytes += tr.bytes;
+        }
+    }
+    return t;
+}
+
+void clear(esp_lcd_panel_io_handle_t io)
+{
+    state_of(io).transfers.clear();
+}
+
+uint16_t columns(esp_lcd_panel_io_handle_t io)
+{
+    return address_columns(state_of(io));
+}
+
+uint16_t rows(esp_lcd_panel_io_handle_t io)
+{
+    return address_rows(state_of(io));
+}
+
+uint16_t pixel(esp_lcd_panel_io_handle_t io, uint16_t x, uint16_t y)
+{
+    const State &s = state_of(io);
+    if (x >= address_columns(s) || y >= address_rows(s)) {
+        return 0;
+    }
+    return s.gram[static_cast<size_t>(y) * kGramSide + x];
+}
+
+void dump(esp_lcd_panel_io_handle_t io, FILE *out, size_t since)
+{
+    const std::vector<Transfer> &all = state_of(io).transfers;
+    for (size_t i = since; i < all.size(); ++i) {
+        const Transfer &t = all[i];
+        if (t.cmd >= 0) {
+            std::fprintf(out, "%5zu cmd 0x%02X", i, t.cmd);
+        } else {
+            std::fprintf(out, "%5zu cmd  --", i);
+        }
+        std::fprintf(out, " %-5s %7" PRIu32 " B", t.color ? "color" : "param", t.bytes);
+        if (t.color) {
+            std::fprintf(out, "  [%u,%u]-[%u,%u] %" PRIu32 "x%" PRIu32, t.window.x0, t.window.y0, t.window.x1,
+                         t.window.y1, t.window.width(), t.window.height());
+        }
+        std::fputc('\n', out);
+    }
+}
+
+bool write_png(esp_lcd_panel_io_handle_t io, const char *path, const Window *crop)
+{
+    Window area;
+    area.x1 = static_cast<uint16_t>(columns(io) - 1);
+    area.y1 = static_cast<uint16_t>(rows(io) - 1);
+    if (crop != nullptr) {
+        area.x0 = std::min(crop->x0, area.x1);
+        area.y0 = std::min(crop->y0, area.y1);
+        area.x1 = std::min(crop->x1, area.x1);
+        area.y1 = std::min(crop->y1, area.y1);
+    }
+    if (path == nullptr || area.width() == 0 || area.height() == 0) {
+        return false;
+    }
+
+    std::string raw;
+    raw.reserve(static_cast<size_t>(area.width() * 3 + 1) * area.height());
+    for (uint32_t y = area.y0; y <= area.y1; ++y) {
+        raw.push_back(0);  // filter: none
+        for (uint32_t x = area.x0; x <= area.x1; ++x) {
+            const uint16_t c = pixel(io, static_cast<uint16_t>(x), static_cast<uint16_t>(y));
+            const uint8_t r = static_cast<uint8_t>((c >> 11) & 0x1F);
+            const uint8_t g = static_cast<uint8_t>((c >> 5) & 0x3F);
+            const uint8_t b = static_cast<uint8_t>(c & 0x1F);
+            raw.push_back(static_cast<char>(r << 3 | r >> 2));
+            raw.push_back(static_cast<char>(g << 2 | g >> 4));
+            raw.push_back(static_cast<char>(b << 3 | b >> 2));
+        }
+    }
+
+    std::string header;
+    put_u32(&header, area.width());
+    put_u32(&header, area.height());
+    header.append("\x08\x02\x00\x00\x00", 5);  // 8-bit RGB, no interlace
+
+    std::string png = "\x89PNG\r\n\x1a\n";
+    put_chunk(&png, "IHDR", header);
+    put_chunk(&png, "IDAT", zlib_stored(raw));
+    put_chunk(&png, "IEND", std::string());
+
+    FILE *f = std::fopen(path, "wb");
+    if (f == nullptr) {
+        std::perror(path);
+        return false;
+    }
+    const bool ok = std::fwrite(png.data(), 1, png.size(), f) == png.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+}  // namespace panel_recorder
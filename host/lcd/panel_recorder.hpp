@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "esp_lcd_panel_io.h"
+
+// Host esp_lcd panel IO that stands in for the SPI bus under a real panel
+// driver. Every tx_param/tx_color call is recorded with the CASET/RASET
+// window in effect, and RAMWR data is written into a model of the
+// controller's GRAM so the result can be saved as a PNG.
+namespace panel_recorder {
+
+// Inclusive column/row range, as sent in CASET/RASET.
+struct Window {
+    uint16_t x0 = 0;
+    uint16_t y0 = 0;
+    uint16_t x1 = 0;
+    uint16_t y1 = 0;
+
+    uint32_t width() const { return x1 >= x0 ? x1 - x0 + 1u : 0u; }
+    uint32_t height() const { return y1 >= y0 ? y1 - y0 + 1u : 0u; }
+};
+
+struct Transfer {
+    int cmd = -1;        // -1: data only (continues the previous RAMWR)
+    bool color = false;  // tx_color (pixel data) rather than tx_param
+    uint32_t bytes = 0;  // payload, without the command byte
+    Window window;       // address window in effect
+};
+
+struct Totals {
+    uint32_t commands = 0;  // 8-bit command bytes sent
+    uint32_t param_calls = 0;
+    uint32_t color_calls = 0;
+    uint64_t param_bytes = 0;
+    uint64_t color_bytes = 0;
+
+    uint64_t wire_bytes() const { return commands + param_bytes + color_bytes; }
+};
+
+// ST7796 GRAM is 320 columns by 480 rows; MADCTL.MV swaps the two address
+// ranges. Only COLMOD 0x55 (RGB565, MSB first) pixel data is modelled.
+constexpr uint16_t kGramWidth = 320;
+constexpr uint16_t kGramHeight = 480;
+
+// Release with esp_lcd_panel_io_del().
+esp_lcd_panel_io_handle_t create();
+
+const std::vector<Transfer> &transfers(esp_lcd_panel_io_handle_t io);
+// Totals over transfers()[since..].
+Totals totals(esp_lcd_panel_io_handle_t io, size_t since = 0);
+// Drop the recorded transfers; GRAM and controller state are kept.
+void clear(esp_lcd_panel_io_handle_t io);
+
+// Current column x row address space (480x320 once MV is set).
+uint16_t columns(esp_lcd_panel_io_handle_t io);
+uint16_t rows(esp_lcd_panel_io_handle_t io);
+uint16_t pixel(esp_lcd_panel_io_handle_t io, uint16_t x, uint16_t y);
+
+// One line per transfer: command, kind, bytes and window.
+void dump(esp_lcd_panel_io_handle_t io, FILE *out, size_t since = 0);
+
+// Write `crop` (default: the whole address space) as an 8-bit RGB PNG.
+// Pixels are shown as written; MADCTL mirroring and INVON are not applied.
+bool write_png(esp_lcd_panel_io_handle_t io, const char *path, const Window *crop = nullptr);
+
+}  // namespace panel_recorder
@@ -0,0 +1,105 @@
+#include "headless_display.hpp"
+
+#include <vector>
+
+#include "esp_lcd_panel_ops.h"
+#include "esp_timer.h"
+
+namespace headless_display {
+namespace {
+
+struct State {
+    std::vector<uint16_t> pixels;
+    std::vector<uint16_t> second;
+    esp_lcd_panel_handle_t panel = nullptr;
+    Stats stats;
+};
+
+uint32_t tick_ms()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+// Direct mode renders straight into the framebuffer, so flushing only has
+// to account for the area.
+void flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *)
+{
+    auto *state = static_cast<State *>(lv_display_get_user_data(display));
+    state->stats.flushes++;
+    state->stats.pixels += static_cast<uint64_t>(lv_area_get_width(area)) * lv_area_get_height(area);
+    lv_display_flush_ready(display);
+}
+
+void panel_flush_cb(lv_display_t *display, const lv_area_t *area, uint8_t *px_map)
+{
+    auto *state = static_cast<State *>(lv_display_get_user_data(display));
+    const uint32_t pixels = static_cast<uint32_t>(lv_area_get_width(area)) * lv_area_get_height(area);
+    state->stats.flushes++;
+    state->stats.pixels += pixels;
+    // The ST7796 takes RGB565 MSB first (esp_lvgl_port's swap_bytes flag).
+    lv_draw_sw_rgb565_swap(px_map, pixels);
+    esp_lcd_panel_draw_bitmap(state->panel, area->x1, area->y1, area->x2 + 1, area->y2 + 1, px_map);
+    lv_display_flush_ready(display);
+}
+
+void ensure_lvgl()
+{
+    if (!lv_is_initialized()) {
+        lv_init();
+        lv_tick_set_cb(tick_ms);
+    }
+}
+
+}  // namespace
+
+lv_display_t *create(int32_t width, int32_t height)
+{
+    ensure_lvgl();
+
+    auto *state = new State();
+    state->pixels.assign(static_cast<size_t>(width) * height, 0);
+
+    lv_display_t *display = lv_display_create(width, height);
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_user_data(display, state);
+    lv_display_set_buffers(display, state->pixels.data(), nullptr, state->pixels.size() * sizeof(uint16_t),
+                           LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_cb(display, flush_cb);
+    return display;
+}
+
+lv_display_t *create_panel(int32_t width, int32_t height, int32_t buffer_lines, esp_lcd_panel_handle_t panel)
+{
+    ensure_lvgl();
+
+    auto *state = new State();
+    state->panel = panel;
+    state->pixels.assign(static_cast<size_t>(width) * buffer_lines, 0);
+    state->second.assign(state->pixels.size(), 0);
+
+    lv_display_t *display = lv_display_create(width, height);
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_user_data(display, state);
+    lv_display_set_buffers(display, state->pixels.data(), state->second.data(),
+                           state->pixels.size() * sizeof(uint16_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display, panel_flush_cb);
+    return display;
+}
+
+void refresh(lv_display_t *display)
+{
+    lv_timer_handler();
+    lv_refr_now(display);
+}
+
+const uint16_t *framebuffer(lv_display_t *display)
+{
+    return static_cast<State *>(lv_display_get_user_data(display))->pixels.data();
+}
+
+Stats stats(lv_display_t *display)
+{
+    return static_cast<State *>(lv_display_get_user_data(display))->stats;
+}
+
+}  // namespace headless_display
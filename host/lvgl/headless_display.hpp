@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esp_lcd_types.h"
+#include "lvgl.h"
+
+// LVGL display rendered into an in-memory RGB565 framebuffer, for driving
+// the UI code on Linux. LVGL's tick comes from esp_timer_get_time().
+namespace headless_display {
+
+struct Stats {
+    uint32_t flushes = 0;
+    uint64_t pixels = 0;  // sum of flushed area sizes
+};
+
+// Initializes LVGL on first use. Displays live until process exit.
+lv_display_t *create(int32_t width, int32_t height);
+
+// Partial-mode display flushing into an esp_lcd panel the way esp_lvgl_port
+// does on the device: two `buffer_lines`-high buffers, byte-swapped RGB565,
+// one esp_lcd_panel_draw_bitmap() per flushed area. framebuffer() is not
+// available for these; read the panel side instead.
+lv_display_t *create_panel(int32_t width, int32_t height, int32_t buffer_lines, esp_lcd_panel_handle_t panel);
+
+// Render every invalidated area now.
+void refresh(lv_display_t *display);
+
+// Row-major width x height pixels (create() displays only).
+const uint16_t *framebuffer(lv_display_t *display);
+Stats stats(lv_display_t *display);
+
+}  // namespace headless_display
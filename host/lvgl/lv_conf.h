@@ -0,0 +1,25 @@
+/*
+ * LVGL configuration for the host build. Mirrors the firmware's sdkconfig
+ * where it matters for rendering (RGB565, Montserrat 10/12/14); everything
+ * else keeps LVGL's defaults.
+ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_CLIB
+
+#define LV_USE_OS LV_OS_NONE
+#define LV_USE_LOG 0
+
+#define LV_FONT_MONTSERRAT_10 1
+#define LV_FONT_MONTSERRAT_12 1
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_DEFAULT &lv_font_montserrat_14
+
+#define LV_BUILD_EXAMPLES 0
+
+#endif
@@ -0,0 +1,97 @@
+// Host shim: esp_lcd dispatch and no-op GPIO, enough to run the vendored
+// panel drivers (main/esp_lcd_st7796.c) over a host panel IO.
+
+#include "driver/gpio.h"
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+
+extern "C" {
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return config != nullptr ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t, uint32_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size)
+{
+    if (io == nullptr || io->tx_param == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return io->tx_param(io, lcd_cmd, param, param_size);
+}
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size)
+{
+    if (io == nullptr || io->tx_color == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return io->tx_color(io, lcd_cmd, color, color_size);
+}
+
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io)
+{
+    if (io == nullptr || io->del == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return io->del(io);
+}
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    return panel != nullptr ? panel->reset(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    return panel != nullptr ? panel->init(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_del(esp_lcd_panel_handle_t panel)
+{
+    return panel != nullptr ? panel->del(panel) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end,
+                                    const void *color_data)
+{
+    return panel != nullptr ? panel->draw_bitmap(panel, x_start, y_start, x_end, y_end, color_data)
+                            : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_mirror(esp_lcd_panel_handle_t panel, bool mirror_x, bool mirror_y)
+{
+    return panel != nullptr ? panel->mirror(panel, mirror_x, mirror_y) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_swap_xy(esp_lcd_panel_handle_t panel, bool swap_axes)
+{
+    return panel != nullptr ? panel->swap_xy(panel, swap_axes) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_set_gap(esp_lcd_panel_handle_t panel, int x_gap, int y_gap)
+{
+    return panel != nullptr ? panel->set_gap(panel, x_gap, y_gap) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert_color_data)
+{
+    return panel != nullptr ? panel->invert_color(panel, invert_color_data) : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on_off)
+{
+    return panel != nullptr ? panel->disp_on_off(panel, on_off) : ESP_ERR_INVALID_ARG;
+}
+
+}  // extern "C"
@@ -0,0 +1,156 @@
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+namespace {
+
+struct ErrName {
+    esp_err_t code;
+    const char *name;
+};
+
+constexpr ErrName kErrNames[] = {
+    {ESP_OK, "ESP_OK"},
+    {ESP_FAIL, "ESP_FAIL"},
+    {ESP_ERR_NO_MEM, "ESP_ERR_NO_MEM"},
+    {ESP_ERR_INVALID_ARG, "ESP_ERR_INVALID_ARG"},
+    {ESP_ERR_INVALID_STATE, "ESP_ERR_INVALID_STATE"},
+    {ESP_ERR_INVALID_SIZE, "ESP_ERR_INVALID_SIZE"},
+    {ESP_ERR_NOT_FOUND, "ESP_ERR_NOT_FOUND"},
+    {ESP_ERR_NOT_SUPPORTED, "ESP_ERR_NOT_SUPPORTED"},
+    {ESP_ERR_TIMEOUT, "ESP_ERR_TIMEOUT"},
+    {ESP_ERR_NVS_NOT_INITIALIZED, "ESP_ERR_NVS_NOT_INITIALIZED"},
+    {ESP_ERR_NVS_NOT_FOUND, "ESP_ERR_NVS_NOT_FOUND"},
+    {ESP_ERR_NVS_TYPE_MISMATCH, "ESP_ERR_NVS_TYPE_MISMATCH"},
+    {ESP_ERR_NVS_READ_ONLY, "ESP_ERR_NVS_READ_ONLY"},
+    {ESP_ERR_NVS_INVALID_HANDLE, "ESP_ERR_NVS_INVALID_HANDLE"},
+    {ESP_ERR_NVS_KEY_TOO_LONG, "ESP_ERR_NVS_KEY_TOO_LONG"},
+    {ESP_ERR_NVS_INVALID_LENGTH, "ESP_ERR_NVS_INVALID_LENGTH"},
+};
+
+esp_log_level_t initial_log_level()
+{
+    const char *env = std::getenv("POCKETSSH_LOG");
+    if (env == nullptr || env[0] == '\0') {
+        return ESP_LOG_WARN;
+    }
+    switch (env[0]) {
+    case 'n': return ESP_LOG_NONE;
+    case 'e': return ESP_LOG_ERROR;
+    case 'w': return ESP_LOG_WARN;
+    case 'i': return ESP_LOG_INFO;
+    case 'd': return ESP_LOG_DEBUG;
+    case 'v': return ESP_LOG_VERBOSE;
+    default: return ESP_LOG_WARN;
+    }
+}
+
+esp_log_level_t g_log_level = initial_log_level();
+
+int64_t monotonic_us()
+{
+    timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+}  // namespace
+
+extern "C" {
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    for (const ErrName &entry : kErrNames) {
+        if (entry.code == code) {
+            return entry.name;
+        }
+    }
+    return "UNKNOWN ERROR";
+}
+
+void esp_error_check_failed(esp_err_t rc, const char *expr, const char *file, int line)
+{
+    if (rc == ESP_OK) {
+        return;
+    }
+    std::fprintf(stderr, "ESP_ERROR_CHECK failed: %s (0x%x) at %s:%d\n  %s\n", esp_err_to_name(rc), rc, file,
+                 line, expr);
+    std::abort();
+}
+
+// Per-tag levels are not tracked; any tag sets the global level.
+void esp_log_level_set(const char *, esp_log_level_t level)
+{
+    g_log_level = level;
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    if (level > g_log_level || level == ESP_LOG_NONE) {
+        return;
+    }
+    static const char kLetters[] = "NEWIDV";
+    std::fprintf(stderr, "%c (%lld) %s: ", kLetters[level], static_cast<long long>(esp_timer_get_time() / 1000),
+                 tag);
+    va_list args;
+    va_start(args, format);
+    std::vfprintf(stderr, format, args);
+    va_end(args);
+    std::fputc('\n', stderr);
+}
+
+int64_t esp_timer_get_time(void)
+{
+    // Function-local so other translation units' static initializers see a
+    // sane clock.
+    static const int64_t start_us = monotonic_us();
+    return monotonic_us() - start_us;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t)
+{
+    return std::malloc(size);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t)
+{
+    return std::calloc(n, size);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t)
+{
+    return std::realloc(ptr, size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    std::free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t)
+{
+    return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t)
+{
+    return 0;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t)
+{
+    return 0;
+}
+
+size_t heap_caps_get_total_size(uint32_t)
+{
+    return 0;
+}
+
+}  // extern "C"
@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+struct tskTaskControlBlock {
+    std::string name;
+    UBaseType_t number = 0;
+    UBaseType_t priority = 0;
+    BaseType_t core = tskNO_AFFINITY;
+    std::mutex notify_lock;
+    std::condition_variable notify_cv;
+    uint32_t notify_value = 0;
+};
+
+// Semaphores use `mutex`; item queues use the rest.
+struct QueueDefinition {
+    std::recursive_timed_mutex mutex;
+
+    std::mutex lock;
+    std::condition_variable changed;
+    std::vector<uint8_t> owned;
+    uint8_t *storage = nullptr;
+    size_t item_size = 0;
+    size_t length = 0;
+    size_t head = 0;
+    size_t count = 0;
+};
+
+namespace {
+
+constexpr const char *kTag = "freertos_shim";
+
+std::mutex g_tasks_lock;
+std::vector<tskTaskControlBlock *> g_tasks;
+// Deleted tasks' control blocks stay allocated: a stale handle held by
+// another thread must not point at freed memory.
+std::vector<tskTaskControlBlock *> g_retired;
+UBaseType_t g_next_number = 1;
+thread_local tskTaskControlBlock *t_current = nullptr;
+
+tskTaskControlBlock *register_task(const char *name, UBaseType_t priority, BaseType_t core)
+{
+    auto *tcb = new tskTaskControlBlock();
+    tcb->name.assign(name != nullptr ? name : "", 0, configMAX_TASK_NAME_LEN - 1);
+    tcb->priority = priority;
+    tcb->core = core;
+    std::lock_guard<std::mutex> guard(g_tasks_lock);
+    tcb->number = g_next_number++;
+    g_tasks.push_back(tcb);
+    return tcb;
+}
+
+void retire_task(tskTaskControlBlock *tcb)
+{
+    std::lock_guard<std::mutex> guard(g_tasks_lock);
+    g_tasks.erase(std::remove(g_tasks.begin(), g_tasks.end(), tcb), g_tasks.end());
+    g_retired.push_back(tcb);
+}
+
+// The thread that calls in first without being created here (normally
+// main()) is registered on demand as "main".
+tskTaskControlBlock *current_task()
+{
+    if (t_current == nullptr) {
+        t_current = register_task("main", 1, 0);
+    }
+    return t_current;
+}
+
+// Wait on `queue->changed` until `ready` holds or the ticks run out.
+template <typename Ready>
+bool wait_queue(QueueDefinition *queue, std::unique_lock<std::mutex> *lock, TickType_t ticks_to_wait, Ready ready)
+{
+    if (ticks_to_wait == portMAX_DELAY) {
+        queue->changed.wait(*lock, ready);
+        return true;
+    }
+    return queue->changed.wait_for(*lock,
+                                   std::chrono::milliseconds(static_cast<int64_t>(ticks_to_wait) * portTICK_PERIOD_MS),
+                                   ready);
+}
+
+tskTaskControlBlock *start_thread(TaskFunction_t fn, const char *name, void *arg, UBaseType_t priority,
+                                  BaseType_t core_id)
+{
+    tskTaskControlBlock *tcb = register_task(name, priority, core_id);
+    std::thread([tcb, fn, arg]() {
+        t_current = tcb;
+        fn(arg);
+        // A FreeRTOS task must not return; treat it like vTaskDelete(NULL).
+        ESP_LOGW(kTag, "task %s returned", tcb->name.c_str());
+        retire_task(tcb);
+    }).detach();
+    return tcb;
+}
+
+}  // namespace
+
+extern "C" {
+
+BaseType_t xPortGetCoreID(void)
+{
+    return 0;
+}
+
+BaseType_t xPortInIsrContext(void)
+{
+    return pdFALSE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t, void *arg, UBaseType_t priority,
+                                   TaskHandle_t *out_handle, BaseType_t core_id)
+{
+    tskTaskControlBlock *tcb = start_thread(fn, name, arg, priority, core_id);
+    if (out_handle != nullptr) {
+        *out_handle = tcb;
+    }
+    return pdPASS;
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t fn, const char *name, uint32_t, void *arg,
+                                           UBaseType_t priority, StackType_t *, StaticTask_t *, BaseType_t core_id)
+{
+    return start_thread(fn, name, arg, priority, core_id);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    tskTaskControlBlock *self = current_task();
+    if (task != nullptr && task != self) {
+        ESP_LOGW(kTag, "vTaskDelete(%s) from %s: only self-deletion is supported", task->name.c_str(),
+                 self->name.c_str());
+        return;
+    }
+    retire_task(self);
+    t_current = nullptr;
+    pthread_exit(nullptr);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (ticks == 0) {
+        std::this_thread::yield();
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int64_t>(ticks) * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return static_cast<TickType_t>(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current_task();
+}
+
+UBaseType_t uxTaskGetTaskNumber(TaskHandle_t task)
+{
+    return task != nullptr ? task->number : 0;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void)
+{
+    current_task();
+    std::lock_guard<std::mutex> guard(g_tasks_lock);
+    return static_cast<UBaseType_t>(g_tasks.size());
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *tasks, UBaseType_t capacity, configRUN_TIME_COUNTER_TYPE *total)
+{
+    tskTaskControlBlock *self = current_task();
+    if (total != nullptr) {
+        *total = 0;
+    }
+    std::lock_guard<std::mutex> guard(g_tasks_lock);
+    if (tasks == nullptr || capacity < g_tasks.size()) {
+        return 0;
+    }
+    UBaseType_t count = 0;
+    for (tskTaskControlBlock *tcb : g_tasks) {
+        TaskStatus_t &status = tasks[count++];
+        status = {};
+        status.xHandle = tcb;
+        status.pcTaskName = tcb->name.c_str();
+        status.xTaskNumber = tcb->number;
+        status.eCurrentState = tcb == self ? eRunning : eReady;
+        status.uxCurrentPriority = tcb->priority;
+        status.uxBasePriority = tcb->priority;
+        status.xCoreID = tcb->core;
+    }
+    return count;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    tskTaskControlBlock *self = current_task();
+    std::unique_lock<std::mutex> lock(self->notify_lock);
+    auto notified = [self]() { return self->notify_value > 0; };
+    if (ticks_to_wait == portMAX_DELAY) {
+        self->notify_cv.wait(lock, notified);
+    } else {
+        self->notify_cv.wait_for(lock, std::chrono::milliseconds(static_cast<int64_t>(ticks_to_wait) *
+                                                                 portTICK_PERIOD_MS),
+                                 notified);
+    }
+    const uint32_t value = self->notify_value;
+    if (value > 0) {
+        self->notify_value = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (task == nullptr) {
+        return pdFAIL;
+    }
+    {
+        std::lock_guard<std::mutex> guard(task->notify_lock);
+        task->notify_value++;
+    }
+    task->notify_cv.notify_one();
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return new QueueDefinition();
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return new QueueDefinition();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait)
+{
+    if (sem == nullptr) {
+        return pdFAIL;
+    }
+    if (ticks_to_wait == portMAX_DELAY) {
+        sem->mutex.lock();
+        return pdPASS;
+    }
+    if (ticks_to_wait == 0) {
+        return sem->mutex.try_lock() ? pdPASS : pdFAIL;
+    }
+    return sem->mutex.try_lock_for(std::chrono::milliseconds(static_cast<int64_t>(ticks_to_wait) *
+                                                             portTICK_PERIOD_MS))
+               ? pdPASS
+               : pdFAIL;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (sem == nullptr) {
+        return pdFAIL;
+    }
+    sem->mutex.unlock();
+    return pdPASS;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    delete sem;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    auto *queue = new QueueDefinition();
+    queue->owned.resize(static_cast<size_t>(length) * item_size);
+    queue->storage = queue->owned.data();
+    queue->item_size = item_size;
+    queue->length = length;
+    return queue;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t *storage, StaticQueue_t *)
+{
+    if (storage == nullptr || length == 0) {
+        return nullptr;
+    }
+    auto *queue = new QueueDefinition();
+    queue->storage = storage;
+    queue->item_size = item_size;
+    queue->length = length;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    if (queue == nullptr) {
+        return pdFAIL;
+    }
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if (!wait_queue(queue, &lock, ticks_to_wait, [queue]() { return queue->count < queue->length; })) {
+        return pdFAIL;
+    }
+    const size_t slot = (queue->head + queue->count) % queue->length;
+    std::memcpy(queue->storage + slot * queue->item_size, item, queue->item_size);
+    queue->count++;
+    lock.unlock();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks_to_wait)
+{
+    if (queue == nullptr) {
+        return pdFAIL;
+    }
+    std::unique_lock<std::mutex> lock(queue->lock);
+    if (!wait_queue(queue, &lock, ticks_to_wait, [queue]() { return queue->count > 0; })) {
+        return pdFAIL;
+    }
+    std::memcpy(item, queue->storage + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    lock.unlock();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    if (queue == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return static_cast<UBaseType_t>(queue->count);
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    if (queue == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return static_cast<UBaseType_t>(queue->length - queue->count);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    if (queue == nullptr) {
+        return pdFAIL;
+    }
+    {
+        std::lock_guard<std::mutex> guard(queue->lock);
+        queue->head = 0;
+        queue->count = 0;
+    }
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    delete queue;
+}
+
+}  // extern "C"
@@ -0,0 +1,9 @@
+#pragma once
+
+// Host shim: the I2C port type named by the T-Pager driver headers. There
+// is no bus; recorded input replaces the TCA8418 reads.
+
+typedef enum {
+    I2C_NUM_0 = 0,
+    I2C_NUM_1,
+} i2c_port_t;
@@ -0,0 +1,8 @@
+#pragma once
+
+// Host shim: placement attributes have no meaning off-target.
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_BSS_ATTR
+#define RTC_DATA_ATTR
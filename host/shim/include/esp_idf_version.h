@@ -0,0 +1,7 @@
+#pragma once
+
+// Host shim: report the IDF release the firmware is built against, so
+// version-gated driver code takes the same branch as on the device.
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 3, 0)
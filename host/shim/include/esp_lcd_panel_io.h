@@ -0,0 +1,30 @@
+#pragma once
+
+// Host shim: panel IO calls dispatch through esp_lcd_panel_io_t, so any
+// host implementation (see host/lcd/panel_recorder.hpp) can stand in for
+// the SPI bus.
+
+#include <stddef.h>
+
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct esp_lcd_panel_io_t {
+    esp_err_t (*tx_param)(struct esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size);
+    esp_err_t (*tx_color)(struct esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size);
+    esp_err_t (*del)(struct esp_lcd_panel_io_t *io);
+};
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param,
+                                    size_t param_size);
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color,
+                                    size_t color_size);
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io);
+
+#ifdef __cplusplus
+}
+#endif
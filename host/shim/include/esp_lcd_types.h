@@ -0,0 +1,26 @@
+#pragma once
+
+// Host shim: esp_lcd handle and colour-order types.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct esp_lcd_panel_io_t esp_lcd_panel_io_t;
+typedef struct esp_lcd_panel_t esp_lcd_panel_t;
+typedef esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t;
+typedef esp_lcd_panel_t *esp_lcd_panel_handle_t;
+
+typedef enum {
+    LCD_RGB_ELEMENT_ORDER_RGB = 0,
+    LCD_RGB_ELEMENT_ORDER_BGR,
+} lcd_rgb_element_order_t;
+
+// Pre-6.0 name for the element order.
+typedef lcd_rgb_element_order_t lcd_rgb_endian_t;
+#define LCD_RGB_ENDIAN_RGB LCD_RGB_ELEMENT_ORDER_RGB
+#define LCD_RGB_ENDIAN_BGR LCD_RGB_ELEMENT_ORDER_BGR
+
+#ifdef __cplusplus
+}
+#endif
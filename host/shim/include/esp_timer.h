@@ -0,0 +1,15 @@
+#pragma once
+
+// Host shim: microseconds since process start on CLOCK_MONOTONIC.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
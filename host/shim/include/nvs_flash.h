@@ -0,0 +1,18 @@
+#pragma once
+
+// Host shim: NVS is a flat file, see nvs.h.
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Loads the backing file (POCKETSSH_NVS, default ./pocketssh_nvs.txt).
+esp_err_t nvs_flash_init(void);
+// Drops every entry and the backing file.
+esp_err_t nvs_flash_erase(void);
+
+#ifdef __cplusplus
+}
+#endif
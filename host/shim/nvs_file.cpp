@@ -0,0 +1,395 @@
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "esp_log.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+// Backing file format, one entry per line:
+//   <namespace> TAB <key> TAB <type> TAB <value>
+// where integers are decimal and str/blob values are hex-encoded bytes.
+
+namespace {
+
+constexpr const char *kTag = "nvs_shim";
+constexpr size_t kMaxKeyLen = 15;
+constexpr const char *kDefaultPath = "pocketssh_nvs.txt";
+
+enum class Type { kU8, kI32, kU32, kStr, kBlob };
+constexpr const char *kTypeNames[] = {"u8", "i32", "u32", "str", "blob"};
+
+struct Entry {
+    Type type;
+    int64_t number = 0;
+    std::string bytes;
+};
+
+struct Handle {
+    std::string name_space;
+    nvs_open_mode_t mode;
+};
+
+using Key = std::pair<std::string, std::string>;
+
+std::mutex g_lock;
+bool g_initialized = false;
+std::string g_path;
+std::map<Key, Entry> g_entries;
+std::map<nvs_handle_t, Handle> g_handles;
+nvs_handle_t g_next_handle = 1;
+
+std::string hex_encode(const std::string &bytes)
+{
+    static const char kDigits[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(bytes.size() * 2);
+    for (unsigned char c : bytes) {
+        out.push_back(kDigits[c >> 4]);
+        out.push_back(kDigits[c & 0x0F]);
+    }
+    return out;
+}
+
+bool hex_decode(const std::string &hex, std::string *bytes)
+{
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+    bytes->clear();
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        char pair[3] = {hex[i], hex[i + 1], '\0'};
+        char *end = nullptr;
+        const long value = std::strtol(pair, &end, 16);
+        if (*end != '\0') {
+            return false;
+        }
+        bytes->push_back(static_cast<char>(value));
+    }
+    return true;
+}
+
+bool parse_type(const std::string &name, Type *type)
+{
+    for (size_t i = 0; i < sizeof(kTypeNames) / sizeof(kTypeNames[0]); ++i) {
+        if (name == kTypeNames[i]) {
+            *type = static_cast<Type>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void load_file()
+{
+    g_entries.clear();
+    FILE *f = std::fopen(g_path.c_str(), "r");
+    if (f == nullptr) {
+        return;
+    }
+    char line[8192];
+    int line_no = 0;
+    while (std::fgets(line, sizeof(line), f) != nullptr) {
+        line_no++;
+        line[std::strcspn(line, "\r\n")] = '\0';
+        char *fields[4] = {};
+        char *cursor = line;
+        size_t n = 0;
+        for (; n < 4 && cursor != nullptr; ++n) {
+            fields[n] = cursor;
+            cursor = std::strchr(cursor, '\t');
+            if (cursor != nullptr) {
+                *cursor++ = '\0';
+            }
+        }
+        Entry entry = {};
+        if (n != 4 || !parse_type(fields[2], &entry.type)) {
+            ESP_LOGW(kTag, "%s:%d: skipping malformed entry", g_path.c_str(), line_no);
+            continue;
+        }
+        if (entry.type == Type::kStr || entry.type == Type::kBlob) {
+            if (!hex_decode(fields[3], &entry.bytes)) {
+                ESP_LOGW(kTag, "%s:%d: bad hex value", g_path.c_str(), line_no);
+                continue;
+            }
+        } else {
+            entry.number = std::strtoll(fields[3], nullptr, 10);
+        }
+        g_entries[{fields[0], fields[1]}] = entry;
+    }
+    std::fclose(f);
+}
+
+esp_err_t save_file()
+{
+    const std::string tmp_path = g_path + ".tmp";
+    FILE *f = std::fopen(tmp_path.c_str(), "w");
+    if (f == nullptr) {
+        ESP_LOGE(kTag, "cannot write %s", tmp_path.c_str());
+        return ESP_FAIL;
+    }
+    for (const auto &item : g_entries) {
+        const Entry &entry = item.second;
+        std::fprintf(f, "%s\t%s\t%s\t", item.first.first.c_str(), item.first.second.c_str(),
+                     kTypeNames[static_cast<int>(entry.type)]);
+        if (entry.type == Type::kStr || entry.type == Type::kBlob) {
+            std::fputs(hex_encode(entry.bytes).c_str(), f);
+        } else {
+            std::fprintf(f, "%" PRId64, entry.number);
+        }
+        std::fputc('\n', f);
+    }
+    const bool ok = std::ferror(f) == 0;
+    std::fclose(f);
+    if (!ok || std::rename(tmp_path.c_str(), g_path.c_str()) != 0) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+// Caller holds g_lock.
+esp_err_t lookup_handle(nvs_handle_t handle, bool write, const char *key, Handle **out)
+{
+    auto it = g_handles.find(handle);
+    if (it == g_handles.end()) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    if (key != nullptr && std::strlen(key) > kMaxKeyLen) {
+        return ESP_ERR_NVS_KEY_TOO_LONG;
+    }
+    if (write && it->second.mode == NVS_READONLY) {
+        return ESP_ERR_NVS_READ_ONLY;
+    }
+    *out = &it->second;
+    return ESP_OK;
+}
+
+esp_err_t set_entry(nvs_handle_t handle, const char *key, const Entry &entry)
+{
+    if (key == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(g_lock);
+    Handle *h = nullptr;
+    const esp_err_t err = lookup_handle(handle, true, key, &h);
+    if (err != ESP_OK) {
+        return err;
+    }
+    g_entries[{h->name_space, key}] = entry;
+    return ESP_OK;
+}
+
+// Copies the entry out so the caller can drop the lock.
+esp_err_t get_entry(nvs_handle_t handle, const char *key, Type type, Entry *out)
+{
+    if (key == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(g_lock);
+    Handle *h = nullptr;
+    const esp_err_t err = lookup_handle(handle, false, key, &h);
+    if (err != ESP_OK) {
+        return err;
+    }
+    auto it = g_entries.find({h->name_space, key});
+    // Entries are typed on the device too: a key stored as another type
+    // reads as missing.
+    if (it == g_entries.end() || it->second.type != type) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *out = it->second;
+    return ESP_OK;
+}
+
+template <typename T>
+esp_err_t get_number(nvs_handle_t handle, const char *key, Type type, T *out_value)
+{
+    if (out_value == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    Entry entry = {};
+    const esp_err_t err = get_entry(handle, key, type, &entry);
+    if (err == ESP_OK) {
+        *out_value = static_cast<T>(entry.number);
+    }
+    return err;
+}
+
+esp_err_t get_bytes(nvs_handle_t handle, const char *key, Type type, void *out_value, size_t *length)
+{
+    if (length == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    Entry entry = {};
+    const esp_err_t err = get_entry(handle, key, type, &entry);
+    if (err != ESP_OK) {
+        return err;
+    }
+    const size_t needed = entry.bytes.size() + (type == Type::kStr ? 1 : 0);
+    if (out_value == nullptr) {
+        *length = needed;
+        return ESP_OK;
+    }
+    if (*length < needed) {
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    std::memcpy(out_value, entry.bytes.data(), entry.bytes.size());
+    if (type == Type::kStr) {
+        static_cast<char *>(out_value)[entry.bytes.size()] = '\0';
+    }
+    *length = needed;
+    return ESP_OK;
+}
+
+}  // namespace
+
+extern "C" {
+
+esp_err_t nvs_flash_init(void)
+{
+    std::lock_guard<std::mutex> guard(g_lock);
+    const char *env = std::getenv("POCKETSSH_NVS");
+    g_path = (env != nullptr && env[0] != '\0') ? env : kDefaultPath;
+    load_file();
+    g_initialized = true;
+    ESP_LOGI(kTag, "%u entries from %s", static_cast<unsigned>(g_entries.size()), g_path.c_str());
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void)
+{
+    std::lock_guard<std::mutex> guard(g_lock);
+    g_entries.clear();
+    if (!g_path.empty()) {
+        std::remove(g_path.c_str());
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *name_space, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    if (name_space == nullptr || out_handle == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(g_lock);
+    if (!g_initialized) {
+        return ESP_ERR_NVS_NOT_INITIALIZED;
+    }
+    if (open_mode == NVS_READONLY) {
+        auto it = g_entries.lower_bound({name_space, ""});
+        if (it == g_entries.end() || it->first.first != name_space) {
+            return ESP_ERR_NVS_NOT_FOUND;
+        }
+    }
+    *out_handle = g_next_handle++;
+    g_handles[*out_handle] = {name_space, open_mode};
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    std::lock_guard<std::mutex> guard(g_lock);
+    g_handles.erase(handle);
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    std::lock_guard<std::mutex> guard(g_lock);
+    Handle *h = nullptr;
+    const esp_err_t err = lookup_handle(handle, false, nullptr, &h);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return save_file();
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value)
+{
+    return set_entry(handle, key, {Type::kU8, value, {}});
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value)
+{
+    return set_entry(handle, key, {Type::kI32, value, {}});
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value)
+{
+    return set_entry(handle, key, {Type::kU32, value, {}});
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char *key, const char *value)
+{
+    if (value == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return set_entry(handle, key, {Type::kStr, 0, value});
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    if (value == nullptr && length > 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return set_entry(handle, key, {Type::kBlob, 0, std::string(static_cast<const char *>(value), length)});
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out_value)
+{
+    return get_number(handle, key, Type::kU8, out_value);
+}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *out_value)
+{
+    return get_number(handle, key, Type::kI32, out_value);
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out_value)
+{
+    return get_number(handle, key, Type::kU32, out_value);
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char *key, char *out_value, size_t *length)
+{
+    return get_bytes(handle, key, Type::kStr, out_value, length);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    return get_bytes(handle, key, Type::kBlob, out_value, length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    if (key == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(g_lock);
+    Handle *h = nullptr;
+    const esp_err_t err = lookup_handle(handle, true, key, &h);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return g_entries.erase({h->name_space, key}) > 0 ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    std::lock_guard<std::mutex> guard(g_lock);
+    Handle *h = nullptr;
+    const esp_err_t err = lookup_handle(handle, true, nullptr, &h);
+    if (err != ESP_OK) {
+        return err;
+    }
+    for (auto it = g_entries.begin(); it != g_entries.end();) {
+        it = it->first.first == h->name_space ? g_entries.erase(it) : std::next(it);
+    }
+    return ESP_OK;
+}
+
+}  // extern "C"
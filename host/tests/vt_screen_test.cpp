@@ -0,0 +1,315 @@
+// vt_screen::Screen parser and grid checks, run by ctest.
+//
+// Each case feeds a byte sequence and compares the rendered text and the
+// cursor with what a terminal would show. Exits 1 when any check fails.
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "vt_screen.hpp"
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+#define CHECK_TEXT(screen, expected) check_text(&(screen), (expected), __LINE__)
+
+std::string render(vt_screen::Screen *screen)
+{
+    static char text[vt_screen::kRenderMax];
+    screen->render(text, sizeof(text));
+    return text;
+}
+
+void check(bool ok, const char *what, int line)
+{
+    if (!ok) {
+        std::fprintf(stderr, "vt_screen_test.cpp:%d: CHECK(%s) failed\n", line, what);
+        g_failures++;
+    }
+}
+
+void check_text(vt_screen::Screen *screen, const std::string &expected, int line)
+{
+    const std::string actual = render(screen);
+    if (actual != expected) {
+        std::fprintf(stderr, "vt_screen_test.cpp:%d: rendered \"%s\", expected \"%s\"\n", line, actual.c_str(),
+                     expected.c_str());
+        g_failures++;
+    }
+}
+
+void feed(vt_screen::Screen *screen, const char *data)
+{
+    screen->feed(data, std::strlen(data));
+}
+
+void escape_split_across_feeds()
+{
+    vt_screen::Screen screen;
+    feed(&screen, "hello\033");
+    feed(&screen, "[");
+    feed(&screen, "1;");
+    feed(&screen, "3HX");
+    CHECK_TEXT(screen, "heXlo");
+    CHECK(screen.cursor_row() == 0 && screen.cursor_col() == 3);
+
+    // An OSC title split inside its ESC \ terminator prints nothing.
+    screen.reset();
+    feed(&screen, "\033]0;title\033");
+    feed(&screen, "\\ok");
+    CHECK_TEXT(screen, "ok");
+}
+
+void deferred_wrap_at_last_column()
+{
+    const std::string line(vt_screen::kCols, 'a');
+
+    vt_screen::Screen screen;
+    feed(&screen, line.c_str());
+    // The cursor stays on the last column until the next printable byte.
+    CHECK(screen.cursor_row() == 0 && screen.cursor_col() == vt_screen::kCols - 1);
+    feed(&screen, "b");
+    CHECK(screen.cursor_row() == 1 && screen.cursor_col() == 1);
+    CHECK_TEXT(screen, line + "\nb");
+
+    // CR cancels the pending wrap: the next byte overwrites column 0.
+    screen.reset();
+    feed(&screen, line.c_str());
+    feed(&screen, "\rb");
+    CHECK(screen.cursor_row() == 0 && screen.cursor_col() == 1);
+    CHECK_TEXT(screen, "b" + line.substr(1));
+
+    // So does cursor movement.
+    screen.reset();
+    feed(&screen, line.c_str());
+    feed(&screen, "\033[Db");
+    CHECK(screen.cursor_row() == 0);
+    CHECK_TEXT(screen, line.substr(0, vt_screen::kCols - 2) + "ba");
+}
+
+void scrolling_moves_the_ring()
+{
+    vt_screen::Screen screen;
+    const uint32_t scrolls_before = screen.stats().scrolls;
+    std::string expected;
+    for (int i = 0; i < 30; ++i) {
+        char line[16];
+        std::snprintf(line, sizeof(line), "L%d", i);
+        feed(&screen, line);
+        if (i < 29) {
+            feed(&screen, "\r\n");
+        }
+        if (i >= 30 - vt_screen::kRows) {
+            expected += line;
+            expected += i < 29 ? "\n" : "";
+        }
+    }
+    CHECK(screen.stats().scrolls - scrolls_before == 30 - vt_screen::kRows);
+    CHECK(screen.cursor_row() == vt_screen::kRows - 1);
+    CHECK_TEXT(screen, expected);
+
+    // Absolute positions address the visible rows, not the storage rows.
+    feed(&screen, "\033[1;1H#\033[24;1H$");
+    CHECK(render(&screen).compare(0, 3, "#6\n") == 0);
+    CHECK(render(&screen).substr(render(&screen).size() - 3) == "$29");
+
+    // Reverse index at the top scrolls down and blanks the new top row.
+    feed(&screen, "\033[H\033M");
+    CHECK(render(&screen).compare(0, 4, "\n#6\n") == 0);
+}
+
+void csi_parameter_limits()
+{
+    vt_screen::Screen screen;
+    // Overlong values are capped, then clamped to the grid.
+    feed(&screen, "\033[99999999;99999999H");
+    CHECK(screen.cursor_row() == vt_screen::kRows - 1 && screen.cursor_col() == vt_screen::kCols - 1);
+
+    // Parameters past the fourth are dropped; their digits run into the
+    // last kept one, which is never read by H.
+    feed(&screen, "\033[3;4;5;6;7;8;9H");
+    CHECK(screen.cursor_row() == 2 && screen.cursor_col() == 3);
+
+    // Missing and zero parameters take the default.
+    feed(&screen, "\033[;5H");
+    CHECK(screen.cursor_row() == 0 && screen.cursor_col() == 4);
+    feed(&screen, "\033[0;0H");
+    CHECK(screen.cursor_row() == 0 && screen.cursor_col() == 0);
+
+    // Private sequences are consumed without effect.
+    feed(&screen, "\033[?25lok");
+    CHECK_TEXT(screen, "ok");
+}
+
+void truncated_utf8()
+{
+    vt_screen::Screen screen;
+    // One cell per character, continuation bytes dropped, even when the
+    // character is split across reads.
+    feed(&screen, "\xE2");
+    feed(&screen, "\x94\x80");
+    feed(&screen, "a");
+    CHECK_TEXT(screen, "?a");
+
+    // A sequence cut short: the byte that interrupts it is still handled.
+    screen.reset();
+    feed(&screen, "\xE2\x94" "b\xF0\033[2Gc");
+    CHECK_TEXT(screen, "?c?");
+}
+
+void render_trims_blanks()
+{
+    vt_screen::Screen screen;
+    feed(&screen, "ab   \r\n\r\n");
+    // Trailing spaces go; rows run down to the cursor row.
+    CHECK_TEXT(screen, "ab\n\n");
+
+    // Below the cursor, rows run down to the last non-blank one.
+    feed(&screen, "\033[6;3Hz\033[2;1H");
+    CHECK_TEXT(screen, "ab\n\n\n\n\n  z");
+
+    // A short buffer is filled and terminated.
+    char small[4];
+    screen.render(small, sizeof(small));
+    CHECK(std::strcmp(small, "ab\n") == 0);
+
+    // Erased cells count as blank.
+    feed(&screen, "\033[6;1H\033[2K\033[1;2H\033[K");
+    CHECK_TEXT(screen, "a");
+}
+
+void local_text_keeps_parser_state()
+{
+    vt_screen::Screen screen;
+    feed(&screen, "$ \033[");
+    screen.write_text("ls\nok");
+    feed(&screen, "3D!");
+    CHECK_TEXT(screen, "$ ls\n!k");
+    CHECK(screen.cursor_row() == 1 && screen.cursor_col() == 1);
+}
+
+void frames_carry_changed_rows()
+{
+    static vt_screen::Frame frame;
+    vt_screen::Screen screen;
+    feed(&screen, "$ ls\r\nREADME  \r\n$ ");
+    screen.take_frame(&frame);
+    CHECK(frame.rows == (vt_screen::RowMask{1} << vt_screen::kRows) - 1);
+    CHECK(frame.last_row == 2);
+    CHECK(std::strcmp(frame.text[1], "README") == 0);
+    CHECK(!screen.dirty());
+
+    // An echoed key is one row.
+    feed(&screen, "x");
+    CHECK(screen.dirty());
+    screen.take_frame(&frame);
+    CHECK(frame.rows == vt_screen::RowMask{1} << 2);
+    CHECK(std::strcmp(frame.text[2], "$ x") == 0);
+
+    // Cursor movement alone changes no row, but can change the last row.
+    feed(&screen, "\033[5;1H");
+    CHECK(screen.dirty());
+    screen.take_frame(&frame);
+    CHECK(frame.rows == 0);
+    CHECK(frame.last_row == 4);
+
+    // Erasing marks the rows it touched.
+    feed(&screen, "\033[1;1H\033[K\033[2;3H\033[1K");
+    screen.take_frame(&frame);
+    CHECK(frame.rows == 0x3u);
+    CHECK(frame.text[0][0] == '\0' && std::strcmp(frame.text[1], "   DME") == 0);
+
+    // Scrolling moves the top of the ring: only the row that comes in at
+    // the bottom is carried.
+    feed(&screen, "\033[24;1H\n");
+    screen.take_frame(&frame);
+    CHECK(frame.top == 1 && frame.history == 1);
+    CHECK(frame.rows == vt_screen::RowMask{1} << vt_screen::kRows);
+    CHECK(frame.text[vt_screen::kRows][0] == '\0');
+
+    // Rows keep their ring position once scrolled: the screen's top row is
+    // ring row 1.
+    feed(&screen, "\033[1;1H\033[2Ktop");
+    screen.take_frame(&frame);
+    CHECK(frame.rows == vt_screen::RowMask{1} << 1);
+    CHECK(std::strcmp(frame.text[1], "top") == 0);
+}
+
+void scrollback_keeps_scrolled_rows()
+{
+    static vt_screen::Frame frame;
+    vt_screen::Screen screen;
+    for (int i = 0; i < 25; ++i) {
+        char line[16];
+        std::snprintf(line, sizeof(line), "L%d  \r\n", i);
+        feed(&screen, line);
+    }
+    // 25 line feeds from the top row: the last two scroll L0 and L1 off,
+    // and they stay in the ring rows they were written to.
+    screen.take_frame(&frame);
+    CHECK(frame.top == 2 && frame.history == 2);
+    CHECK(std::strcmp(frame.text[0], "L0") == 0 && std::strcmp(frame.text[1], "L1") == 0);
+    CHECK(std::strcmp(frame.text[2], "L2") == 0);
+    CHECK(render(&screen).compare(0, 3, "L2\n") == 0);
+
+    // Scrolling again carries only the new bottom row.
+    feed(&screen, "L25\r\n");
+    screen.take_frame(&frame);
+    CHECK(frame.history == 3);
+    CHECK(frame.rows == ((vt_screen::RowMask{1} << 25) | (vt_screen::RowMask{1} << 26)));
+
+    // Past the ring, the oldest scrollback rows are reused at the bottom.
+    for (int i = 26; i < 100; ++i) {
+        char line[16];
+        std::snprintf(line, sizeof(line), "L%d\r\n", i);
+        feed(&screen, line);
+    }
+    screen.take_frame(&frame);
+    CHECK(frame.history == vt_screen::kScrollbackRows);
+    CHECK(std::strcmp(frame.text[frame.top], "L77") == 0);
+    for (uint16_t k = 0; k < frame.history; ++k) {
+        const uint16_t ring_row = (frame.top + vt_screen::kRingRows - frame.history + k) % vt_screen::kRingRows;
+        CHECK(std::string(frame.text[ring_row]) == "L" + std::to_string(77 - vt_screen::kScrollbackRows + k));
+    }
+
+    // A reverse scroll on the top row brings back a blank row in place of
+    // the newest scrollback row.
+    feed(&screen, "\033[1;1H\033M");
+    screen.take_frame(&frame);
+    CHECK(frame.history == vt_screen::kScrollbackRows - 1);
+    CHECK(frame.text[frame.top][0] == '\0');
+    CHECK(frame.rows == vt_screen::RowMask{1} << frame.top);
+
+    // A reset (ESC c) keeps the scrollback; clear_scrollback() drops it.
+    feed(&screen, "\033c");
+    screen.take_frame(&frame);
+    CHECK(frame.history == vt_screen::kScrollbackRows - 1);
+    screen.clear_scrollback();
+    screen.take_frame(&frame);
+    CHECK(frame.history == 0);
+}
+
+}  // namespace
+
+int main()
+{
+    escape_split_across_feeds();
+    deferred_wrap_at_last_column();
+    scrolling_moves_the_ring();
+    csi_parameter_limits();
+    truncated_utf8();
+    render_trims_blanks();
+    local_text_keeps_parser_state();
+    frames_carry_changed_rows();
+    scrollback_keeps_scrolled_rows();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "vt_screen_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("vt_screen_test: ok\n");
+    return 0;
+}
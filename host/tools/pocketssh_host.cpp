@@ -0,0 +1,284 @@
+// Runs the terminal core on Linux against the ESP-IDF shims:
+//
+//   pocketssh_host hosts <ssh_config>
+//   pocketssh_host resolve <ssh_config> <alias>
+//   pocketssh_host strip [CHUNK] < stream      escape-free text to stdout
+//   pocketssh_host history [list | add CMD | clear]
+//   pocketssh_host input <recording>            replay recorded T-Pager input
+//   pocketssh_host render [CHUNK] < stream     (LVGL builds only)
+//
+// History goes through the file-backed NVS shim (POCKETSSH_NVS).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "history_store.hpp"
+#include "input_replay.hpp"
+#include "metrics.hpp"
+#include "nvs_flash.h"
+#include "ssh_config.hpp"
+#include "terminal_text.hpp"
+
+#if defined(POCKETSSH_HOST_LVGL)
+#include "headless_display.hpp"
+#endif
+
+namespace {
+
+constexpr size_t kDefaultChunk = 1024;  // SSHTerminal's channel read size
+
+int usage()
+{
+    std::fprintf(stderr,
+                 "usage: pocketssh_host hosts <ssh_config>\n"
+                 "       pocketssh_host resolve <ssh_config> <alias>\n"
+                 "       pocketssh_host strip [CHUNK] < stream\n"
+                 "       pocketssh_host history [list | add CMD | clear]\n"
+                 "       pocketssh_host input <recording>\n"
+#if defined(POCKETSSH_HOST_LVGL)
+                 "       pocketssh_host render [CHUNK] < stream\n"
+#endif
+    );
+    return 2;
+}
+
+bool load_config(const char *path, ssh_config::Config *config)
+{
+    FILE *file = std::fopen(path, "r");
+    if (file == nullptr) {
+        std::perror(path);
+        return false;
+    }
+    const bool ok = ssh_config::parse(file, config);
+    std::fclose(file);
+    return ok;
+}
+
+size_t chunk_arg(int argc, char **argv, int index)
+{
+    if (argc <= index) {
+        return kDefaultChunk;
+    }
+    const long chunk = std::strtol(argv[index], nullptr, 10);
+    return chunk > 0 ? static_cast<size_t>(chunk) : kDefaultChunk;
+}
+
+int cmd_hosts(int argc, char **argv)
+{
+    ssh_config::Config config;
+    if (argc < 3 || !load_config(argv[2], &config)) {
+        return argc < 3 ? usage() : 1;
+    }
+    for (const std::string &alias : config.aliases) {
+        std::printf("%s\n", alias.c_str());
+    }
+    return 0;
+}
+
+int cmd_resolve(int argc, char **argv)
+{
+    ssh_config::Config config;
+    if (argc < 4 || !load_config(argv[2], &config)) {
+        return argc < 4 ? usage() : 1;
+    }
+    ssh_config::Resolved resolved;
+    if (!ssh_config::resolve(config, argv[3], &resolved)) {
+        std::fprintf(stderr, "%s: no matching Host block\n", argv[3]);
+        return 1;
+    }
+    std::printf("host %s\nuser %s\nport %d\nidentitiesonly %s\nstricthostkeychecking %s\nnetwork %s\n",
+                resolved.host_name.c_str(), resolved.user.c_str(), resolved.port,
+                resolved.identities_only ? "yes" : "no", resolved.strict_host_key_checking.c_str(),
+                resolved.network.c_str());
+    for (const std::string &identity : resolved.identity_files) {
+        std::printf("identityfile %s\n", identity.c_str());
+    }
+    return 0;
+}
+
+int cmd_strip(int argc, char **argv)
+{
+    std::vector<char> chunk(chunk_arg(argc, argv, 2));
+    std::string text;
+    size_t n = 0;
+    while ((n = std::fread(chunk.data(), 1, chunk.size(), stdin)) > 0) {
+        text.clear();
+        terminal_text::strip_ansi(chunk.data(), n, &text);
+        std::fwrite(text.data(), 1, text.size(), stdout);
+    }
+    return 0;
+}
+
+int cmd_history(int argc, char **argv)
+{
+    ESP_ERROR_CHECK(nvs_flash_init());
+    std::vector<std::string> history;
+    history_store::load(&history);
+
+    const std::string action = argc > 2 ? argv[2] : "list";
+    if (action == "add" && argc > 3) {
+        history.push_back(argv[3]);
+        history_store::save(history);
+    } else if (action == "clear") {
+        history_store::clear();
+        history.clear();
+    } else if (action != "list") {
+        return usage();
+    }
+    for (size_t i = 0; i < history.size(); ++i) {
+        std::printf("%3zu  %s\n", i + 1, history[i].c_str());
+    }
+    return 0;
+}
+
+// Replay a recording in real time through the calls tpager_base's input
+// task makes: one pass per tick, keys mapped with terminal_char(). With
+// LVGL the keys are typed into a textarea and each pass ends with a frame,
+// so key_render covers input-to-render; without it, input-to-typed.
+int cmd_input(int argc, char **argv)
+{
+    if (argc < 3) {
+        return usage();
+    }
+    const esp_err_t ret = input_replay::start_replay(argv[2]);
+    if (ret != ESP_OK) {
+        std::fprintf(stderr, "%s: %s\n", argv[2], esp_err_to_name(ret));
+        return 1;
+    }
+#if defined(POCKETSSH_HOST_LVGL)
+    lv_display_t *display = headless_display::create(480, 222);
+    lv_obj_t *output = lv_textarea_create(lv_screen_active());
+    lv_obj_set_size(output, 480, 222);
+#endif
+
+    std::string typed;
+    int32_t encoder_net = 0;
+    uint32_t presses = 0;
+    while (input_replay::replaying()) {
+        tpager::Tca8418Event ev = {};
+        int64_t input_us = 0;
+        while (input_replay::next_key(&ev, &input_us) == ESP_OK) {
+            presses += ev.pressed ? 1 : 0;
+            char key = '\0';
+            if (!input_replay::terminal_char(ev, &key)) {
+                continue;
+            }
+            if (ev.erase_previous_space && !typed.empty()) {
+                typed.pop_back();
+            }
+            if (key == '\b') {
+                if (!typed.empty()) {
+                    typed.pop_back();
+                }
+            } else {
+                typed.push_back(key);
+            }
+#if defined(POCKETSSH_HOST_LVGL)
+            const char text[2] = {key, '\0'};
+            if (key == '\b') {
+                lv_textarea_delete_char(output);
+            } else {
+                lv_textarea_add_text(output, text);
+            }
+#endif
+            input_replay::note_key_typed(input_us);
+        }
+        tpager::EncoderEvent enc = {};
+        input_replay::next_encoder(&enc);
+        encoder_net += enc.delta;
+        if (enc.button_changed && enc.button_pressed) {
+            typed.push_back('\n');
+        }
+#if defined(POCKETSSH_HOST_LVGL)
+        headless_display::refresh(display);
+#endif
+        input_replay::note_frame_ready();
+        vTaskDelay(1);
+    }
+
+    static char report[1024];
+    input_replay::format_report(report, sizeof(report));
+    std::fputs(report, stdout);
+    std::printf("presses %u, encoder net %d\ntyped: ", static_cast<unsigned>(presses), static_cast<int>(encoder_net));
+    for (const char c : typed) {
+        std::fputs(c == '\n' ? "\\n" : std::string(1, c).c_str(), stdout);
+    }
+    std::fputc('\n', stdout);
+
+    metrics::format_report(report, sizeof(report));
+    std::istringstream lines(report);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.rfind("HISTOGRAM", 0) == 0 || line.rfind("key_drops", 0) == 0 || line.rfind("key_render", 0) == 0) {
+            std::printf("%s\n", line.c_str());
+        }
+    }
+    return 0;
+}
+
+#if defined(POCKETSSH_HOST_LVGL)
+// Feed a stream through buffer_output() into a textarea on a T-Pager sized
+// display, refreshing after every chunk, and report the render cost.
+int cmd_render(int argc, char **argv)
+{
+    lv_display_t *display = headless_display::create(480, 222);
+    lv_obj_t *output = lv_textarea_create(lv_screen_active());
+    lv_obj_set_size(output, 480, 222);
+    lv_textarea_set_cursor_click_pos(output, false);
+
+    std::vector<char> chunk(chunk_arg(argc, argv, 2));
+    std::string pending;
+    size_t total = 0;
+    size_t n = 0;
+    const int64_t start_us = esp_timer_get_time();
+    while ((n = std::fread(chunk.data(), 1, chunk.size(), stdin)) > 0) {
+        total += n;
+        terminal_text::buffer_output(&pending, chunk.data(), n);
+        lv_textarea_add_text(output, pending.c_str());
+        pending.clear();
+        headless_display::refresh(display);
+    }
+    const int64_t elapsed_us = esp_timer_get_time() - start_us;
+    const headless_display::Stats stats = headless_display::stats(display);
+    std::printf("bytes %zu\nelapsed_us %lld\nflushes %u\npixels %llu\n", total, static_cast<long long>(elapsed_us),
+                static_cast<unsigned>(stats.flushes), static_cast<unsigned long long>(stats.pixels));
+    return 0;
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        return usage();
+    }
+    const std::string command = argv[1];
+    if (command == "hosts") {
+        return cmd_hosts(argc, argv);
+    }
+    if (command == "resolve") {
+        return cmd_resolve(argc, argv);
+    }
+    if (command == "strip") {
+        return cmd_strip(argc, argv);
+    }
+    if (command == "history") {
+        return cmd_history(argc, argv);
+    }
+    if (command == "input") {
+        return cmd_input(argc, argv);
+    }
+#if defined(POCKETSSH_HOST_LVGL)
+    if (command == "render") {
+        return cmd_render(argc, argv);
+    }
+#endif
+    return usage();
+}
@@ -1,17 +1,11 @@
 #include "battery_measurement.hpp"
 
-const std::vector<BatteryMeasurement::BatteryLevel> BatteryMeasurement::batteryCurve = {
-    {4.20f, 100},
-    {4.00f, 90},
-    {3.85f, 75},
-    {3.70f, 50},
-    {3.60f, 25},
-    {3.50f, 10},
-    {3.30f, 0},
-};
+#include <algorithm>
+#include <cmath>
 
 BatteryMeasurement::BatteryMeasurement()
-    : adcHandle(nullptr), caliHandle(nullptr), calibrationEnabled(false) {}
+    : adcHandle(nullptr), caliHandle(nullptr), calibrationEnabled(false),
+      filteredVolts(0.0f), history(), historyCount(0), historyHead(0) {}
 
 BatteryMeasurement::~BatteryMeasurement()
 {
@@ -71,16 +65,29 @@ esp_err_t BatteryMeasurement::init()
 
 float BatteryMeasurement::readBatteryVoltage()
 {
-    int rawReading = 0;
-    int voltage_mv = 0;
-
-    // Read raw ADC value
-    esp_err_t ret = adc_oneshot_read(adcHandle, ADC_CHANNEL, &rawReading);
-    if (ret != ESP_OK)
+    // Burst of one-shots; drop the extremes (WiFi TX spikes couple into the
+    // divider) and average the rest.
+    std::array<int, BURST_SAMPLES> raw = {};
+    for (int i = 0; i < BURST_SAMPLES; ++i)
     {
-        ESP_LOGE(TAG, "ADC read failed: %s", esp_err_to_name(ret));
-        return 0.0f;
+        int reading = 0;
+        esp_err_t ret = adc_oneshot_read(adcHandle, ADC_CHANNEL, &reading);
+        if (ret != ESP_OK)
+        {
+            ESP_LOGE(TAG, "ADC read failed: %s", esp_err_to_name(ret));
+            return 0.0f;
+        }
+        raw[i] = reading;
     }
+    std::sort(raw.begin(), raw.end());
+    int sum = 0;
+    for (int i = BURST_TRIM; i < BURST_SAMPLES - BURST_TRIM; ++i)
+    {
+        sum += raw[i];
+    }
+    const int count = BURST_SAMPLES - 2 * BURST_TRIM;
+    const int rawReading = (sum + count / 2) / count;
+    int voltage_mv = 0;
 
     // Convert to millivolts
     if (calibrationEnabled)
@@ -96,39 +103,103 @@ float BatteryMeasurement::readBatteryVoltage()
     // Apply voltage divider correction (GPIO4 has 2x divider)
     float batteryVoltage = (voltage_mv * DIVIDER_RATIO) / 1000.0f;
     
-    ESP_LOGI(TAG, "ADC Raw: %d, Voltage: %d mV, Battery: %.2f V", rawReading, voltage_mv, batteryVoltage);
+    ESP_LOGD(TAG, "ADC Raw: %d (spread %d), Voltage: %d mV, Battery: %.2f V",
+             rawReading, raw[BURST_SAMPLES - 1] - raw[0], voltage_mv, batteryVoltage);
     
     return batteryVoltage;
 }
 
 int BatteryMeasurement::voltageToPercentage(float voltage)
 {
-    if (voltage >= batteryCurve.front().voltage)
+    static_assert(interpolateVoltage(4.30f) == 100.0f, "above the curve clamps to 100%");
+    static_assert(interpolateVoltage(3.20f) == 0.0f, "below the curve clamps to 0%");
+    return static_cast<int>(interpolateVoltage(voltage) + 0.5f);
+}
+
+void BatteryMeasurement::update(float loadMilliamps, int64_t nowMs)
+{
+    const float measured = readBatteryVoltage();
+    if (measured <= 0.1f)
+    {
+        ESP_LOGW(TAG, "Battery voltage too low or invalid: %.2fV", measured);
+        return;
+    }
+
+    // Estimate the open-circuit voltage by adding back the IR drop for the
+    // current load, then filter asymmetrically: a sag that survives the
+    // compensation (TX burst) is mostly ignored, a recovery is followed quickly.
+    const float compensated = measured + (loadMilliamps / 1000.0f) * INTERNAL_RESISTANCE_OHM;
+    if (filteredVolts <= 0.0f)
+    {
+        filteredVolts = compensated;
+    }
+    else
     {
-        return 100; // Above max voltage
+        const float alpha = compensated > filteredVolts ? FILTER_ALPHA_UP : FILTER_ALPHA_DOWN;
+        filteredVolts += alpha * (compensated - filteredVolts);
     }
-    if (voltage <= batteryCurve.back().voltage)
+
+    recordTrendPoint(nowMs);
+}
+
+int BatteryMeasurement::filteredPercentage() const
+{
+    if (filteredVolts <= 0.0f)
     {
-        return 0; // Below min voltage
+        return -1;
     }
-    return interpolateVoltage(voltage);
+    return static_cast<int>(interpolateVoltage(filteredVolts) + 0.5f);
 }
 
-int BatteryMeasurement::interpolateVoltage(float voltage)
+void BatteryMeasurement::recordTrendPoint(int64_t nowMs)
 {
-    for (size_t i = 0; i < batteryCurve.size() - 1; ++i)
+    if (historyCount > 0)
     {
-        const auto &p1 = batteryCurve[i];
-        const auto &p2 = batteryCurve[i + 1];
-        if (voltage <= p1.voltage && voltage > p2.voltage)
+        const size_t newest = (historyHead + HISTORY_LEN - 1) % HISTORY_LEN;
+        if (nowMs - history[newest].timeMs < HISTORY_INTERVAL_MS)
         {
-            // Linear interpolation
-            return p1.percentage + static_cast<int>((voltage - p1.voltage) * (p2.percentage - p1.percentage) / (p2.voltage - p1.voltage));
+            return;
         }
     }
-    // Should never reach here, but return 0 for safety
-    ESP_LOGW(TAG, "Voltage interpolation fallback");
-    return 0;
+    history[historyHead] = {nowMs, interpolateVoltage(filteredVolts)};
+    historyHead = (historyHead + 1) % HISTORY_LEN;
+    historyCount = std::min(historyCount + 1, HISTORY_LEN);
+}
+
+int BatteryMeasurement::minutesRemaining() const
+{
+    if (historyCount < HISTORY_MIN_POINTS)
+    {
+        return -1;
+    }
+
+    // Least-squares slope of percentage over the trend window (%/minute).
+    const size_t oldest = (historyHead + HISTORY_LEN - historyCount) % HISTORY_LEN;
+    const int64_t t0 = history[oldest].timeMs;
+    float sumT = 0.0f, sumP = 0.0f, sumTT = 0.0f, sumTP = 0.0f;
+    for (size_t i = 0; i < historyCount; ++i)
+    {
+        const GaugeSample &sample = history[(oldest + i) % HISTORY_LEN];
+        const float t = static_cast<float>(sample.timeMs - t0) / 60000.0f;
+        sumT += t;
+        sumP += sample.percentage;
+        sumTT += t * t;
+        sumTP += t * sample.percentage;
+    }
+    const float n = static_cast<float>(historyCount);
+    const float denom = n * sumTT - sumT * sumT;
+    if (denom <= 0.0f)
+    {
+        return -1;
+    }
+    const float slope = (n * sumTP - sumT * sumP) / denom;
+    if (slope > -0.01f)
+    {
+        return -1; // Charging or flat: no meaningful estimate
+    }
+
+    const float minutes = interpolateVoltage(filteredVolts) / -slope;
+    return static_cast<int>(std::min(minutes, 99.0f * 60.0f));
 }
 
 void BatteryMeasurement::deinit()
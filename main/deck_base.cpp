@@ -6,7 +6,6 @@
 
 #include <stdio.h>
 #include <string.h>
-#include <dirent.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -14,32 +13,26 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_check.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "bsp/esp-bsp.h"
 #include "bsp/display.h"
 #include "bsp/touch.h"
-#include "esp_vfs_fat.h"
-#include "driver/spi_common.h"
-#include "driver/sdspi_host.h"
 
 #include "esp_lcd_touch_gt911.h"
 #include "driver/gpio.h"
 
 #include "utilities.h"
+#include "board_traits.hpp"
 #include "c3_keyboard.hpp"
+#include "metrics.hpp"
+#include "pepboy_frames.h"
+#include "power_mgmt.hpp"
 #include "ssh_terminal.hpp"
+#include "task_layout.hpp"
 
 #include "lvgl.h"
 
-// Pepboy splash screen images
-LV_IMG_DECLARE(pepboy_0);
-LV_IMG_DECLARE(pepboy_1);
-LV_IMG_DECLARE(pepboy_2);
-LV_IMG_DECLARE(pepboy_3);
-LV_IMG_DECLARE(pepboy_4);
-LV_IMG_DECLARE(pepboy_5);
-LV_IMG_DECLARE(pepboy_6);
-LV_IMG_DECLARE(pepboy_7);
-
 #if defined(BSP_LCD_DRAW_BUFF_SIZE)
 #define DRAW_BUF_SIZE BSP_LCD_DRAW_BUFF_SIZE
 #else
@@ -57,10 +50,85 @@ static lv_obj_t *splash_screen = NULL;
 static lv_obj_t *splash_img = NULL;
 static lv_timer_t *splash_timer = NULL;
 static int splash_frame = 0;
-static const lv_image_dsc_t* pepboy_frames[] = {
-    &pepboy_0, &pepboy_1, &pepboy_2, &pepboy_3,
-    &pepboy_4, &pepboy_5, &pepboy_6, &pepboy_7
-};
+
+// Splash frames are delta/RLE packed (lvgl_pepboy_img/pack_frames.py) and
+// decoded in place into a single RGB565 buffer that the image widget shows.
+static uint8_t *splash_pixels = NULL;
+static lv_image_dsc_t splash_dsc;
+static uint32_t splash_decode_us[PEPBOY_FRAME_COUNT];
+
+static task_layout::StaticTask<task_layout::kDeckKeypad> keypad_task_storage;
+static task_layout::StaticTask<task_layout::kDeckTrackball> trackball_task_storage;
+static bool splash_stats_logged = false;
+
+static size_t splash_frame_bytes()
+{
+    return (size_t)pepboy_frame_w * pepboy_frame_h * 2;
+}
+
+// Apply packed frame `frame` on top of the previous frame already in
+// splash_pixels (frame 0 starts from black). Tokens: 0x00-0x3F skip n+1
+// pixels, 0x40-0x7F repeat next pixel n-0x3F times, 0x80-0xFF copy n-0x7F
+// literal pixels.
+static void decode_splash_frame(int frame)
+{
+    const int64_t start_us = esp_timer_get_time();
+    const size_t frame_bytes = splash_frame_bytes();
+    if (frame == 0) {
+        memset(splash_pixels, 0, frame_bytes);
+    }
+
+    const uint8_t *src = pepboy_frame_stream + pepboy_frame_offsets[frame];
+    const uint8_t *src_end = pepboy_frame_stream + pepboy_frame_offsets[frame + 1];
+    uint8_t *dst = splash_pixels;
+    uint8_t *dst_end = splash_pixels + frame_bytes;
+    while (src < src_end) {
+        const uint8_t token = *src++;
+        size_t len;
+        if (token < 0x40) {
+            len = (size_t)(token + 1) * 2;
+        } else if (token < 0x80) {
+            len = (size_t)(token - 0x3F) * 2;
+        } else {
+            len = (size_t)(token - 0x7F) * 2;
+        }
+        if (len > (size_t)(dst_end - dst)) {
+            ESP_LOGE(TAG, "Splash frame %d overruns buffer", frame);
+            break;
+        }
+        if (token < 0x40) {
+            // Unchanged pixels: already in the buffer
+        } else if (token < 0x80) {
+            const uint8_t lo = src[0];
+            const uint8_t hi = src[1];
+            src += 2;
+            for (size_t i = 0; i < len; i += 2) {
+                dst[i] = lo;
+                dst[i + 1] = hi;
+            }
+        } else {
+            memcpy(dst, src, len);
+            src += len;
+        }
+        dst += len;
+    }
+
+    splash_decode_us[frame] = (uint32_t)(esp_timer_get_time() - start_us);
+}
+
+static void log_splash_stats()
+{
+    uint32_t total_us = 0;
+    uint32_t max_us = 0;
+    for (int i = 0; i < PEPBOY_FRAME_COUNT; i++) {
+        total_us += splash_decode_us[i];
+        if (splash_decode_us[i] > max_us) {
+            max_us = splash_decode_us[i];
+        }
+    }
+    ESP_LOGI(TAG, "Splash decode: avg %lu us, max %lu us per frame (%d frames)",
+             (unsigned long)(total_us / PEPBOY_FRAME_COUNT), (unsigned long)max_us, PEPBOY_FRAME_COUNT);
+}
 
 // Dismiss splash screen (called by touch or keyboard)
 void dismiss_splash_screen()
@@ -70,11 +138,17 @@ void dismiss_splash_screen()
         splash_timer = NULL;
     }
     if (splash_screen) {
-        bsp_display_lock(0);
+        board::Current::display_lock(0);
         lv_scr_load(ssh_screen);
         lv_obj_delete(splash_screen);
         splash_screen = NULL;
-        bsp_display_unlock();
+        splash_img = NULL;
+        if (splash_pixels) {
+            lv_image_cache_drop(&splash_dsc);
+            heap_caps_free(splash_pixels);
+            splash_pixels = NULL;
+        }
+        board::Current::display_unlock();
     }
 }
 
@@ -90,17 +164,51 @@ void splash_timer_cb(lv_timer_t * timer)
     // Update to next frame
     splash_frame++;
     
-    // Wrap frame index (8 frames total) - loop indefinitely
-    if (splash_frame >= 8) {
+    // Wrap frame index - loop indefinitely
+    if (splash_frame >= PEPBOY_FRAME_COUNT) {
         splash_frame = 0;
+        if (!splash_stats_logged) {
+            log_splash_stats();
+            splash_stats_logged = true;
+        }
     }
     
-    // Update image
-    lv_image_set_src(splash_img, pepboy_frames[splash_frame]);
+    // Decode over the shown buffer; the source pointer is unchanged, so drop
+    // any cached copy and invalidate the widget explicitly.
+    decode_splash_frame(splash_frame);
+    lv_image_cache_drop(&splash_dsc);
+    lv_obj_invalidate(splash_img);
 }
 
 void show_splash_screen()
 {
+    const size_t frame_bytes = splash_frame_bytes();
+    splash_pixels = (uint8_t *)heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!splash_pixels) {
+        splash_pixels = (uint8_t *)heap_caps_malloc(frame_bytes, MALLOC_CAP_8BIT);
+    }
+    if (!splash_pixels) {
+        ESP_LOGE(TAG, "No memory for splash frame buffer (%u bytes), skipping splash", (unsigned)frame_bytes);
+        return;
+    }
+    ESP_LOGI(TAG, "Splash frames: %lu packed bytes (raw %lu, %lu saved)",
+             (unsigned long)pepboy_packed_bytes, (unsigned long)pepboy_raw_bytes,
+             (unsigned long)(pepboy_raw_bytes - pepboy_packed_bytes));
+
+    memset(&splash_dsc, 0, sizeof(splash_dsc));
+    splash_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    splash_dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+    splash_dsc.header.w = pepboy_frame_w;
+    splash_dsc.header.h = pepboy_frame_h;
+    splash_dsc.header.stride = pepboy_frame_w * 2;
+    splash_dsc.data_size = frame_bytes;
+    splash_dsc.data = splash_pixels;
+
+    // Reset counter
+    splash_frame = 0;
+    splash_stats_logged = false;
+    decode_splash_frame(0);
+
     // Create splash screen
     splash_screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(splash_screen, lv_color_black(), 0);
@@ -111,16 +219,13 @@ void show_splash_screen()
     
     // Create image object centered on screen
     splash_img = lv_image_create(splash_screen);
-    lv_image_set_src(splash_img, &pepboy_0);
+    lv_image_set_src(splash_img, &splash_dsc);
     lv_obj_align(splash_img, LV_ALIGN_CENTER, 0, 0);
     
     // Load splash screen
     lv_scr_load(splash_screen);
     
-    // Reset counter
-    splash_frame = 0;
-    
-    // Create timer for animation (100ms per frame for smooth walking animation)
+    // Create timer for animation (150ms per frame for smooth walking animation)
     splash_timer = lv_timer_create(splash_timer_cb, 150, NULL);
 }
 
@@ -140,6 +245,8 @@ void keypad_task(void *param)
         if (key)
         {
             ESP_LOGI("KEYPAD", "Key Pressed: %c", (unsigned char)key);
+            metrics::add(metrics::Counter::kKeyEvents);
+            metrics::add(metrics::Counter::kKeyPresses);
 
             // If splash screen is active, dismiss it on any key press
             if (splash_screen) {
@@ -150,10 +257,7 @@ void keypad_task(void *param)
 
             // Send key input to SSH terminal with display lock
             if (ssh_terminal && ssh_screen) {
-                if (bsp_display_lock(0)) {
-                    ssh_terminal->handle_key_input((char)key);
-                    bsp_display_unlock();
-                }
+                ssh_terminal->deliver_key((char)key);
             }
         }
         vTaskDelay(pdMS_TO_TICKS(50)); // Shorter delay for better responsiveness
@@ -176,16 +280,16 @@ void trackball_task(void *param)
         // Detect falling edge (button press)
         if (!up && last_up) {
             // Non-blocking: prioritize screen updates, drop input if display is busy
-            if (ssh_terminal && bsp_display_lock(0)) {
-                ssh_terminal->navigate_history(1); // Older command
-                bsp_display_unlock();
+            if (ssh_terminal) {
+                board::with_display_lock(board::Current::kInputLockWaitMs,
+                                         [] { ssh_terminal->navigate_history(1); }); // Older command
             }
         }
         if (!down && last_down) {
             // Non-blocking: prioritize screen updates, drop input if display is busy
-            if (ssh_terminal && bsp_display_lock(0)) {
-                ssh_terminal->navigate_history(-1); // Newer command
-                bsp_display_unlock();
+            if (ssh_terminal) {
+                board::with_display_lock(board::Current::kInputLockWaitMs,
+                                         [] { ssh_terminal->navigate_history(-1); }); // Newer command
             }
         }
         
@@ -197,17 +301,15 @@ void trackball_task(void *param)
             // Button released - check duration
             uint32_t press_duration = (xTaskGetTickCount() * portTICK_PERIOD_MS) - press_start_time;
             
-            if (ssh_terminal && bsp_display_lock(0)) {
-                if (press_duration >= LONG_PRESS_MS) {
-                    // Long press: Delete current history entry
-                    ESP_LOGI("TRACKBALL", "Long press detected (%lu ms) - deleting command", press_duration);
-                    ssh_terminal->delete_current_history_entry();
-                } else {
-                    // Short press: Execute current input (like Enter key)
-                    ESP_LOGI("TRACKBALL", "Short press detected (%lu ms) - executing current input", press_duration);
-                    ssh_terminal->handle_key_input('\n');
-                }
-                bsp_display_unlock();
+            if (ssh_terminal && press_duration >= LONG_PRESS_MS) {
+                // Long press: Delete current history entry
+                ESP_LOGI("TRACKBALL", "Long press detected (%lu ms) - deleting command", press_duration);
+                board::with_display_lock(board::Current::kInputLockWaitMs,
+                                         [] { ssh_terminal->delete_current_history_entry(); });
+            } else if (ssh_terminal) {
+                // Short press: Execute current input (like Enter key)
+                ESP_LOGI("TRACKBALL", "Short press detected (%lu ms) - executing current input", press_duration);
+                ssh_terminal->deliver_key('\n');
             }
         }
         
@@ -304,9 +406,6 @@ void device_init(void)
     gpio_set_pull_mode(BOARD_BOOT_PIN, GPIO_PULLUP_ONLY);
 }
 
-// Forward declaration
-void load_ssh_keys_from_sd(SSHTerminal* terminal);
-
 extern "C" void app_main(void)
 {
     esp_err_t ret = nvs_flash_init();
@@ -316,16 +415,36 @@ extern "C" void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
 
+    /* CPU at 80 MHz unless network/handshake/render work holds a PM lock */
+    ESP_ERROR_CHECK_WITHOUT_ABORT(power_mgmt::init());
+
     /* Initialize device GPIOs */
     device_init();
 
-    /* Load SSH keys from SD card BEFORE LVGL initialization */
-    // Note: Create a temporary terminal instance just for loading keys
-    SSHTerminal* temp_terminal = new SSHTerminal();
-    load_ssh_keys_from_sd(temp_terminal);
+    /* Load SSH keys from SD card BEFORE LVGL initialization: the card
+       shares the display's SPI pins */
+    const int keys_loaded = board::load_keys_from_sd();
+    if (keys_loaded < 0) {
+        ESP_LOGW(TAG, "SSH keys not loaded: SD card or %s missing", board::kKeysDir);
+    } else {
+        ESP_LOGI(TAG, "Loaded %d SSH key(s) from SD", keys_loaded);
+    }
+    ssh_terminal = new SSHTerminal();
 
-    /* Initialize display and LVGL */
-    lv_display_t *disp = bsp_display_start();
+    /* Initialize display and LVGL (render task pinned per task_layout.hpp) */
+    bsp_display_cfg_t disp_cfg = {
+        .lvgl_port_cfg = ESP_LVGL_PORT_INIT_CONFIG(),
+        .buffer_size = DRAW_BUF_SIZE,
+        .double_buffer = true,
+        .flags = {
+            .buff_dma = true,
+            .buff_spiram = false,
+        },
+    };
+    disp_cfg.lvgl_port_cfg.task_priority = task_layout::kLvgl.priority;
+    disp_cfg.lvgl_port_cfg.task_stack = task_layout::kLvgl.stack_bytes;
+    disp_cfg.lvgl_port_cfg.task_affinity = task_layout::kLvgl.core;
+    lv_display_t *disp = bsp_display_start_with_config(&disp_cfg);
 
     /* Set display brightness to 100% */
     bsp_display_backlight_on();
@@ -344,14 +463,17 @@ extern "C" void app_main(void)
 
     lvgl_port_add_touch(&touch_cfg);
 
-    bsp_display_lock(0);
+    board::Current::display_lock(0);
+
+    power_mgmt::attach_render_hooks(disp);
 
     // Show splash screen animation
     show_splash_screen();
 
-    // Use the terminal instance that already has loaded keys
-    ssh_terminal = temp_terminal;
     ssh_screen = ssh_terminal->create_terminal_screen();
+    if (!splash_screen) {
+        lv_scr_load(ssh_screen);
+    }
     
     // Display version and initial instructions
 #ifdef POCKETSSH_VERSION
@@ -378,184 +500,9 @@ extern "C" void app_main(void)
     // Update status bar to show initial battery voltage
     ssh_terminal->update_status_bar();
 
-    bsp_display_unlock();
+    board::Current::display_unlock();
 
-    xTaskCreate(keypad_task, "keypad_task", 4096, NULL, 5, NULL);
-    
-    xTaskCreate(trackball_task, "trackball_task", 4096, NULL, 5, NULL);
-}
-
-/*
- * Load SSH private keys from SD card
- * Reads all .pem files from /sdcard/ssh_keys/ directory and loads them into memory
- * Must be called BEFORE LVGL initialization to avoid SD card access conflicts
- */
-void load_ssh_keys_from_sd(SSHTerminal* terminal)
-{
-    if (!terminal) {
-        ESP_LOGE(TAG, "Terminal pointer is NULL");
-        return;
-    }
-
-    ESP_LOGI(TAG, "Starting SD card key loading...");
-
-    // SD card mount configuration
-    esp_vfs_fat_sdmmc_mount_config_t mount_config = {
-        .format_if_mount_failed = false,
-        .max_files = 5,
-        .allocation_unit_size = 16 * 1024,
-        .disk_status_check_enable = false,
-        .use_one_fat = false
-    };
-
-    sdmmc_card_t *card = NULL;
-    const char mount_point[] = "/sdcard";
-    
-    ESP_LOGI(TAG, "Mounting SD card...");
-    
-    // Configure SPI bus for SD card (T-Deck Plus uses SPI mode, not SDMMC)
-    spi_bus_config_t bus_cfg = {
-        .mosi_io_num = BOARD_SPI_MOSI,
-        .miso_io_num = BOARD_SPI_MISO,
-        .sclk_io_num = BOARD_SPI_SCK,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        .max_transfer_sz = 4000,
-    };
-    
-    esp_err_t ret = spi_bus_initialize(SPI3_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
-    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
-        ESP_LOGE(TAG, "Failed to initialize SPI bus (%s)", esp_err_to_name(ret));
-        return;
-    }
-    
-    ESP_LOGI(TAG, "SPI bus initialized");
-    
-    // Configure SPI host for SD card
-    sdmmc_host_t host = SDSPI_HOST_DEFAULT();
-    
-    // Configure SD card SPI device
-    sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
-    slot_config.gpio_cs = BOARD_SDCARD_CS;
-    slot_config.host_id = SPI3_HOST;
-    
-    ESP_LOGI(TAG, "Attempting to mount SD card on SPI3...");
-    
-    // Mount SD card using SPI mode
-    ret = esp_vfs_fat_sdspi_mount(mount_point, &host, &slot_config, &mount_config, &card);
-    
-    if (ret != ESP_OK) {
-        if (ret == ESP_FAIL) {
-            ESP_LOGE(TAG, "Failed to mount filesystem");
-        } else {
-            ESP_LOGE(TAG, "Failed to initialize SD card (%s)", esp_err_to_name(ret));
-        }
-        return;
-    }
-    
-    ESP_LOGI(TAG, "SD card mounted successfully");
-
-    // Open the ssh_keys directory
-    const char* keys_dir = "/sdcard/ssh_keys";
-    ESP_LOGI(TAG, "Opening directory: %s", keys_dir);
-    DIR* dir = opendir(keys_dir);
-    
-    if (!dir) {
-        ESP_LOGW(TAG, "Failed to open directory %s - creating it", keys_dir);
-        mkdir(keys_dir, 0755);
-        dir = opendir(keys_dir);
-        if (!dir) {
-            ESP_LOGE(TAG, "Still cannot open directory after creation");
-            esp_vfs_fat_sdcard_unmount(mount_point, card);
-            spi_bus_free(SPI3_HOST);
-            return;
-        }
-    }
-
-    ESP_LOGI(TAG, "Directory opened, scanning for .pem files...");
-
-    // Read all .pem files from directory
-    struct dirent* entry;
-    int keys_loaded = 0;
-    int files_found = 0;
-    
-    while ((entry = readdir(dir)) != NULL) {
-        files_found++;
-        ESP_LOGI(TAG, "Found file: %s", entry->d_name);
-        
-        // Skip . and .. entries
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-            continue;
-        }
-        
-        // Check if file has .pem or .PEM extension (case-insensitive)
-        size_t name_len = strlen(entry->d_name);
-        if (name_len < 5) {
-            ESP_LOGD(TAG, "Skipping file (name too short): %s", entry->d_name);
-            continue;
-        }
-        
-        const char* ext = entry->d_name + name_len - 4;
-        if (strcasecmp(ext, ".pem") != 0) {
-            ESP_LOGI(TAG, "Skipping non-PEM file: %s", entry->d_name);
-            continue;
-        }
-        
-        ESP_LOGI(TAG, "Processing PEM file: %s", entry->d_name);
-        
-        // Build full file path
-        char filepath[256];
-        snprintf(filepath, sizeof(filepath), "%s/%s", keys_dir, entry->d_name);
-        
-        // Open and read the key file
-        FILE* f = fopen(filepath, "rb");
-        if (!f) {
-            ESP_LOGE(TAG, "Failed to open key file: %s", filepath);
-            continue;
-        }
-        
-        // Get file size
-        fseek(f, 0, SEEK_END);
-        long file_size = ftell(f);
-        fseek(f, 0, SEEK_SET);
-        
-        if (file_size <= 0 || file_size > 16384) {
-            ESP_LOGW(TAG, "Invalid key file size: %s (%ld bytes)", entry->d_name, file_size);
-            fclose(f);
-            continue;
-        }
-        
-        // Allocate buffer and read key data
-        char* key_data = (char*)malloc(file_size + 1);
-        if (!key_data) {
-            ESP_LOGE(TAG, "Failed to allocate memory for key: %s", entry->d_name);
-            fclose(f);
-            continue;
-        }
-        
-        size_t bytes_read = fread(key_data, 1, file_size, f);
-        fclose(f);
-        
-        if (bytes_read != (size_t)file_size) {
-            ESP_LOGE(TAG, "Failed to read complete key file: %s", entry->d_name);
-            free(key_data);
-            continue;
-        }
-        
-        key_data[file_size] = '\0';  // Null terminate
-        
-        // Load key into terminal's memory
-        terminal->load_key_from_memory(entry->d_name, key_data, file_size);
-        free(key_data);
-        keys_loaded++;
-    }
-    
-    closedir(dir);
-    
-    ESP_LOGI(TAG, "Total files found: %d, Keys loaded: %d", files_found, keys_loaded);
+    keypad_task_storage.start(keypad_task, NULL);
     
-    // Unmount SD card and deinitialize SPI bus
-    esp_vfs_fat_sdcard_unmount(mount_point, card);
-    spi_bus_free(SPI3_HOST);
-    ESP_LOGI(TAG, "SD card unmounted, %d SSH keys loaded", keys_loaded);
+    trackball_task_storage.start(trackball_task, NULL);
 }
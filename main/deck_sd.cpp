@@ -0,0 +1,95 @@
+#include "deck_sd.hpp"
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "driver/sdspi_host.h"
+#include "driver/spi_common.h"
+#include "esp_log.h"
+#include "esp_vfs_fat.h"
+#include "utilities.h"
+
+namespace deck {
+namespace {
+
+constexpr const char *kTag = "deck_sd";
+constexpr const char *kMountPoint = "/sdcard";
+constexpr const char *kKeysDir = "/sdcard/ssh_keys";
+constexpr spi_host_device_t kSpiHost = SPI3_HOST;
+
+sdmmc_card_t *g_card = nullptr;
+
+}  // namespace
+
+esp_err_t sd_mount()
+{
+    if (g_card != nullptr) {
+        return ESP_OK;
+    }
+
+    esp_vfs_fat_sdmmc_mount_config_t mount_config = {
+        .format_if_mount_failed = false,
+        .max_files = 5,
+        .allocation_unit_size = 16 * 1024,
+        .disk_status_check_enable = false,
+        .use_one_fat = false
+    };
+
+    // T-Deck Plus uses SPI mode, not SDMMC
+    spi_bus_config_t bus_cfg = {
+        .mosi_io_num = BOARD_SPI_MOSI,
+        .miso_io_num = BOARD_SPI_MISO,
+        .sclk_io_num = BOARD_SPI_SCK,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = 4000,
+    };
+
+    esp_err_t ret = spi_bus_initialize(kSpiHost, &bus_cfg, SPI_DMA_CH_AUTO);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(kTag, "Failed to initialize SPI bus (%s)", esp_err_to_name(ret));
+        return ret;
+    }
+
+    sdmmc_host_t host = SDSPI_HOST_DEFAULT();
+    sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
+    slot_config.gpio_cs = BOARD_SDCARD_CS;
+    slot_config.host_id = kSpiHost;
+
+    ESP_LOGI(kTag, "Mounting SD card on SPI3...");
+    ret = esp_vfs_fat_sdspi_mount(kMountPoint, &host, &slot_config, &mount_config, &g_card);
+    if (ret != ESP_OK) {
+        if (ret == ESP_FAIL) {
+            ESP_LOGE(kTag, "Failed to mount filesystem");
+        } else {
+            ESP_LOGE(kTag, "Failed to initialize SD card (%s)", esp_err_to_name(ret));
+        }
+        g_card = nullptr;
+        spi_bus_free(kSpiHost);
+        return ret;
+    }
+
+    DIR *dir = opendir(kKeysDir);
+    if (dir == nullptr) {
+        ESP_LOGW(kTag, "%s missing - creating it", kKeysDir);
+        mkdir(kKeysDir, 0755);
+    } else {
+        closedir(dir);
+    }
+    ESP_LOGI(kTag, "SD card mounted");
+    return ESP_OK;
+}
+
+esp_err_t sd_unmount()
+{
+    if (g_card == nullptr) {
+        return ESP_OK;
+    }
+    esp_vfs_fat_sdcard_unmount(kMountPoint, g_card);
+    g_card = nullptr;
+    spi_bus_free(kSpiHost);
+    ESP_LOGI(kTag, "SD card unmounted");
+    return ESP_OK;
+}
+
+}  // namespace deck
@@ -0,0 +1,221 @@
+#include "event_trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "report_format.hpp"
+
+namespace event_trace {
+namespace {
+
+constexpr const char *kTag = "event_trace";
+
+// 512 records x 12 bytes per core. Internal RAM because the keyboard ISR is
+// registered with ESP_INTR_FLAG_IRAM and may run with the cache disabled.
+constexpr uint32_t kRingRecords = 512;
+static_assert((kRingRecords & (kRingRecords - 1)) == 0, "ring size must be a power of two");
+constexpr uint16_t kIsrTask = 0;
+constexpr UBaseType_t kTaskSlack = 4;
+
+struct Record {
+    uint32_t ts_us;  // low 32 bits of esp_timer; unrolled against "now" on dump
+    uint16_t event;
+    uint16_t task;   // FreeRTOS task number, kIsrTask from interrupts
+    uint32_t arg;
+};
+static_assert(sizeof(Record) == 12, "trace record must stay 12 bytes");
+
+struct Ring {
+    std::atomic<uint32_t> head{0};
+    Record records[kRingRecords];
+};
+
+// Chrome trace phase per event: B/E bracket a span on the recording task, i
+// is an instant. A taken display lock also opens the "lvgl_lock" hold span.
+struct EventInfo {
+    const char *name;
+    char phase;
+};
+constexpr size_t kEventCount = static_cast<size_t>(Event::kCount);
+constexpr EventInfo kEvents[kEventCount] = {
+    {"key_irq", 'i'},
+    {"channel_read", 'i'},
+    {"parse", 'B'},
+    {"parse", 'E'},
+    {"flush", 'B'},
+    {"flush", 'E'},
+    {"lvgl_lock_wait", 'B'},
+    {"lvgl_lock_wait", 'E'},
+    {"lvgl_lock", 'E'},
+    {"nvs_write", 'B'},
+    {"nvs_write", 'E'},
+};
+
+Ring g_rings[portNUM_PROCESSORS];
+std::atomic<bool> g_enabled{true};
+
+using report_format::appendf;
+
+void write_event(FILE *f, bool *first, const char *name, char phase, int core, uint16_t task, int64_t ts_us,
+                 const Record &r)
+{
+    std::fprintf(f, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%u,\"ts\":%" PRId64, *first ? "" : ",",
+                 name, phase, core, static_cast<unsigned>(task), ts_us);
+    *first = false;
+    if (phase == 'i') {
+        std::fprintf(f, ",\"s\":\"t\"");
+    }
+    if (phase != 'E' || r.arg != 0) {
+        std::fprintf(f, ",\"args\":{\"arg\":%" PRIu32 "}", r.arg);
+    }
+    std::fputc('}', f);
+}
+
+void write_metadata(FILE *f, bool *first)
+{
+    for (int core = 0; core < portNUM_PROCESSORS; ++core) {
+        std::fprintf(f, "%s\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"core%d\"}}",
+                     *first ? "" : ",", core, core);
+        *first = false;
+        std::fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"isr\"}}",
+                     core, static_cast<unsigned>(kIsrTask));
+    }
+
+    const UBaseType_t capacity = uxTaskGetNumberOfTasks() + kTaskSlack;
+    auto *tasks = static_cast<TaskStatus_t *>(std::malloc(sizeof(TaskStatus_t) * capacity));
+    if (tasks == nullptr) {
+        return;
+    }
+    const UBaseType_t count = uxTaskGetSystemState(tasks, capacity, nullptr);
+    for (UBaseType_t i = 0; i < count; ++i) {
+        for (int core = 0; core < portNUM_PROCESSORS; ++core) {
+            std::fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                         core, static_cast<unsigned>(tasks[i].xTaskNumber), tasks[i].pcTaskName);
+        }
+    }
+    std::free(tasks);
+}
+
+}  // namespace
+
+void IRAM_ATTR record(Event event, uint32_t arg)
+{
+    if (!g_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    Ring &ring = g_rings[xPortGetCoreID()];
+    // Only this core writes this ring; the atomic increment keeps an ISR that
+    // preempts a recording task from claiming the same slot.
+    const uint32_t seq = ring.head.fetch_add(1, std::memory_order_relaxed);
+    Record &r = ring.records[seq & (kRingRecords - 1)];
+    r.ts_us = static_cast<uint32_t>(esp_timer_get_time());
+    r.event = static_cast<uint16_t>(event);
+    r.task = xPortInIsrContext() ? kIsrTask
+                                 : static_cast<uint16_t>(uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()));
+    r.arg = arg;
+}
+
+void set_enabled(bool enabled)
+{
+    g_enabled.store(enabled);
+}
+
+bool enabled()
+{
+    return g_enabled.load();
+}
+
+void clear()
+{
+    const bool was_enabled = g_enabled.exchange(false);
+    vTaskDelay(1);  // let a record() in flight on the other core finish
+    for (Ring &ring : g_rings) {
+        ring.head.store(0);
+    }
+    g_enabled.store(was_enabled);
+}
+
+esp_err_t dump_chrome_json(const char *path, size_t *out_records, bool (*stop)())
+{
+    if (path == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    FILE *f = std::fopen(path, "w");
+    if (f == nullptr) {
+        ESP_LOGW(kTag, "open %s failed (errno=%d)", path, errno);
+        return ESP_FAIL;
+    }
+
+    const bool was_enabled = g_enabled.exchange(false);
+    vTaskDelay(1);
+
+    const int64_t now_us = esp_timer_get_time();
+    const uint32_t now_low = static_cast<uint32_t>(now_us);
+    size_t written = 0;
+    bool first = true;
+    bool stopped = false;
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", f);
+    write_metadata(f, &first);
+    for (int core = 0; core < portNUM_PROCESSORS && !stopped; ++core) {
+        const Ring &ring = g_rings[core];
+        const uint32_t head = ring.head.load();
+        const uint32_t count = std::min(head, kRingRecords);
+        for (uint32_t seq = head - count; seq != head; ++seq) {
+            if (stop != nullptr && stop()) {
+                stopped = true;
+                break;
+            }
+            const Record &r = ring.records[seq & (kRingRecords - 1)];
+            if (r.event >= kEventCount) {
+                continue;
+            }
+            // Records are younger than the 71-minute wrap of the low word.
+            const int64_t ts_us = now_us - static_cast<uint32_t>(now_low - r.ts_us);
+            const EventInfo &info = kEvents[r.event];
+            write_event(f, &first, info.name, info.phase, core, r.task, ts_us, r);
+            if (r.event == static_cast<uint16_t>(Event::kLvglLockAcquired) && r.arg != 0) {
+                write_event(f, &first, "lvgl_lock", 'B', core, r.task, ts_us, r);
+            }
+            written++;
+        }
+    }
+    std::fputs("\n]}\n", f);
+    const bool ok = std::ferror(f) == 0 && !stopped;
+    std::fclose(f);
+
+    g_enabled.store(was_enabled);
+    if (out_records != nullptr) {
+        *out_records = written;
+    }
+    ESP_LOGI(kTag, "wrote %u records to %s", static_cast<unsigned>(written), path);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+size_t format_status(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    size_t used = 0;
+    appendf(out, out_len, &used, "trace: %s, %u records/core ring\n", enabled() ? "on" : "off",
+            static_cast<unsigned>(kRingRecords));
+    for (int core = 0; core < portNUM_PROCESSORS; ++core) {
+        const uint32_t head = g_rings[core].head.load();
+        appendf(out, out_len, &used, "core%d: %" PRIu32 " recorded, %" PRIu32 " held, %" PRIu32 " overwritten\n",
+                core, head, std::min(head, kRingRecords), head > kRingRecords ? head - kRingRecords : 0);
+    }
+    return used;
+}
+
+}  // namespace event_trace
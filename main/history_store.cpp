@@ -0,0 +1,150 @@
+#include "history_store.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "esp_log.h"
+#include "event_trace.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+
+namespace history_store {
+namespace {
+
+constexpr const char *kTag = "history";
+constexpr const char *kNamespace = "storage";
+constexpr const char *kCountKey = "hist_count";
+
+void entry_key(uint32_t index, char *key, size_t key_len)
+{
+    std::snprintf(key, key_len, "hist_%" PRIu32, index);
+}
+
+}  // namespace
+
+void load(std::vector<std::string> *history)
+{
+    if (history == nullptr) {
+        return;
+    }
+
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(kNamespace, NVS_READONLY, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(kTag, "Failed to open NVS for reading history: %s", esp_err_to_name(err));
+        return;
+    }
+
+    uint32_t history_count = 0;
+    err = nvs_get_u32(handle, kCountKey, &history_count);
+    if (err != ESP_OK || history_count == 0) {
+        ESP_LOGI(kTag, "No command history found in NVS");
+        nvs_close(handle);
+        return;
+    }
+
+    ESP_LOGI(kTag, "Loading %" PRIu32 " commands from NVS...", history_count);
+
+    history->clear();
+    for (uint32_t i = 0; i < history_count && i < kMaxEntries; i++) {
+        char key[16];
+        entry_key(i, key, sizeof(key));
+
+        size_t required_size = 0;
+        err = nvs_get_str(handle, key, NULL, &required_size);
+        if (err != ESP_OK) {
+            continue;
+        }
+
+        char *cmd = static_cast<char *>(std::malloc(required_size));
+        if (cmd) {
+            err = nvs_get_str(handle, key, cmd, &required_size);
+            if (err == ESP_OK) {
+                history->push_back(std::string(cmd));
+            }
+            std::free(cmd);
+        }
+    }
+
+    nvs_close(handle);
+    ESP_LOGI(kTag, "Loaded %d commands from NVS", static_cast<int>(history->size()));
+}
+
+void save(const std::vector<std::string> &history)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(kNamespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(kTag, "Failed to open NVS for writing history: %s", esp_err_to_name(err));
+        return;
+    }
+
+    size_t start_idx = 0;
+    if (history.size() > kMaxEntries) {
+        start_idx = history.size() - kMaxEntries;
+    }
+
+    const uint32_t history_count = history.size() - start_idx;
+    event_trace::record(event_trace::Event::kNvsWriteBegin, history_count);
+    err = nvs_set_u32(handle, kCountKey, history_count);
+    if (err != ESP_OK) {
+        ESP_LOGE(kTag, "Failed to save history count: %s", esp_err_to_name(err));
+        event_trace::record(event_trace::Event::kNvsWriteEnd);
+        nvs_close(handle);
+        return;
+    }
+
+    int saved_count = 0;
+    for (size_t i = start_idx; i < history.size(); i++) {
+        char key[16];
+        entry_key(static_cast<uint32_t>(i - start_idx), key, sizeof(key));
+
+        err = nvs_set_str(handle, key, history[i].c_str());
+        if (err != ESP_OK) {
+            ESP_LOGW(kTag, "Failed to save command %zu: %s", i, esp_err_to_name(err));
+        } else {
+            saved_count++;
+        }
+
+        if (saved_count % 10 == 0) {
+            vTaskDelay(1);
+        }
+    }
+
+    err = nvs_commit(handle);
+    event_trace::record(event_trace::Event::kNvsWriteEnd);
+    if (err != ESP_OK) {
+        ESP_LOGE(kTag, "Failed to commit NVS changes: %s", esp_err_to_name(err));
+    } else {
+        ESP_LOGI(kTag, "Saved %d commands to NVS", saved_count);
+    }
+
+    nvs_close(handle);
+}
+
+void clear()
+{
+    nvs_handle_t handle;
+    if (nvs_open(kNamespace, NVS_READWRITE, &handle) != ESP_OK) {
+        return;
+    }
+
+    uint32_t history_count = 0;
+    nvs_get_u32(handle, kCountKey, &history_count);
+
+    event_trace::record(event_trace::Event::kNvsWriteBegin, history_count);
+    for (uint32_t i = 0; i < history_count && i < kMaxEntries; i++) {
+        char key[16];
+        entry_key(i, key, sizeof(key));
+        nvs_erase_key(handle, key);
+    }
+
+    nvs_erase_key(handle, kCountKey);
+    nvs_commit(handle);
+    event_trace::record(event_trace::Event::kNvsWriteEnd);
+    nvs_close(handle);
+}
+
+}  // namespace history_store
@@ -6,7 +6,8 @@
 #include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_cali.h"
 #include "esp_adc/adc_cali_scheme.h"
-#include <vector>
+#include <array>
+#include <cstdint>
 
 class BatteryMeasurement
 {
@@ -17,12 +18,27 @@ public:
     // Initializes the battery measurement with delayed ADC init
     esp_err_t init();
 
-    // Reads the battery voltage
+    // Reads the battery voltage (burst of one-shots, trimmed mean)
     float readBatteryVoltage();
 
     // Converts the battery voltage to percentage
     int voltageToPercentage(float voltage);
 
+    // Takes a reading and feeds the gauge. loadMilliamps is the caller's
+    // estimate of the current draw at sample time, used to undo the sag
+    // across the cell's internal resistance. Call periodically.
+    void update(float loadMilliamps, int64_t nowMs);
+
+    // Load-compensated, filtered voltage; 0 until the first valid update()
+    float filteredVoltage() const { return filteredVolts; }
+
+    // Percentage of the filtered voltage, -1 until the first valid update()
+    int filteredPercentage() const;
+
+    // Minutes until empty at the recent discharge rate, -1 when unknown
+    // (not enough history, charging, or a flat trend)
+    int minutesRemaining() const;
+
     // Deinitializes
     void deinit();
 
@@ -33,6 +49,12 @@ private:
         int percentage; // Corresponding battery percentage
     };
 
+    struct GaugeSample
+    {
+        int64_t timeMs;
+        float percentage;
+    };
+
     static constexpr const char *TAG = "BATTERY_MEASUREMENT";
     static constexpr int BAT_ADC_PIN = 4; // GPIO4 for battery ADC
     static constexpr adc_channel_t ADC_CHANNEL = ADC_CHANNEL_3; // GPIO4 = ADC1_CH3
@@ -41,14 +63,56 @@ private:
     static constexpr adc_bitwidth_t ADC_BITWIDTH = ADC_BITWIDTH_12; // 12-bit resolution
     static constexpr float DIVIDER_RATIO = 2.0f; // Voltage divider correction
 
-    static const std::vector<BatteryLevel> batteryCurve;
+    static constexpr int BURST_SAMPLES = 16; // One-shots per reading
+    static constexpr int BURST_TRIM = 4;     // Dropped from each end before averaging
+
+    static constexpr float INTERNAL_RESISTANCE_OHM = 0.15f; // Cell + protection + wiring, approx.
+    static constexpr float FILTER_ALPHA_UP = 0.3f;   // Recovery after a load step
+    static constexpr float FILTER_ALPHA_DOWN = 0.05f; // Sag: TX bursts barely move it
+
+    static constexpr int64_t HISTORY_INTERVAL_MS = 60 * 1000; // One trend point per minute
+    static constexpr size_t HISTORY_LEN = 30;                  // 30 minute trend window
+    static constexpr size_t HISTORY_MIN_POINTS = 5;
+
+    static constexpr std::array<BatteryLevel, 7> batteryCurve = {{
+        {4.20f, 100},
+        {4.00f, 90},
+        {3.85f, 75},
+        {3.70f, 50},
+        {3.60f, 25},
+        {3.50f, 10},
+        {3.30f, 0},
+    }};
 
     adc_oneshot_unit_handle_t adcHandle;
     adc_cali_handle_t caliHandle;
     bool calibrationEnabled;
 
+    float filteredVolts;
+    std::array<GaugeSample, HISTORY_LEN> history;
+    size_t historyCount;
+    size_t historyHead;
+
     // Interpolates the voltage-to-percentage using the lookup table
-    int interpolateVoltage(float voltage);
+    static constexpr float interpolateVoltage(float voltage)
+    {
+        if (voltage >= batteryCurve.front().voltage)
+        {
+            return 100.0f;
+        }
+        for (size_t i = 0; i + 1 < batteryCurve.size(); ++i)
+        {
+            const BatteryLevel &p1 = batteryCurve[i];
+            const BatteryLevel &p2 = batteryCurve[i + 1];
+            if (voltage > p2.voltage)
+            {
+                return p2.percentage + (voltage - p2.voltage) * (p1.percentage - p2.percentage) / (p1.voltage - p2.voltage);
+            }
+        }
+        return 0.0f;
+    }
+
+    void recordTrendPoint(int64_t nowMs);
 };
 
-#endif // BATTERY_MEASUREMENT_HPP
\ No newline at end of file
+#endif // BATTERY_MEASUREMENT_HPP
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esp_err.h"
+#include "key_store.hpp"
+#include "lvgl.h"
+
+// What differs between the T-Deck Plus and the T-Pager, resolved at compile
+// time. Shared code (ssh_terminal, the board entry points) calls
+// board::Current and never tests TPAGER_TARGET for these; the hooks below
+// are inline wrappers around the board's own driver calls, so the display
+// lock costs the same as calling lvgl_port_lock()/bsp_display_lock()
+// directly.
+//
+// Board features that only exist on one side (T-Pager backlight profiles,
+// input replay) stay behind TPAGER_TARGET in the code that uses them.
+namespace board {
+
+enum class Id : uint8_t { kDeck, kTPager };
+
+// Terminal screen geometry and colours (0xRRGGBB).
+struct TerminalLayout {
+    uint32_t status_color;
+    uint32_t byte_counter_color;
+    uint32_t output_color;
+    uint32_t output_border_color;
+    uint8_t output_border_width;
+    uint32_t input_color;
+    int16_t edge_x;             // status bar / byte counter inset
+    int16_t edge_y;
+    int16_t output_width_trim;  // output and input row: 100% minus this
+    int16_t output_height_pct;
+    int16_t output_top;
+    int16_t input_width_trim;
+    int16_t input_height;
+    lv_align_t input_align;
+    int16_t input_x;
+    int16_t input_y;
+};
+
+constexpr const char *kKeysDir = "/sdcard/ssh_keys";
+
+template <Id>
+struct Traits;
+
+template <>
+struct Traits<Id::kDeck> {
+    // The card is on the display's pins and is only mounted at boot, before
+    // the display starts; runtime file access finds it unmounted.
+    static constexpr bool kRuntimeSd = false;
+    static constexpr bool kSdSharesDisplayBus = true;
+    // How long input tasks wait for the display lock before dropping a key.
+    // The keypad task polls every 50 ms, so it barely waits. Not 0: the BSP
+    // reads a zero timeout as wait forever.
+    static constexpr uint32_t kInputLockWaitMs = 1;
+    static constexpr const char *kCancelChord = "Ctrl+C";
+    static constexpr TerminalLayout kLayout = {
+        0x00FF00, 0x00FFFF, 0x00FF00, 0x00FF00, 2, 0xFFFF00,
+        5, 5, 0, 75, 25, 10, 25, LV_ALIGN_BOTTOM_LEFT, 5, -5,
+    };
+    static constexpr const char *kBanner =
+        "\n"
+        "  ================================================\n"
+        "           POCKET SSH TERM - ESP32-S3\n"
+        "  ================================================\n"
+        "\n"
+        "  Commands:\n"
+        "   connect <ALIAS> - Resolve via ssh_config and SSH key\n"
+        "   connect <SSID> <PASSWORD>  - WiFi connect\n"
+        "     Use quotes for spaces: connect \"My WiFi\" \"my pass\"\n"
+        "   hosts - List aliases from /sdcard/ssh_keys/ssh_config\n"
+        "   ssh <HOST> <PORT> <USER> <PASS> - SSH\n"
+        "   sshkey <HOST> <PORT> <USER> <KEYFILE> - SSH key\n"
+        "   disconnect - WiFi off | exit - SSH off\n"
+        "   clear - Clear screen | help - Show help\n"
+        "\n"
+        "  Ready. Type 'connect' to start...\n\n";
+
+    static bool display_lock(uint32_t timeout_ms);
+    static void display_unlock();
+    static esp_err_t sd_mount();
+    static esp_err_t sd_unmount();
+};
+
+template <>
+struct Traits<Id::kTPager> {
+    // Mounted on demand for ssh_config, traces and stats snapshots.
+    static constexpr bool kRuntimeSd = true;
+    static constexpr bool kSdSharesDisplayBus = true;
+    static constexpr uint32_t kInputLockWaitMs = 25;
+    static constexpr const char *kCancelChord = "Alt+Backspace";
+    // A 1 px side inset keeps the border visible on the panel edges while
+    // leaving the most character columns.
+    static constexpr TerminalLayout kLayout = {
+        0xD9F2E6, 0xAEE6FF, 0xF7FFF9, 0x48A878, 1, 0xFFE9A8,
+        4, 2, 2, 76, 18, 2, 22, LV_ALIGN_BOTTOM_MID, 0, -2,
+    };
+    static constexpr const char *kBanner =
+        "PocketSSH T-Pager\n"
+        "Type 'help' for commands.\n"
+        "Start with: hosts, connect <alias>, or connect <SSID> <PASSWORD>\n\n";
+
+    static bool display_lock(uint32_t timeout_ms);
+    static void display_unlock();
+    static esp_err_t sd_mount();
+    static esp_err_t sd_unmount();
+};
+
+}  // namespace board
+
+// Hooks for the board being built. The other board's are declared but never
+// defined, so calling them is a link error rather than a silent no-op.
+#if defined(TPAGER_TARGET)
+#include "esp_lvgl_port.h"
+#include "tpager_sd.hpp"
+
+namespace board {
+
+using Current = Traits<Id::kTPager>;
+
+inline bool Traits<Id::kTPager>::display_lock(uint32_t timeout_ms)
+{
+    return lvgl_port_lock(timeout_ms);
+}
+
+inline void Traits<Id::kTPager>::display_unlock()
+{
+    lvgl_port_unlock();
+}
+
+inline esp_err_t Traits<Id::kTPager>::sd_mount()
+{
+    tpager::SdDiagStats stats = {};
+    return tpager::sd_mount_and_scan_keys(&stats);
+}
+
+inline esp_err_t Traits<Id::kTPager>::sd_unmount()
+{
+    return tpager::sd_unmount();
+}
+
+}  // namespace board
+#else
+#include "bsp/esp-bsp.h"
+#include "deck_sd.hpp"
+
+namespace board {
+
+using Current = Traits<Id::kDeck>;
+
+inline bool Traits<Id::kDeck>::display_lock(uint32_t timeout_ms)
+{
+    return bsp_display_lock(timeout_ms);
+}
+
+inline void Traits<Id::kDeck>::display_unlock()
+{
+    bsp_display_unlock();
+}
+
+inline esp_err_t Traits<Id::kDeck>::sd_mount()
+{
+    return deck::sd_mount();
+}
+
+inline esp_err_t Traits<Id::kDeck>::sd_unmount()
+{
+    return deck::sd_unmount();
+}
+
+}  // namespace board
+#endif
+
+namespace board {
+
+// Run `fn` under the display lock. False when the UI held the lock for
+// longer than `timeout_ms` and `fn` did not run.
+template <typename Fn>
+bool with_display_lock(uint32_t timeout_ms, Fn &&fn)
+{
+    if (!Current::display_lock(timeout_ms)) {
+        return false;
+    }
+    fn();
+    Current::display_unlock();
+    return true;
+}
+
+// Mount the card, store every key in /sdcard/ssh_keys, unmount. Returns the
+// number of keys stored, -1 when the card or the directory is missing.
+// Boot only. Once the display runs, hold the display lock around it
+// (kSdSharesDisplayBus).
+inline int load_keys_from_sd()
+{
+    if (Current::sd_mount() != ESP_OK) {
+        return -1;
+    }
+    const int loaded = key_store::load_dir(kKeysDir);
+    ESP_ERROR_CHECK_WITHOUT_ABORT(Current::sd_unmount());
+    return loaded;
+}
+
+}  // namespace board
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "esp_err.h"
+
+namespace deck {
+
+// Mount /sdcard via SDSPI on SPI3 and create /sdcard/ssh_keys if missing.
+// The T-Deck card shares pins with the display, so this only runs before
+// the display is started.
+esp_err_t sd_mount();
+// Unmount and release the SPI bus again.
+esp_err_t sd_unmount();
+
+}  // namespace deck
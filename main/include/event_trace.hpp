@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+// Always-on event trace for profiling stalls. Each core has its own ring of
+// fixed-size records (timestamp, event, task, arg) in internal RAM; recording
+// is one atomic increment plus a 12-byte store, and is safe from IRAM ISRs.
+// Old records are overwritten. `trace dump` turns the rings into a Chrome
+// trace (chrome://tracing, Perfetto) with one process per core and one thread
+// per task.
+namespace event_trace {
+
+enum class Event : uint16_t {
+    kKeyIrq = 0,        // T-Pager keyboard interrupt
+    kChannelRead,       // arg: bytes returned by libssh2_channel_read
+    kParseBegin,        // arg: chunk length
+    kParseEnd,
+    kFlushBegin,        // arg: 1 when the screen changed since the last render
+    kFlushEnd,
+    kLvglLockWait,      // display lock requested
+    kLvglLockAcquired,  // arg: 1 when taken, 0 on timeout
+    kLvglLockRelease,
+    kNvsWriteBegin,     // arg: entries written
+    kNvsWriteEnd,
+    kCount,
+};
+
+void record(Event event, uint32_t arg = 0);
+
+void set_enabled(bool enabled);
+bool enabled();
+// Drop every recorded event.
+void clear();
+
+// Write the rings as Chrome trace JSON. Recording pauses while the file is
+// written. The caller mounts the filesystem. When `stop` is given and
+// returns true between records, the file is closed early (still valid
+// JSON) and ESP_FAIL returned.
+esp_err_t dump_chrome_json(const char *path, size_t *out_records, bool (*stop)() = nullptr);
+
+// Render the `trace` status report (newline-separated lines).
+size_t format_status(char *out, size_t out_len);
+
+}  // namespace event_trace
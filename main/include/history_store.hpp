@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Command-line history persisted in the NVS "storage" namespace as
+// hist_count plus one hist_<n> string per entry, oldest first.
+namespace history_store {
+
+constexpr size_t kMaxEntries = 100;
+
+// Replace `history` with the stored entries. Leaves it untouched when
+// nothing is stored.
+void load(std::vector<std::string> *history);
+
+// Store the newest kMaxEntries entries of `history`.
+void save(const std::vector<std::string> &history);
+
+// Erase every stored entry.
+void clear();
+
+}  // namespace history_store
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "esp_err.h"
+#include "tpager_encoder.hpp"
+#include "tpager_tca8418.hpp"
+
+// Recorded T-Pager input: timestamped Tca8418Event / EncoderEvent sequences
+// that the runtime can replay into poll_keyboard()/poll_encoder() in place
+// of the I2C and GPIO reads, so input-to-render latency and dropped keys can
+// be compared between builds. The same files replay on the host
+// (`pocketssh_host input`).
+//
+// File format, one event per line; '#' starts a comment:
+//   <t_us> K <pressed> <key> <ch> <erase> <raw>   keyboard event
+//   <t_us> E <delta> <transitions> <changed> <pressed>   encoder event
+// t_us counts from the start of the recording, <key> is a Tca8418Key name
+// (char, enter, bksp, alt, caps, sym, space, unknown), <ch> and <raw> are
+// hex bytes. Matrix row/column are not recorded.
+namespace input_replay {
+
+constexpr const char *kDefaultPath = "/sdcard/input.rec";
+// Recordings stop growing past this many events.
+constexpr size_t kMaxEvents = 2048;
+
+struct Event {
+    int64_t t_us = 0;
+    bool is_key = false;
+    tpager::Tca8418Event key;
+    tpager::EncoderEvent encoder;
+};
+
+// Parse a recording; on failure `bad_line` (1-based) names the offending
+// line. Events must be in time order.
+bool parse(FILE *file, std::vector<Event> *events, size_t *bad_line);
+bool write(FILE *file, const std::vector<Event> &events);
+
+// The character the runtime types for `ev`, or false when it types nothing.
+bool terminal_char(const tpager::Tca8418Event &ev, char *out_key);
+
+// Recording and replay are exclusive. The input task records and delivers
+// the events; starting and stopping is safe from another task, such as the
+// command worker doing the file I/O. start_replay() refuses while a replay
+// or a recording is running.
+esp_err_t start_recording();
+// Stop recording and write the events to `path` (the caller mounts it).
+esp_err_t stop_recording(const char *path);
+bool recording();
+void record_key(const tpager::Tca8418Event &ev);
+void record_encoder(const tpager::EncoderEvent &ev);
+
+esp_err_t start_replay(const char *path);
+esp_err_t start_replay(std::vector<Event> events);
+void stop_replay();
+bool replaying();
+// True once, when the last event of a replay has been delivered.
+bool take_replay_finished();
+
+// Next due replay event. next_key() follows tca8418_poll_event()'s
+// contract (ESP_ERR_NOT_FOUND when none is due); `due_us` is the
+// esp_timer time the event was scheduled for.
+esp_err_t next_key(tpager::Tca8418Event *ev, int64_t *due_us);
+esp_err_t next_encoder(tpager::EncoderEvent *ev);
+
+// Latency bookkeeping: a key typed at `input_us` is charged to the
+// kKeyRenderUs histogram when the next frame finishes (note_frame_ready(),
+// from the display's LV_EVENT_REFR_READY).
+void note_key_typed(int64_t input_us);
+void note_frame_ready();
+
+// Render the `input` command report (newline-separated lines).
+size_t format_report(char *out, size_t out_len);
+
+}  // namespace input_replay
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+#include "esp_err.h"
+
+// One worker task (cmd_worker) for built-in commands that block: WiFi
+// association, SSH connect, SD card reads. The caller queues a job and
+// returns at once, so the input task and LVGL keep running while it works.
+// One job at a time; a second submit is refused rather than queued.
+//
+// Cancellation is cooperative: cancel() raises a flag that the job polls
+// with cancelled() between steps and in its retry loops.
+namespace job_runner {
+
+typedef void (*JobFn)(void *ctx, const char *args);
+
+// Longest `args` string submit() accepts, including the terminator.
+constexpr size_t kMaxArgs = 192;
+
+// Start the worker. Safe to call more than once.
+esp_err_t start();
+
+// Queue `fn(ctx, args)` on the worker. `name` must outlive the job (a
+// string literal). ESP_ERR_INVALID_STATE while a job is running,
+// ESP_ERR_INVALID_SIZE when `args` does not fit.
+esp_err_t submit(const char *name, JobFn fn, void *ctx, const char *args);
+
+bool busy();
+// Name of the job queued or running, nullptr when idle.
+const char *current();
+
+// Ask the current job to stop. False when there is none.
+bool cancel();
+// True on the worker once cancel() was called for the running job.
+bool cancelled();
+
+bool on_worker();
+
+}  // namespace job_runner
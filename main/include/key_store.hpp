@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+// Private key material loaded from the SD card. Keys live in one PSRAM arena
+// of fixed slots allocated on first use; names are matched case-insensitively
+// through a small open-addressed index, without building temporary strings.
+// A slot is wiped as soon as its key is replaced or evicted.
+//
+// Keys are stored from the boot task and read by the input task once boot is
+// done; there is no locking.
+namespace key_store {
+
+constexpr size_t kMaxKeys = 8;
+constexpr size_t kMaxKeyBytes = 16 * 1024;
+constexpr size_t kMaxNameLen = 63;
+
+// Copy `len` bytes of key data into a slot named `name` (a key with the same
+// name is overwritten). The source buffer is not touched; callers wipe it.
+esp_err_t put(const char *name, const char *data, size_t len);
+
+// Key data for `name` (NUL-terminated, so it can go straight to libssh2), or
+// nullptr. Points into the arena and stays valid until the key is replaced
+// or evicted.
+const char *find(const char *name, size_t *len);
+
+// Zeroize and release one key / every key. The arena itself is kept.
+bool evict(const char *name);
+void clear();
+
+size_t count();
+
+// Store every *.pem file in `dir` under its file name. Returns how many
+// were stored, -1 when the directory cannot be opened. The card must be
+// mounted (and, where it shares a bus with the display, held) by the caller.
+int load_dir(const char *dir);
+
+// Stored (lowercased) name of the index-th key in slot order; nullptr past
+// the end.
+const char *name_at(size_t index);
+
+// Overwrite `len` bytes so the compiler cannot drop the store.
+void wipe(void *data, size_t len);
+
+}  // namespace key_store
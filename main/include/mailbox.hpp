@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "metrics.hpp"
+
+// Bounded, typed message queues between tasks. A task that owns some state
+// (the SSH session on ssh_rx, the widgets on taskLVGL) is only reached
+// through its mailbox, so nothing else touches that state or has to take a
+// lock for it. Messages are copied into statically allocated queue storage;
+// a full mailbox refuses the post rather than growing.
+//
+// A mailbox can feed a depth histogram (the depth each receive() finds,
+// including the message it takes); all of them feed the queue_full counter
+// and are listed by the `stats` command with their high-water mark.
+namespace mailbox {
+
+// Shared by every Mailbox instantiation; read by format_report().
+struct Stats {
+    const char *name = nullptr;
+    QueueHandle_t queue = nullptr;
+    UBaseType_t capacity = 0;
+    metrics::Histogram depth_histogram = metrics::Histogram::kCount;
+    std::atomic<uint32_t> posted{0};
+    std::atomic<uint32_t> full{0};
+    std::atomic<uint32_t> high_water{0};
+};
+
+namespace detail {
+void attach(Stats *stats);
+void note_post(Stats *stats, bool ok);
+void note_receive(Stats *stats);
+}  // namespace detail
+
+// N messages of type T. Define one per mailbox at namespace scope (the
+// storage lives in .bss) and init() it before the first post or receive.
+template <typename T, size_t N>
+class Mailbox {
+    static_assert(std::is_trivially_copyable<T>::value, "mailbox messages are copied bytewise");
+
+public:
+    explicit Mailbox(const char *name, metrics::Histogram depth_histogram = metrics::Histogram::kCount)
+    {
+        stats_.name = name;
+        stats_.capacity = N;
+        stats_.depth_histogram = depth_histogram;
+    }
+
+    Mailbox(const Mailbox &) = delete;
+    Mailbox &operator=(const Mailbox &) = delete;
+
+    bool init()
+    {
+        if (queue_ == nullptr) {
+            queue_ = xQueueCreateStatic(N, sizeof(T), storage_, &queue_buffer_);
+            stats_.queue = queue_;
+            detail::attach(&stats_);
+        }
+        return queue_ != nullptr;
+    }
+
+    // False when the mailbox stayed full for `wait` ticks (or is not set up).
+    bool post(const T &msg, TickType_t wait = 0)
+    {
+        if (queue_ == nullptr) {
+            return false;
+        }
+        const bool ok = xQueueSend(queue_, &msg, wait) == pdTRUE;
+        detail::note_post(&stats_, ok);
+        return ok;
+    }
+
+    bool receive(T *msg, TickType_t wait = 0)
+    {
+        if (queue_ == nullptr || xQueueReceive(queue_, msg, wait) != pdTRUE) {
+            return false;
+        }
+        detail::note_receive(&stats_);
+        return true;
+    }
+
+    // Drop whatever is queued, e.g. messages meant for a finished session.
+    void clear()
+    {
+        if (queue_ != nullptr) {
+            xQueueReset(queue_);
+        }
+    }
+
+private:
+    QueueHandle_t queue_ = nullptr;
+    StaticQueue_t queue_buffer_;
+    uint8_t storage_[N * sizeof(T)];
+    Stats stats_;
+};
+
+// Render the mailbox table for `stats` (newline-separated lines).
+size_t format_report(char *out, size_t out_len);
+
+}  // namespace mailbox
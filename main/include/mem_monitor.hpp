@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Heap telemetry: internal/PSRAM free space, largest block, minimum-ever free
+// and fragmentation, plus per-subsystem attribution. Subsystems that call
+// malloc themselves go through the tagged allocator; the ones that live in
+// their own pool or containers report a footprint with set_usage().
+namespace mem_monitor {
+
+enum class Tag : uint8_t {
+    kLibssh2 = 0,  // session allocator (libssh2_session_init_ex)
+    kLvgl,         // LVGL builtin pool usage
+    kTerminal,     // receive/input/history buffers (scrollback is in LVGL)
+    kKeys,         // key_store PSRAM arena
+    kCount,
+};
+
+void *tagged_malloc(Tag tag, size_t size);
+void *tagged_realloc(Tag tag, void *ptr, size_t size);
+void tagged_free(void *ptr);
+
+void set_usage(Tag tag, size_t bytes);
+
+// Take a heap sample; warns once when internal fragmentation crosses the
+// threshold (and again only after it recovers). Call periodically.
+void sample();
+
+// Log a snapshot tagged with `stage`. Returns false (and warns) when the
+// largest internal block is below what an SSH session setup needs, so the
+// caller can free memory before libssh2_session_init fails.
+bool check_session_headroom(const char *stage);
+
+// Render the `mem` command report (newline-separated lines).
+size_t format_report(char *out, size_t out_len);
+
+}  // namespace mem_monitor
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+// Process-wide counters and latency histograms, registered by enum so a hot
+// path pays one atomic add (counters) or a short critical section
+// (histograms) and no lookup. Histogram buckets are powers of two, so
+// percentiles are reported as bucket upper bounds.
+namespace metrics {
+
+enum class Counter : uint8_t {
+    kRxBytes = 0,        // session bytes read from the channel (never reset)
+    kTxBytes,            // bytes written to the channel
+    kRxReads,            // libssh2_channel_read calls that returned data
+    kKeyIrqs,            // T-Pager keyboard interrupts
+    kKeyEvents,          // keyboard events (press + release on the T-Pager)
+    kKeyPresses,
+    kKeyReleases,
+    kEncoderTransitions, // T-Pager rotary encoder quadrature transitions
+    kSshAttempts,        // connect / connect_with_key calls
+    kSshConnects,        // attempts that reached an open channel
+    kLockTimeouts,       // display_lock() calls that gave up
+    kKeyDrops,           // keys not typed because the LVGL lock timed out
+    kQueueFull,          // mailbox posts refused because the mailbox was full
+    kRxYields,           // ssh_rx used up its time slice and called taskYIELD()
+    kRxSleeps,           // ssh_rx busy past its limit and slept a tick
+    kCount,
+};
+
+enum class Histogram : uint8_t {
+    kAppendTextUs = 0,   // SSHTerminal::append_text
+    kFlushUs,            // SSHTerminal::flush_display_buffer
+    kLockWaitUs,         // terminal display_lock() acquire time
+    kHandshakeMs,        // libssh2_session_handshake
+    kRxChunkBytes,       // size of each channel read
+    kKeyRenderUs,        // T-Pager key read (or replay due time) to the next frame
+    kNetQueueDepth,      // ssh_rx mailbox depth at each receive
+    kUiQueueDepth,       // UI mailbox depth at each receive
+    kJobMs,              // built-in command jobs on cmd_worker, submit to return
+    kScreenRenderUs,     // SSHTerminal::show_screen, grid to textarea
+    kCount,
+};
+
+// ISR-safe.
+void add(Counter counter, uint32_t n = 1);
+uint32_t value(Counter counter);
+
+void observe(Histogram histogram, uint32_t sample);
+
+// Zero every counter and histogram.
+void reset();
+
+// Render the `stats` command report (newline-separated lines).
+size_t format_report(char *out, size_t out_len);
+
+// Append one compact JSON line (uptime, build, counters, histogram
+// count/p50/p99/max) to `path`. The caller mounts the filesystem.
+esp_err_t append_snapshot(const char *path);
+
+}  // namespace metrics
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Splash animation frames, delta/RLE packed by lvgl_pepboy_img/pack_frames.py.
+// Frame N is encoded against frame N-1 (frame 0 against black); see the
+// script for the token format. Pixels are LV_COLOR_FORMAT_RGB565.
+#define PEPBOY_FRAME_COUNT 8
+
+extern const uint16_t pepboy_frame_w;
+extern const uint16_t pepboy_frame_h;
+extern const uint32_t pepboy_raw_bytes;
+extern const uint32_t pepboy_packed_bytes;
+extern const uint32_t pepboy_frame_offsets[PEPBOY_FRAME_COUNT + 1];
+extern const uint8_t pepboy_frame_stream[];
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+// Dynamic frequency scaling: the CPU idles at kMinCpuMhz and is raised to
+// kMaxCpuMhz only while one of the locks below is held. Each lock belongs to
+// one kind of work and is held only while that work is in progress.
+namespace power_mgmt {
+
+constexpr int kMaxCpuMhz = 240;
+constexpr int kMinCpuMhz = 80;
+
+enum class Lock : uint8_t {
+    kNetwork = 0,  // ssh_rx while data is flowing
+    kHandshake,    // SSH key exchange + authentication
+    kRender,       // LVGL refresh (REFR_START .. REFR_READY)
+    kCount,
+};
+
+// Create the PM locks and enable DFS. Safe to call without CONFIG_PM_ENABLE;
+// locks then only feed the statistics.
+esp_err_t init();
+
+// Switch between DFS (min..max) and a fixed kMaxCpuMhz at runtime, so the
+// same workload can be compared both ways.
+esp_err_t set_dfs_enabled(bool enabled);
+bool dfs_enabled();
+
+// Let the idle task put the chip into automatic light sleep (needs tickless
+// idle). Held off while any lock below is taken; GPIO/WiFi wake sources are
+// the caller's business.
+esp_err_t set_light_sleep_enabled(bool enabled);
+bool light_sleep_enabled();
+
+void acquire(Lock lock);
+void release(Lock lock);
+
+// Holds `lock` for the lifetime of the scope.
+class CpuBoost {
+public:
+    explicit CpuBoost(Lock lock) : lock_(lock) { acquire(lock_); }
+    ~CpuBoost() { release(lock_); }
+    CpuBoost(const CpuBoost &) = delete;
+    CpuBoost &operator=(const CpuBoost &) = delete;
+
+private:
+    Lock lock_;
+};
+
+// Hold the render lock across each display refresh and time the frames.
+// Call with the display lock held.
+void attach_render_hooks(lv_display_t *disp);
+
+void record_handshake_us(uint32_t us);
+
+// Clear accumulated lock/frame/handshake statistics.
+void reset_stats();
+
+// Render the `dfs` command report (newline-separated lines).
+size_t format_report(char *out, size_t out_len);
+
+}  // namespace power_mgmt
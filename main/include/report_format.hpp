@@ -0,0 +1,31 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+
+// Helpers for the text reports that the built-in commands print (tasks,
+// dfs, mem, trace, stats, ...), each written into a caller's fixed buffer.
+// Builds for the host target as well.
+namespace report_format {
+
+// printf at out + *used and advance *used. Output that does not fit is cut
+// off; `out` stays NUL-terminated, and once it is full later calls do
+// nothing.
+__attribute__((format(printf, 4, 5)))
+inline void appendf(char *out, size_t out_len, size_t *used, const char *fmt, ...)
+{
+    if (*used + 1 >= out_len) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int n = std::vsnprintf(out + *used, out_len - *used, fmt, args);
+    va_end(args);
+    if (n > 0) {
+        *used = std::min(out_len - 1, *used + static_cast<size_t>(n));
+    }
+}
+
+}  // namespace report_format
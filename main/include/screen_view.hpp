@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "lvgl.h"
+#include "vt_screen.hpp"
+
+// The session screen as LVGL widgets: one label per vt_screen ring row, in
+// a vertically scrolling column ordered from the oldest scrollback row down
+// to the bottom screen row. apply() sets only the rows a Frame carries, so
+// an echoed key invalidates one row of the panel instead of the whole
+// output area. A scroll moves the labels that wrap round from the top of
+// the ring to the bottom of the column; the rows that became scrollback
+// keep their text and are not set again. Builds for the host target as
+// well (with LVGL).
+//
+// LVGL task or display lock held, like any widget.
+namespace screen_view {
+
+class View {
+public:
+    // Builds the column on `parent`, hidden. The caller sizes, places and
+    // styles it; the labels inherit its font and text colour.
+    lv_obj_t *create(lv_obj_t *parent);
+
+    lv_obj_t *obj() const { return column_; }
+    bool shown() const { return column_ != nullptr && !lv_obj_has_flag(column_, LV_OBJ_FLAG_HIDDEN); }
+    void set_shown(bool shown);
+
+    // Show a frame taken from the screen. While the column is scrolled to
+    // the bottom it stays there.
+    void apply(const vt_screen::Frame &frame);
+
+    // Blank rows, no scrollback. The next frame must carry every screen
+    // row, as one taken after vt_screen::Screen::reset() does.
+    void clear();
+
+    // The scrollback, then the shown rows, one line each.
+    void text(std::string *out) const;
+
+private:
+    // The label at `position` down the column, 0 being the oldest
+    // scrollback row and kScrollbackRows the top screen row.
+    lv_obj_t *at(uint16_t position) const
+    {
+        return rows_[(top_ + vt_screen::kRows + position) % vt_screen::kRingRows];
+    }
+    bool in_use(uint16_t position) const;
+
+    lv_obj_t *column_ = nullptr;
+    lv_obj_t *rows_[vt_screen::kRingRows] = {};  // by ring row
+    // The column is ordered for this Frame::top.
+    uint16_t top_ = 0;
+    // Scrollback rows shown (Frame::history).
+    uint16_t history_ = 0;
+    // Screen rows after this one are hidden (Frame::last_row).
+    uint16_t last_row_ = vt_screen::kRows - 1;
+};
+
+}  // namespace screen_view
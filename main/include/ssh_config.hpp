@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// OpenSSH-style client config (the subset PocketSSH honours) and the string
+// helpers shared with the command line. Pure C++ with no ESP-IDF
+// dependencies so it also builds in the host target; locating and mounting
+// the file stays with the caller.
+namespace ssh_config {
+
+// Relative and ~/.ssh/ IdentityFile paths resolve under this directory.
+constexpr const char *kKeysRoot = "/sdcard/ssh_keys/";
+
+struct Options {
+    bool has_host_name = false;
+    std::string host_name;
+
+    bool has_user = false;
+    std::string user;
+
+    bool has_port = false;
+    int port = 22;
+
+    bool has_identities_only = false;
+    bool identities_only = false;
+    std::vector<std::string> identity_files;
+
+    bool has_connect_timeout = false;
+    int connect_timeout = 0;
+
+    bool has_server_alive_interval = false;
+    int server_alive_interval = 0;
+
+    bool has_server_alive_count_max = false;
+    int server_alive_count_max = 0;
+
+    bool has_strict_host_key_checking = false;
+    std::string strict_host_key_checking;
+
+    bool has_network = false;
+    std::string network;
+};
+
+struct HostBlock {
+    std::vector<std::string> patterns;
+    Options options;
+};
+
+struct Config {
+    Options global_options;
+    std::vector<HostBlock> host_blocks;
+    std::vector<std::string> aliases;  // literal Host patterns, first-seen order
+};
+
+struct Resolved {
+    bool matched = false;
+    std::string alias;
+    std::string host_name;
+    std::string user;
+    int port = 22;
+    bool identities_only = false;
+    std::vector<std::string> identity_files;
+    std::string strict_host_key_checking = "ask";
+    std::string network;
+};
+
+std::vector<std::string> split_nonempty_whitespace(const std::string &input);
+// Whitespace-separated arguments from `start_pos`; '...' and "..." group.
+std::vector<std::string> split_quoted_arguments(const std::string &input, size_t start_pos);
+std::string lowercase_ascii(std::string value);
+std::string base_name(const std::string &path);
+// Case-insensitive glob with '*' and '?'.
+bool wildcard_match(const std::string &pattern, const std::string &candidate);
+
+// Parse an open config stream into `parsed` (reset first). Lines longer than
+// 511 bytes are split.
+bool parse(FILE *file, Config *parsed);
+
+// Merge the global options and every matching Host block for `alias`, in
+// file order. False when no Host block matches.
+bool resolve(const Config &config, const std::string &alias, Resolved *resolved);
+
+}  // namespace ssh_config
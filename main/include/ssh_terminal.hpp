@@ -9,11 +9,14 @@
 
 #include "lvgl.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include <string>
 #include <vector>
-#include <map>
+#include <atomic>
 #include "libssh2.h"
 #include "battery_measurement.hpp"
+#include "screen_view.hpp"
 
 #define SSH_MAX_LINE_LENGTH 128
 #define SSH_MAX_LINES 100
@@ -35,6 +38,9 @@ public:
     void append_text(const char* text);
     void clear_terminal();
     void handle_key_input(char key);
+    // handle_key_input() from an input task: takes the display lock for the
+    // board's input wait, false (counted in key_drops) when it was busy.
+    bool deliver_key(char key);
     void send_command(const char* cmd);
     void navigate_history(int direction);
     void delete_current_history_entry();
@@ -49,40 +55,81 @@ public:
     
     lv_obj_t* get_screen() { return terminal_screen; }
     
+    // LVGL task or display lock held; from the command worker it posts a
+    // refresh to the LVGL task instead.
     void update_status_bar();
     
+    // Gauge-filtered battery percentage, -1 until the first sample
+    int battery_percent() const { return battery_pct.load(); }
+    
     // SSH key management
     void load_key_from_memory(const char* keyname, const char* key_data, size_t key_len);
     const char* get_loaded_key(const char* keyname, size_t* len);
     std::vector<std::string> get_loaded_key_names();
     
+    // Called from the SSH receive task whenever session output arrives, so a
+    // board's idle logic can treat output like input. Keep it short.
+    //
+    // Task ownership: the widgets and the input line belong to whoever holds
+    // the display lock. From start_receive() until the session ends, the
+    // libssh2 session, channel and receive-side buffers belong to ssh_rx;
+    // send_command(), send_special_key() and `exit` reach it through its
+    // mailbox, and it reaches the widgets through the UI mailbox, drained by
+    // an LVGL timer. ssh_rx never takes the display lock.
+    typedef void (*activity_cb_t)(void* ctx);
+    void set_activity_callback(activity_cb_t cb, void* ctx);
+    
 private:
     lv_obj_t* terminal_screen;
     lv_obj_t* terminal_output;
+    screen_view::View session_view;     // replaces terminal_output during a session
     lv_obj_t* input_label;
     lv_obj_t* status_bar;
+    lv_obj_t* status_battery_label;
+    lv_obj_t* status_wifi_label;
+    lv_obj_t* status_rssi_label;
+    lv_obj_t* status_ssh_label;
     lv_obj_t* byte_counter_label;
-    lv_obj_t* side_panel;
+    lv_obj_t* side_panel;               // built on first use, NULL when released
+    lv_timer_t* side_panel_release_timer;
+    lv_obj_t* top_overlay;              // live `top` view over the output, NULL when closed
+    lv_timer_t* top_timer;
     
     std::string current_input;
     size_t cursor_pos;
-    size_t bytes_received;
+    size_t bytes_received;              // ssh_rx
+    size_t bytes_shown;                 // ssh_rx, last count posted as kByteCount
     std::vector<std::string> command_history;
     int history_index;
     
     lv_timer_t* cursor_blink_timer;
     bool cursor_visible;
     
-    lv_timer_t* battery_update_timer;
+    // Filled by status_sampler_task; update_status_bar only reads these.
+    TaskHandle_t status_sampler_handle;
+    TaskHandle_t ssh_rx_handle;         // static, notified once per session
+    std::atomic<bool> rx_active{false}; // ssh_rx owns the session while set
+    std::atomic<int> battery_mv{-1};    // gauge-filtered, -1 until first sample
+    std::atomic<int> battery_minutes{-1}; // runtime estimate, -1 when unknown
+    std::atomic<int> battery_pct{-1};   // gauge-filtered, -1 until first sample
+    std::atomic<int> rssi_dbm{0};       // EMA-filtered, 0 when not associated
+    
+    // Last values pushed to the status bar labels
+    struct StatusBarCache {
+        int battery_cv = -2;
+        int remaining_min = -2;
+        int link_state = -1;
+        int rssi_dbm = 1;
+    } status_cache;
     
     bool history_needs_save;
     lv_timer_t* history_save_timer;
+    lv_timer_t* ui_mailbox_timer;
     
-    std::string text_buffer;
-    int64_t last_display_update;
+    int64_t last_display_update;        // ssh_rx
     
-    bool wifi_connected;
-    bool ssh_connected;
+    std::atomic<bool> wifi_connected;
+    std::atomic<bool> ssh_connected;
     bool battery_initialized;
     
     BatteryMeasurement battery;
@@ -94,28 +141,80 @@ private:
     char* hostname;
     int port_number;
     
-    // SSH key storage: keyname -> key content
-    std::map<std::string, std::string> loaded_keys;
+    activity_cb_t activity_cb;
+    void* activity_ctx;
     
     void update_terminal_display();
     void update_input_display();
     void process_received_data(const char* data, size_t len);
     void flush_display_buffer();
+    void attach_screen();               // LVGL task, on kAttachScreen
+    void show_screen();                 // LVGL task, on kScreen
+    bool sync_session_view();           // LVGL task or display lock held
+    void detach_screen();
+    void set_byte_counter(size_t bytes);
+    // Push terminal/LVGL footprints to mem_monitor. Display lock held.
+    void report_memory_usage();
     
-    void load_history_from_nvs();
-    void save_history_to_nvs();
-    void clear_history_nvs();
-    std::string strip_ansi_codes(const char* data, size_t len);
     void send_special_key(const char* sequence);
     void create_side_panel();
+    void show_side_panel();
+    void hide_side_panel();
     void toggle_side_panel();
+    bool side_panel_visible() const;
+    void show_top_overlay(uint32_t period_ms);
+    void hide_top_overlay();
+    static void top_refresh_cb(lv_timer_t* timer);
     static void gesture_event_cb(lv_event_t* e);
     static void special_key_event_cb(lv_event_t* e);
     static void input_touch_event_cb(lv_event_t* e);
     static void cursor_blink_cb(lv_timer_t* timer);
-    static void battery_update_cb(lv_timer_t* timer);
+    static void status_sampler_task(void* param);
     static void history_save_cb(lv_timer_t* timer);
+    static void side_panel_release_cb(lv_timer_t* timer);
+    static void ui_mailbox_cb(lv_timer_t* timer);
     static void ssh_receive_task(void* param);
+    void receive_session();
+    esp_err_t start_receive();
+    bool drain_net_mailbox();
+    void write_channel(const char* data, size_t len);
+    
+    // Built-in commands, looked up by their first word. Jobs (connect, ssh,
+    // sshkey, hosts) block on the network or the SD card, so they run on the
+    // command worker while the user keeps typing; the rest run in place.
+    // A command that only touches the SD card for some arguments (trace
+    // dump, stats sd on, input stop/play) runs as a job for those only.
+    struct CommandSpec {
+        const char* name;
+        uint8_t flags;                  // kCommand* below
+        void (SSHTerminal::*run)(const std::string& args);
+        const char* help;               // lines for `help`
+    };
+    static constexpr uint8_t kCommandBare = 1;  // matches "name"
+    static constexpr uint8_t kCommandArgs = 2;  // matches "name ARGS"
+    static constexpr uint8_t kCommandJob = 4;
+    static const CommandSpec kCommands[];
+    bool run_command(const std::string& line);
+    static void run_job(void* ctx, const char* line);
+    void cmd_hosts(const std::string& args);
+    void cmd_connect(const std::string& args);
+    void cmd_netinfo(const std::string& args);
+    void cmd_top(const std::string& args);
+    void cmd_tasks(const std::string& args);
+    void cmd_dfs(const std::string& args);
+    void cmd_mem(const std::string& args);
+    void cmd_trace(const std::string& args);
+    void cmd_stats(const std::string& args);
+#if defined(TPAGER_TARGET)
+    void cmd_power(const std::string& args);
+    void cmd_input(const std::string& args);
+#endif
+    void cmd_ssh(const std::string& args);
+    void cmd_sshkey(const std::string& args);
+    void cmd_disconnect(const std::string& args);
+    void cmd_exit(const std::string& args);
+    void cmd_clear(const std::string& args);
+    void cmd_help(const std::string& args);
     
     static int waitsocket(int socket_fd, LIBSSH2_SESSION *session);
     esp_err_t ssh_authenticate(const char* username, const char* password);
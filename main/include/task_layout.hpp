@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Core placement policy (ESP32-S3, two cores):
+// - Core 0 renders. The LVGL port task owns lv_timer_handler() and the panel
+//   flush, so layout/draw work never competes with SSH crypto for a core.
+// - Core 1 talks. WiFi driver, lwIP (pinned via sdkconfig), the SSH receive
+//   task (libssh2 crypto), keyboard/encoder input and boot hooks live here.
+//
+// Task table (single source of truth; larger number = higher priority):
+//
+// | Task                  | Core | Prio | Stack | Owner                        |
+// |-----------------------|------|------|-------|------------------------------|
+// | taskLVGL              | 0    | 4    | 8192  | esp_lvgl_port (display init) |
+// | tpager_runtime_task   | 1    | 6    | 8192  | tpager_base (input poll)     |
+// | keypad_task           | 1    | 6    | 4096  | deck_base (input poll)       |
+// | trackball_task        | 1    | 6    | 4096  | deck_base (input poll)       |
+// | ssh_rx                | 1    | 5    | 6144  | ssh_terminal (libssh2 read)  |
+// | tpager_wifi_auto_task | 1    | 4    | 6144  | tpager_base (boot test hook) |
+// | cmd_worker            | 1    | 4    | 8192  | job_runner (connect, hosts)  |
+// | status_sampler        | 1    | 2    | 4096  | ssh_terminal (battery/RSSI)  |
+// | wifi / tiT            | 1    | 23/18| -     | ESP-IDF (sdkconfig affinity) |
+//
+// Input sits one level above ssh_rx so a keystroke preempts a long crypto/read
+// burst on the shared core instead of waiting for a time slice.
+//
+// ssh_rx never takes the LVGL lock: its output reaches taskLVGL through the
+// UI mailbox and writes reach it through its own (mailbox.hpp).
+//
+// Long-lived tasks use StaticTask: stack and TCB live in .bss, so a missing
+// stack shows up in the link map instead of as a failed create at connect
+// time. ssh_rx is started once at boot and woken per session; cmd_worker
+// waits on its job mailbox. Only taskLVGL is still heap-allocated
+// (esp_lvgl_port creates it during display init).
+// The `tasks` command prints the high-water marks to tune the sizes above.
+namespace task_layout {
+
+constexpr BaseType_t kRenderCore = 0;
+constexpr BaseType_t kNetworkCore = 1;
+
+struct TaskSpec {
+    const char *name;
+    BaseType_t core;
+    UBaseType_t priority;
+    uint32_t stack_bytes;
+};
+
+constexpr TaskSpec kLvgl = {"taskLVGL", kRenderCore, 4, 8192};
+constexpr TaskSpec kTPagerInput = {"tpager_runtime_task", kNetworkCore, 6, 8192};
+constexpr TaskSpec kDeckKeypad = {"keypad_task", kNetworkCore, 6, 4096};
+constexpr TaskSpec kDeckTrackball = {"trackball_task", kNetworkCore, 6, 4096};
+constexpr TaskSpec kSshRx = {"ssh_rx", kNetworkCore, 5, 6144};
+constexpr TaskSpec kTPagerWifiAuto = {"tpager_wifi_auto_task", kNetworkCore, 4, 6144};
+// Runs the SSH handshake and key auth for `connect`, so sized like the input
+// task that used to.
+constexpr TaskSpec kCommandWorker = {"cmd_worker", kNetworkCore, 4, 8192};
+constexpr TaskSpec kStatusSampler = {"status_sampler", kNetworkCore, 2, 4096};
+
+constexpr const TaskSpec *kAllTasks[] = {
+    &kLvgl,  &kTPagerInput,    &kDeckKeypad,    &kDeckTrackball,
+    &kSshRx, &kTPagerWifiAuto, &kCommandWorker, &kStatusSampler,
+};
+
+// Spec for a task name from the table above, nullptr for ESP-IDF tasks.
+// FreeRTOS truncates names to configMAX_TASK_NAME_LEN - 1 characters.
+inline const TaskSpec *find_spec(const char *name)
+{
+    for (const TaskSpec *spec : kAllTasks) {
+        if (std::strncmp(spec->name, name, configMAX_TASK_NAME_LEN - 1) == 0) {
+            return spec;
+        }
+    }
+    return nullptr;
+}
+
+inline BaseType_t create_task(const TaskSpec &spec, TaskFunction_t fn, void *arg, TaskHandle_t *out_handle = nullptr)
+{
+    return xTaskCreatePinnedToCore(fn, spec.name, spec.stack_bytes, arg, spec.priority, out_handle, spec.core);
+}
+
+// Statically allocated stack + TCB for the task described by Spec. Define
+// one per task at namespace scope; start() cannot fail for lack of memory.
+// A task that deletes itself may only be restarted after the idle task has
+// cleaned it up.
+template <const TaskSpec &Spec>
+class StaticTask {
+public:
+    TaskHandle_t start(TaskFunction_t fn, void *arg)
+    {
+        handle_ = xTaskCreateStaticPinnedToCore(fn, Spec.name, Spec.stack_bytes, arg, Spec.priority, stack_, &tcb_,
+                                                Spec.core);
+        return handle_;
+    }
+
+    TaskHandle_t handle() const { return handle_; }
+
+private:
+    StackType_t stack_[Spec.stack_bytes / sizeof(StackType_t)];
+    StaticTask_t tcb_;
+    TaskHandle_t handle_ = nullptr;
+};
+
+}  // namespace task_layout
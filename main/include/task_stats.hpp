@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+
+namespace task_stats {
+
+struct CoreLoad {
+    uint32_t window_ms = 0;
+    float busy_pct[portNUM_PROCESSORS] = {};
+};
+
+// Per-core utilization since the previous call (first call: since boot).
+// Requires CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS with the esp_timer clock.
+bool sample_core_load(CoreLoad *out);
+
+// Render a `top`-style report into `out` (newline-separated lines): per-core
+// load and each task's share of one core since the previous call.
+size_t format_top(char *out, size_t out_len);
+
+// Render the `tasks` report: stack size (for tasks in task_layout), stack
+// high-water mark and each task's share of one core since the previous call.
+size_t format_tasks(char *out, size_t out_len);
+
+}  // namespace task_stats
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Escape-sequence removal and the bounded text buffer that carried session
+// output to the widget before vt_screen. The replay benchmark still runs it
+// as the baseline for the screen path, and kFlushChunk sizes the text
+// pieces of the UI mailbox. Builds for the host target as well.
+namespace terminal_text {
+
+// Once the pending text grows past kPendingMax only the newest kPendingKeep
+// bytes are kept; the widget could not show the dropped part in time anyway.
+constexpr size_t kPendingMax = 2048;
+constexpr size_t kPendingKeep = 1024;
+
+// Append `data` to `out` without CSI/OSC/charset escape sequences and CRs.
+// Yields for a tick every 1 KB of input.
+void strip_ansi(const char *data, size_t len, std::string *out);
+
+// strip_ansi() into `pending`, then apply the kPendingMax bound.
+void buffer_output(std::string *pending, const char *data, size_t len);
+
+// Pending text goes to the widget in pieces of at most kFlushChunk bytes,
+// one display-lock hold each.
+constexpr size_t kFlushChunk = 256;
+
+// Takes one NUL-terminated piece of text. Returns false when it cannot take
+// it now (display lock busy); the piece is offered again on the next flush.
+typedef bool (*Sink)(const char *text, void *ctx);
+
+// Hand `pending` to `sink` piece by piece, yielding a tick after each, until
+// it is empty or the sink refuses. Returns the number of bytes consumed,
+// which are removed from `pending`.
+size_t flush(std::string *pending, Sink sink, void *ctx);
+
+}  // namespace terminal_text
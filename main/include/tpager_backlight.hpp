@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_err.h"
+
+namespace tpager {
+
+// Brightness presets. The pager has no ambient light sensor, so the profile
+// is picked by the user (`power day|night|saver`) and kept in NVS.
+enum class BacklightProfile : uint8_t {
+    Day = 0,
+    Night,
+    Saver,
+    Count,
+};
+
+// What the idle policy asks for; the profile maps it to a duty cycle.
+enum class BacklightLevel : uint8_t {
+    Full = 0,
+    Dim,
+    Off,
+};
+
+// Display backlight on GPIO 42, driven by LEDC PWM with hardware fades.
+// Not thread-safe: call from the T-Pager input task (idle policy, terminal
+// commands) after init.
+esp_err_t backlight_init(uint8_t percent = 100);
+esp_err_t backlight_set_percent(uint8_t percent, uint32_t fade_ms = 0, bool wait = false);
+uint8_t backlight_percent();
+
+// Apply `level` of the current profile, capped for low battery. fade_ms 0
+// switches at once (and cuts short a running fade).
+esp_err_t backlight_set_level(BacklightLevel level, uint32_t fade_ms = 0, bool wait = false);
+
+esp_err_t backlight_set_profile(BacklightProfile profile, bool persist = true);
+BacklightProfile backlight_profile();
+const char *backlight_profile_name(BacklightProfile profile);
+bool backlight_profile_from_name(const char *name, BacklightProfile *out);
+// Load the saved profile from NVS (keeps Day when none is stored).
+void backlight_restore_profile();
+
+// Feed the battery gauge (-1 = unknown). Below 20% the brightness is capped,
+// harder below 10%.
+void backlight_set_battery_percent(int percent);
+
+// Render the `power` command report (newline-separated lines).
+size_t backlight_format_report(char *out, size_t out_len);
+
+}  // namespace tpager
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace tpager {
+
+// Pager idle policy. With no input or session output the backlight dims,
+// then goes off (levels come from the backlight profile); Off also pauses
+// LVGL and lets the chip enter automatic light sleep. Any input, output or
+// wake pin returns straight to Active.
+enum class IdleStage : uint8_t {
+    Active,
+    Dimmed,
+    Off,
+};
+
+struct IdleWakePin {
+    gpio_num_t pin = GPIO_NUM_NC;
+    gpio_int_type_t awake_intr = GPIO_INTR_DISABLE;  // restored on wake
+};
+
+struct IdleConfig {
+    uint32_t dim_after_ms = 30 * 1000;
+    uint32_t off_after_ms = 60 * 1000;
+    // Active-low lines that wake the chip while Off. Each needs an ISR
+    // registered that calls idle_wake_from_isr() and notifies the owner.
+    IdleWakePin wake_pins[2];
+};
+
+// `owner` is the task that calls idle_poll(); it is notified whenever the
+// state needs attention while it is blocked.
+esp_err_t idle_init(const IdleConfig &config, TaskHandle_t owner);
+
+// Record activity. Safe from any task.
+void idle_note_input();
+void idle_note_output();
+
+// Call from a wake pin's ISR before notifying the owner. While Off the pins
+// are level-triggered, so this masks the pin until the owner wakes up.
+void idle_wake_from_isr(gpio_num_t pin);
+
+// Advance the state machine; owner task only. Returns how long the owner may
+// block before the next call.
+TickType_t idle_poll();
+
+IdleStage idle_stage();
+
+}  // namespace tpager
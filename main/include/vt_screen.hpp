@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The remote terminal as a grid of character cells. Session output is
+// parsed in place, straight from the channel read buffer: a printable byte
+// is written once, into its cell, and nothing else is buffered per byte.
+// The grid is a ring of kRingRows rows: the screen, and above it the rows
+// that scrolled off the top, up to kScrollbackRows of them. A scroll moves
+// the top of the screen along the ring, so a row that leaves the screen
+// stays where it is stored and becomes scrollback without being copied.
+// The grid tracks which ring rows changed, and at most once per UI frame
+// take_frame() copies out just those, so an echoed key costs one row
+// rather than the whole screen. Builds for the host target as well.
+//
+// Parser state survives between feed() calls, so an escape sequence split
+// across two channel reads is still consumed whole. Understood: CR, LF,
+// BS, HT, cursor movement (CSI A B C D E F G H d f, ESC 7/8, CSI s/u),
+// erase (CSI J, K, X), ESC D/E/M and ESC c. SGR, modes, OSC titles and
+// charset designators are consumed and dropped. Bytes outside ASCII show
+// as '?', one cell per UTF-8 character.
+//
+// Not thread-safe: the caller serialises feed() against render().
+namespace vt_screen {
+
+// The PTY size requested from sshd (ssh_open_channel()).
+constexpr uint16_t kCols = 80;
+constexpr uint16_t kRows = 24;
+// Longest render(): every row and its newline, plus the terminator.
+constexpr size_t kRenderMax = kRows * (kCols + 1) + 1;
+// Scrolled-off rows kept above the screen; older ones are reused for new
+// rows at the bottom.
+constexpr uint16_t kScrollbackRows = 40;
+constexpr uint16_t kRingRows = kRows + kScrollbackRows;
+
+// One bit per ring row, bit s for ring row s.
+using RowMask = uint64_t;
+static_assert(kRingRows <= 64, "RowMask holds one bit per ring row");
+
+struct Stats {
+    uint64_t bytes_in = 0;           // bytes passed to feed()
+    uint64_t cell_writes = 0;        // bytes stored into cells
+    uint64_t render_bytes = 0;       // text produced by render() and take_frame()
+    uint32_t renders = 0;            // take_frame() calls
+    uint32_t scrolls = 0;
+};
+
+// What take_frame() copies out: the ring rows that changed since the last
+// take, and where the screen and the scrollback sit in the ring.
+struct Frame {
+    // Screen row r is ring row (top + r) % kRingRows. The `history` ring
+    // rows before top are the scrollback, the newest right above the
+    // screen; the other ring rows hold nothing.
+    uint16_t top = 0;
+    uint16_t history = 0;
+    // Screen rows below this one are blank and below the cursor; render()
+    // leaves them out.
+    uint16_t last_row = 0;
+    RowMask rows = 0;  // ring rows whose text[] was filled
+    char text[kRingRows][kCols + 1] = {};  // by ring row, trailing blanks trimmed
+};
+
+class Screen {
+public:
+    Screen();
+
+    // Blank screen, cursor home, parser in ground state. Stats and the
+    // scrollback are kept.
+    void reset();
+    // Forget the scrollback; the screen is left alone.
+    void clear_scrollback() { history_ = 0; }
+
+    void feed(const char *data, size_t len);
+
+    // Local output (command replies, connect progress) at the cursor, as
+    // if the session had printed it: '\n' starts a new line. The parser
+    // state is left alone, so a sequence the session sent half of still
+    // completes.
+    void write_text(const char *text);
+
+    // True when the grid or the cursor changed since the last take_frame().
+    bool dirty() const { return dirty_; }
+
+    // Copy the changed ring rows into `frame` and mark the grid clean.
+    void take_frame(Frame *frame);
+
+    // The visible rows as NUL-terminated text, trailing blanks trimmed,
+    // down to the last non-blank row or the cursor row. Returns the length.
+    // Leaves the dirty state alone.
+    size_t render(char *out, size_t out_len);
+
+    const Stats &stats() const { return stats_; }
+    uint16_t cursor_row() const { return row_; }
+    uint16_t cursor_col() const { return col_; }
+
+private:
+    enum class State : uint8_t { kGround, kEscape, kCsi, kOsc, kOscEscape, kCharset, kUtf8 };
+
+    static constexpr size_t kMaxParams = 4;
+
+    char *row_cells(uint16_t row) { return cells_[(top_ + row) % kRingRows]; }
+    void mark_row(uint16_t row) { dirty_rows_ |= RowMask{1} << ((top_ + row) % kRingRows); }
+    uint16_t last_row();
+    void put(char c);
+    void line_feed();
+    void reverse_line_feed();
+    void clear_cells(uint16_t row, uint16_t from, uint16_t to);
+    void erase_display(uint16_t mode);
+    void erase_line(uint16_t mode);
+    void move_to(int row, int col);
+    void esc_dispatch(char c);
+    void csi_dispatch(char c);
+    uint16_t param(size_t index, uint16_t fallback) const;
+
+    // Row r of the screen is cells_[(top_ + r) % kRingRows]; scrolling
+    // moves top_ and blanks one row instead of shifting the grid. The
+    // history_ rows before top_ are the scrollback.
+    char cells_[kRingRows][kCols];
+    uint16_t top_ = 0;
+    uint16_t history_ = 0;
+    uint16_t row_ = 0;
+    uint16_t col_ = 0;
+    uint16_t saved_row_ = 0;
+    uint16_t saved_col_ = 0;
+    // Cursor sat on the last column after a write; the next printable
+    // character wraps first.
+    bool wrap_pending_ = false;
+    bool dirty_ = false;
+    RowMask dirty_rows_ = 0;
+
+    State state_ = State::kGround;
+    uint16_t params_[kMaxParams];
+    uint8_t param_count_ = 0;
+    uint8_t utf8_remaining_ = 0;
+    bool csi_private_ = false;
+
+    Stats stats_;
+};
+
+}  // namespace vt_screen
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Cooperative time slicing for a task working through a backlog, such as
+// ssh_rx during an output burst. A vTaskDelay(1) between items sleeps a whole
+// tick (10 ms at CONFIG_FREERTOS_HZ=100) however little work is pending.
+// Instead the task works until its slice is used up, then offers the core
+// with taskYIELD(), which costs a context switch at most.
+//
+// taskYIELD() never runs a lower-priority task. So once the task has worked
+// for busy_limit_us without blocking it sleeps one tick, letting the tasks
+// below it and the idle task (checked by the task watchdog) run on its core.
+// Builds for the host target as well.
+namespace work_budget {
+
+enum class Action : uint8_t { kNone, kYield, kSleep };
+
+class Budget {
+public:
+    constexpr Budget(uint32_t slice_us, uint32_t busy_limit_us) : slice_us_(slice_us), busy_limit_us_(busy_limit_us)
+    {
+    }
+
+    // Call when the task starts working after it blocked: a fresh slice and
+    // a fresh busy period.
+    void start()
+    {
+        slice_start_us_ = esp_timer_get_time();
+        busy_start_us_ = slice_start_us_;
+    }
+
+    // Call between work items. Yields or sleeps when the budget says so and
+    // reports which.
+    Action checkpoint()
+    {
+        const int64_t now_us = esp_timer_get_time();
+        if (now_us - busy_start_us_ >= busy_limit_us_) {
+            vTaskDelay(1);
+            start();
+            return Action::kSleep;
+        }
+        if (now_us - slice_start_us_ >= slice_us_) {
+            taskYIELD();
+            slice_start_us_ = esp_timer_get_time();
+            return Action::kYield;
+        }
+        return Action::kNone;
+    }
+
+private:
+    int64_t slice_us_;
+    int64_t busy_limit_us_;
+    int64_t slice_start_us_ = 0;
+    int64_t busy_start_us_ = 0;
+};
+
+}  // namespace work_budget
@@ -0,0 +1,491 @@
+#include "input_replay.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "metrics.hpp"
+#include "report_format.hpp"
+
+namespace input_replay {
+namespace {
+
+constexpr const char *kTag = "input_replay";
+constexpr size_t kLineMax = 128;
+
+enum class Mode : uint8_t {
+    kIdle = 0,
+    kRecording,
+    kReplaying,
+};
+
+struct KeyName {
+    tpager::Tca8418Key key;
+    const char *name;
+};
+
+constexpr KeyName kKeyNames[] = {
+    {tpager::Tca8418Key::Unknown, "unknown"}, {tpager::Tca8418Key::Character, "char"},
+    {tpager::Tca8418Key::Enter, "enter"},     {tpager::Tca8418Key::Backspace, "bksp"},
+    {tpager::Tca8418Key::Alt, "alt"},         {tpager::Tca8418Key::Caps, "caps"},
+    {tpager::Tca8418Key::Symbol, "sym"},      {tpager::Tca8418Key::Space, "space"},
+};
+
+// The input task appends to and reads the event list; the command worker
+// hands lists in and out (file I/O) by swapping under the lock, while the
+// mode keeps the input task off it. The lock also covers the counters and
+// latency state that the report and the LVGL task read.
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+Mode g_mode = Mode::kIdle;
+std::vector<Event> g_events;
+size_t g_cursor = 0;
+int64_t g_start_us = 0;
+uint32_t g_overflow = 0;
+uint32_t g_delivered = 0;
+int64_t g_max_late_us = 0;
+bool g_finished = false;
+int64_t g_pending_input_us = 0;
+
+using report_format::appendf;
+
+const char *key_name(tpager::Tca8418Key key)
+{
+    for (const KeyName &entry : kKeyNames) {
+        if (entry.key == key) {
+            return entry.name;
+        }
+    }
+    return "unknown";
+}
+
+bool key_from_name(const char *name, tpager::Tca8418Key *out)
+{
+    for (const KeyName &entry : kKeyNames) {
+        if (std::strcmp(entry.name, name) == 0) {
+            *out = entry.key;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_line(const char *line, Event *event)
+{
+    long long t_us = 0;
+    char kind = '\0';
+    int consumed = 0;
+    if (std::sscanf(line, "%lld %c %n", &t_us, &kind, &consumed) < 2 || t_us < 0) {
+        return false;
+    }
+    const char *rest = line + consumed;
+    event->t_us = t_us;
+
+    if (kind == 'K') {
+        int pressed = 0;
+        char name[16] = {};
+        unsigned ch = 0;
+        int erase = 0;
+        unsigned raw = 0;
+        if (std::sscanf(rest, "%d %15s %x %d %x", &pressed, name, &ch, &erase, &raw) != 5 || ch > 0xFF ||
+            raw > 0xFF) {
+            return false;
+        }
+        tpager::Tca8418Event &key = event->key;
+        if (!key_from_name(name, &key.key)) {
+            return false;
+        }
+        event->is_key = true;
+        key.valid = true;
+        key.pressed = pressed != 0;
+        key.ch = static_cast<char>(ch);
+        key.erase_previous_space = erase != 0;
+        key.raw = static_cast<uint8_t>(raw);
+        key.code = static_cast<uint8_t>(raw & 0x7F);
+        return true;
+    }
+    if (kind == 'E') {
+        long delta = 0;
+        long transitions = 0;
+        int changed = 0;
+        int pressed = 0;
+        if (std::sscanf(rest, "%ld %ld %d %d", &delta, &transitions, &changed, &pressed) != 4) {
+            return false;
+        }
+        tpager::EncoderEvent &enc = event->encoder;
+        event->is_key = false;
+        enc.delta = static_cast<int32_t>(delta);
+        enc.moved = delta != 0;
+        enc.transitions = static_cast<int32_t>(transitions);
+        enc.button_changed = changed != 0;
+        enc.button_pressed = pressed != 0;
+        return true;
+    }
+    return false;
+}
+
+void append_event(Event event)
+{
+    if (g_mode != Mode::kRecording) {
+        return;
+    }
+    event.t_us = esp_timer_get_time() - g_start_us;
+    // kMaxEvents are reserved up front, so push_back() never allocates here.
+    portENTER_CRITICAL(&g_lock);
+    // Checked again: stop_recording() may have taken the list meanwhile.
+    if (g_mode == Mode::kRecording && g_events.size() < kMaxEvents) {
+        g_events.push_back(event);
+    } else if (g_mode == Mode::kRecording) {
+        g_overflow++;
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void finish_replay_locked()
+{
+    g_mode = Mode::kIdle;
+    g_finished = true;
+}
+
+// The replay event at the cursor when it is due, else nullptr.
+const Event *due_event(int64_t now)
+{
+    if (g_mode != Mode::kReplaying || g_cursor >= g_events.size()) {
+        return nullptr;
+    }
+    const Event &event = g_events[g_cursor];
+    return g_start_us + event.t_us <= now ? &event : nullptr;
+}
+
+void note_delivered(const Event &event, int64_t now)
+{
+    portENTER_CRITICAL(&g_lock);
+    g_delivered++;
+    g_max_late_us = std::max(g_max_late_us, now - (g_start_us + event.t_us));
+    if (++g_cursor >= g_events.size()) {
+        finish_replay_locked();
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+}  // namespace
+
+bool parse(FILE *file, std::vector<Event> *events, size_t *bad_line)
+{
+    if (file == nullptr || events == nullptr) {
+        return false;
+    }
+    events->clear();
+    char line[kLineMax];
+    size_t line_no = 0;
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+        line_no++;
+        char *comment = std::strchr(line, '#');
+        if (comment != nullptr) {
+            *comment = '\0';
+        }
+        const char *p = line;
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            p++;
+        }
+        if (*p == '\0') {
+            continue;
+        }
+        Event event;
+        if (!parse_line(p, &event) || (!events->empty() && event.t_us < events->back().t_us) ||
+            events->size() >= kMaxEvents) {
+            if (bad_line != nullptr) {
+                *bad_line = line_no;
+            }
+            return false;
+        }
+        events->push_back(event);
+    }
+    return true;
+}
+
+bool write(FILE *file, const std::vector<Event> &events)
+{
+    if (file == nullptr) {
+        return false;
+    }
+    std::fprintf(file, "# PocketSSH input recording: %u events\n", static_cast<unsigned>(events.size()));
+    for (const Event &event : events) {
+        if (event.is_key) {
+            const tpager::Tca8418Event &key = event.key;
+            std::fprintf(file, "%" PRId64 " K %d %s %02x %d %02x\n", event.t_us, key.pressed ? 1 : 0,
+                         key_name(key.key), static_cast<unsigned char>(key.ch), key.erase_previous_space ? 1 : 0,
+                         key.raw);
+        } else {
+            const tpager::EncoderEvent &enc = event.encoder;
+            std::fprintf(file, "%" PRId64 " E %" PRId32 " %" PRId32 " %d %d\n", event.t_us, enc.delta,
+                         enc.transitions, enc.button_changed ? 1 : 0, enc.button_pressed ? 1 : 0);
+        }
+    }
+    return std::ferror(file) == 0;
+}
+
+bool terminal_char(const tpager::Tca8418Event &ev, char *out_key)
+{
+    if (out_key == nullptr || !ev.pressed) {
+        return false;
+    }
+
+    switch (ev.key) {
+    case tpager::Tca8418Key::Character:
+    case tpager::Tca8418Key::Space:
+        if (ev.ch != '\0') {
+            *out_key = ev.ch;
+            return true;
+        }
+        break;
+    case tpager::Tca8418Key::Enter:
+        *out_key = '\n';
+        return true;
+    case tpager::Tca8418Key::Backspace:
+        *out_key = ev.ch != '\0' ? ev.ch : '\b';  // '\x03' with Alt
+        return true;
+    default:
+        break;
+    }
+    return false;
+}
+
+esp_err_t start_recording()
+{
+    if (g_mode == Mode::kReplaying) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    g_events.clear();
+    g_events.reserve(kMaxEvents);
+    portENTER_CRITICAL(&g_lock);
+    g_mode = Mode::kRecording;
+    g_start_us = esp_timer_get_time();
+    g_overflow = 0;
+    portEXIT_CRITICAL(&g_lock);
+    return ESP_OK;
+}
+
+esp_err_t stop_recording(const char *path)
+{
+    std::vector<Event> events;
+    portENTER_CRITICAL(&g_lock);
+    const bool was_recording = g_mode == Mode::kRecording;
+    if (was_recording) {
+        g_mode = Mode::kIdle;
+        g_events.swap(events);
+    }
+    portEXIT_CRITICAL(&g_lock);
+    if (!was_recording) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    FILE *f = std::fopen(path, "w");
+    if (f == nullptr) {
+        ESP_LOGW(kTag, "open %s failed (errno=%d)", path, errno);
+        return ESP_FAIL;
+    }
+    const bool ok = write(f, events);
+    std::fclose(f);
+    ESP_LOGI(kTag, "recorded %u events -> %s", static_cast<unsigned>(events.size()), path);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+bool recording()
+{
+    return g_mode == Mode::kRecording;
+}
+
+void record_key(const tpager::Tca8418Event &ev)
+{
+    Event event;
+    event.is_key = true;
+    event.key = ev;
+    append_event(event);
+}
+
+void record_encoder(const tpager::EncoderEvent &ev)
+{
+    if (!ev.moved && !ev.button_changed) {
+        return;
+    }
+    Event event;
+    event.encoder = ev;
+    append_event(event);
+}
+
+esp_err_t start_replay(const char *path)
+{
+    FILE *f = std::fopen(path, "r");
+    if (f == nullptr) {
+        ESP_LOGW(kTag, "open %s failed (errno=%d)", path, errno);
+        return ESP_ERR_NOT_FOUND;
+    }
+    std::vector<Event> events;
+    size_t bad_line = 0;
+    const bool ok = parse(f, &events, &bad_line);
+    std::fclose(f);
+    if (!ok) {
+        ESP_LOGW(kTag, "%s:%u: bad event line", path, static_cast<unsigned>(bad_line));
+        return ESP_ERR_INVALID_ARG;
+    }
+    return start_replay(std::move(events));
+}
+
+esp_err_t start_replay(std::vector<Event> events)
+{
+    if (events.empty()) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    portENTER_CRITICAL(&g_lock);
+    if (g_mode != Mode::kIdle) {
+        portEXIT_CRITICAL(&g_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The previous list is freed with `events`, outside the lock.
+    g_events.swap(events);
+    g_cursor = 0;
+    g_delivered = 0;
+    g_max_late_us = 0;
+    g_finished = false;
+    g_start_us = esp_timer_get_time();
+    g_mode = Mode::kReplaying;
+    portEXIT_CRITICAL(&g_lock);
+    return ESP_OK;
+}
+
+void stop_replay()
+{
+    portENTER_CRITICAL(&g_lock);
+    if (g_mode == Mode::kReplaying) {
+        finish_replay_locked();
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+bool replaying()
+{
+    return g_mode == Mode::kReplaying;
+}
+
+bool take_replay_finished()
+{
+    portENTER_CRITICAL(&g_lock);
+    const bool finished = g_finished;
+    g_finished = false;
+    portEXIT_CRITICAL(&g_lock);
+    return finished;
+}
+
+esp_err_t next_key(tpager::Tca8418Event *ev, int64_t *due_us)
+{
+    if (ev == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // An encoder event at the cursor holds keys back until poll_encoder()
+    // has taken it, so the two streams keep their recorded order.
+    const int64_t now = esp_timer_get_time();
+    const Event *event = due_event(now);
+    if (event == nullptr || !event->is_key) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *ev = event->key;
+    if (due_us != nullptr) {
+        *due_us = g_start_us + event->t_us;
+    }
+    note_delivered(*event, now);
+    return ESP_OK;
+}
+
+esp_err_t next_encoder(tpager::EncoderEvent *ev)
+{
+    if (ev == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *ev = tpager::EncoderEvent{};
+    // Merge every due encoder event, as one encoder_poll() would.
+    const int64_t now = esp_timer_get_time();
+    const Event *event = nullptr;
+    while ((event = due_event(now)) != nullptr && !event->is_key) {
+        const tpager::EncoderEvent &enc = event->encoder;
+        ev->delta += enc.delta;
+        ev->transitions += enc.transitions;
+        if (enc.button_changed) {
+            ev->button_changed = true;
+            ev->button_pressed = enc.button_pressed;
+        }
+        note_delivered(*event, now);
+    }
+    ev->moved = ev->delta != 0;
+    return ESP_OK;
+}
+
+void note_key_typed(int64_t input_us)
+{
+    portENTER_CRITICAL(&g_lock);
+    if (g_pending_input_us == 0) {
+        g_pending_input_us = input_us;
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void note_frame_ready()
+{
+    portENTER_CRITICAL(&g_lock);
+    const int64_t input_us = g_pending_input_us;
+    g_pending_input_us = 0;
+    portEXIT_CRITICAL(&g_lock);
+    if (input_us != 0) {
+        metrics::observe(metrics::Histogram::kKeyRenderUs,
+                         static_cast<uint32_t>(std::max<int64_t>(0, esp_timer_get_time() - input_us)));
+    }
+}
+
+size_t format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    portENTER_CRITICAL(&g_lock);
+    const Mode mode = g_mode;
+    const size_t events = g_events.size();
+    const uint32_t delivered = g_delivered;
+    const int64_t max_late_us = g_max_late_us;
+    const uint32_t overflow = g_overflow;
+    portEXIT_CRITICAL(&g_lock);
+
+    size_t used = 0;
+    switch (mode) {
+    case Mode::kRecording:
+        appendf(out, out_len, &used, "input: recording, %u events", static_cast<unsigned>(events));
+        if (overflow > 0) {
+            appendf(out, out_len, &used, " (%" PRIu32 " over the %u limit)", overflow,
+                    static_cast<unsigned>(kMaxEvents));
+        }
+        appendf(out, out_len, &used, "\n");
+        break;
+    case Mode::kReplaying:
+        appendf(out, out_len, &used, "input: replaying %" PRIu32 "/%u events\n", delivered,
+                static_cast<unsigned>(events));
+        break;
+    case Mode::kIdle:
+        appendf(out, out_len, &used, "input: idle\n");
+        break;
+    }
+    if (mode != Mode::kRecording && delivered > 0) {
+        appendf(out, out_len, &used, "last replay: %" PRIu32 " events, max late %" PRId64 " ms\n", delivered,
+                max_late_us / 1000);
+    }
+    appendf(out, out_len, &used, "key_drops %" PRIu32 ", key_render: see stats\n",
+            metrics::value(metrics::Counter::kKeyDrops));
+    return used;
+}
+
+}  // namespace input_replay
@@ -0,0 +1,120 @@
+#include "job_runner.hpp"
+
+#include <atomic>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "mailbox.hpp"
+#include "metrics.hpp"
+#include "task_layout.hpp"
+
+namespace job_runner {
+namespace {
+
+constexpr const char *kTag = "job_runner";
+
+struct Job {
+    const char *name;
+    JobFn fn;
+    void *ctx;
+    char args[kMaxArgs];
+};
+
+task_layout::StaticTask<task_layout::kCommandWorker> g_worker_task;
+mailbox::Mailbox<Job, 1> g_jobs("job");
+// Set by submit(), cleared when the job returns.
+std::atomic<const char *> g_current{nullptr};
+std::atomic<bool> g_cancel{false};
+
+void worker_task(void *)
+{
+    static Job job;  // off the worker stack
+    while (true) {
+        if (!g_jobs.receive(&job, portMAX_DELAY)) {
+            continue;
+        }
+        ESP_LOGI(kTag, "%s: start", job.name);
+        const int64_t start_us = esp_timer_get_time();
+        job.fn(job.ctx, job.args);
+        const uint32_t elapsed_ms = static_cast<uint32_t>((esp_timer_get_time() - start_us) / 1000);
+        metrics::observe(metrics::Histogram::kJobMs, elapsed_ms);
+        ESP_LOGI(kTag, "%s: done in %u ms%s", job.name, static_cast<unsigned>(elapsed_ms),
+                 g_cancel.load() ? " (cancelled)" : "");
+        g_cancel = false;
+        g_current = nullptr;
+    }
+}
+
+}  // namespace
+
+esp_err_t start()
+{
+    if (g_worker_task.handle() != nullptr) {
+        return ESP_OK;
+    }
+    if (!g_jobs.init()) {
+        return ESP_ERR_NO_MEM;
+    }
+    return g_worker_task.start(worker_task, nullptr) != nullptr ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t submit(const char *name, JobFn fn, void *ctx, const char *args)
+{
+    if (fn == nullptr || args == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (g_worker_task.handle() == nullptr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    Job job = {};
+    if (std::strlen(args) >= sizeof(job.args)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const char *idle = nullptr;
+    if (!g_current.compare_exchange_strong(idle, name)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    job.name = name;
+    job.fn = fn;
+    job.ctx = ctx;
+    std::strcpy(job.args, args);
+    g_cancel = false;
+    if (!g_jobs.post(job)) {
+        g_current = nullptr;
+        return ESP_ERR_INVALID_STATE;
+    }
+    return ESP_OK;
+}
+
+bool busy()
+{
+    return g_current.load() != nullptr;
+}
+
+const char *current()
+{
+    return g_current.load();
+}
+
+bool cancel()
+{
+    if (!busy()) {
+        return false;
+    }
+    g_cancel = true;
+    return true;
+}
+
+bool cancelled()
+{
+    return on_worker() && g_cancel.load();
+}
+
+bool on_worker()
+{
+    return g_worker_task.handle() != nullptr && xTaskGetCurrentTaskHandle() == g_worker_task.handle();
+}
+
+}  // namespace job_runner
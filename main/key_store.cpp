@@ -0,0 +1,265 @@
+#include "key_store.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <iterator>
+#include <strings.h>
+#include <vector>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "mem_monitor.hpp"
+
+namespace key_store {
+namespace {
+
+constexpr const char *kTag = "key_store";
+
+struct Slot {
+    bool used;
+    uint32_t len;
+    char name[kMaxNameLen + 1];
+    char data[kMaxKeyBytes + 1];
+};
+
+// Open-addressed (linear probing) name -> slot index. Kept at least half
+// empty so a miss ends after a couple of probes.
+constexpr size_t kIndexSize = 16;
+static_assert((kIndexSize & (kIndexSize - 1)) == 0, "index size must be a power of two");
+static_assert(kIndexSize >= 2 * kMaxKeys, "index must stay at most half full");
+constexpr uint8_t kNoSlot = 0xFF;
+
+Slot *g_slots = nullptr;
+uint8_t g_index[kIndexSize];
+
+// FNV-1a over the lowercased name, so lookups need no lowercase copy.
+uint32_t name_hash(const char *name)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *p = name; *p != '\0'; ++p) {
+        hash ^= static_cast<uint8_t>(std::tolower(static_cast<unsigned char>(*p)));
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Index position holding `name`, or the empty position where it would go.
+size_t probe(const char *name)
+{
+    size_t pos = name_hash(name) & (kIndexSize - 1);
+    while (g_index[pos] != kNoSlot && strcasecmp(g_slots[g_index[pos]].name, name) != 0) {
+        pos = (pos + 1) & (kIndexSize - 1);
+    }
+    return pos;
+}
+
+void rebuild_index()
+{
+    std::fill(std::begin(g_index), std::end(g_index), kNoSlot);
+    for (size_t i = 0; i < kMaxKeys; ++i) {
+        if (g_slots[i].used) {
+            g_index[probe(g_slots[i].name)] = static_cast<uint8_t>(i);
+        }
+    }
+}
+
+bool ensure_arena()
+{
+    if (g_slots != nullptr) {
+        return true;
+    }
+    g_slots = static_cast<Slot *>(heap_caps_calloc(kMaxKeys, sizeof(Slot), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if (g_slots == nullptr) {
+        ESP_LOGE(kTag, "key arena alloc failed (%u bytes PSRAM)", static_cast<unsigned>(kMaxKeys * sizeof(Slot)));
+        return false;
+    }
+    std::fill(std::begin(g_index), std::end(g_index), kNoSlot);
+    mem_monitor::set_usage(mem_monitor::Tag::kKeys, kMaxKeys * sizeof(Slot));
+    return true;
+}
+
+void release_slot(Slot &slot)
+{
+    wipe(slot.data, slot.len);
+    wipe(slot.name, sizeof(slot.name));
+    slot.len = 0;
+    slot.used = false;
+}
+
+bool has_pem_extension(const char *name)
+{
+    const size_t len = std::strlen(name);
+    return len >= 5 && strcasecmp(name + len - 4, ".pem") == 0;
+}
+
+// Read one key file and store it under its file name; the read buffer is
+// wiped either way.
+bool load_file(const char *dir, const char *name)
+{
+    char path[256];
+    std::snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *f = std::fopen(path, "rb");
+    if (f == nullptr) {
+        ESP_LOGW(kTag, "cannot open %s", path);
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const long file_size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    if (file_size <= 0 || file_size > static_cast<long>(kMaxKeyBytes)) {
+        ESP_LOGW(kTag, "skipping %s (%ld bytes)", path, file_size);
+        std::fclose(f);
+        return false;
+    }
+
+    std::vector<char> data(static_cast<size_t>(file_size));
+    const size_t bytes_read = std::fread(data.data(), 1, data.size(), f);
+    std::fclose(f);
+    const bool ok = bytes_read == data.size() && put(name, data.data(), data.size()) == ESP_OK;
+    wipe(data.data(), data.size());
+    if (!ok) {
+        ESP_LOGW(kTag, "failed to load %s", path);
+        return false;
+    }
+    ESP_LOGI(kTag, "loaded %s (%u bytes)", name, static_cast<unsigned>(bytes_read));
+    return true;
+}
+
+}  // namespace
+
+void wipe(void *data, size_t len)
+{
+    volatile uint8_t *p = static_cast<volatile uint8_t *>(data);
+    while (len-- > 0) {
+        *p++ = 0;
+    }
+}
+
+esp_err_t put(const char *name, const char *data, size_t len)
+{
+    if (name == nullptr || data == nullptr || len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t name_len = std::strlen(name);
+    if (name_len == 0 || name_len > kMaxNameLen || len > kMaxKeyBytes) {
+        ESP_LOGW(kTag, "rejecting key %s (%u bytes)", name, static_cast<unsigned>(len));
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (!ensure_arena()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    const size_t pos = probe(name);
+    size_t slot_index = g_index[pos];
+    if (slot_index == kNoSlot) {
+        slot_index = 0;
+        while (slot_index < kMaxKeys && g_slots[slot_index].used) {
+            slot_index++;
+        }
+        if (slot_index == kMaxKeys) {
+            ESP_LOGW(kTag, "no free key slot for %s (max %u)", name, static_cast<unsigned>(kMaxKeys));
+            return ESP_ERR_NO_MEM;
+        }
+        g_index[pos] = static_cast<uint8_t>(slot_index);
+    }
+
+    Slot &slot = g_slots[slot_index];
+    release_slot(slot);
+    for (size_t i = 0; i < name_len; ++i) {
+        slot.name[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(name[i])));
+    }
+    slot.name[name_len] = '\0';
+    std::memcpy(slot.data, data, len);
+    slot.data[len] = '\0';
+    slot.len = static_cast<uint32_t>(len);
+    slot.used = true;
+    return ESP_OK;
+}
+
+const char *find(const char *name, size_t *len)
+{
+    if (name == nullptr || g_slots == nullptr) {
+        return nullptr;
+    }
+    const uint8_t slot_index = g_index[probe(name)];
+    if (slot_index == kNoSlot) {
+        return nullptr;
+    }
+    if (len != nullptr) {
+        *len = g_slots[slot_index].len;
+    }
+    return g_slots[slot_index].data;
+}
+
+bool evict(const char *name)
+{
+    if (name == nullptr || g_slots == nullptr) {
+        return false;
+    }
+    const uint8_t slot_index = g_index[probe(name)];
+    if (slot_index == kNoSlot) {
+        return false;
+    }
+    release_slot(g_slots[slot_index]);
+    // Linear probing cannot just blank the entry; with eight keys a rebuild
+    // is cheaper than tombstones.
+    rebuild_index();
+    return true;
+}
+
+void clear()
+{
+    if (g_slots == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < kMaxKeys; ++i) {
+        if (g_slots[i].used) {
+            release_slot(g_slots[i]);
+        }
+    }
+    std::fill(std::begin(g_index), std::end(g_index), kNoSlot);
+}
+
+size_t count()
+{
+    if (g_slots == nullptr) {
+        return 0;
+    }
+    return static_cast<size_t>(
+        std::count_if(g_slots, g_slots + kMaxKeys, [](const Slot &slot) { return slot.used; }));
+}
+
+int load_dir(const char *dir)
+{
+    DIR *d = dir != nullptr ? opendir(dir) : nullptr;
+    if (d == nullptr) {
+        return -1;
+    }
+    int loaded = 0;
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(d)) != nullptr) {
+        if (has_pem_extension(entry->d_name) && load_file(dir, entry->d_name)) {
+            loaded++;
+        }
+    }
+    closedir(d);
+    return loaded;
+}
+
+const char *name_at(size_t index)
+{
+    if (g_slots == nullptr) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < kMaxKeys; ++i) {
+        if (g_slots[i].used && index-- == 0) {
+            return g_slots[i].name;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace key_store
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Pack the pepboy splash frames into one delta/RLE stream.
+
+Input: LVGL image converter output (pepboy_N.c, RGB565, one array per frame).
+Output: pepboy_frames.c, consumed by the splash animation in deck_base.cpp.
+
+Each frame is encoded against the previous one (frame 0 against an all-black
+frame), pixel by pixel, as a sequence of tokens:
+
+    0x00..0x3F  SKIP  n = t + 1 pixels unchanged from the previous frame
+    0x40..0x7F  RUN   n = t - 0x3F copies of the next 2-byte pixel
+    0x80..0xFF  LIT   n = t - 0x7F pixels follow, 2 bytes each
+
+Pixels keep the converter's little-endian RGB565 byte order, so the decoder
+copies bytes straight into an LV_COLOR_FORMAT_RGB565 buffer.
+
+Usage: python3 pack_frames.py [frame_dir]   (regenerates pepboy_frames.c)
+"""
+
+import os
+import re
+import sys
+
+FRAME_COUNT = 8
+SKIP_MAX = 0x40
+RUN_MAX = 0x40
+LIT_MAX = 0x80
+MIN_RUN = 3  # shorter repeats are cheaper inside a literal
+
+
+def load_frame(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("_map[] = {") : text.index("};")]
+    raw = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    w = int(re.search(r"\.header\.w = (\d+)", text).group(1))
+    h = int(re.search(r"\.header\.h = (\d+)", text).group(1))
+    if len(raw) != w * h * 2:
+        raise ValueError(f"{path}: {len(raw)} bytes, expected {w * h * 2}")
+    pixels = [raw[i : i + 2] for i in range(0, len(raw), 2)]
+    return w, h, pixels
+
+
+def encode(prev, cur):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:LIT_MAX]
+            del literal[:LIT_MAX]
+            out.append(0x80 + len(chunk) - 1)
+            for px in chunk:
+                out.extend(px)
+
+    i = 0
+    n = len(cur)
+    while i < n:
+        skip = 0
+        while i + skip < n and cur[i + skip] == prev[i + skip]:
+            skip += 1
+        if skip >= 2 or (skip == 1 and not literal):
+            flush_literal()
+            i += skip
+            while skip:
+                step = min(skip, SKIP_MAX)
+                out.append(step - 1)
+                skip -= step
+            continue
+
+        run = 1
+        while i + run < n and cur[i + run] == cur[i]:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literal()
+            step = min(run, RUN_MAX)
+            out.append(0x40 + step - 1)
+            out += cur[i]
+            i += step
+            continue
+
+        literal.append(cur[i])
+        i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def decode(prev, stream):
+    out = list(prev)
+    i = 0
+    px = 0
+    while i < len(stream):
+        t = stream[i]
+        i += 1
+        if t < 0x40:
+            px += t + 1
+        elif t < 0x80:
+            value = stream[i : i + 2]
+            i += 2
+            for _ in range(t - 0x3F):
+                out[px] = value
+                px += 1
+        else:
+            for _ in range(t - 0x7F):
+                out[px] = stream[i : i + 2]
+                i += 2
+                px += 1
+    return out
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for off in range(0, len(data), per_line):
+        chunk = data[off : off + per_line]
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    frame_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    frames = []
+    width = height = None
+    for idx in range(FRAME_COUNT):
+        w, h, pixels = load_frame(os.path.join(frame_dir, f"pepboy_{idx}.c"))
+        if width is None:
+            width, height = w, h
+        elif (w, h) != (width, height):
+            raise ValueError(f"pepboy_{idx}.c is {w}x{h}, expected {width}x{height}")
+        frames.append(pixels)
+
+    black = [b"\x00\x00"] * (width * height)
+    stream = bytearray()
+    offsets = []
+    prev = black
+    for idx, cur in enumerate(frames):
+        enc = encode(prev, cur)
+        if decode(prev, enc) != cur:
+            raise AssertionError(f"frame {idx} failed round trip")
+        offsets.append(len(stream))
+        stream += enc
+        prev = cur
+    offsets.append(len(stream))
+
+    raw_total = FRAME_COUNT * width * height * 2
+    out_path = os.path.join(frame_dir, "pepboy_frames.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("// Generated by pack_frames.py from pepboy_0..7.c -- do not edit.\n")
+        f.write(f"// {raw_total} raw bytes -> {len(stream)} packed bytes.\n\n")
+        f.write('#include "pepboy_frames.h"\n\n')
+        f.write(f"const uint16_t pepboy_frame_w = {width};\n")
+        f.write(f"const uint16_t pepboy_frame_h = {height};\n")
+        f.write(f"const uint32_t pepboy_raw_bytes = {raw_total};\n")
+        f.write(f"const uint32_t pepboy_packed_bytes = {len(stream)};\n\n")
+        f.write("const uint32_t pepboy_frame_offsets[PEPBOY_FRAME_COUNT + 1] = {\n")
+        f.write("  " + ", ".join(str(o) for o in offsets) + ",\n};\n\n")
+        f.write("const uint8_t pepboy_frame_stream[] = {\n")
+        f.write(c_bytes(stream))
+        f.write("\n};\n")
+
+    print(f"{width}x{height} x{FRAME_COUNT}: {raw_total} raw bytes -> {len(stream)} packed bytes")
+    for idx in range(FRAME_COUNT):
+        print(f"  frame {idx}: {offsets[idx + 1] - offsets[idx]} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,3222 @@
+// Generated by pack_frames.py from pepboy_0..7.c -- do not edit.
+// 313920 raw bytes -> 51291 packed bytes.
+
+#include "pepboy_frames.h"
+
+const uint16_t pepboy_frame_w = 109;
+const uint16_t pepboy_frame_h = 180;
+const uint32_t pepboy_raw_bytes = 313920;
+const uint32_t pepboy_packed_bytes = 51291;
+
+const uint32_t pepboy_frame_offsets[PEPBOY_FRAME_COUNT + 1] = {
+  0, 6940, 13429, 19296, 25305, 31451, 37671, 44575, 51291,
+};
+
+const uint8_t pepboy_frame_stream[] = {
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x21, 0x82, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x27, 0x86, 0x20, 0x00,
+  0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x3f, 0x25, 0x81, 0x62,
+  0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x20, 0x00, 0x3f,
+  0x1c, 0x82, 0x41, 0x08, 0x41, 0x08, 0x20, 0x00, 0x01, 0x81, 0x61, 0x08, 0x23, 0x23, 0x46, 0xc7,
+  0x4d, 0x85, 0x65, 0x34, 0xa3, 0x1a, 0x22, 0x1a, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x3f, 0x16,
+  0x87, 0x20, 0x00, 0x61, 0x08, 0x23, 0x23, 0xc4, 0x2b, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x22,
+  0x1a, 0x4c, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x61, 0x08, 0x3f, 0x14, 0x82, 0x20, 0x00, 0x61, 0x08,
+  0x06, 0x3d, 0x53, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x62, 0x10, 0x20, 0x00, 0x3f, 0x09, 0x81, 0x62,
+  0x10, 0x62, 0x10, 0x05, 0x82, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x55, 0xc7, 0x4d, 0x82, 0x06,
+  0x3d, 0x22, 0x11, 0x41, 0x08, 0x3f, 0x07, 0x83, 0x21, 0x08, 0x22, 0x1a, 0x23, 0x23, 0x41, 0x08,
+  0x03, 0x82, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x58, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x41, 0x08,
+  0x3f, 0x06, 0x88, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x41, 0x08, 0x41,
+  0x08, 0x62, 0x10, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x65, 0x34, 0x06, 0x3d, 0x4b,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x3f, 0x05, 0x80, 0x62, 0x10, 0x42, 0xc7, 0x4d, 0x83,
+  0x06, 0x3d, 0xc4, 0x2b, 0xc4, 0x2b, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0xc4, 0x2b,
+  0xc4, 0x2b, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x41, 0x08,
+  0x62, 0x10, 0x23, 0x23, 0x4b, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x04, 0x80, 0x61,
+  0x08, 0x48, 0xc7, 0x4d, 0x8a, 0xc4, 0x2b, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x23, 0x23, 0x06, 0x3d, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x42, 0x62, 0x10, 0x82, 0x41,
+  0x08, 0x41, 0x08, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x44, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x62, 0x10, 0x3f, 0x03, 0x80, 0x62, 0x10, 0x47, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x62, 0x10,
+  0x61, 0x08, 0x23, 0x23, 0x23, 0x23, 0x22, 0x1a, 0x43, 0x61, 0x08, 0x96, 0x22, 0x1a, 0x65, 0x34,
+  0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x23, 0x23, 0x62, 0x10, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d,
+  0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08,
+  0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x02, 0x81, 0x61, 0x08, 0x06,
+  0x3d, 0x46, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x81, 0x65,
+  0x34, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x43, 0x61, 0x08, 0x8c, 0xa2, 0x11, 0xc4,
+  0x2b, 0x65, 0x34, 0x06, 0x3d, 0xc4, 0x2b, 0x61, 0x08, 0x20, 0x00, 0x62, 0x10, 0x06, 0x3d, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x01, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x45, 0xc7,
+  0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0xc4, 0x2b, 0x4f, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x23, 0x23,
+  0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0xa3, 0x1a, 0x42, 0xc7,
+  0x4d, 0x80, 0x61, 0x08, 0x3f, 0x02, 0x88, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x06, 0x3d, 0x06,
+  0x3d, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x59, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x20,
+  0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x00, 0x88, 0x41, 0x08,
+  0xc1, 0x10, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a,
+  0x5a, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x3f, 0x00, 0x87, 0x61, 0x08, 0x65, 0x34, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x62,
+  0x10, 0x61, 0x08, 0xc4, 0x2b, 0x5b, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0x42,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08, 0x23, 0x23,
+  0x4b, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0xa2, 0x11, 0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d,
+  0x23, 0x23, 0x61, 0x08, 0xc1, 0x10, 0x44, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x41,
+  0x08, 0xa3, 0x1a, 0xa3, 0x1a, 0x21, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x21,
+  0x08, 0x21, 0x08, 0xc1, 0x10, 0x4b, 0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x21, 0x08, 0x41, 0x08, 0x22,
+  0x1a, 0x46, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d,
+  0x80, 0x61, 0x08, 0x3f, 0x01, 0x42, 0x62, 0x10, 0x86, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x11, 0x22,
+  0x11, 0xa3, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22, 0x11, 0x61,
+  0x08, 0x61, 0x08, 0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x61,
+  0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x02, 0x81, 0x20, 0x00, 0xa2, 0x11,
+  0x54, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x45, 0xc7, 0x4d, 0x85, 0xc1, 0x10,
+  0x22, 0x11, 0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x3f, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x5d, 0xc7, 0x4d, 0x89, 0x06, 0x3d, 0x23, 0x23, 0x61,
+  0x08, 0xa3, 0x1a, 0x22, 0x1a, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x3f,
+  0x02, 0x80, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0xc1, 0x10, 0x45, 0xc7,
+  0x4d, 0x80, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0xc4, 0x2b, 0x49, 0xc7, 0x4d, 0x88,
+  0xa3, 0x1a, 0xc4, 0x2b, 0xa2, 0x11, 0x22, 0x11, 0x23, 0x23, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34,
+  0x61, 0x08, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x21,
+  0x08, 0x61, 0x08, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0x44,
+  0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x21, 0x08, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x88, 0xc4, 0x2b, 0x61,
+  0x08, 0xa3, 0x1a, 0xa3, 0x1a, 0xc1, 0x10, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x3f,
+  0x01, 0x80, 0x62, 0x10, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b,
+  0x43, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x44, 0xc7, 0x4d, 0x83, 0x62, 0x10,
+  0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a,
+  0x22, 0x1a, 0xc1, 0x10, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d,
+  0x83, 0xa3, 0x1a, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41,
+  0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0x06,
+  0x3d, 0x47, 0xc7, 0x4d, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x61, 0x08, 0xa3,
+  0x1a, 0xa2, 0x11, 0x22, 0x11, 0x62, 0x10, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10,
+  0x65, 0x34, 0x45, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7,
+  0x4d, 0x87, 0x22, 0x1a, 0x62, 0x10, 0xc1, 0x10, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x61, 0x08,
+  0x20, 0x00, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x41, 0x08, 0xa3,
+  0x1a, 0x46, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x62, 0x10, 0xc1, 0x10, 0x48, 0xc7, 0x4d, 0x87, 0x06,
+  0x3d, 0xc4, 0x2b, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x3f,
+  0x03, 0x80, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0x22, 0x11, 0x48, 0xc7,
+  0x4d, 0x80, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0xc1, 0x10, 0xa2, 0x11, 0x06, 0x3d,
+  0x22, 0x11, 0xc4, 0x2b, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11, 0x47, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x42,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x04, 0x80, 0xa2, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x61, 0x08, 0x5a, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x03, 0x80, 0x22,
+  0x11, 0x48, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x41, 0x08, 0xa3, 0x1a, 0x5a, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10,
+  0x06, 0x3d, 0x59, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x51, 0xc7, 0x4d, 0x80, 0xa2,
+  0x11, 0x3f, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x80, 0x65, 0x34, 0x4e, 0xc7,
+  0x4d, 0x81, 0x22, 0x11, 0x22, 0x1a, 0x50, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x85, 0x41,
+  0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x85, 0xc4,
+  0x2b, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x3f, 0x03, 0x98, 0x20, 0x00, 0xa2, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10,
+  0x61, 0x08, 0x22, 0x11, 0x22, 0x1a, 0xa3, 0x1a, 0xc4, 0x2b, 0xc4, 0x2b, 0x65, 0x34, 0xc4, 0x2b,
+  0x23, 0x23, 0xa3, 0x1a, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x65, 0x34,
+  0x61, 0x08, 0x20, 0x00, 0x22, 0x11, 0x4d, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x3f, 0x04,
+  0x88, 0x62, 0x10, 0xc7, 0x4d, 0x23, 0x23, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x65, 0x34, 0xc4,
+  0x2b, 0xa3, 0x1a, 0x44, 0x22, 0x1a, 0x82, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x83, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x23,
+  0x23, 0x23, 0x23, 0xa3, 0x1a, 0xc1, 0x10, 0x41, 0x08, 0x3f, 0x05, 0x82, 0x21, 0x08, 0xa3, 0x1a,
+  0x06, 0x3d, 0x42, 0x61, 0x08, 0x81, 0xc1, 0x10, 0x65, 0x34, 0x49, 0xc7, 0x4d, 0x85, 0x06, 0x3d,
+  0x22, 0x11, 0x62, 0x10, 0x22, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x83, 0xc4, 0x2b,
+  0x61, 0x08, 0x21, 0x08, 0x21, 0x08, 0x3f, 0x08, 0x80, 0x62, 0x10, 0x43, 0x06, 0x3d, 0x85, 0xa3,
+  0x1a, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x23, 0x23, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x88, 0x06,
+  0x3d, 0x23, 0x23, 0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0x65,
+  0x34, 0x47, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x0b, 0x81, 0x21, 0x08, 0x22, 0x1a,
+  0x44, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x43, 0x62, 0x10, 0x82,
+  0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20, 0x00, 0x3f, 0x0c,
+  0x81, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x43, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x41, 0x08, 0x3f, 0x0e, 0x80, 0x61, 0x08, 0x59, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08,
+  0x3f, 0x0f, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x57, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x3f,
+  0x11, 0x81, 0x21, 0x08, 0xc1, 0x10, 0x55, 0xc7, 0x4d, 0x80, 0x23, 0x23, 0x43, 0x61, 0x08, 0x3f,
+  0x10, 0x82, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x52, 0xc7, 0x4d, 0x86, 0xa2, 0x11, 0xc1, 0x10,
+  0x06, 0x3d, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x11, 0x82, 0x61, 0x08, 0x22,
+  0x11, 0x06, 0x3d, 0x4f, 0xc7, 0x4d, 0x88, 0xa3, 0x1a, 0xc4, 0x2b, 0xc7, 0x4d, 0xc4, 0x2b, 0x61,
+  0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x12, 0x82, 0x61, 0x08, 0x61, 0x08,
+  0x23, 0x23, 0x4f, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x3f, 0x12, 0x84, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0x65,
+  0x34, 0x4b, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x0f, 0x8b, 0x21, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x06, 0x3d,
+  0x61, 0x08, 0x00, 0x00, 0x20, 0x00, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0xc4, 0x2b,
+  0x45, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x0e, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x42, 0xc7, 0x4d, 0x88, 0x06,
+  0x3d, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0xc1, 0x10, 0x61, 0x08, 0x23,
+  0x23, 0x42, 0xc7, 0x4d, 0x84, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x45,
+  0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x20, 0x00, 0xa2, 0x11, 0x62, 0x10, 0x3f, 0x0b, 0x81, 0x41, 0x08,
+  0xa3, 0x1a, 0x45, 0xc7, 0x4d, 0x80, 0x65, 0x34, 0x43, 0x61, 0x08, 0x87, 0x22, 0x1a, 0x23, 0x23,
+  0xa3, 0x1a, 0x22, 0x11, 0x62, 0x10, 0x20, 0x00, 0x61, 0x08, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x85,
+  0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x0a, 0x80, 0x61,
+  0x08, 0x48, 0xc7, 0x4d, 0x89, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x41,
+  0x08, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x62,
+  0x10, 0x00, 0x00, 0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x07, 0x83,
+  0x21, 0x08, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x4b, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d,
+  0x4a, 0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x3f, 0x05, 0x85, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x61, 0x08, 0x62,
+  0x10, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x83, 0xa2, 0x11, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0x44,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x03, 0x87, 0x41, 0x08, 0xa3, 0x1a, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x54, 0xc7, 0x4d, 0x83, 0xa2, 0x11,
+  0x21, 0x08, 0x61, 0x08, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x01,
+  0x81, 0x20, 0x00, 0x22, 0x11, 0x43, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x61,
+  0x08, 0x65, 0x34, 0x50, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x23,
+  0x23, 0x48, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x00, 0x80, 0x61, 0x08, 0x46, 0xc7,
+  0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x84, 0x23, 0x23,
+  0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x23, 0x23, 0x4a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x3e, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34,
+  0x49, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x65, 0x34, 0x23, 0x23, 0xa2, 0x11, 0x62, 0x10, 0x21, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x4c, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3c, 0x81,
+  0x61, 0x08, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7,
+  0x4d, 0x88, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08,
+  0xa2, 0x11, 0x65, 0x34, 0x4f, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x3a, 0x81, 0x41, 0x08,
+  0xa3, 0x1a, 0x49, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x48, 0xc7, 0x4d, 0x85, 0xc4, 0x2b,
+  0x41, 0x08, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x65, 0x34, 0x53, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x61, 0x08, 0x38, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08,
+  0x48, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x57, 0xc7, 0x4d, 0x81, 0x23, 0x23,
+  0x41, 0x08, 0x37, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08,
+  0x48, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x58, 0xc7, 0x4d, 0x81, 0xa2, 0x11,
+  0x21, 0x08, 0x35, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0xc1, 0x10, 0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x5a, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x34, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x4b, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11,
+  0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xc1, 0x10, 0x5a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10,
+  0x33, 0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x48, 0xc7,
+  0x4d, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x5b, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x31, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x22, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x5c, 0xc7,
+  0x4d, 0x81, 0x22, 0x11, 0x20, 0x00, 0x2f, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0x23, 0x23, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x47, 0xc7,
+  0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x5c, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10,
+  0x2f, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0xa3, 0x1a, 0x45, 0xc7,
+  0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x22, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0xc4, 0x2b, 0x5d, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x2d, 0x81, 0x21, 0x08, 0x22, 0x1a,
+  0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x5e, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x2d, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x5e, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x2b, 0x81,
+  0x21, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b,
+  0x5f, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2b, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x49, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x06, 0x3d, 0x53, 0xc7,
+  0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x29, 0x81, 0x21, 0x08, 0x23, 0x23, 0x48, 0xc7, 0x4d, 0x81,
+  0x22, 0x11, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x47, 0xc7,
+  0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x49, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x22, 0x1a,
+  0x65, 0x34, 0x53, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x29, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x81,
+  0x22, 0x1a, 0x62, 0x10, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x47, 0xc7,
+  0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xc1, 0x10,
+  0x65, 0x34, 0x52, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x27, 0x81, 0x41, 0x08, 0x23, 0x23,
+  0x49, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x62, 0x10, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x4b, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x27, 0x80,
+  0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x44, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23,
+  0x4c, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x51, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x25, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08,
+  0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x4d, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x3d,
+  0x51, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x25, 0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x81,
+  0x62, 0x10, 0xa2, 0x11, 0x4d, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x11, 0x51, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x23, 0x81, 0x61, 0x08, 0x65, 0x34, 0x4b, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11,
+  0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x4e, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10,
+  0x22, 0x1a, 0x51, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x23, 0x80, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x84,
+  0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x4f, 0xc7, 0x4d, 0x82,
+  0x23, 0x23, 0x61, 0x08, 0x23, 0x23, 0x50, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x21, 0x81,
+  0x20, 0x00, 0x22, 0x11, 0x4b, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x20, 0x00, 0x00, 0x00, 0x21, 0x08,
+  0x23, 0x23, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xc1, 0x10, 0x48, 0xc7, 0x4d, 0x82, 0xa2, 0x11,
+  0x62, 0x10, 0x06, 0x3d, 0x4f, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0xc4, 0x2b, 0x50, 0xc7,
+  0x4d, 0x80, 0x62, 0x10, 0x20, 0x83, 0x41, 0x08, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7,
+  0x4d, 0x81, 0x22, 0x11, 0x21, 0x08, 0x02, 0x80, 0x22, 0x11, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x50, 0xc7, 0x4d, 0x82,
+  0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0x4f, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x1f, 0x84, 0x20, 0x00,
+  0xa2, 0x11, 0xc7, 0x4d, 0x61, 0x08, 0xc1, 0x10, 0x48, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08,
+  0x03, 0x80, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82,
+  0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x4f, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22, 0x11, 0x20, 0x00,
+  0x61, 0x08, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x21, 0x08, 0x1e, 0x85, 0x61, 0x08,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0xa2, 0x11, 0x46, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x04, 0x80, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7,
+  0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x4e, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08,
+  0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0x4f, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x1d, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xa2, 0x11, 0x44, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x05, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x81,
+  0x61, 0x08, 0x62, 0x10, 0x49, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x88,
+  0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x22, 0x1a, 0x41, 0x08,
+  0xa2, 0x11, 0x4e, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x1d, 0x80, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x83,
+  0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20, 0x00,
+  0x06, 0x87, 0x62, 0x10, 0xa2, 0x11, 0x65, 0x34, 0x06, 0x3d, 0xc7, 0x4d, 0xc1, 0x10, 0x62, 0x10,
+  0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x8b,
+  0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x41, 0x08, 0x23, 0x23, 0x4d, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08,
+  0x1c, 0x80, 0x22, 0x11, 0x45, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10,
+  0x23, 0x23, 0xa3, 0x1a, 0x41, 0x08, 0x07, 0x87, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10,
+  0xc4, 0x2b, 0x46, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x43, 0x61, 0x08, 0x81, 0x23, 0x23,
+  0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34,
+  0x4c, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x1b, 0x81, 0x21, 0x08, 0x23, 0x23, 0x47, 0xc7,
+  0x4d, 0x83, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x07, 0x83, 0x21, 0x08, 0xa3, 0x1a,
+  0xc4, 0x2b, 0x22, 0x11, 0x42, 0x61, 0x08, 0x80, 0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x43, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08,
+  0x62, 0x10, 0xa2, 0x11, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x01, 0x81,
+  0x61, 0x08, 0x06, 0x3d, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x1b, 0x81, 0x41, 0x08, 0x65, 0x34,
+  0x47, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x23, 0x23, 0x20, 0x00, 0x06, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x50, 0xc7, 0x4d, 0x8b, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d,
+  0x47, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x01, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x4c, 0xc7,
+  0x4d, 0x80, 0xa2, 0x11, 0x1b, 0x82, 0x41, 0x08, 0x06, 0x3d, 0x22, 0x1a, 0x45, 0xc7, 0x4d, 0x85,
+  0x06, 0x3d, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0x65, 0x34, 0x20, 0x00, 0x06, 0x81, 0x20, 0x00,
+  0x22, 0x1a, 0x50, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x41, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10,
+  0x61, 0x08, 0x02, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x21, 0x08,
+  0x1a, 0x83, 0x61, 0x08, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x44, 0xc7, 0x4d, 0x85, 0xc4, 0x2b,
+  0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0x21, 0x08, 0x07, 0x81, 0x61, 0x08, 0x06, 0x3d,
+  0x51, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x65, 0x34, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x84, 0x06, 0x3d,
+  0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x61, 0x08, 0x03, 0x81, 0x61, 0x08, 0x65, 0x34, 0x4a, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x1a, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x61, 0x08, 0xa3, 0x1a,
+  0x42, 0xc7, 0x4d, 0x86, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x22, 0x1a, 0x08, 0x82, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x5e, 0xc7, 0x4d, 0x85, 0x23, 0x23,
+  0x62, 0x10, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x62, 0x10, 0x04, 0x80, 0x61, 0x08, 0x4a, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x1a, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x22, 0x11, 0xc1, 0x10,
+  0x42, 0xc7, 0x4d, 0x86, 0xa3, 0x1a, 0x41, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x62, 0x10, 0x08, 0x84, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x5a, 0xc7,
+  0x4d, 0x87, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x62, 0x10, 0x04, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x49, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x21, 0x08,
+  0x41, 0x08, 0x19, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x43, 0xc7, 0x4d, 0x84,
+  0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x09, 0x86, 0x41, 0x08, 0x23, 0x23,
+  0x22, 0x1a, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x56, 0xc7, 0x4d, 0x84, 0x06, 0x3d,
+  0x22, 0x1a, 0x62, 0x10, 0x62, 0x10, 0xa3, 0x1a, 0x42, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x05, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08,
+  0x22, 0x11, 0x19, 0x84, 0x41, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x42, 0xc7,
+  0x4d, 0x84, 0x22, 0x11, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x0a, 0x88, 0xa2, 0x11,
+  0xc7, 0x4d, 0x06, 0x3d, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d,
+  0x51, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x22, 0x11, 0x62, 0x10, 0x62, 0x10, 0x22, 0x1a, 0x06, 0x3d,
+  0x43, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x06, 0x80, 0xa2, 0x11, 0x46, 0xc7, 0x4d, 0x85,
+  0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x65, 0x34, 0x41, 0x08, 0x18, 0x84, 0x21, 0x08,
+  0xa3, 0x1a, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x62, 0x10,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x09, 0x80, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x88,
+  0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34,
+  0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x22, 0x1a, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x06, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x86, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x61, 0x08, 0x19, 0x8d, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x1a,
+  0x20, 0x00, 0x08, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x89, 0x06, 0x3d, 0x23, 0x23,
+  0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10,
+  0x42, 0xa2, 0x11, 0x81, 0x22, 0x11, 0xc1, 0x10, 0x42, 0x61, 0x08, 0x83, 0x62, 0x10, 0x61, 0x08,
+  0xa3, 0x1a, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x06, 0x89, 0x21, 0x08,
+  0xc1, 0x10, 0x22, 0x1a, 0xa3, 0x1a, 0xa3, 0x1a, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08,
+  0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x19, 0x8d, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d,
+  0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x06, 0x3d,
+  0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x08, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x84,
+  0x06, 0x3d, 0x06, 0x3d, 0x23, 0x23, 0x22, 0x1a, 0xc1, 0x10, 0x46, 0x61, 0x08, 0x83, 0x22, 0x11,
+  0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x08, 0x43, 0x62, 0x10,
+  0x82, 0x61, 0x08, 0x22, 0x11, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x21, 0x08, 0x19,
+  0x8d, 0x22, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x62,
+  0x10, 0xc4, 0x2b, 0x65, 0x34, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x08, 0x80, 0x22,
+  0x11, 0x62, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x07, 0x81, 0x61, 0x08, 0x65, 0x34, 0x42, 0x06, 0x3d,
+  0x47, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x41, 0x08, 0x19, 0x8d, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0x61, 0x08,
+  0x61, 0x08, 0xc7, 0x4d, 0x61, 0x08, 0x08, 0x80, 0x62, 0x10, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x61, 0x08, 0x06, 0x3d, 0x57, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x06, 0x81, 0x20, 0x00, 0xa3, 0x1a,
+  0x49, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x1a, 0x8c, 0x61, 0x08,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x41, 0x08, 0x08, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x46, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x06, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d,
+  0x62, 0x10, 0x1a, 0x81, 0x20, 0x00, 0x22, 0x11, 0x43, 0xc7, 0x4d, 0x84, 0x22, 0x1a, 0x65, 0x34,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x0b, 0x80, 0xc1, 0x10, 0x46, 0xc7, 0x4d, 0x82, 0xc4, 0x2b,
+  0x61, 0x08, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x05, 0x81, 0x21, 0x08,
+  0x23, 0x23, 0x47, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x23, 0x23,
+  0xc7, 0x4d, 0x61, 0x08, 0x1b, 0x81, 0x21, 0x08, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x84, 0xc4, 0x2b,
+  0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xa2, 0x11, 0x0b, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00,
+  0x04, 0x81, 0x20, 0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d,
+  0x42, 0xc7, 0x4d, 0x86, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0xa2, 0x11, 0xc7, 0x4d,
+  0x61, 0x08, 0x1c, 0x88, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x0b, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x45, 0xc7, 0x4d, 0x82,
+  0xc4, 0x2b, 0x61, 0x08, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x04, 0x81, 0x41, 0x08,
+  0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x83, 0xa2, 0x11, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x86, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x21, 0x08,
+  0x1e, 0x83, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x62, 0x10, 0x0f, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x44, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x80, 0x62, 0x10,
+  0x04, 0x88, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x00, 0x00,
+  0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x86, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a,
+  0x61, 0x08, 0xa3, 0x1a, 0x20, 0x00, 0x32, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x44, 0xc7, 0x4d, 0x82,
+  0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x55, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x04, 0x83,
+  0x61, 0x08, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x85, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x34, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x55, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x0b, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85,
+  0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 0x35, 0x80, 0x61, 0x08,
+  0x43, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x55, 0xc7, 0x4d, 0x80, 0xa2, 0x11,
+  0x0c, 0x88, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x06, 0x3d,
+  0x65, 0x34, 0x41, 0x08, 0x37, 0x81, 0x20, 0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0xa2, 0x11,
+  0x62, 0x10, 0x06, 0x3d, 0x55, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x0c, 0x87, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d, 0x62, 0x10, 0x39, 0x85, 0x21, 0x08,
+  0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x62, 0x10, 0x56, 0xc7, 0x4d, 0x80, 0x62, 0x10,
+  0x0c, 0x86, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x62, 0x10, 0x62, 0x10,
+  0x3b, 0x84, 0x41, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x81,
+  0x65, 0x34, 0x61, 0x08, 0x0c, 0x84, 0x41, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10,
+  0x3e, 0x83, 0x41, 0x08, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x81, 0x23, 0x23,
+  0x21, 0x08, 0x0d, 0x83, 0xc4, 0x2b, 0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x3f, 0x82, 0x41, 0x08,
+  0x61, 0x08, 0xa2, 0x11, 0x55, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x0e, 0x83, 0xa3, 0x1a, 0xc7, 0x4d,
+  0x22, 0x1a, 0x20, 0x00, 0x3f, 0x00, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x55, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x0e, 0x82, 0xc1, 0x10, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x54, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x0e, 0x82, 0x41, 0x08, 0x61, 0x08, 0x20, 0x00,
+  0x3f, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x54, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x3f,
+  0x13, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x54, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3f, 0x13,
+  0x80, 0x62, 0x10, 0x55, 0xc7, 0x4d, 0x42, 0x61, 0x08, 0x3f, 0x12, 0x80, 0x61, 0x08, 0x55, 0xc7,
+  0x4d, 0x83, 0x62, 0x10, 0x22, 0x11, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x11, 0x80, 0xc1, 0x10, 0x54,
+  0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3f,
+  0x10, 0x80, 0x22, 0x1a, 0x54, 0xc7, 0x4d, 0x86, 0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x0e, 0x81, 0x21, 0x08, 0x23, 0x23, 0x54, 0xc7, 0x4d,
+  0x81, 0x61, 0x08, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x0d, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x44, 0xc7,
+  0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x0c, 0x81, 0x61, 0x08, 0x65, 0x34, 0x53, 0xc7, 0x4d,
+  0x82, 0xc4, 0x2b, 0x61, 0x08, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x3f,
+  0x0b, 0x80, 0x62, 0x10, 0x54, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x81,
+  0x23, 0x23, 0x61, 0x08, 0x3f, 0x0a, 0x80, 0x61, 0x08, 0x54, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa2,
+  0x11, 0x48, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x3f, 0x09, 0x80, 0x22, 0x11, 0x53, 0xc7,
+  0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x49, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20, 0x00,
+  0x3f, 0x07, 0x81, 0x20, 0x00, 0x23, 0x23, 0x53, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x61, 0x08, 0x4a,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x07, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x53, 0xc7,
+  0x4d, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x4b, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x06,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x4c,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x3f, 0x05, 0x80, 0x61, 0x08, 0x53, 0xc7, 0x4d, 0x82,
+  0x22, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x4d, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x3f, 0x03,
+  0x81, 0x20, 0x00, 0x22, 0x1a, 0x53, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x4e, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x03, 0x81, 0x61, 0x08, 0x65, 0x34, 0x52, 0xc7, 0x4d, 0x82,
+  0xc4, 0x2b, 0x62, 0x10, 0x65, 0x34, 0x4e, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x03,
+  0x80, 0x61, 0x08, 0x53, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x4f, 0xc7, 0x4d, 0x81, 0x22,
+  0x11, 0x20, 0x00, 0x37, 0x81, 0x21, 0x08, 0x61, 0x08, 0x42, 0x62, 0x10, 0x80, 0x21, 0x08, 0x05,
+  0x80, 0xa2, 0x11, 0x52, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x4e, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x20, 0x00, 0x36, 0x82, 0x62, 0x10, 0x22, 0x1a, 0x65, 0x34, 0x42,
+  0x06, 0x3d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x20, 0x00, 0x02, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x52,
+  0xc7, 0x4d, 0x83, 0x22, 0x1a, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x4d, 0xc7, 0x4d, 0x83, 0xa2,
+  0x11, 0x21, 0x08, 0x61, 0x08, 0x20, 0x00, 0x34, 0x81, 0x41, 0x08, 0x23, 0x23, 0x45, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x01, 0x80, 0x62, 0x10, 0x53, 0xc7, 0x4d, 0x83, 0x61,
+  0x08, 0x00, 0x00, 0x20, 0x00, 0x22, 0x11, 0x4c, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x61,
+  0x08, 0xa3, 0x1a, 0x21, 0x08, 0x34, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x84, 0x65,
+  0x34, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x51, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41,
+  0x08, 0x01, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x41, 0x08, 0x23,
+  0x23, 0xc4, 0x2b, 0x41, 0x08, 0x34, 0x80, 0x62, 0x10, 0x49, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x61,
+  0x08, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x4f, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x03,
+  0x81, 0x61, 0x08, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x22, 0x11, 0x41, 0x08, 0xc1,
+  0x10, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x34, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d,
+  0x80, 0x06, 0x3d, 0x42, 0x61, 0x08, 0x82, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0x4c, 0xc7, 0x4d,
+  0x81, 0xc4, 0x2b, 0x61, 0x08, 0x04, 0x81, 0x62, 0x10, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x88, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x21,
+  0x08, 0x34, 0x81, 0x41, 0x08, 0x23, 0x23, 0x4a, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x62, 0x10, 0x23,
+  0x23, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x4b, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x06,
+  0x8a, 0x62, 0x10, 0x23, 0x23, 0xc4, 0x2b, 0x23, 0x23, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x62,
+  0x10, 0x41, 0x08, 0x62, 0x10, 0xa3, 0x1a, 0x42, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x36, 0x80, 0x61,
+  0x08, 0x4b, 0xc7, 0x4d, 0x87, 0x23, 0x23, 0x62, 0x10, 0x65, 0x34, 0x06, 0x3d, 0xc1, 0x10, 0x41,
+  0x08, 0x61, 0x08, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x06, 0x89, 0x21,
+  0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0xc4,
+  0x2b, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x36, 0x81, 0x21, 0x08, 0xa3,
+  0x1a, 0x4b, 0xc7, 0x4d, 0x87, 0xa2, 0x11, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61,
+  0x08, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x07, 0x80, 0x61, 0x08, 0x42,
+  0x65, 0x34, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x37,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x87, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x23, 0x23, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41,
+  0x08, 0x06, 0x81, 0x62, 0x10, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x38,
+  0x81, 0x20, 0x00, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61,
+  0x08, 0x06, 0x82, 0x20, 0x00, 0xa2, 0x11, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20,
+  0x00, 0x39, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x87, 0xa3, 0x1a, 0x61, 0x08, 0x06,
+  0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0x43, 0xc7, 0x4d, 0x81, 0x22,
+  0x1a, 0x21, 0x08, 0x06, 0x85, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10, 0x23,
+  0x23, 0x46, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x3b, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x4b,
+  0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x86, 0xa2, 0x11, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x06, 0x81, 0x41, 0x08, 0xa2, 0x11, 0x42,
+  0x23, 0x23, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62,
+  0x10, 0x3d, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x8a, 0xc4, 0x2b, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x61,
+  0x08, 0x07, 0x80, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x20, 0x00, 0x3d, 0x81, 0x20,
+  0x00, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08, 0x42,
+  0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0xc1, 0x10, 0x20, 0x00, 0x07, 0x80, 0x22,
+  0x1a, 0x4a, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3f, 0x81, 0x21, 0x08, 0xc1, 0x10, 0x45,
+  0xc7, 0x4d, 0x8d, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0xa2, 0x11, 0xa3, 0x1a, 0x62,
+  0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x41, 0x08, 0x07,
+  0x81, 0x41, 0x08, 0x65, 0x34, 0x49, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x01, 0x81,
+  0x21, 0x08, 0x22, 0x11, 0x43, 0xc7, 0x4d, 0x88, 0x22, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11,
+  0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x09, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x03,
+  0x83, 0x21, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0xc4, 0x2b, 0x42, 0x61, 0x08, 0x80, 0x65, 0x34, 0x43,
+  0xc7, 0x4d, 0x85, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x09,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0x3f,
+  0x05, 0x84, 0x21, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x84,
+  0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x65, 0x34, 0x62, 0x10, 0x0a, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x43, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x3f, 0x09, 0x81, 0x62,
+  0x10, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x82, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x0b, 0x81, 0x20,
+  0x00, 0x62, 0x10, 0x44, 0x61, 0x08, 0x80, 0x41, 0x08, 0x3f, 0x0c, 0x81, 0x62, 0x10, 0xa3, 0x1a,
+  0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x22, 0x83, 0x21, 0x08, 0x61, 0x08, 0xa3,
+  0x1a, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x25, 0x80, 0x21, 0x08,
+  0x42, 0x61, 0x08, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x84, 0x20,
+  0x00, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x26, 0x86, 0x20, 0x00, 0xc1, 0x10,
+  0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08, 0x3f, 0x25, 0x81, 0x61, 0x08, 0x06,
+  0x3d, 0x43, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x41, 0x08, 0x21, 0x08, 0x20,
+  0x00, 0x3f, 0x1a, 0x82, 0x41, 0x08, 0x41, 0x08, 0x21, 0x08, 0x01, 0x81, 0x61, 0x08, 0xc4, 0x2b,
+  0x46, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x23, 0x23, 0xa3, 0x1a, 0xa3, 0x1a, 0xa2, 0x11, 0x61, 0x08,
+  0x3f, 0x16, 0x87, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x61,
+  0x08, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x14, 0x81, 0x20, 0x00,
+  0x61, 0x08, 0x54, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x09, 0x81, 0x62,
+  0x10, 0x62, 0x10, 0x05, 0x82, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x56, 0xc7, 0x4d, 0x81, 0xa2,
+  0x11, 0x61, 0x08, 0x3f, 0x07, 0x83, 0x21, 0x08, 0xa3, 0x1a, 0xc4, 0x2b, 0x61, 0x08, 0x03, 0x81,
+  0x41, 0x08, 0x22, 0x11, 0x59, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x61, 0x08, 0x3f, 0x06, 0x88, 0x61,
+  0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x23,
+  0x23, 0x4c, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0xc4, 0x2b, 0x06, 0x3d, 0x0a, 0x82, 0xc7, 0x4d, 0x23,
+  0x23, 0x61, 0x08, 0x3f, 0x06, 0x43, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x65, 0x34, 0x43, 0xc7, 0x4d,
+  0x83, 0x06, 0x3d, 0x23, 0x23, 0x23, 0x23, 0x65, 0x34, 0x04, 0x85, 0x65, 0x34, 0x61, 0x08, 0x41,
+  0x08, 0x20, 0x00, 0x62, 0x10, 0xa3, 0x1a, 0x0a, 0x82, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x3f,
+  0x04, 0x80, 0x61, 0x08, 0x02, 0x45, 0xc7, 0x4d, 0x89, 0x23, 0x23, 0x62, 0x10, 0x41, 0x08, 0x41,
+  0x08, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x65, 0x34, 0x22, 0x11, 0x42, 0x61, 0x08,
+  0x83, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08, 0x22, 0x1a, 0x03, 0x80, 0x06, 0x3d, 0x42, 0x65, 0x34,
+  0x80, 0x06, 0x3d, 0x01, 0x82, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x3f, 0x03, 0x80, 0x62, 0x10,
+  0x07, 0x86, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0xc4, 0x2b, 0x23, 0x23, 0x22, 0x11,
+  0x42, 0x61, 0x08, 0x81, 0xa3, 0x1a, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x86, 0xc4, 0x2b, 0x61, 0x08,
+  0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x43, 0x62, 0x10, 0x86, 0x61, 0x08,
+  0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x02, 0x81, 0x61,
+  0x08, 0x65, 0x34, 0x05, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d,
+  0x80, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x22, 0x11, 0x42, 0x61, 0x08, 0x8c, 0xa3,
+  0x1a, 0x65, 0x34, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x61, 0x08,
+  0x06, 0x3d, 0x03, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0x4f, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0xa3, 0x1a,
+  0x01, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x01, 0x89, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08, 0x23,
+  0x23, 0x65, 0x34, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x59, 0xc7, 0x4d,
+  0x82, 0x22, 0x1a, 0x20, 0x00, 0x22, 0x11, 0x02, 0x81, 0xa3, 0x1a, 0x20, 0x00, 0x3f, 0x00, 0x88,
+  0x41, 0x08, 0x22, 0x11, 0x62, 0x10, 0x21, 0x08, 0x61, 0x08, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10,
+  0x23, 0x23, 0x5a, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0xa2, 0x11, 0x02, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x3f, 0x00, 0x87, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0xc1, 0x10, 0x20, 0x00, 0x62,
+  0x10, 0x22, 0x11, 0x65, 0x34, 0x5b, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x02,
+  0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x02, 0x88, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34,
+  0xc7, 0x4d, 0x65, 0x34, 0x22, 0x11, 0x61, 0x08, 0xa3, 0x1a, 0x0b, 0x82, 0xa3, 0x1a, 0xc1, 0x10,
+  0x23, 0x23, 0x07, 0x83, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x11, 0x44, 0xc7, 0x4d, 0x3f,
+  0x01, 0x8a, 0x21, 0x08, 0xa3, 0x1a, 0x22, 0x1a, 0x21, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x22, 0x1a,
+  0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x22, 0x11, 0x0b, 0x83, 0x22, 0x11, 0x21, 0x08, 0x41, 0x08,
+  0xa2, 0x11, 0x06, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x04, 0x80, 0x61, 0x08,
+  0x3f, 0x00, 0x8a, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xa2,
+  0x11, 0x22, 0x1a, 0xc4, 0x2b, 0xc4, 0x2b, 0x06, 0x3d, 0x0b, 0x84, 0xc7, 0x4d, 0xa2, 0x11, 0x61,
+  0x08, 0x41, 0x08, 0xc4, 0x2b, 0x05, 0x84, 0x65, 0x34, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x65,
+  0x34, 0x3f, 0x06, 0x82, 0x00, 0x00, 0x21, 0x08, 0x22, 0x1a, 0x54, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x22, 0x11, 0x05, 0x86, 0x06, 0x3d, 0xc1, 0x10, 0xc1, 0x10, 0xc4, 0x2b, 0x22, 0x11, 0x61, 0x08,
+  0x23, 0x23, 0x3f, 0x06, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x80, 0x06, 0x3d, 0x10, 0x49, 0xc7,
+  0x4d, 0x85, 0xc4, 0x2b, 0xc1, 0x10, 0x22, 0x1a, 0xa3, 0x1a, 0x62, 0x10, 0x22, 0x1a, 0x01, 0x80,
+  0x62, 0x10, 0x3f, 0x01, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61,
+  0x08, 0x61, 0x08, 0x05, 0x80, 0x06, 0x3d, 0x05, 0x82, 0x06, 0x3d, 0x22, 0x1a, 0xc4, 0x2b, 0x09,
+  0x88, 0x22, 0x1a, 0xc4, 0x2b, 0x22, 0x1a, 0xc1, 0x10, 0x23, 0x23, 0x61, 0x08, 0xa2, 0x11, 0x65,
+  0x34, 0x61, 0x08, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x02, 0x83, 0x23, 0x23, 0x20, 0x00,
+  0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0x65, 0x34, 0x62, 0x10, 0xa3, 0x1a, 0x04, 0x82, 0x22, 0x11,
+  0x20, 0x00, 0x61, 0x08, 0x09, 0x88, 0xc4, 0x2b, 0x61, 0x08, 0xa3, 0x1a, 0x23, 0x23, 0x61, 0x08,
+  0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x02, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a,
+  0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x03, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x04, 0x83,
+  0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x42, 0x06, 0x3d, 0x85, 0x61, 0x08, 0x22,
+  0x1a, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x80, 0x61, 0x08,
+  0x03, 0x83, 0x23, 0x23, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x02, 0x82, 0xa3, 0x1a, 0x41, 0x08,
+  0x61, 0x08, 0x44, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x0b, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0xa2, 0x11,
+  0x65, 0x34, 0x61, 0x08, 0x22, 0x1a, 0x22, 0x1a, 0xc1, 0x10, 0x62, 0x10, 0x3f, 0x07, 0x82, 0x06,
+  0x3d, 0xc1, 0x10, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x65,
+  0x34, 0x04, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x0a, 0x88, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x61,
+  0x08, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0xc1, 0x10, 0x20, 0x00, 0x3f, 0x07, 0x45, 0xc7, 0x4d,
+  0x82, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x22,
+  0x11, 0x48, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x23, 0x23, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0xc4,
+  0x2b, 0x61, 0x08, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x80, 0xc1, 0x10, 0x08, 0x82, 0xa3, 0x1a,
+  0x41, 0x08, 0xa2, 0x11, 0x54, 0xc7, 0x4d, 0x86, 0x22, 0x11, 0x22, 0x11, 0x06, 0x3d, 0x22, 0x1a,
+  0xc4, 0x2b, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x0c, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x56,
+  0xc7, 0x4d, 0x80, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x80,
+  0xa2, 0x11, 0x20, 0x44, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11,
+  0x07, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0xa2, 0x11, 0x19, 0x81, 0xc7, 0x4d, 0x61, 0x08,
+  0x3f, 0x03, 0x80, 0x61, 0x08, 0x08, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x19,
+  0x80, 0x22, 0x11, 0x3f, 0x03, 0x80, 0x62, 0x10, 0x08, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d,
+  0x47, 0xc7, 0x4d, 0x80, 0x65, 0x34, 0x3f, 0x17, 0x80, 0x06, 0x3d, 0x02, 0x80, 0x65, 0x34, 0x04,
+  0x49, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x22, 0x11, 0x10, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x81, 0x41,
+  0x08, 0xc4, 0x2b, 0x01, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x0b, 0x86, 0x06, 0x3d, 0x23, 0x23, 0xc1,
+  0x10, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x3f, 0x13, 0x8a, 0x00, 0x00, 0x22, 0x11,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0xa2, 0x11, 0x22, 0x1a,
+  0xa3, 0x1a, 0x42, 0x23, 0x23, 0x8a, 0xa3, 0x1a, 0xa2, 0x11, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08,
+  0xa2, 0x11, 0xc4, 0x2b, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0xc1, 0x10, 0x0d, 0x81, 0x22, 0x1a,
+  0x41, 0x08, 0x3f, 0x03, 0x89, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x23, 0x23, 0x00, 0x00, 0x61,
+  0x08, 0x65, 0x34, 0x06, 0x3d, 0x65, 0x34, 0x23, 0x23, 0x43, 0xa3, 0x1a, 0x00, 0x82, 0xc4, 0x2b,
+  0x06, 0x3d, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08,
+  0x08, 0x85, 0x06, 0x3d, 0x22, 0x1a, 0xa3, 0x1a, 0x22, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00,
+  0x00, 0x05, 0x82, 0x21, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x43, 0x61, 0x08, 0x00, 0x49, 0xc7, 0x4d,
+  0x84, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x23, 0x23, 0x62, 0x10, 0x09, 0x83, 0x23, 0x23, 0x41,
+  0x08, 0x20, 0x00, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0xa3, 0x1a,
+  0x65, 0x34, 0x42, 0x06, 0x3d, 0x88, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0x07, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00,
+  0x00, 0x0b, 0x81, 0x20, 0x00, 0x22, 0x11, 0x44, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x23, 0x23, 0x22,
+  0x11, 0x61, 0x08, 0x43, 0x62, 0x10, 0x82, 0x61, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x4c, 0xc7, 0x4d,
+  0x80, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x0c, 0x82, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x03, 0x43,
+  0xc7, 0x4d, 0x43, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x7f, 0x00, 0x00,
+  0x0d, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x51, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x62,
+  0x10, 0x21, 0x08, 0x3f, 0x0e, 0x81, 0x00, 0x00, 0x61, 0x08, 0x17, 0x84, 0x23, 0x23, 0x61, 0x08,
+  0x22, 0x1a, 0xa2, 0x11, 0x21, 0x08, 0x3f, 0x0d, 0x83, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x06,
+  0x3d, 0x14, 0x86, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0xa2, 0x11, 0x21,
+  0x08, 0x3f, 0x0d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0xc4, 0x2b, 0x11, 0x89, 0x06, 0x3d,
+  0x22, 0x11, 0x22, 0x11, 0x06, 0x3d, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11,
+  0x21, 0x08, 0x3f, 0x0d, 0x84, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x0f,
+  0x85, 0x23, 0x23, 0x65, 0x34, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d,
+  0x80, 0x61, 0x08, 0x3f, 0x0f, 0x84, 0x00, 0x00, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a,
+  0x0d, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x81,
+  0x62, 0x10, 0x20, 0x00, 0x3f, 0x0e, 0x87, 0x61, 0x08, 0x06, 0x3d, 0x23, 0x23, 0xc1, 0x10, 0x62,
+  0x10, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x0b, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06,
+  0x3d, 0x02, 0x84, 0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x0b, 0x81,
+  0x62, 0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x88, 0x61, 0x08, 0x00, 0x00, 0x20, 0x00, 0x62, 0x10,
+  0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0x04, 0x83, 0x23, 0x23, 0x62, 0x10,
+  0x62, 0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x00, 0x00, 0x22, 0x11, 0xc7, 0x4d,
+  0x22, 0x1a, 0x21, 0x08, 0x3f, 0x0a, 0x80, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x22,
+  0x11, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0xa2, 0x11, 0xc1, 0x10, 0xc4, 0x2b, 0x02,
+  0x84, 0x23, 0x23, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x86, 0x23,
+  0x23, 0x41, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x08, 0x83,
+  0x61, 0x08, 0xc1, 0x10, 0x61, 0x08, 0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0xa2, 0x11,
+  0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0x22, 0x11, 0x22, 0x1a, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08,
+  0x20, 0x00, 0x62, 0x10, 0xa3, 0x1a, 0x44, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00,
+  0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x05, 0x85, 0x61,
+  0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0xa2, 0x11, 0x04, 0x42, 0xc7, 0x4d, 0x87,
+  0x23, 0x23, 0xc1, 0x10, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x23, 0x23,
+  0x45, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7,
+  0x4d, 0x80, 0x61, 0x08, 0x3f, 0x04, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x83, 0x22,
+  0x11, 0x41, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x04, 0x4d, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x62, 0x10,
+  0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x03,
+  0x80, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10, 0x41, 0x08, 0x22, 0x1a, 0x07,
+  0x48, 0xc7, 0x4d, 0x84, 0x23, 0x23, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7,
+  0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x01, 0x81, 0x62, 0x10, 0x65, 0x34, 0x45, 0xc7, 0x4d,
+  0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x0d, 0x85, 0xc4, 0x2b, 0x61, 0x08, 0x21,
+  0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3f,
+  0x81, 0x41, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x08,
+  0x88, 0xc4, 0x2b, 0xa3, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0x21, 0x08, 0x41, 0x08, 0x61,
+  0x08, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d,
+  0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x87, 0x65, 0x34, 0x41, 0x08, 0x20, 0x00, 0x41,
+  0x08, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62,
+  0x10, 0x3d, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x09, 0x84, 0x23,
+  0x23, 0x41, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x06, 0x3d, 0x01, 0x50, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x3b, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x49, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08,
+  0x48, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x55, 0xc7, 0x4d, 0x81, 0x22, 0x11,
+  0x20, 0x00, 0x3a, 0x80, 0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7,
+  0x4d, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x56, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x3a, 0x81, 0x61, 0x08,
+  0x65, 0x34, 0x49, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x08, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x57, 0xc7, 0x4d, 0x00, 0x80, 0x41, 0x08, 0x37, 0x81, 0x20, 0x00, 0x22, 0x11, 0x4a,
+  0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x08, 0x81, 0x61, 0x08, 0x22, 0x11, 0x58,
+  0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x36, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x81, 0xc4, 0x2b, 0xc4, 0x2b, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x08, 0x81, 0x62,
+  0x10, 0x22, 0x1a, 0x58, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x75, 0x00, 0x00, 0x81, 0x21,
+  0x08, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x23, 0x23, 0x06, 0x81, 0x61, 0x08, 0x22,
+  0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x19, 0x81, 0x23, 0x23, 0x41, 0x08, 0x34,
+  0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x05, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x1a, 0x80, 0x61,
+  0x08, 0x73, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x03, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3,
+  0x1a, 0x05, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4,
+  0x2b, 0x1a, 0x81, 0x65, 0x34, 0x61, 0x08, 0x72, 0x00, 0x00, 0x00, 0x44, 0xc7, 0x4d, 0x82, 0x06,
+  0x3d, 0x62, 0x10, 0xa2, 0x11, 0x05, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x07, 0x82, 0x65,
+  0x34, 0x62, 0x10, 0xc4, 0x2b, 0x1b, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x70, 0x00, 0x00, 0x81, 0x41,
+  0x08, 0x23, 0x23, 0x04, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x11, 0x05, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0x23, 0x23, 0x07, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x1b, 0x81, 0x06, 0x3d, 0x62,
+  0x10, 0x70, 0x00, 0x00, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x07,
+  0x80, 0x23, 0x23, 0x07, 0x80, 0x65, 0x34, 0x1e, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x6e, 0x00, 0x00,
+  0x00, 0x80, 0xa3, 0x1a, 0x06, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x81, 0x62, 0x10, 0x23, 0x23,
+  0x07, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x1d, 0x80, 0x62, 0x10, 0x6e, 0x00, 0x00, 0x00,
+  0x47, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x61, 0x08, 0x31, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x6c, 0x00,
+  0x00, 0x00, 0x80, 0x22, 0x1a, 0x07, 0x81, 0xa3, 0x1a, 0x62, 0x10, 0x10, 0x80, 0x06, 0x3d, 0x09,
+  0x81, 0x65, 0x34, 0x23, 0x23, 0x14, 0x80, 0x62, 0x10, 0x6c, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06,
+  0x3d, 0x07, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x05, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x07,
+  0x80, 0x06, 0x3d, 0x09, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0xc1, 0x10, 0x13, 0x81, 0x22, 0x1a, 0x20,
+  0x00, 0x6a, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x08, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4,
+  0x2b, 0x05, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x08,
+  0x82, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x11, 0x52, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x6a,
+  0x00, 0x00, 0x00, 0x80, 0x06, 0x3d, 0x08, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x22, 0x1a, 0x05, 0x81,
+  0x61, 0x08, 0x22, 0x1a, 0x09, 0x80, 0x22, 0x1a, 0x09, 0x82, 0x23, 0x23, 0x62, 0x10, 0x22, 0x11,
+  0x52, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x6a, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x09, 0x82, 0xc7, 0x4d,
+  0xc1, 0x10, 0x61, 0x08, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x07, 0x82, 0xc7, 0x4d,
+  0x61, 0x08, 0x22, 0x11, 0x0a, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x22, 0x11, 0x51, 0xc7, 0x4d, 0x81,
+  0x65, 0x34, 0x41, 0x08, 0x68, 0x00, 0x00, 0x00, 0x80, 0x65, 0x34, 0x09, 0x82, 0xc7, 0x4d, 0xa3,
+  0x1a, 0x62, 0x10, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x07, 0x82, 0xc7, 0x4d, 0x61,
+  0x08, 0x61, 0x08, 0x0b, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0xa2, 0x11, 0x51, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x68, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x09, 0x83, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0xc4, 0x2b, 0x04, 0x81, 0x62, 0x10, 0x22, 0x11, 0x07, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x62,
+  0x10, 0x06, 0x3d, 0x0b, 0x82, 0x23, 0x23, 0x62, 0x10, 0xa3, 0x1a, 0x50, 0xc7, 0x4d, 0x81, 0xa3,
+  0x1a, 0x21, 0x08, 0x66, 0x00, 0x00, 0x82, 0x20, 0x00, 0x41, 0x08, 0xa3, 0x1a, 0x0a, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0x22, 0x1a, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0xc1, 0x10, 0x08, 0x82, 0x22,
+  0x1a, 0x61, 0x08, 0x06, 0x3d, 0x0c, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x23, 0x23, 0x0f, 0x81, 0x06,
+  0x3d, 0x61, 0x08, 0x66, 0x00, 0x00, 0x42, 0x61, 0x08, 0x09, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x20,
+  0x00, 0x61, 0x08, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x08, 0x82, 0x23, 0x23, 0x61,
+  0x08, 0xc4, 0x2b, 0x0d, 0x82, 0xa2, 0x11, 0x62, 0x10, 0xc4, 0x2b, 0x0f, 0x80, 0x61, 0x08, 0x65,
+  0x00, 0x00, 0x00, 0x83, 0x65, 0x34, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x07, 0x84, 0xc7, 0x4d,
+  0x23, 0x23, 0x41, 0x08, 0x00, 0x00, 0x62, 0x10, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08,
+  0x08, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x1a, 0x0e, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x65, 0x34,
+  0x0e, 0x81, 0x23, 0x23, 0x21, 0x08, 0x63, 0x00, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x01, 0x82, 0x61,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x85, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x61,
+  0x08, 0x06, 0x3d, 0x04, 0x80, 0x62, 0x10, 0x08, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x0d,
+  0x84, 0x06, 0x3d, 0xc1, 0x10, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x0e, 0x80, 0x62, 0x10, 0x63,
+  0x00, 0x00, 0x87, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x61,
+  0x08, 0x06, 0x3d, 0x04, 0x82, 0xc7, 0x4d, 0x22, 0x11, 0x20, 0x00, 0x01, 0x82, 0x41, 0x08, 0x22,
+  0x1a, 0x06, 0x3d, 0x02, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x82, 0xc7, 0x4d, 0x61,
+  0x08, 0x61, 0x08, 0x0b, 0x86, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x21, 0x08, 0x62, 0x10, 0x62,
+  0x10, 0x61, 0x08, 0x4e, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x63, 0x00, 0x00, 0x80, 0x61, 0x08, 0x43,
+  0xc7, 0x4d, 0x84, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x01, 0x82, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x02, 0x85, 0x00, 0x00, 0x21, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x23,
+  0x23, 0xc4, 0x2b, 0x01, 0x80, 0x06, 0x3d, 0x07, 0x83, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x65,
+  0x34, 0x08, 0x89, 0xc4, 0x2b, 0xc1, 0x10, 0x62, 0x10, 0x21, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x06,
+  0x3d, 0x23, 0x23, 0x61, 0x08, 0x22, 0x1a, 0x4d, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x62,
+  0x00, 0x00, 0x80, 0x22, 0x11, 0x44, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x62,
+  0x10, 0x42, 0x61, 0x08, 0x80, 0x62, 0x10, 0x03, 0x88, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08, 0x41,
+  0x08, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x07, 0x83, 0xc7, 0x4d, 0x06,
+  0x3d, 0x62, 0x10, 0x22, 0x1a, 0x05, 0x81, 0x65, 0x34, 0x22, 0x1a, 0x43, 0x61, 0x08, 0x81, 0xa3,
+  0x1a, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0x65, 0x34, 0x0c, 0x81, 0x65,
+  0x34, 0x41, 0x08, 0x61, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x46, 0xc7, 0x4d, 0x85, 0x65,
+  0x34, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x03, 0x87, 0x41, 0x08, 0xc4,
+  0x2b, 0x06, 0x3d, 0x65, 0x34, 0xa3, 0x1a, 0xa3, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0x09, 0x8d, 0xc7,
+  0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x65, 0x34, 0xc4, 0x2b, 0xa2, 0x11, 0x61,
+  0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x81, 0x61,
+  0x08, 0x61, 0x08, 0x4d, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x61, 0x00, 0x00, 0x81, 0x21, 0x08, 0x23,
+  0x23, 0x01, 0x45, 0xc7, 0x4d, 0x84, 0x22, 0x11, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10,
+  0x03, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x50, 0xc7, 0x4d, 0x8a, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0xc4, 0x2b, 0x06, 0x3d,
+  0x48, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x41, 0x08, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x61, 0x00, 0x00, 0x83, 0x21, 0x08, 0x23, 0x23, 0xc4, 0x2b, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x84,
+  0x61, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x03, 0x81, 0x20, 0x00, 0xa3, 0x1a,
+  0x51, 0xc7, 0x4d, 0x85, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x06, 0x3d,
+  0x01, 0x49, 0xc7, 0x4d, 0x84, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x4b,
+  0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x60, 0x00, 0x00, 0x83, 0x20, 0x00, 0xa3, 0x1a, 0xc1,
+  0x10, 0xc1, 0x10, 0x02, 0x87, 0xc7, 0x4d, 0xc4, 0x2b, 0x22, 0x1a, 0x62, 0x10, 0xc4, 0x2b, 0xc7,
+  0x4d, 0x06, 0x3d, 0x61, 0x08, 0x03, 0x81, 0x00, 0x00, 0x61, 0x08, 0x61, 0xc7, 0x4d, 0x83, 0x06,
+  0x3d, 0x22, 0x11, 0x41, 0x08, 0xa2, 0x11, 0x01, 0x80, 0xc1, 0x10, 0x4b, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x21, 0x08, 0x60, 0x00, 0x00, 0x83, 0x20, 0x00, 0x22, 0x1a, 0xa3, 0x1a, 0x62, 0x10, 0x02,
+  0x86, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x04,
+  0x82, 0x00, 0x00, 0x21, 0x08, 0xa2, 0x11, 0x0f, 0x4f, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x61, 0x08,
+  0x21, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0x61, 0x08, 0x00, 0x00, 0x41, 0x08, 0x23, 0x23, 0x4a, 0xc7,
+  0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x61, 0x00, 0x00, 0x83, 0xa2, 0x11, 0x06, 0x3d, 0x62, 0x10,
+  0x65, 0x34, 0x42, 0xc7, 0x4d, 0x85, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x1a,
+  0x21, 0x08, 0x04, 0x84, 0x00, 0x00, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x0d, 0x4e,
+  0xc7, 0x4d, 0x86, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62,
+  0x10, 0x01, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x61,
+  0x00, 0x00, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0xc1, 0x10, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x85, 0x06,
+  0x3d, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x06, 0x84, 0x23, 0x23, 0x62,
+  0x10, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x0d, 0x4a, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0xa2, 0x11,
+  0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x02, 0x81, 0x20, 0x00,
+  0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10, 0xc1, 0x10, 0x21, 0x08, 0x60, 0x00,
+  0x00, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85,
+  0x22, 0x11, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x04, 0x87, 0x61, 0x08,
+  0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x15, 0x84,
+  0xa3, 0x1a, 0x62, 0x10, 0x62, 0x10, 0x22, 0x1a, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08,
+  0x22, 0x1a, 0x06, 0x3d, 0x62, 0x10, 0x60, 0x00, 0x00, 0x84, 0x41, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x61, 0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x22, 0x1a, 0x41, 0x08, 0x03, 0x80, 0x62, 0x10, 0x42, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0xc1, 0x10, 0x42, 0x61, 0x08, 0x80, 0x23, 0x23, 0x10, 0x85, 0x06, 0x3d, 0xa3, 0x1a, 0x62, 0x10,
+  0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x03, 0x80,
+  0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x01, 0x80, 0xc1, 0x10,
+  0x61, 0x00, 0x00, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x88, 0xc7, 0x4d,
+  0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08,
+  0x02, 0x81, 0x61, 0x08, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0xc1, 0x10, 0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x09, 0x85, 0x65, 0x34,
+  0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a,
+  0x20, 0x00, 0x03, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10,
+  0x61, 0x08, 0x06, 0x3d, 0x01, 0x81, 0x23, 0x23, 0x21, 0x08, 0x60, 0x00, 0x00, 0x8e, 0x41, 0x08,
+  0x65, 0x34, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x22, 0x1a, 0x06, 0x3d, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x61, 0x08, 0x02, 0x81, 0x41, 0x08,
+  0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x8a, 0x06, 0x3d, 0xc4, 0x2b, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x42, 0x22, 0x11, 0x86,
+  0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x48, 0xc7,
+  0x4d, 0x80, 0x22, 0x11, 0x45, 0x00, 0x00, 0x86, 0x22, 0x1a, 0x23, 0x23, 0xa2, 0x11, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0x02, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x00,
+  0x00, 0x8d, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d,
+  0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x65, 0x34, 0xa2, 0x11, 0x02, 0x81,
+  0x20, 0x00, 0xa3, 0x1a, 0x02, 0x45, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x06, 0x3d, 0x23, 0x23, 0xa2,
+  0x11, 0x42, 0x61, 0x08, 0x42, 0x62, 0x10, 0x85, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0xa3, 0x1a,
+  0x65, 0x34, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x45, 0x00, 0x00, 0x84, 0x41, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x03, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x61,
+  0x00, 0x00, 0x8d, 0x21, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x61,
+  0x08, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x03,
+  0x80, 0xc1, 0x10, 0x4f, 0xc7, 0x4d, 0x42, 0x06, 0x3d, 0x50, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x45,
+  0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x62, 0x00, 0x00,
+  0x81, 0x41, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x00, 0x85, 0x65, 0x34, 0xc4, 0x2b, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x04, 0x80, 0x61, 0x08, 0x63, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x04, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x63, 0x00, 0x00, 0x81,
+  0x61, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x00, 0x84, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x06,
+  0x3d, 0x62, 0x10, 0x04, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x22, 0x80, 0x62, 0x10, 0x03, 0x81, 0x62,
+  0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x64, 0x00, 0x00, 0x85, 0x41, 0x08, 0xa2,
+  0x11, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x42, 0x62, 0x10, 0x80, 0x20, 0x00, 0x04,
+  0x81, 0x41, 0x08, 0xc4, 0x2b, 0x07, 0x59, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x02, 0x81,
+  0x61, 0x08, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x65, 0x00, 0x00, 0x85, 0x20, 0x00,
+  0x62, 0x10, 0x22, 0x1a, 0xc4, 0x2b, 0x65, 0x34, 0x62, 0x10, 0x08, 0x80, 0x22, 0x1a, 0x4a, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x14, 0x80, 0x65, 0x34, 0x02, 0x81, 0x41, 0x08, 0xa3, 0x1a,
+  0x4a, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0xc4, 0x2b, 0xc7, 0x4d, 0xa2, 0x11, 0x67, 0x00, 0x00, 0x82,
+  0x20, 0x00, 0x21, 0x08, 0x41, 0x08, 0x09, 0x80, 0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x81, 0xa2, 0x11,
+  0xa3, 0x1a, 0x14, 0x84, 0xc4, 0x2b, 0x41, 0x08, 0x20, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x42, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x22, 0x1a, 0x06, 0x83, 0x22, 0x1a, 0xa3, 0x1a, 0xc7, 0x4d, 0x22, 0x11,
+  0x74, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xc4, 0x2b,
+  0x14, 0x82, 0xa3, 0x1a, 0x21, 0x08, 0x22, 0x11, 0x43, 0xc7, 0x4d, 0x83, 0x22, 0x1a, 0x61, 0x08,
+  0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x86, 0xc1, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xa2, 0x11,
+  0x22, 0x1a, 0xc7, 0x4d, 0x61, 0x08, 0x74, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x48, 0xc7,
+  0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x65, 0x34, 0x14, 0x89, 0xa2, 0x11, 0x21, 0x08, 0x22, 0x1a,
+  0x65, 0x34, 0xc4, 0x2b, 0xa2, 0x11, 0x62, 0x10, 0x20, 0x00, 0x00, 0x00, 0x61, 0x08, 0x42, 0xc7,
+  0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x01, 0x83, 0x22, 0x11, 0x22, 0x1a, 0x06, 0x3d, 0x61, 0x08,
+  0x74, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x00, 0x81, 0x61, 0x08, 0x06,
+  0x3d, 0x14, 0x84, 0xc1, 0x10, 0x00, 0x00, 0x20, 0x00, 0x21, 0x08, 0x21, 0x08, 0x43, 0x00, 0x00,
+  0x80, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0xc1, 0x10, 0x01, 0x83, 0xc1, 0x10, 0xa2,
+  0x11, 0x23, 0x23, 0x21, 0x08, 0x75, 0x00, 0x00, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0xc4,
+  0x2b, 0x62, 0x10, 0x06, 0x3d, 0x13, 0x80, 0xc7, 0x4d, 0x05, 0x42, 0x00, 0x00, 0x80, 0xa3, 0x1a,
+  0x42, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0xa2, 0x11, 0x01, 0x82, 0x61, 0x08, 0x23, 0x23, 0x61, 0x08,
+  0x76, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x61, 0x08,
+  0x14, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x06, 0x81, 0x21, 0x08, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x86,
+  0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0xa3, 0x1a, 0x21, 0x08, 0x76, 0x00,
+  0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x61, 0x08, 0x14, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x06, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x02, 0x82, 0x61,
+  0x08, 0x41, 0x08, 0x41, 0x08, 0x78, 0x00, 0x00, 0x80, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x81, 0x22,
+  0x11, 0x22, 0x11, 0x14, 0x81, 0x65, 0x34, 0x61, 0x08, 0x06, 0x88, 0x62, 0x10, 0x06, 0x3d, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d, 0x22, 0x1a, 0x21, 0x08, 0x7a, 0x00, 0x00,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa2, 0x11, 0x14, 0x81, 0x23,
+  0x23, 0x41, 0x08, 0x06, 0x80, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x42, 0x61, 0x08, 0x80, 0x21, 0x08,
+  0x7b, 0x00, 0x00, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa3, 0x1a,
+  0x13, 0x82, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x06, 0x84, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d,
+  0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0xa3, 0x1a, 0x13, 0x81, 0xc7, 0x4d, 0x22, 0x11, 0x07, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x61, 0x08, 0x01, 0x7e, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0x61,
+  0x08, 0xc4, 0x2b, 0x13, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x07, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0xc4,
+  0x2b, 0x41, 0x08, 0x01, 0x7e, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x13, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x07, 0x82, 0x62, 0x10,
+  0x65, 0x34, 0x62, 0x10, 0x02, 0x7f, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x12, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x08,
+  0x80, 0x41, 0x08, 0x03, 0x7f, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x00,
+  0x81, 0x62, 0x10, 0xc4, 0x2b, 0x12, 0x81, 0xc7, 0x4d, 0x65, 0x34, 0x42, 0x61, 0x08, 0x80, 0x21,
+  0x08, 0x3f, 0x0b, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10,
+  0x65, 0x34, 0x12, 0x85, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc1, 0x10,
+  0x3f, 0x0b, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65,
+  0x34, 0x12, 0x86, 0xc7, 0x4d, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41,
+  0x08, 0x3f, 0x0b, 0x86, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10,
+  0x06, 0x3d, 0x12, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10,
+  0x3f, 0x0c, 0x85, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x11,
+  0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x3f,
+  0x0c, 0x85, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x11, 0x83,
+  0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x20, 0x00,
+  0x3f, 0x0c, 0x84, 0x62, 0x10, 0x06, 0x3d, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0x11, 0x83, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x65, 0x34, 0x01, 0x82, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x3f,
+  0x0c, 0x84, 0x20, 0x00, 0xa2, 0x11, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0x10, 0x84, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08,
+  0x3f, 0x0c, 0x84, 0x00, 0x00, 0x61, 0x08, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x10, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x02, 0x80, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x0e, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x10, 0x83, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x62, 0x10, 0x22, 0x11, 0x02, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00, 0x81,
+  0x62, 0x10, 0x06, 0x3d, 0x10, 0x83, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x23, 0x23, 0x02, 0x80,
+  0xa2, 0x11, 0x7f, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0f, 0x84,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x02, 0x81, 0xc4, 0x2b, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x0c, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0f, 0x84, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0c,
+  0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0f, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x61, 0x08, 0x04, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x0e, 0x42, 0xc7, 0x4d, 0x81, 0x62, 0x10, 0x22, 0x1a, 0x05, 0x80, 0x22,
+  0x11, 0x7f, 0x00, 0x00, 0x0b, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0e, 0x84, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00,
+  0x0a, 0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0e, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3,
+  0x1a, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x0a, 0x44, 0x00, 0x00,
+  0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0d, 0x42, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x80,
+  0xa2, 0x11, 0x7f, 0x00, 0x00, 0x0a, 0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0d, 0x42,
+  0xc7, 0x4d, 0x81, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x4f, 0x00,
+  0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23,
+  0x23, 0x06, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23,
+  0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x80, 0xa2, 0x11, 0x7f,
+  0x00, 0x00, 0x4f, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x61,
+  0x08, 0x41, 0x08, 0x65, 0x34, 0x06, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x81,
+  0x20, 0x00, 0xa3, 0x1a, 0x0b, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x22,
+  0x11, 0x06, 0x80, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80, 0x22, 0x1a, 0x0b, 0x42,
+  0xc7, 0x4d, 0x84, 0xc4, 0x2b, 0x41, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x80, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x0a, 0x43, 0xc7, 0x4d, 0x80, 0x22,
+  0x11, 0x01, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x04, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x80, 0x22, 0x11, 0x0a, 0x43, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x02, 0x81, 0x61,
+  0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x50, 0x00,
+  0x00, 0x80, 0xc1, 0x10, 0x4d, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x02, 0x81, 0x20, 0x00,
+  0x22, 0x1a, 0x43, 0xc7, 0x4d, 0x00, 0x7f, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x4d, 0xc7, 0x4d,
+  0x80, 0xa2, 0x11, 0x03, 0x86, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x22,
+  0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x51, 0x00, 0x00, 0x80, 0x61, 0x08, 0x4d, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x02, 0x42, 0x00, 0x00, 0x83, 0x61, 0x08, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61,
+  0x08, 0x01, 0x43, 0x00, 0x00, 0x82, 0x20, 0x00, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x02,
+  0x50, 0x00, 0x00, 0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x02, 0x7f, 0x00, 0x00,
+  0x0a, 0x4f, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x01,
+  0x7f, 0x00, 0x00, 0x0c, 0x4e, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x82,
+  0x23, 0x23, 0x61, 0x08, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x4e, 0x00, 0x00, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x01, 0x47, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x61, 0x08, 0xa3, 0x1a, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x0e, 0x4d, 0x00, 0x00, 0x82, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x45, 0xc7, 0x4d,
+  0x87, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc4, 0x2b, 0x41,
+  0x08, 0x7f, 0x00, 0x00, 0x0e, 0x4b, 0x00, 0x00, 0x80, 0x20, 0x00, 0x42, 0x62, 0x10, 0x46, 0x61,
+  0x08, 0x81, 0x22, 0x11, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00,
+  0x00, 0x0f, 0x49, 0x00, 0x00, 0x84, 0x21, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x06, 0x3d, 0xc4, 0x2b,
+  0x44, 0x23, 0x23, 0x81, 0x65, 0x34, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x00, 0x7f, 0x00, 0x00, 0x10,
+  0x47, 0x00, 0x00, 0x81, 0x41, 0x08, 0x22, 0x1a, 0x4a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x65, 0x34,
+  0x42, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x12, 0x44, 0x00, 0x00, 0x81,
+  0x61, 0x08, 0x23, 0x23, 0x02, 0x48, 0xc7, 0x4d, 0x85, 0xa2, 0x11, 0x62, 0x10, 0x65, 0x34, 0x06,
+  0x3d, 0xc1, 0x10, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x81, 0x61, 0x08, 0x23,
+  0x23, 0x03, 0x47, 0xc7, 0x4d, 0x85, 0x23, 0x23, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x61, 0x08,
+  0x20, 0x00, 0x3f, 0x16, 0x82, 0x00, 0x00, 0x41, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x61, 0x08, 0x3f, 0x1b, 0x81, 0x21, 0x08, 0xa2, 0x11, 0x4b, 0xc7, 0x4d, 0x81, 0x22, 0x1a,
+  0x61, 0x08, 0x3f, 0x1c, 0x80, 0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x21,
+  0x08, 0x3f, 0x1c, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10,
+  0x20, 0x00, 0x3f, 0x1c, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61,
+  0x08, 0x21, 0x08, 0x3f, 0x1e, 0x82, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x84,
+  0x06, 0x3d, 0x23, 0x23, 0xc1, 0x10, 0x62, 0x10, 0x21, 0x08, 0x3f, 0x22, 0x81, 0x41, 0x08, 0x61,
+  0x08, 0x42, 0x62, 0x10, 0x81, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x07, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x07, 0x42, 0x41, 0x08, 0x3f, 0x28, 0x85, 0x61, 0x08, 0xc4, 0x2b,
+  0x06, 0x3d, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x25, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x43,
+  0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x1d, 0x81, 0x20, 0x00, 0x21, 0x08,
+  0x02, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x22, 0x1a, 0xa2, 0x11,
+  0xc1, 0x10, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x16, 0x87, 0x20, 0x00, 0x61, 0x08, 0xa3, 0x1a, 0xa3,
+  0x1a, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x4c, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41,
+  0x08, 0x3f, 0x15, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x53, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10,
+  0x20, 0x00, 0x3f, 0x09, 0x81, 0x61, 0x08, 0x62, 0x10, 0x05, 0x82, 0x20, 0x00, 0x61, 0x08, 0x06,
+  0x3d, 0x14, 0x83, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x07, 0x83, 0x20, 0x00,
+  0x22, 0x1a, 0xa3, 0x1a, 0x21, 0x08, 0x03, 0x82, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x58, 0xc7,
+  0x4d, 0x81, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x06, 0x88, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xa2,
+  0x11, 0x61, 0x08, 0x20, 0x00, 0x21, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x4c, 0xc7, 0x4d, 0x42, 0x06,
+  0x3d, 0x0a, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x05, 0x80, 0x62, 0x10, 0x42, 0xc7,
+  0x4d, 0x83, 0x65, 0x34, 0xa3, 0x1a, 0xa3, 0x1a, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x65, 0x34, 0x06, 0x3d, 0x04, 0x85, 0x06, 0x3d, 0xa2, 0x11, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08,
+  0xc4, 0x2b, 0x0a, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x09, 0x44, 0xc7, 0x4d, 0x80,
+  0x65, 0x34, 0x42, 0x61, 0x08, 0x8c, 0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d,
+  0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x23, 0x23,
+  0x04, 0x42, 0x06, 0x3d, 0x02, 0x82, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x0c, 0xa0, 0x06,
+  0x3d, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x22, 0x1a, 0x22, 0x11, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0x22, 0x1a, 0x62,
+  0x10, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x62,
+  0x10, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62,
+  0x10, 0x3f, 0x02, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d,
+  0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xc4, 0x2b, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x91, 0x65, 0x34,
+  0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0x61, 0x08, 0xc1, 0x10, 0x23, 0x23, 0xc4, 0x2b, 0x65, 0x34,
+  0x23, 0x23, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a,
+  0x41, 0x08, 0x3f, 0x01, 0x81, 0x20, 0x00, 0x22, 0x11, 0x05, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x23,
+  0x23, 0x4f, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x22, 0x1a, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x83, 0x06,
+  0x3d, 0x62, 0x10, 0x20, 0x00, 0xa3, 0x1a, 0x01, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x02, 0x88,
+  0x41, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08,
+  0x22, 0x1a, 0x59, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x00, 0x00, 0x22, 0x11, 0x02, 0x81, 0xa2, 0x11,
+  0x20, 0x00, 0x3f, 0x00, 0x80, 0x21, 0x08, 0x42, 0x61, 0x08, 0x84, 0x62, 0x10, 0x62, 0x10, 0x61,
+  0x08, 0x41, 0x08, 0xa2, 0x11, 0x5a, 0xc7, 0x4d, 0x80, 0xa3, 0x1a, 0x04, 0x81, 0xc4, 0x2b, 0x41,
+  0x08, 0x3f, 0x00, 0x87, 0x61, 0x08, 0x65, 0x34, 0xc4, 0x2b, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08,
+  0x61, 0x08, 0x23, 0x23, 0x5b, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x21, 0x08, 0x23, 0x23, 0x02, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x3f, 0x01, 0x89, 0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0xa3, 0x1a, 0xc1, 0x10, 0xc4, 0x2b, 0x0b, 0x82, 0xc4, 0x2b, 0x22,
+  0x1a, 0x65, 0x34, 0x08, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x3f, 0x01,
+  0x8a, 0x41, 0x08, 0x23, 0x23, 0x23, 0x23, 0x41, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0x23, 0x23, 0x62,
+  0x10, 0x21, 0x08, 0x00, 0x00, 0xc1, 0x10, 0x0b, 0x83, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0xa3,
+  0x1a, 0x06, 0x83, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x04, 0x80, 0x61, 0x08, 0x3f,
+  0x00, 0x8a, 0x00, 0x00, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x61, 0x08,
+  0x61, 0x08, 0x22, 0x1a, 0xa2, 0x11, 0x65, 0x34, 0x0b, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x41, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0xc1, 0x10, 0x06, 0x3d,
+  0x3f, 0x06, 0x82, 0x00, 0x00, 0x20, 0x00, 0x22, 0x11, 0x54, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61,
+  0x08, 0x23, 0x23, 0x04, 0x86, 0x06, 0x3d, 0xc1, 0x10, 0x22, 0x1a, 0xc4, 0x2b, 0x61, 0x08, 0x61,
+  0x08, 0x65, 0x34, 0x3f, 0x06, 0x81, 0x61, 0x08, 0x65, 0x34, 0x14, 0x48, 0xc7, 0x4d, 0x86, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x23, 0x23, 0xa2, 0x11, 0x61, 0x08, 0xc4, 0x2b, 0x01, 0x80, 0x62,
+  0x10, 0x3f, 0x02, 0x80, 0xc1, 0x10, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xc1, 0x10, 0x22, 0x11,
+  0x0d, 0x81, 0xc4, 0x2b, 0x06, 0x3d, 0x09, 0x88, 0x23, 0x23, 0x65, 0x34, 0x22, 0x11, 0xa2, 0x11,
+  0xa3, 0x1a, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x65,
+  0x34, 0x02, 0x83, 0xc4, 0x2b, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0x06, 0x3d, 0x61,
+  0x08, 0xc4, 0x2b, 0x04, 0x82, 0x22, 0x1a, 0x41, 0x08, 0x61, 0x08, 0x08, 0x89, 0xc7, 0x4d, 0x23,
+  0x23, 0x61, 0x08, 0x23, 0x23, 0xa2, 0x11, 0x22, 0x11, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x41,
+  0x08, 0x3f, 0x01, 0x80, 0x62, 0x10, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x00, 0x00, 0x41, 0x08,
+  0xc4, 0x2b, 0x03, 0x82, 0xc1, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0x04, 0x83, 0x61, 0x08, 0x00, 0x00,
+  0x62, 0x10, 0x06, 0x3d, 0x08, 0x87, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0xa2, 0x11,
+  0x22, 0x11, 0xc4, 0x2b, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x83, 0x23, 0x23, 0x00, 0x00, 0x61,
+  0x08, 0x65, 0x34, 0x02, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x80, 0x06,
+  0x3d, 0x0b, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0x23, 0x23, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x22,
+  0x11, 0xa2, 0x11, 0x62, 0x10, 0x3f, 0x07, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x42, 0xc7,
+  0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x04, 0x81, 0xc7, 0x4d, 0x61, 0x08,
+  0x0a, 0x88, 0x06, 0x3d, 0xa2, 0x11, 0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23,
+  0x61, 0x08, 0x21, 0x08, 0x3f, 0x07, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0x02, 0x82, 0x22,
+  0x11, 0x41, 0x08, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x48,
+  0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x65, 0x34, 0xc4, 0x2b, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x61,
+  0x08, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x80, 0x22, 0x11, 0x08, 0x82, 0x23, 0x23, 0x61, 0x08,
+  0xc1, 0x10, 0x48, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x00, 0x86, 0x61, 0x08, 0x22,
+  0x1a, 0x06, 0x3d, 0xc1, 0x10, 0x23, 0x23, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11,
+  0x07, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x14, 0x81, 0x06, 0x3d, 0x22, 0x1a,
+  0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x80, 0xa2, 0x11, 0x21, 0x43, 0xc7,
+  0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3f, 0x0c, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x41, 0x08, 0xa3,
+  0x1a, 0x19, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x08, 0x83, 0x06, 0x3d,
+  0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x19, 0x80, 0x22, 0x11, 0x3f, 0x0d, 0x82, 0xc7, 0x4d, 0x06,
+  0x3d, 0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x11, 0x80, 0xa2, 0x11, 0x3f, 0x04, 0x80,
+  0x06, 0x3d, 0x02, 0x80, 0x06, 0x3d, 0x04, 0x49, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0xa3, 0x1a, 0x10,
+  0x80, 0x61, 0x08, 0x3f, 0x03, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x01, 0x81, 0xc4, 0x2b, 0x61, 0x08,
+  0x0c, 0x84, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08, 0xa2, 0x11, 0x3f, 0x14, 0x8a, 0x20,
+  0x00, 0xa2, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0xc1, 0x10, 0xa2, 0x11, 0xa3,
+  0x1a, 0xc4, 0x2b, 0x65, 0x34, 0x42, 0x06, 0x3d, 0x8a, 0x65, 0x34, 0x23, 0x23, 0x22, 0x1a, 0xc1,
+  0x10, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0xc4, 0x2b, 0x62, 0x10, 0x21, 0x08, 0x22, 0x11, 0x0d,
+  0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x04, 0x87, 0x61, 0x08, 0xc7, 0x4d, 0x23, 0x23, 0x20, 0x00,
+  0x61, 0x08, 0x65, 0x34, 0xc4, 0x2b, 0xa3, 0x1a, 0x45, 0xa2, 0x11, 0x85, 0x22, 0x1a, 0x23, 0x23,
+  0x65, 0x34, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x01, 0x81, 0x00, 0x00, 0x61, 0x08, 0x09, 0x84,
+  0xc4, 0x2b, 0x65, 0x34, 0xc4, 0x2b, 0x22, 0x11, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x05, 0x87, 0x41,
+  0x08, 0x23, 0x23, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x49,
+  0xc7, 0x4d, 0x84, 0x06, 0x3d, 0xa2, 0x11, 0x62, 0x10, 0x22, 0x11, 0x62, 0x10, 0x09, 0x84, 0xc4,
+  0x2b, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x06, 0x8b, 0x00, 0x00,
+  0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08,
+  0x22, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x03, 0x87, 0x65, 0x34, 0xa2, 0x11, 0x62, 0x10, 0x61, 0x08,
+  0xc4, 0x2b, 0xc7, 0x4d, 0x23, 0x23, 0x65, 0x34, 0x08, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b,
+  0x81, 0x21, 0x08, 0x22, 0x1a, 0x01, 0x86, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x65, 0x34, 0xa2,
+  0x11, 0x61, 0x08, 0x61, 0x08, 0x44, 0x62, 0x10, 0x00, 0x80, 0x23, 0x23, 0x4c, 0xc7, 0x4d, 0x81,
+  0x22, 0x1a, 0x21, 0x08, 0x3f, 0x0b, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x42, 0xc7,
+  0x4d, 0x80, 0x06, 0x3d, 0x43, 0x65, 0x34, 0x80, 0x06, 0x3d, 0x4d, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x61, 0x08, 0x3f, 0x0d, 0x81, 0x00, 0x00, 0x61, 0x08, 0x07, 0x51, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x62, 0x10, 0x20, 0x00, 0x3f, 0x0e, 0x81, 0x21, 0x08, 0x22, 0x11, 0x17, 0x84, 0x65, 0x34, 0x62,
+  0x10, 0xa2, 0x11, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x0e, 0x81, 0x41, 0x08, 0xa2, 0x11, 0x15, 0x86,
+  0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0xc7, 0x4d, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x0d,
+  0x83, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x12, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0x65,
+  0x34, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x3f, 0x0e, 0x82,
+  0x00, 0x00, 0x62, 0x10, 0x22, 0x1a, 0x10, 0x85, 0xa3, 0x1a, 0xa3, 0x1a, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x61, 0x08, 0xc4, 0x2b, 0x01, 0x81, 0xc7, 0x4d, 0xc1, 0x10, 0x3f, 0x0f, 0x84, 0x20, 0x00, 0x21,
+  0x08, 0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0x0d, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61,
+  0x08, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x82, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x3f, 0x0c, 0x88,
+  0x20, 0x00, 0xc1, 0x10, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x22, 0x1a,
+  0x06, 0x3d, 0x0c, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x02, 0x84, 0x23, 0x23, 0x21, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x0b, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x88, 0x65,
+  0x34, 0x61, 0x08, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0xc4, 0x2b, 0x06,
+  0x3d, 0x05, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x85, 0x61,
+  0x08, 0x00, 0x00, 0xa2, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x0a, 0x81, 0x61, 0x08,
+  0x65, 0x34, 0x03, 0x88, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11,
+  0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x02, 0x84, 0x06, 0x3d, 0xc1, 0x10, 0x41, 0x08, 0x62, 0x10,
+  0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x87, 0x22, 0x1a, 0x21, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d,
+  0xc7, 0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x08, 0x83, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x06,
+  0x3d, 0x02, 0x8f, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10, 0xc1,
+  0x10, 0xa3, 0x1a, 0xc4, 0x2b, 0x23, 0x23, 0x22, 0x1a, 0x61, 0x08, 0x21, 0x08, 0x41, 0x08, 0x22,
+  0x11, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x41, 0x08, 0x41, 0x08, 0x23, 0x23, 0x43,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x08, 0x84, 0x65, 0x34, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10,
+  0xc4, 0x2b, 0x03, 0x8b, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08,
+  0x20, 0x00, 0x20, 0x00, 0x21, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x83,
+  0x23, 0x23, 0x61, 0x08, 0x20, 0x00, 0xa2, 0x11, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10,
+  0x3f, 0x05, 0x88, 0x00, 0x00, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x41,
+  0x08, 0xc1, 0x10, 0x06, 0x3d, 0x04, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x65, 0x34, 0x06, 0x3d,
+  0x46, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x41, 0x08, 0x20, 0x00, 0x22, 0x11, 0x46, 0xc7, 0x4d, 0x81,
+  0x23, 0x23, 0x41, 0x08, 0x3f, 0x03, 0x82, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x01, 0x85, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x0e, 0x84, 0x06, 0x3d, 0x61,
+  0x08, 0x21, 0x08, 0x21, 0x08, 0xa2, 0x11, 0x48, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x3f,
+  0x02, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08,
+  0xc4, 0x2b, 0x0b, 0x86, 0x06, 0x3d, 0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0x20, 0x00, 0x62, 0x10,
+  0x23, 0x23, 0x49, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x62,
+  0x10, 0x06, 0x3d, 0x04, 0x81, 0xc7, 0x4d, 0x22, 0x1a, 0x09, 0x89, 0x06, 0x3d, 0xc1, 0x10, 0x61,
+  0x08, 0x61, 0x08, 0x21, 0x08, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x4b,
+  0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x82, 0x00, 0x00, 0x21, 0x08, 0xa3, 0x1a, 0x06,
+  0x80, 0xa2, 0x11, 0x09, 0x80, 0x65, 0x34, 0x42, 0x61, 0x08, 0x82, 0xc1, 0x10, 0xa3, 0x1a, 0x06,
+  0x3d, 0x4f, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20, 0x00, 0x3e, 0x81, 0x00, 0x00, 0x62, 0x10, 0x07,
+  0x80, 0xc1, 0x10, 0x09, 0x82, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x00, 0x80,
+  0x61, 0x08, 0x3d, 0x82, 0x00, 0x00, 0x20, 0x00, 0x22, 0x1a, 0x08, 0x80, 0x61, 0x08, 0x48, 0xc7,
+  0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x54, 0xc7, 0x4d, 0x80, 0x23, 0x23, 0x3c, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x12, 0x81, 0x22, 0x11, 0x62, 0x10, 0x56, 0xc7,
+  0x4d, 0x80, 0x61, 0x08, 0x7d, 0x00, 0x00, 0x80, 0x61, 0x08, 0x09, 0x80, 0xc1, 0x10, 0x08, 0x81,
+  0x61, 0x08, 0x61, 0x08, 0x16, 0x81, 0x65, 0x34, 0x61, 0x08, 0x39, 0x83, 0x00, 0x00, 0x00, 0x00,
+  0x41, 0x08, 0xc4, 0x2b, 0x14, 0x80, 0x22, 0x11, 0x17, 0x80, 0x22, 0x11, 0x7b, 0x00, 0x00, 0x83,
+  0x62, 0x10, 0xc7, 0x4d, 0x06, 0x3d, 0x65, 0x34, 0x07, 0x80, 0x22, 0x11, 0x09, 0x80, 0xa2, 0x11,
+  0x17, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7a, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x01, 0x80, 0xa3, 0x1a,
+  0x07, 0x80, 0x22, 0x1a, 0x07, 0x80, 0x06, 0x3d, 0x1a, 0x81, 0x22, 0x11, 0x20, 0x00, 0x35, 0x42,
+  0x00, 0x00, 0x84, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xa2, 0x11, 0x22, 0x1a, 0x06, 0x80, 0x62,
+  0x10, 0x24, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x78, 0x00, 0x00, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x61, 0x08, 0xa2, 0x11, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x09, 0x80, 0xa3,
+  0x1a, 0x19, 0x80, 0x22, 0x11, 0x78, 0x00, 0x00, 0x84, 0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x61,
+  0x08, 0xc1, 0x10, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x09, 0x80, 0x23, 0x23, 0x19,
+  0x81, 0x65, 0x34, 0x61, 0x08, 0x76, 0x00, 0x00, 0x85, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x61, 0x08, 0x61, 0x08, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x07, 0x80, 0x06,
+  0x3d, 0x1c, 0x80, 0x61, 0x08, 0x76, 0x00, 0x00, 0x80, 0x61, 0x08, 0x01, 0x82, 0xc7, 0x4d, 0xc1,
+  0x10, 0x61, 0x08, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x07, 0x80, 0x06, 0x3d, 0x1c,
+  0x81, 0xc4, 0x2b, 0x41, 0x08, 0x74, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x02, 0x80, 0xa2,
+  0x11, 0x06, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x07, 0x80, 0x06, 0x3d, 0x1d, 0x80, 0x61,
+  0x08, 0x74, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x02, 0x81, 0xa3, 0x1a, 0x62, 0x10, 0x05,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x1b,
+  0x81, 0xa3, 0x1a, 0x21, 0x08, 0x73, 0x00, 0x00, 0x80, 0x61, 0x08, 0x03, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0x06, 0x3d, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0x23, 0x23, 0x1c, 0x80, 0x62, 0x10, 0x72, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x03,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x09,
+  0x80, 0xa3, 0x1a, 0x07, 0x81, 0xc7, 0x4d, 0x06, 0x3d, 0x12, 0x80, 0x22, 0x11, 0x72, 0x00, 0x00,
+  0x81, 0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0xa3, 0x1a, 0x04, 0x82, 0x06,
+  0x3d, 0x62, 0x10, 0x22, 0x1a, 0x07, 0x82, 0xc7, 0x4d, 0x62, 0x10, 0x22, 0x1a, 0x07, 0x82, 0xc7,
+  0x4d, 0x61, 0x08, 0xa3, 0x1a, 0x51, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x41, 0x08, 0x71, 0x00, 0x00,
+  0x80, 0x61, 0x08, 0x04, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0xc1, 0x10, 0x04, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0x22, 0x11, 0x07, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x22, 0x11, 0x08, 0x82, 0x23, 0x23, 0x62,
+  0x10, 0x23, 0x23, 0x11, 0x80, 0x61, 0x08, 0x70, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x05,
+  0x81, 0x22, 0x1a, 0x62, 0x10, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x07, 0x82, 0xc7,
+  0x4d, 0x61, 0x08, 0x61, 0x08, 0x09, 0x82, 0xa2, 0x11, 0x62, 0x10, 0xc4, 0x2b, 0x10, 0x81, 0xa2,
+  0x11, 0x20, 0x00, 0x6f, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x05, 0x82, 0xc4, 0x2b, 0x61,
+  0x08, 0x65, 0x34, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x22, 0x11, 0x08, 0x81, 0xc1, 0x10, 0x62,
+  0x10, 0x0a, 0x82, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x0f, 0x81, 0x65, 0x34, 0x41, 0x08, 0x6f,
+  0x00, 0x00, 0x80, 0x62, 0x10, 0x06, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x03, 0x82, 0xc7,
+  0x4d, 0x61, 0x08, 0x61, 0x08, 0x08, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x82, 0x06,
+  0x3d, 0x61, 0x08, 0xc1, 0x10, 0x50, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x6f, 0x00, 0x00, 0x81, 0x61,
+  0x08, 0x06, 0x3d, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x03, 0x82, 0xc7, 0x4d, 0x61,
+  0x08, 0x61, 0x08, 0x08, 0x82, 0x23, 0x23, 0x61, 0x08, 0xc4, 0x2b, 0x0a, 0x82, 0xc4, 0x2b, 0x62,
+  0x10, 0xa3, 0x1a, 0x4f, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x6f, 0x00, 0x00, 0x81, 0x41, 0x08, 0x65,
+  0x34, 0x05, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x05, 0x80, 0x61, 0x08, 0x08, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0xa3, 0x1a, 0x0b, 0x82, 0x22, 0x11, 0x62, 0x10, 0x65, 0x34, 0x4e, 0xc7, 0x4d,
+  0x81, 0xa3, 0x1a, 0x20, 0x00, 0x6d, 0x00, 0x00, 0x82, 0x21, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x05,
+  0x83, 0xc7, 0x4d, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x08,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x0b, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x4e,
+  0xc7, 0x4d, 0x81, 0x65, 0x34, 0x41, 0x08, 0x6d, 0x00, 0x00, 0x83, 0x62, 0x10, 0x65, 0x34, 0x62,
+  0x10, 0x23, 0x23, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08, 0xc4, 0x2b, 0x03,
+  0x82, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x0c,
+  0x82, 0xa3, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x4d, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x6d,
+  0x00, 0x00, 0x85, 0xc1, 0x10, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x43,
+  0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x21, 0x08, 0x61, 0x08, 0x23, 0x23, 0x02, 0x82, 0xc1, 0x10, 0x61,
+  0x08, 0x06, 0x3d, 0x07, 0x83, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x85, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x4d, 0xc7, 0x4d, 0x80, 0x62,
+  0x10, 0x6c, 0x00, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x01, 0x87, 0x22, 0x11, 0x41, 0x08, 0x62,
+  0x10, 0xa3, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x42, 0x41, 0x08, 0x85, 0x62,
+  0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x08, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0x23, 0x23, 0x07, 0x87, 0xc4, 0x2b, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x08, 0xa3, 0x1a, 0x4d, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x6c, 0x00, 0x00, 0x81, 0x41,
+  0x08, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x42,
+  0x61, 0x08, 0x83, 0x21, 0x08, 0xa2, 0x11, 0x22, 0x1a, 0x61, 0x08, 0x42, 0x62, 0x10, 0x80, 0xa2,
+  0x11, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x04, 0x8a, 0x65, 0x34, 0x22, 0x1a, 0x61,
+  0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x61,
+  0x08, 0x4d, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x6c, 0x00, 0x00, 0x81, 0x41, 0x08, 0x65, 0x34, 0x44,
+  0xc7, 0x4d, 0x88, 0x65, 0x34, 0xa3, 0x1a, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08, 0x41, 0x08, 0x23,
+  0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x42, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x86, 0xa3, 0x1a, 0x61, 0x08,
+  0x22, 0x1a, 0xa3, 0x1a, 0xa3, 0x1a, 0xc1, 0x10, 0x62, 0x10, 0x42, 0x61, 0x08, 0x81, 0x22, 0x11,
+  0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x6c, 0x00, 0x00, 0x81, 0x41, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x83, 0x61, 0x08,
+  0xc1, 0x10, 0x62, 0x10, 0xa3, 0x1a, 0x50, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00,
+  0x21, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x6c, 0x00, 0x00, 0x81,
+  0x21, 0x08, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0x61, 0x08,
+  0x61, 0x08, 0x10, 0x85, 0xc7, 0x4d, 0x06, 0x3d, 0xa3, 0x1a, 0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d,
+  0x4a, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x80, 0xc1, 0x10,
+  0x6c, 0x00, 0x00, 0x83, 0x20, 0x00, 0xa2, 0x11, 0x65, 0x34, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x86,
+  0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0xa2, 0x11, 0x10, 0x4e,
+  0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x80, 0xa2,
+  0x11, 0x6d, 0x00, 0x00, 0x83, 0x61, 0x08, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x84, 0x61, 0x08, 0x41, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x62, 0x10, 0x42, 0x61, 0x08, 0x80, 0xc4,
+  0x2b, 0x1c, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x42, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x81, 0x22, 0x1a,
+  0x20, 0x00, 0x6c, 0x00, 0x00, 0x83, 0x62, 0x10, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0x42, 0xc7,
+  0x4d, 0x86, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x21, 0x08, 0x22, 0x11, 0xc4, 0x2b,
+  0x42, 0x61, 0x08, 0x80, 0x23, 0x23, 0x18, 0x87, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08,
+  0x65, 0x34, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08,
+  0x6c, 0x00, 0x00, 0x84, 0x41, 0x08, 0x65, 0x34, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x8c, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x20, 0x00, 0xa3, 0x1a, 0xc7, 0x4d, 0x06, 0x3d,
+  0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x13, 0x89, 0x65, 0x34,
+  0xa2, 0x11, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08,
+  0x22, 0x1a, 0x4a, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x6c, 0x00, 0x00, 0x84, 0x20, 0x00,
+  0x22, 0x1a, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x83, 0x22, 0x1a, 0x20, 0x00,
+  0x41, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x06, 0x3d, 0x0e, 0x85, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0xa3, 0x1a, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x49, 0xc7,
+  0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x6e, 0x00, 0x00, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0x06, 0x3d,
+  0x62, 0x10, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34,
+  0x45, 0xc7, 0x4d, 0x00, 0x89, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x22,
+  0x11, 0x22, 0x1a, 0x23, 0x23, 0xc4, 0x2b, 0x65, 0x34, 0x44, 0x06, 0x3d, 0x82, 0x65, 0x34, 0x23,
+  0x23, 0xa2, 0x11, 0x42, 0x61, 0x08, 0x81, 0xa3, 0x1a, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x82, 0xa3,
+  0x1a, 0x61, 0x08, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x62,
+  0x10, 0x21, 0x08, 0x6d, 0x00, 0x00, 0x85, 0x21, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc4, 0x2b, 0x62,
+  0x10, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x62, 0x10, 0x49, 0xc7, 0x4d, 0x87, 0x65,
+  0x34, 0xa3, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x44,
+  0x61, 0x08, 0x85, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x06, 0x3d, 0x47,
+  0xc7, 0x4d, 0x8e, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0xc4, 0x2b, 0x65, 0x34, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x06, 0x3d, 0xc4, 0x2b, 0xa2, 0x11, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x61,
+  0x08, 0x6e, 0x00, 0x00, 0x00, 0x88, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08,
+  0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x4d, 0xc7, 0x4d, 0x00, 0x81, 0x06, 0x3d, 0x65,
+  0x34, 0x43, 0x23, 0x23, 0x83, 0xc4, 0x2b, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x3d, 0x4c, 0xc7, 0x4d,
+  0x8d, 0x61, 0x08, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61,
+  0x08, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x6f, 0x00, 0x00,
+  0x88, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61,
+  0x08, 0xc1, 0x10, 0x4d, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0xc4, 0x2b, 0x54, 0xc7, 0x4d, 0x89, 0xc4,
+  0x2b, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x23, 0x23, 0xa3, 0x1a, 0xa3, 0x1a, 0x23, 0x23, 0x65,
+  0x34, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x70, 0x00, 0x00, 0x87, 0x61, 0x08, 0x06,
+  0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x22, 0x11, 0x4c, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x53, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61,
+  0x08, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x71, 0x00, 0x00, 0x86, 0x61, 0x08, 0x65,
+  0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x41, 0x08, 0xa2, 0x11, 0x01, 0x50, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0xa2, 0x11,
+  0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x72, 0x00, 0x00, 0x85, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d,
+  0x65, 0x34, 0x21, 0x08, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x21, 0x08, 0xa3, 0x1a,
+  0x10, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x4d, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x73, 0x00, 0x00, 0x84, 0x21, 0x08, 0x61, 0x08, 0x22, 0x11, 0x21, 0x08, 0x22, 0x1a, 0x4c, 0xc7,
+  0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0x23, 0x23, 0x0e, 0x80, 0x06, 0x3d, 0x42, 0x61, 0x08, 0x80,
+  0x23, 0x23, 0x01, 0x4c, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x75, 0x00, 0x00, 0x82, 0x20, 0x00, 0x20,
+  0x00, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x0e, 0x82, 0x61,
+  0x08, 0x62, 0x10, 0xc4, 0x2b, 0x02, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x06, 0x3d, 0x46,
+  0xc7, 0x4d, 0x80, 0x23, 0x23, 0x01, 0x80, 0x61, 0x08, 0x76, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22,
+  0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x0d, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0xa2, 0x11, 0x02, 0x84, 0x65, 0x34, 0x22, 0x11, 0x62, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0x42,
+  0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc7, 0x4d, 0x65,
+  0x34, 0x41, 0x08, 0x77, 0x00, 0x00, 0x80, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61,
+  0x08, 0x65, 0x34, 0x0e, 0x80, 0x23, 0x23, 0x43, 0x62, 0x10, 0x42, 0x61, 0x08, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x87, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0xc1, 0x10,
+  0xc7, 0x4d, 0xa2, 0x11, 0x20, 0x00, 0x76, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x4c, 0xc7,
+  0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x0f, 0x80, 0x06, 0x3d, 0x42, 0xc4, 0x2b, 0x83,
+  0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0xa2, 0x11, 0x02, 0x87, 0x65, 0x34, 0x61, 0x08, 0xc7, 0x4d,
+  0xc7, 0x4d, 0xa2, 0x11, 0xa2, 0x11, 0xc7, 0x4d, 0x61, 0x08, 0x78, 0x00, 0x00, 0x80, 0xa2, 0x11,
+  0x4c, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x14, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x65, 0x34, 0x42, 0xc7, 0x4d, 0x87, 0x22, 0x1a, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0xa3, 0x1a, 0xc4, 0x2b, 0x41, 0x08, 0x78, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x4c, 0xc7, 0x4d, 0x82,
+  0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x14, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x86, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x65, 0x34, 0x61, 0x08,
+  0x79, 0x00, 0x00, 0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x15,
+  0x80, 0xc1, 0x10, 0x42, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa2,
+  0x11, 0x61, 0x08, 0x22, 0x11, 0x21, 0x08, 0x79, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4b,
+  0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x41, 0x08, 0xa3, 0x1a, 0x15, 0x80, 0x23, 0x23, 0x42, 0xc7, 0x4d,
+  0x86, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x62, 0x10, 0x21, 0x08, 0x7a,
+  0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x4b, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22,
+  0x1a, 0x13, 0x89, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62,
+  0x10, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x7e, 0x00, 0x00, 0x80, 0x22, 0x1a, 0x4b, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x13, 0x88, 0xa3, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0xc7,
+  0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x80, 0x61,
+  0x08, 0x4b, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x13, 0x85, 0xa2, 0x11, 0x61,
+  0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x20, 0x00, 0x02, 0x7f, 0x00, 0x00, 0x81, 0x41, 0x08,
+  0xc4, 0x2b, 0x4b, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x13, 0x84, 0x61, 0x08, 0x61, 0x08,
+  0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x03, 0x7f, 0x00, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x4b, 0xc7,
+  0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x14, 0x82, 0x61, 0x08, 0xc4, 0x2b, 0x62, 0x10, 0x04, 0x7f,
+  0x00, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x62, 0x10,
+  0x06, 0x3d, 0x12, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x21, 0x08, 0x05, 0x7f, 0x00, 0x00, 0x01, 0x80,
+  0xc1, 0x10, 0x4a, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x12, 0x82, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x61, 0x08, 0x05, 0x7f, 0x00, 0x00, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x49, 0xc7,
+  0x4d, 0x00, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x11, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x06, 0x7f,
+  0x00, 0x00, 0x01, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23,
+  0x11, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x08, 0x81, 0x20, 0x00, 0xa2, 0x11,
+  0x48, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x11, 0x83, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x09, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x48, 0xc7, 0x4d,
+  0x81, 0x61, 0x08, 0x22, 0x11, 0x11, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x0a, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08,
+  0x11, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x82, 0x41,
+  0x08, 0x22, 0x11, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x62, 0x10, 0x11, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x81, 0x62, 0x10, 0xc1, 0x10,
+  0x44, 0x22, 0x1a, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0f, 0x42, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0f,
+  0x42, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x20, 0x00, 0x62, 0x10, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x0d,
+  0x45, 0x00, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x0f, 0x42, 0xc7, 0x4d, 0x83, 0x22, 0x1a, 0x00,
+  0x00, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x45, 0x00, 0x00, 0x80, 0x22, 0x1a, 0x0f,
+  0x42, 0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x00, 0x00, 0xa3, 0x1a, 0x62, 0x10, 0x3f, 0x0f, 0x44, 0x00,
+  0x00, 0x80, 0xc1, 0x10, 0x0f, 0x42, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x00, 0x00, 0x23, 0x23, 0x61,
+  0x08, 0x3f, 0x10, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0e, 0x43, 0xc7, 0x4d, 0x83, 0x61, 0x08,
+  0x21, 0x08, 0xc4, 0x2b, 0xa2, 0x11, 0x3f, 0x10, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x0d, 0x43, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x41, 0x08, 0x65, 0x34, 0x23, 0x23, 0x21, 0x08, 0x3f,
+  0x0f, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0d, 0x43, 0xc7, 0x4d, 0x84, 0x62, 0x10,
+  0x61, 0x08, 0x06, 0x3d, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x0f, 0x43, 0x00, 0x00, 0x81, 0x21, 0x08,
+  0x23, 0x23, 0x0d, 0x43, 0xc7, 0x4d, 0x83, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x3f,
+  0x10, 0x44, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x0d, 0x42, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x61, 0x08,
+  0x62, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x0f, 0x44, 0x00, 0x00, 0x80, 0x61, 0x08,
+  0x0c, 0x43, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0x3f, 0x0f, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0b, 0x43, 0xc7, 0x4d, 0x85,
+  0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xa2, 0x11, 0x20, 0x00, 0x3f, 0x0f, 0x44, 0x00,
+  0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0b, 0x43, 0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x20, 0x00, 0x41,
+  0x08, 0x62, 0x10, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x10, 0x45, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x0b,
+  0x43, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x14, 0x45, 0x00, 0x00, 0x80, 0x61, 0x08,
+  0x0a, 0x44, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x14, 0x45, 0x00, 0x00, 0x81, 0x61,
+  0x08, 0x65, 0x34, 0x09, 0x44, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x14, 0x46, 0x00,
+  0x00, 0x80, 0x22, 0x1a, 0x09, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x14, 0x46, 0x00, 0x00, 0x80, 0x61, 0x08, 0x08, 0x44, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x15, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x07, 0x44, 0xc7, 0x4d,
+  0x80, 0x22, 0x1a, 0x7f, 0x00, 0x00, 0x16, 0x46, 0x00, 0x00, 0x80, 0x22, 0x11, 0x07, 0x44, 0xc7,
+  0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x16, 0x46, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x06, 0x43, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x16, 0x46, 0x00, 0x00,
+  0x81, 0x21, 0x08, 0x23, 0x23, 0x05, 0x43, 0xc7, 0x4d, 0x84, 0x22, 0x1a, 0x62, 0x10, 0x22, 0x11,
+  0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x14, 0x47, 0x00, 0x00, 0x80, 0x61, 0x08, 0x05, 0x88,
+  0xc7, 0x4d, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d,
+  0x62, 0x10, 0x7f, 0x00, 0x00, 0x14, 0x46, 0x00, 0x00, 0x82, 0x41, 0x08, 0x62, 0x10, 0xc1, 0x10,
+  0x43, 0xa3, 0x1a, 0x80, 0xa2, 0x11, 0x42, 0x61, 0x08, 0x80, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x14, 0x44, 0x00, 0x00, 0x8b, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b,
+  0x65, 0x34, 0xa3, 0x1a, 0xa2, 0x11, 0x22, 0x11, 0xa2, 0x11, 0x22, 0x11, 0x22, 0x1a, 0x23, 0x23,
+  0x65, 0x34, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x13, 0x43, 0x00, 0x00, 0x82,
+  0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x06, 0x48, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x14, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x08, 0x42, 0xc7, 0x4d, 0x86, 0x65,
+  0x34, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0xc1, 0x10, 0x21, 0x08, 0x3f, 0x14, 0x83,
+  0x00, 0x00, 0x41, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x08, 0x42, 0xc7, 0x4d, 0x86, 0x23, 0x23, 0x62,
+  0x10, 0x00, 0x00, 0x61, 0x08, 0xa2, 0x11, 0x62, 0x10, 0x20, 0x00, 0x3f, 0x15, 0x81, 0x61, 0x08,
+  0x23, 0x23, 0x09, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0xc1, 0x10, 0x41, 0x08, 0x01, 0x81,
+  0x20, 0x00, 0x20, 0x00, 0x3f, 0x16, 0x81, 0x62, 0x10, 0xc4, 0x2b, 0x4b, 0xc7, 0x4d, 0x00, 0x81,
+  0x61, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x1a, 0x81, 0x41, 0x08, 0x23, 0x23, 0x4a, 0xc7, 0x4d,
+  0x82, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x1c, 0x80, 0x61, 0x08, 0x49, 0xc7,
+  0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x1d, 0x81, 0x21, 0x08, 0x23,
+  0x23, 0x06, 0x83, 0xc4, 0x2b, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x1e, 0x82,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x44, 0xa2, 0x11, 0x83, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08,
+  0x20, 0x00, 0x7f, 0x00, 0x00, 0x1f, 0x7f, 0x00, 0x00, 0x2b, 0x7f, 0x00, 0x00, 0x2b, 0x7f, 0x00,
+  0x00, 0x2c, 0x7f, 0x00, 0x00, 0x2b, 0x7f, 0x00, 0x00, 0x2b, 0x7f, 0x00, 0x00, 0x2c, 0x7f, 0x00,
+  0x00, 0x2e, 0x7f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0e,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x07, 0x7f, 0x00, 0x00, 0x2b, 0x83, 0x00, 0x00, 0x21, 0x08, 0x41, 0x08, 0x21, 0x08, 0x7f, 0x00,
+  0x00, 0x27, 0x86, 0x00, 0x00, 0x61, 0x08, 0x23, 0x23, 0xc4, 0x2b, 0xa3, 0x1a, 0x61, 0x08, 0x21,
+  0x08, 0x7f, 0x00, 0x00, 0x1f, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0xa3,
+  0x1a, 0x62, 0x10, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x1b, 0x46, 0x00, 0x00, 0x81, 0x21, 0x08, 0x22,
+  0x1a, 0x06, 0x81, 0x23, 0x23, 0xc1, 0x10, 0x42, 0x61, 0x08, 0x80, 0x21, 0x08, 0x7f, 0x00, 0x00,
+  0x16, 0x87, 0x00, 0x00, 0x62, 0x10, 0xa2, 0x11, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0xc1, 0x10, 0x0c, 0x81, 0xa2, 0x11, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x49, 0x00, 0x00, 0x81,
+  0x62, 0x10, 0x06, 0x3d, 0x02, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x0e, 0x81, 0x22, 0x1a, 0x61, 0x08,
+  0x7f, 0x00, 0x00, 0x09, 0x82, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x46, 0x00, 0x00, 0x81, 0x62,
+  0x10, 0x65, 0x34, 0x15, 0x82, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x07, 0x83,
+  0x20, 0x00, 0xa2, 0x11, 0x22, 0x1a, 0x21, 0x08, 0x43, 0x00, 0x00, 0x82, 0x20, 0x00, 0x61, 0x08,
+  0x06, 0x3d, 0x0a, 0x4c, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xc1, 0x10, 0x21, 0x08, 0x7f, 0x00, 0x00,
+  0x06, 0x89, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc1, 0x10, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x01, 0x49, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x4c,
+  0xc7, 0x4d, 0x81, 0x22, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x05, 0x80, 0x62, 0x10, 0x02, 0x83,
+  0xc4, 0x2b, 0x22, 0x1a, 0x22, 0x1a, 0xc4, 0x2b, 0x01, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d,
+  0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x65, 0x34, 0x4b, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x8a, 0xc7,
+  0x4d, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x42, 0x61, 0x08, 0x83, 0x41, 0x08, 0x20, 0x00, 0x62, 0x10, 0xc4,
+  0x2b, 0x45, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x04, 0x47, 0xc7, 0x4d, 0x95, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0xa2, 0x11, 0xa2,
+  0x11, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x23, 0x23, 0x65,
+  0x34, 0x65, 0x34, 0xc4, 0x2b, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x06,
+  0x3d, 0xa3, 0x1a, 0x44, 0x61, 0x08, 0x85, 0x22, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x23,
+  0x23, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x05, 0x83, 0xc7, 0x4d,
+  0xa2, 0x11, 0x62, 0x10, 0x65, 0x34, 0x03, 0x82, 0x65, 0x34, 0x23, 0x23, 0xc4, 0x2b, 0x05, 0x8d,
+  0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x23, 0x23,
+  0xc4, 0x2b, 0xa3, 0x1a, 0x62, 0x10, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x81, 0x22, 0x1a,
+  0x21, 0x08, 0x3f, 0x01, 0x81, 0x21, 0x08, 0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61,
+  0x08, 0xa3, 0x1a, 0x0e, 0x83, 0x06, 0x3d, 0xa2, 0x11, 0xa2, 0x11, 0x65, 0x34, 0x04, 0x83, 0x65,
+  0x34, 0x62, 0x10, 0x20, 0x00, 0x23, 0x23, 0x02, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x01, 0x89,
+  0x00, 0x00, 0x41, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x11,
+  0x61, 0x08, 0xa2, 0x11, 0x19, 0x81, 0xa2, 0x11, 0x00, 0x00, 0x03, 0x80, 0xa2, 0x11, 0x7f, 0x00,
+  0x00, 0x01, 0x88, 0x21, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62,
+  0x10, 0x41, 0x08, 0x22, 0x11, 0x1a, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0x22, 0x11, 0x02, 0x81, 0xc4,
+  0x2b, 0x41, 0x08, 0x3f, 0x01, 0x86, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x00, 0x00, 0x41, 0x08,
+  0x62, 0x10, 0xa3, 0x1a, 0x5b, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x21, 0x08, 0x23, 0x23, 0x02, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x3f, 0x00, 0x8a, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc1, 0x10, 0x41,
+  0x08, 0x23, 0x23, 0x06, 0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0xa2, 0x11, 0x65, 0x34, 0x0b, 0x82, 0x65,
+  0x34, 0x23, 0x23, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x06,
+  0x3d, 0x03, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x41, 0x08, 0xc4, 0x2b, 0x23, 0x23, 0x41, 0x08,
+  0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0xc1, 0x10, 0x0b, 0x83,
+  0x61, 0x08, 0x20, 0x00, 0x62, 0x10, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x62, 0x10,
+  0x62, 0x10, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x3f, 0x02, 0x89, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x65, 0x34, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0x22, 0x11, 0xc4, 0x2b, 0x0b, 0x84,
+  0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10, 0x65, 0x34, 0x04, 0x85, 0xc7, 0x4d, 0x06, 0x3d,
+  0xa2, 0x11, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x3f, 0x03, 0x81, 0x00, 0x00,
+  0xc1, 0x10, 0x01, 0x80, 0x06, 0x3d, 0x10, 0x83, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x23, 0x23,
+  0x04, 0x86, 0x06, 0x3d, 0xc1, 0x10, 0xa3, 0x1a, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d,
+  0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x02, 0x81, 0x61, 0x08, 0x65, 0x34, 0x01, 0x5b, 0xc7,
+  0x4d, 0x89, 0x65, 0x34, 0xa2, 0x11, 0xc1, 0x10, 0x23, 0x23, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x3f, 0x01, 0x81, 0x00, 0x00, 0x61, 0x08, 0x02, 0x82, 0xc7,
+  0x4d, 0x22, 0x11, 0x22, 0x1a, 0x4d, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x06, 0x3d, 0x09, 0x88, 0xc4,
+  0x2b, 0xc4, 0x2b, 0xc1, 0x10, 0x22, 0x1a, 0x22, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x61,
+  0x08, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x83, 0x65, 0x34, 0x41, 0x08, 0x61, 0x08,
+  0x65, 0x34, 0x03, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x05, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08,
+  0x49, 0xc7, 0x4d, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0xc4, 0x2b, 0x22, 0x11, 0xa2, 0x11, 0x23, 0x23,
+  0x61, 0x08, 0x22, 0x11, 0x41, 0x08, 0x3f, 0x01, 0x80, 0x62, 0x10, 0x03, 0x83, 0xa3, 0x1a, 0x00,
+  0x00, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0x23, 0x23, 0x03,
+  0x81, 0xc7, 0x4d, 0x61, 0x08, 0x0a, 0x87, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0xc4,
+  0x2b, 0xa2, 0x11, 0xa2, 0x11, 0xc4, 0x2b, 0x3f, 0x08, 0x83, 0xa3, 0x1a, 0x00, 0x00, 0x61, 0x08,
+  0x65, 0x34, 0x01, 0x84, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x0a, 0x88, 0xa3, 0x1a, 0xc1, 0x10, 0xc4, 0x2b, 0xc4, 0x2b, 0x61, 0x08,
+  0xc4, 0x2b, 0xc1, 0x10, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x07, 0x83, 0x65, 0x34, 0x62, 0x10, 0x61,
+  0x08, 0x06, 0x3d, 0x01, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x83, 0x62,
+  0x10, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x87, 0xc1, 0x10, 0x62, 0x10, 0xa2, 0x11, 0x23,
+  0x23, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x04, 0x81,
+  0x06, 0x3d, 0x06, 0x3d, 0x01, 0x83, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0xa2, 0x11, 0x06, 0x82,
+  0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x09, 0x86, 0x65, 0x34, 0x23, 0x23, 0x62, 0x10, 0xa2, 0x11,
+  0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x3f, 0x03, 0x80, 0xc1, 0x10, 0x07, 0x83, 0xc7, 0x4d, 0xc4,
+  0x2b, 0x61, 0x08, 0x61, 0x08, 0x08, 0x81, 0x65, 0x34, 0x06, 0x3d, 0x08, 0x87, 0x06, 0x3d, 0x61,
+  0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x61, 0x08, 0xc4, 0x2b, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x03, 0x80,
+  0x22, 0x11, 0x08, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x14, 0x85, 0x65, 0x34, 0xa2, 0x11,
+  0xc7, 0x4d, 0x06, 0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0xc1, 0x10, 0x5a, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11,
+  0x08, 0x82, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x59, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10,
+  0x3f, 0x0d, 0x83, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x52, 0xc7, 0x4d, 0x80,
+  0x22, 0x11, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x23, 0x23, 0x07,
+  0x52, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x3f, 0x03, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x50, 0xc7,
+  0x4d, 0x81, 0xa2, 0x11, 0x23, 0x23, 0x50, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x3f, 0x03, 0x85, 0x41,
+  0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x84, 0x06,
+  0x3d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x4f, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f,
+  0x03, 0x8a, 0x20, 0x00, 0x22, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11,
+  0xa3, 0x1a, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x8a, 0x06, 0x3d, 0x65, 0x34,
+  0xa3, 0x1a, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0x23, 0x23, 0x62, 0x10, 0x41, 0x08,
+  0x22, 0x1a, 0x09, 0x43, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x04, 0x8a, 0x61, 0x08,
+  0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x23, 0x23, 0x22, 0x1a, 0x22, 0x11,
+  0xc1, 0x10, 0xc1, 0x10, 0x42, 0x22, 0x11, 0x88, 0xa2, 0x11, 0xa3, 0x1a, 0xc4, 0x2b, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x09, 0x85, 0xc7, 0x4d, 0x65, 0x34,
+  0x06, 0x3d, 0x65, 0x34, 0x22, 0x1a, 0x62, 0x10, 0x3f, 0x05, 0x87, 0x41, 0x08, 0x23, 0x23, 0x65,
+  0x34, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x84, 0xa3,
+  0x1a, 0x62, 0x10, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0x08, 0x84, 0x65, 0x34, 0x61, 0x08, 0x41,
+  0x08, 0x41, 0x08, 0x21, 0x08, 0x3f, 0x07, 0x89, 0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x65, 0x34,
+  0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x87,
+  0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x23, 0x23, 0xc7, 0x4d, 0x23, 0x23, 0xc4, 0x2b,
+  0x07, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x0b, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x43, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x23, 0x23, 0xc1, 0x10, 0x44, 0x61, 0x08, 0x84, 0x62, 0x10, 0x62, 0x10, 0x61,
+  0x08, 0x22, 0x1a, 0x06, 0x3d, 0x0a, 0x82, 0xc7, 0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x0c, 0x81,
+  0x62, 0x10, 0x06, 0x3d, 0x06, 0x80, 0x06, 0x3d, 0x43, 0xc4, 0x2b, 0x80, 0x06, 0x3d, 0x0c, 0x82,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x0e, 0x80, 0xc1, 0x10, 0x59, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x0f, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x57, 0xc7, 0x4d, 0x83,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x81, 0x41, 0x08, 0x22,
+  0x1a, 0x55, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0x23, 0x23, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x0f, 0x82, 0x21, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x81,
+  0x23, 0x23, 0x61, 0x08, 0x01, 0x83, 0xa2, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00,
+  0x00, 0x10, 0x81, 0x62, 0x10, 0x23, 0x23, 0x50, 0xc7, 0x4d, 0x85, 0x23, 0x23, 0x22, 0x1a, 0x06,
+  0x3d, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0x01, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00, 0x00,
+  0x0e, 0x85, 0x00, 0x00, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x06, 0x3d, 0x4f, 0xc7,
+  0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x82, 0xc1, 0x10, 0x21, 0x08,
+  0x62, 0x10, 0x7f, 0x00, 0x00, 0x0d, 0x87, 0x62, 0x10, 0x06, 0x3d, 0xc4, 0x2b, 0xc1, 0x10, 0x62,
+  0x10, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x4d, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61, 0x08, 0xc4,
+  0x2b, 0x01, 0x84, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x0b, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x87, 0xc4, 0x2b, 0x62, 0x10, 0x00, 0x00,
+  0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x23, 0x23, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x83, 0x06, 0x3d,
+  0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x03, 0x81, 0x20, 0x00, 0x61, 0x08, 0x01, 0x80, 0x61, 0x08,
+  0x7f, 0x00, 0x00, 0x0a, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x44, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x62,
+  0x10, 0x00, 0x00, 0x43, 0x61, 0x08, 0x81, 0x62, 0x10, 0xa3, 0x1a, 0x42, 0xc7, 0x4d, 0x84, 0x06,
+  0x3d, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x02, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x20,
+  0x00, 0x22, 0x1a, 0x01, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x08, 0x83, 0x62, 0x10,
+  0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x8d, 0xa3, 0x1a, 0x62, 0x10, 0x41, 0x08,
+  0x61, 0x08, 0xa2, 0x11, 0xc4, 0x2b, 0x06, 0x3d, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08,
+  0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x02, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08,
+  0x03, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x06, 0x85, 0x20, 0x00, 0xa2, 0x11, 0x06,
+  0x3d, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0xc1, 0x10, 0x62,
+  0x10, 0x21, 0x08, 0x42, 0x20, 0x00, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x03, 0x84, 0x06,
+  0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x04, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x07, 0x86, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d,
+  0x47, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0xc4, 0x2b, 0xc4, 0x2b, 0x65, 0x34, 0x04, 0x85, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x81, 0x23, 0x23, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x61, 0x08, 0x03, 0x83, 0x22, 0x1a, 0x61, 0x08, 0x62,
+  0x10, 0x65, 0x34, 0x4f, 0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x06,
+  0x3d, 0x07, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x81, 0x41, 0x08, 0x23, 0x23, 0x04, 0x82,
+  0x22, 0x11, 0x20, 0x00, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08,
+  0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x08, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00,
+  0x00, 0x02, 0x81, 0x00, 0x00, 0x62, 0x10, 0x04, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x65,
+  0x34, 0x48, 0xc7, 0x4d, 0x80, 0x22, 0x1a, 0x02, 0x84, 0x41, 0x08, 0x21, 0x08, 0x62, 0x10, 0xc1,
+  0x10, 0xc4, 0x2b, 0x0a, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00,
+  0xc1, 0x10, 0x04, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x86, 0xa3, 0x1a,
+  0x21, 0x08, 0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x0e, 0x80, 0x61, 0x08,
+  0x7f, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x21, 0x08, 0xa3, 0x1a, 0x04, 0x82, 0xa3, 0x1a, 0x00,
+  0x00, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x00, 0x00, 0xc1, 0x10, 0x52, 0xc7, 0x4d,
+  0x81, 0xa3, 0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b,
+  0x04, 0x82, 0xc1, 0x10, 0x41, 0x08, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10,
+  0x21, 0x08, 0x23, 0x23, 0x12, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x61, 0x08, 0x06, 0x3d, 0x04, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d,
+  0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x12, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x62,
+  0x10, 0x48, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x13, 0x80, 0x62,
+  0x10, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x00, 0x00, 0x61, 0x08, 0x54,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x44,
+  0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x21, 0x08, 0xa2, 0x11, 0x48, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x00,
+  0x00, 0x22, 0x11, 0x54, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x21, 0x08, 0x23, 0x23, 0x48, 0xc7, 0x4d,
+  0x82, 0x61, 0x08, 0x00, 0x00, 0xa3, 0x1a, 0x54, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x41, 0x08, 0xc4,
+  0x2b, 0x48, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x54, 0xc7, 0x4d, 0x81, 0xa3,
+  0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x81, 0x00, 0x00, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0x61,
+  0x08, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x65,
+  0x34, 0x54, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x81, 0x00, 0x00, 0x62,
+  0x10, 0x44, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x83, 0x06,
+  0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x54, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62,
+  0x10, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x54,
+  0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x61, 0x08, 0x06,
+  0x3d, 0x02, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x48, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x20,
+  0x00, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x61, 0x08, 0x65, 0x34, 0x02, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d,
+  0x82, 0xa2, 0x11, 0x00, 0x00, 0xc1, 0x10, 0x55, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x82, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61,
+  0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x20, 0x00, 0xa3, 0x1a, 0x55, 0xc7, 0x4d,
+  0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x21, 0x08, 0xa3, 0x1a, 0x42,
+  0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x41,
+  0x08, 0xc4, 0x2b, 0x55, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x11, 0x48,
+  0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x55, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06,
+  0x3d, 0x43, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0xa3, 0x1a, 0x04, 0x4a, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x42, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x41, 0x08, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10,
+  0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x62, 0x10, 0x05, 0x49, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41,
+  0x08, 0x7f, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x65, 0x34, 0x41, 0x08, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61,
+  0x08, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x48, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa3, 0x1a,
+  0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x21, 0x08, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x61, 0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x05, 0x48,
+  0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x85, 0x61, 0x08,
+  0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x21, 0x08, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x61, 0x08, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x06, 0x47, 0xc7, 0x4d,
+  0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x85, 0x62, 0x10, 0xc7, 0x4d,
+  0xc7, 0x4d, 0xc4, 0x2b, 0x21, 0x08, 0xc1, 0x10, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x65, 0x34, 0x06, 0x46, 0xc7, 0x4d,
+  0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x85, 0x61, 0x08, 0x65, 0x34,
+  0xc7, 0x4d, 0xc4, 0x2b, 0x21, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x46, 0xc7, 0x4d,
+  0x81, 0x23, 0x23, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x85, 0x20, 0x00, 0xa2, 0x11,
+  0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x61, 0x08, 0x01, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x07, 0x45, 0xc7, 0x4d, 0x81,
+  0x23, 0x23, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0x06,
+  0x3d, 0x61, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x01,
+  0x44, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x06, 0x3d, 0x04, 0x47, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x83, 0x22, 0x1a, 0xc4, 0x2b, 0x61,
+  0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x01, 0x44, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x02, 0x49, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21,
+  0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x84, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x00, 0x00,
+  0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x02, 0x43, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x7f,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x84, 0x62, 0x10, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10,
+  0x48, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x65, 0x34, 0x43, 0x06,
+  0x3d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc1, 0x10, 0x4c, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x84, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x06,
+  0x3d, 0x08, 0x82, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x43, 0x61, 0x08, 0x84, 0x62, 0x10, 0x61,
+  0x08, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x7f,
+  0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x4d, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x65, 0x34, 0xa3, 0x1a,
+  0xa2, 0x11, 0x44, 0x22, 0x11, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x42, 0xc7, 0x4d,
+  0x80, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x80, 0x62, 0x10, 0x56, 0xc7, 0x4d, 0x82,
+  0xc4, 0x2b, 0x62, 0x10, 0x65, 0x34, 0x07, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x55, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10,
+  0xc4, 0x2b, 0x06, 0x44, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x45, 0x00, 0x00, 0x81,
+  0x62, 0x10, 0xc4, 0x2b, 0x54, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x04, 0x45,
+  0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x42, 0x61, 0x08,
+  0x81, 0xa2, 0x11, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x02,
+  0x47, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x85, 0x62,
+  0x10, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x52, 0xc7, 0x4d, 0x81, 0x62,
+  0x10, 0x22, 0x1a, 0x4a, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x87, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x06,
+  0x3d, 0x4f, 0xc7, 0x4d, 0x81, 0x62, 0x10, 0x22, 0x1a, 0x4a, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x45, 0x00, 0x00, 0x80, 0x22, 0x11, 0x03, 0x85, 0x23, 0x23, 0x61, 0x08, 0x41, 0x08,
+  0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0x4d, 0xc7, 0x4d, 0x00, 0x80, 0xa2, 0x11, 0x49, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x80, 0x22, 0x1a,
+  0x05, 0x88, 0xc4, 0x2b, 0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x23, 0x23,
+  0x65, 0x34, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x00, 0x81, 0x62, 0x10, 0xa2, 0x11, 0x09, 0x83, 0xc4,
+  0x2b, 0x61, 0x08, 0xc1, 0x10, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x81, 0x21, 0x08,
+  0x23, 0x23, 0x07, 0x89, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x42, 0xc1, 0x10, 0x84, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x20, 0x00, 0xa2, 0x11, 0x09, 0x83, 0x22, 0x11, 0x62, 0x10, 0xa3, 0x1a, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x80, 0x23, 0x23, 0x0a, 0x83, 0x06, 0x3d, 0x65, 0x34,
+  0x23, 0x23, 0xa2, 0x11, 0x46, 0x61, 0x08, 0x83, 0x22, 0x11, 0xc1, 0x10, 0x21, 0x08, 0x22, 0x1a,
+  0x09, 0x83, 0x62, 0x10, 0xc1, 0x10, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00,
+  0x00, 0x80, 0xc4, 0x2b, 0x0c, 0x49, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0x23, 0x23, 0x08,
+  0x84, 0x23, 0x23, 0x41, 0x08, 0x23, 0x23, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00,
+  0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0c, 0x49, 0xc7, 0x4d, 0x42, 0x61, 0x08, 0x81, 0xa2, 0x11,
+  0x06, 0x3d, 0x04, 0x86, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x65, 0x34,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0c, 0x47, 0xc7,
+  0x4d, 0x92, 0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0x22, 0x1a, 0x62, 0x10, 0x61, 0x08,
+  0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x23, 0x23, 0x23, 0x23, 0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08,
+  0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x61,
+  0x08, 0x65, 0x34, 0x0c, 0x45, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08,
+  0x65, 0x34, 0x01, 0x83, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x42, 0x61, 0x08, 0x86,
+  0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x02, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x43, 0xc7, 0x4d,
+  0x84, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x62, 0x10, 0xc4, 0x2b, 0x08, 0x42, 0x06, 0x3d, 0x00,
+  0x84, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x0a, 0x89, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a,
+  0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x09, 0x42, 0xc7, 0x4d, 0x85, 0x06,
+  0x3d, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x0a, 0x87, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08,
+  0x22, 0x11, 0x23, 0x23, 0x06, 0x3d, 0x0c, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08,
+  0x01, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81, 0x41, 0x08, 0x23, 0x23, 0x0a,
+  0x84, 0xa2, 0x11, 0x21, 0x08, 0x23, 0x23, 0x61, 0x08, 0xc1, 0x10, 0x05, 0x80, 0x06, 0x3d, 0x0a,
+  0x85, 0x23, 0x23, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x02, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x0a, 0x8c, 0xc4, 0x2b, 0x21, 0x08, 0xc1, 0x10, 0xc4, 0x2b,
+  0x61, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x22, 0x1a, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08,
+  0xa3, 0x1a, 0x09, 0x85, 0xc1, 0x10, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x03, 0x80, 0x22, 0x1a, 0x0a, 0x8c, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xc7,
+  0x4d, 0x06, 0x3d, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x62, 0x10, 0x62,
+  0x10, 0x06, 0x3d, 0x06, 0x80, 0xa3, 0x1a, 0x01, 0x85, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x23, 0x23, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x80, 0xc1, 0x10, 0x4b, 0xc7, 0x4d, 0x82,
+  0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23,
+  0x02, 0x8c, 0x65, 0x34, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0xa2, 0x11, 0xc7, 0x4d,
+  0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x04,
+  0x80, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x20, 0x00, 0xa3, 0x1a, 0x44, 0xc7, 0x4d,
+  0x81, 0xc1, 0x10, 0x61, 0x08, 0x03, 0x81, 0x22, 0x11, 0xa3, 0x1a, 0x01, 0x84, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0x61, 0x08, 0xc1, 0x10, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x04, 0x80, 0x62, 0x10, 0x4b, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0x43, 0xc7,
+  0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x02, 0x89, 0x65, 0x34, 0x61, 0x08, 0x06, 0x3d,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x06, 0x3d, 0x23, 0x23, 0x62, 0x10, 0x65, 0x34, 0x42, 0xc7,
+  0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x04, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0a, 0x83, 0x06,
+  0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x03, 0x81, 0xc1,
+  0x10, 0xa3, 0x1a, 0x01, 0x84, 0x22, 0x11, 0xc1, 0x10, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x01,
+  0x82, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x4b, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0x01, 0x82, 0x65, 0x34, 0x62, 0x10,
+  0x23, 0x23, 0x02, 0x89, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10,
+  0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x82, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x04, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x4b, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x21,
+  0x08, 0x22, 0x11, 0x01, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x89, 0x65, 0x34, 0x62,
+  0x10, 0x23, 0x23, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x65,
+  0x34, 0x02, 0x81, 0xc7, 0x4d, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x06, 0x80, 0x22, 0x11, 0x4b, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x01, 0x89,
+  0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x65, 0x34, 0x03, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x06, 0x80, 0x61,
+  0x08, 0x4c, 0xc7, 0x4d, 0x8d, 0xc1, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0xc4, 0x2b, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22,
+  0x1a, 0x07, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x06, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x4b, 0xc7, 0x4d, 0x8c, 0x23, 0x23, 0x21, 0x08, 0xa2, 0x11, 0xa3, 0x1a, 0x61, 0x08, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0xa3, 0x1a, 0x22, 0x1a, 0xa3, 0x1a, 0x06, 0x3d, 0x08, 0x80,
+  0xc1, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x4b, 0xc7, 0x4d, 0x88, 0x06,
+  0x3d, 0x62, 0x10, 0x62, 0x10, 0xa3, 0x1a, 0x62, 0x10, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x06,
+  0x3d, 0x0b, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x81, 0x20, 0x00, 0xa3, 0x1a,
+  0x4c, 0xc7, 0x4d, 0x85, 0xc1, 0x10, 0x41, 0x08, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0xa3, 0x1a,
+  0x0d, 0x82, 0x23, 0x23, 0x41, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x07, 0x80, 0x61, 0x08, 0x4c,
+  0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x41, 0x08, 0x22, 0x11, 0x10, 0x83, 0x61, 0x08, 0x20, 0x00, 0x61,
+  0x08, 0x41, 0x08, 0x3f, 0x06, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4c, 0xc7, 0x4d, 0x00, 0x81, 0x62,
+  0x10, 0x06, 0x3d, 0x0e, 0x84, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x62, 0x10, 0x3f,
+  0x06, 0x81, 0x21, 0x08, 0x23, 0x23, 0x4c, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x21, 0x08, 0x23, 0x23,
+  0x0e, 0x85, 0x22, 0x11, 0x20, 0x00, 0x22, 0x11, 0xc7, 0x4d, 0xa2, 0x11, 0x20, 0x00, 0x3f, 0x06,
+  0x80, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x0d, 0x86, 0x06,
+  0x3d, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x06, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x4c, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x0c, 0x86,
+  0xa3, 0x1a, 0x21, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x06, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x20, 0x00, 0x22,
+  0x1a, 0x0c, 0x86, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x07, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x84, 0x65, 0x34,
+  0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x0b, 0x81, 0xa2, 0x11, 0x23, 0x23, 0x01, 0x82,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x81, 0x20, 0x00, 0x22, 0x11, 0x4a,
+  0xc7, 0x4d, 0x84, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x0f, 0x82, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x08, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x48, 0xc7,
+  0x4d, 0x85, 0xa2, 0x11, 0x21, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x41, 0x08, 0x61, 0x08, 0x0f, 0x82,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x09, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x45,
+  0xc7, 0x4d, 0x88, 0x06, 0x3d, 0xc1, 0x10, 0x21, 0x08, 0x41, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x61,
+  0x08, 0x62, 0x10, 0x65, 0x34, 0x0e, 0x82, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x0a, 0x8f, 0x21, 0x08, 0x61, 0x08, 0x22, 0x1a, 0xc4, 0x2b, 0x65, 0x34, 0x65, 0x34, 0xa3, 0x1a,
+  0x62, 0x10, 0x20, 0x00, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08,
+  0x22, 0x1a, 0x0e, 0x82, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0c, 0x87, 0x21,
+  0x08, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0x42,
+  0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0d, 0x82, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x86, 0x61, 0x08, 0xa3, 0x1a, 0xa2, 0x11, 0x22, 0x11,
+  0x22, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x21, 0x08,
+  0x23, 0x23, 0x0c, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x81, 0x61, 0x08,
+  0x65, 0x34, 0x49, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x00, 0x00, 0x61, 0x08, 0x0c, 0x42,
+  0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x0b, 0x81, 0x41, 0x08, 0x23, 0x23, 0x49, 0xc7,
+  0x4d, 0x84, 0xa3, 0x1a, 0x20, 0x00, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x0b, 0x83, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0b, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x49,
+  0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x42, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x0b, 0x83, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0c, 0x80, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x42, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x84, 0xc7, 0x4d,
+  0xc7, 0x4d, 0xc1, 0x10, 0x62, 0x10, 0x62, 0x10, 0x3f, 0x0b, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d,
+  0x81, 0x22, 0x1a, 0x20, 0x00, 0x42, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x0a, 0x85, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x0a, 0x81, 0x61, 0x08,
+  0x65, 0x34, 0x46, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x09, 0x85, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x62, 0x10,
+  0x3f, 0x0a, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x01, 0x43, 0x00,
+  0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x08, 0x86, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10,
+  0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x11, 0x3f, 0x0b, 0x80, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x81, 0xa3,
+  0x1a, 0x41, 0x08, 0x01, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x87, 0xc7, 0x4d,
+  0xa2, 0x11, 0x21, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x0a,
+  0x81, 0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x02, 0x44, 0x00,
+  0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x07, 0x87, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0x06, 0x3d, 0xc1, 0x10, 0x20, 0x00, 0x3f, 0x0b, 0x80, 0x61, 0x08, 0x42, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x61, 0x08, 0x04, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x05, 0x87,
+  0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08,
+  0x3f, 0x0c, 0x84, 0x41, 0x08, 0x22, 0x11, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x05, 0x45, 0x00,
+  0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x02, 0x87, 0x65, 0x34, 0x22, 0x11, 0x61, 0x08, 0x41, 0x08,
+  0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x3f, 0x0f, 0x82, 0x20, 0x00, 0x61, 0x08, 0x41,
+  0x08, 0x06, 0x45, 0x00, 0x00, 0x81, 0x20, 0x00, 0x62, 0x10, 0x43, 0x61, 0x08, 0x82, 0x21, 0x08,
+  0x62, 0x10, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x1a, 0x43, 0x00, 0x00, 0x43,
+  0x61, 0x08, 0x84, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0xa3, 0x1a, 0x06, 0x3d, 0x43, 0xc7, 0x4d,
+  0x80, 0x61, 0x08, 0x3f, 0x19, 0x43, 0x00, 0x00, 0x82, 0x21, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x42,
+  0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x17, 0x45, 0x00, 0x00, 0x80, 0x61, 0x08,
+  0x4b, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x16, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10,
+  0x65, 0x34, 0x0a, 0x82, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x14, 0x46, 0x00, 0x00, 0x81,
+  0x41, 0x08, 0x23, 0x23, 0x05, 0x45, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x14, 0x47,
+  0x00, 0x00, 0x80, 0x61, 0x08, 0x05, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x13,
+  0x47, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x03, 0x47, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x21,
+  0x08, 0x3f, 0x13, 0x48, 0x00, 0x00, 0x80, 0x61, 0x08, 0x03, 0x47, 0xc7, 0x4d, 0x81, 0xa2, 0x11,
+  0x41, 0x08, 0x3f, 0x13, 0x49, 0x00, 0x00, 0x80, 0x61, 0x08, 0x01, 0x47, 0xc7, 0x4d, 0x82, 0x23,
+  0x23, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x14, 0x49, 0x00, 0x00, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d,
+  0x83, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x15, 0x4a, 0x00, 0x00, 0x89, 0x41,
+  0x08, 0x22, 0x11, 0x23, 0x23, 0x23, 0x23, 0xc4, 0x2b, 0x23, 0x23, 0x22, 0x1a, 0x61, 0x08, 0x61,
+  0x08, 0x20, 0x00, 0x3f, 0x18, 0x4b, 0x00, 0x00, 0x42, 0x41, 0x08, 0x81, 0x21, 0x08, 0x20, 0x00,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x20, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x34, 0x7f, 0x00, 0x00, 0x2b, 0x84,
+  0x41, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x26, 0x81, 0x41,
+  0x08, 0xa3, 0x1a, 0x02, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x23, 0x81,
+  0x00, 0x00, 0x61, 0x08, 0x05, 0x80, 0x23, 0x23, 0x42, 0x61, 0x08, 0x81, 0x41, 0x08, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x18, 0x87, 0x41, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x20, 0x00, 0x00,
+  0x00, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x84, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0xc4, 0x2b, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x16, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x01, 0x83, 0x65, 0x34, 0xa3, 0x1a,
+  0xa2, 0x11, 0x65, 0x34, 0x0c, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x0a, 0x81, 0x20,
+  0x00, 0x21, 0x08, 0x06, 0x81, 0x41, 0x08, 0x22, 0x1a, 0x14, 0x82, 0x06, 0x3d, 0x22, 0x11, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08, 0x45, 0x00, 0x00, 0x00,
+  0x80, 0x22, 0x1a, 0x17, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x83, 0x41, 0x08,
+  0xc4, 0x2b, 0x65, 0x34, 0x62, 0x10, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x23, 0x23, 0x0b, 0x4d,
+  0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x09, 0x85, 0x65, 0x34, 0x61, 0x08,
+  0x62, 0x10, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0x02, 0x48, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x22,
+  0x1a, 0x22, 0x11, 0x23, 0x23, 0x4b, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00,
+  0x0f, 0x85, 0xc7, 0x4d, 0x23, 0x23, 0xc1, 0x10, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x87, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08,
+  0x06, 0x3d, 0x05, 0x44, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x0c, 0x91,
+  0xc7, 0x4d, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0xa3, 0x1a, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10,
+  0x21, 0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x8b, 0x06, 0x3d, 0xc4, 0x2b, 0xa3, 0x1a, 0xa2, 0x11,
+  0x22, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0xc1, 0x10, 0x21, 0x08,
+  0x3f, 0x02, 0x80, 0x62, 0x10, 0x47, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x22, 0x1a, 0x42,
+  0x06, 0x3d, 0x84, 0xc4, 0x2b, 0xa2, 0x11, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x03, 0x85, 0x06,
+  0x3d, 0x22, 0x11, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0xa2, 0x11, 0x44, 0x61, 0x08, 0x82, 0x41,
+  0x08, 0x61, 0x08, 0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x05, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc1, 0x10, 0x0e, 0x84, 0x23, 0x23,
+  0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x03, 0x83, 0xa3, 0x1a, 0x41, 0x08, 0x41, 0x08,
+  0xc4, 0x2b, 0x01, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x02, 0x81, 0x61, 0x08, 0x65, 0x34, 0x43,
+  0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x0f, 0x81, 0x06, 0x3d, 0x06,
+  0x3d, 0x06, 0x82, 0x61, 0x08, 0x00, 0x00, 0x22, 0x1a, 0x02, 0x80, 0x61, 0x08, 0x3f, 0x01, 0x89,
+  0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0xc1, 0x10, 0xa3, 0x1a, 0xa3, 0x1a, 0xc1, 0x10, 0x61, 0x08,
+  0x62, 0x10, 0x65, 0x34, 0x1f, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x00, 0x88, 0x41, 0x08, 0xa3,
+  0x1a, 0x61, 0x08, 0x41, 0x08, 0x20, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x1a,
+  0x82, 0x22, 0x1a, 0x20, 0x00, 0x22, 0x1a, 0x02, 0x80, 0x65, 0x34, 0x3f, 0x02, 0x88, 0x06, 0x3d,
+  0xc7, 0x4d, 0x22, 0x11, 0x21, 0x08, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34,
+  0x4d, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34,
+  0x3f, 0x05, 0x8a, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x0b, 0x83, 0x22, 0x11, 0x62, 0x10, 0xc1,
+  0x10, 0x06, 0x3d, 0x06, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x3f, 0x06, 0x8a,
+  0x20, 0x00, 0x22, 0x11, 0xc1, 0x10, 0x41, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08,
+  0x62, 0x10, 0x62, 0x10, 0x22, 0x1a, 0x0b, 0x83, 0xa3, 0x1a, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08,
+  0x46, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x3f,
+  0x02, 0x82, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x01, 0x83, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d,
+  0x06, 0x3d, 0x0d, 0x83, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0xa3, 0x1a, 0x05, 0x84, 0xa3, 0x1a,
+  0x65, 0x34, 0x22, 0x11, 0x62, 0x10, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x3f, 0x03, 0x81, 0x41, 0x08,
+  0x23, 0x23, 0x14, 0x82, 0x06, 0x3d, 0xc4, 0x2b, 0x06, 0x3d, 0x05, 0x85, 0x22, 0x1a, 0x61, 0x08,
+  0xa3, 0x1a, 0x23, 0x23, 0x62, 0x10, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x3f, 0x08, 0x81, 0x65, 0x34,
+  0x65, 0x34, 0x0d, 0x4b, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x22, 0x1a, 0xc1, 0x10, 0x23, 0x23, 0x61,
+  0x08, 0xc1, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x01, 0x81, 0x21, 0x08, 0x22, 0x1a,
+  0x03, 0x82, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x82, 0xc7, 0x4d, 0x23, 0x23, 0x06, 0x3d,
+  0x04, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x1a, 0x09, 0x88, 0xa2, 0x11, 0x22, 0x1a, 0x23, 0x23,
+  0x61, 0x08, 0x23, 0x23, 0xc1, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x02, 0x80, 0x06,
+  0x3d, 0x02, 0x80, 0x23, 0x23, 0x06, 0x82, 0x23, 0x23, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x49, 0xc7,
+  0x4d, 0x88, 0x06, 0x3d, 0x22, 0x11, 0xc1, 0x10, 0xc4, 0x2b, 0x61, 0x08, 0xc4, 0x2b, 0xa2, 0x11,
+  0x62, 0x10, 0x21, 0x08, 0x3f, 0x08, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0x62, 0x10, 0x04, 0x80, 0xc7, 0x4d, 0x0b, 0x83, 0x65, 0x34, 0xc4, 0x2b, 0x06, 0x3d, 0x22,
+  0x11, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x3f, 0x08, 0x81, 0xc4, 0x2b, 0x21, 0x08, 0x03, 0x83,
+  0xc7, 0x4d, 0x22, 0x11, 0x21, 0x08, 0xa2, 0x11, 0x04, 0x80, 0x06, 0x3d, 0x0b, 0x88, 0x23, 0x23,
+  0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x22, 0x11, 0xc1, 0x10, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08,
+  0x3f, 0x08, 0x81, 0x23, 0x23, 0x23, 0x23, 0x02, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0x06,
+  0x3d, 0x05, 0x83, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x87, 0xc7, 0x4d, 0x65,
+  0x34, 0x61, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x22, 0x11, 0xa2, 0x11, 0x22, 0x11, 0x3f, 0x03, 0x80,
+  0x61, 0x08, 0x08, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34, 0x06, 0x82, 0x65, 0x34,
+  0xa2, 0x11, 0x23, 0x23, 0x09, 0x82, 0x22, 0x11, 0x65, 0x34, 0xa3, 0x1a, 0x01, 0x81, 0x22, 0x11,
+  0x62, 0x10, 0x3f, 0x0c, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0xc4, 0x2b, 0x14, 0x86, 0xa3,
+  0x1a, 0x61, 0x08, 0xc7, 0x4d, 0xc4, 0x2b, 0x65, 0x34, 0x22, 0x11, 0x21, 0x08, 0x3f, 0x03, 0x80,
+  0x22, 0x11, 0x09, 0x80, 0x22, 0x11, 0x16, 0x80, 0x06, 0x3d, 0x02, 0x80, 0xc1, 0x10, 0x7f, 0x00,
+  0x00, 0x04, 0x80, 0xa2, 0x11, 0x07, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x19,
+  0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11, 0x08, 0x82, 0xa3, 0x1a, 0x41, 0x08,
+  0x61, 0x08, 0x5a, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x0e, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x06,
+  0x3d, 0x3f, 0x1f, 0x53, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x06, 0x3d, 0x10, 0x80, 0x22, 0x11, 0x3f,
+  0x03, 0x80, 0x61, 0x08, 0x02, 0x81, 0xc7, 0x4d, 0xa3, 0x1a, 0x0c, 0x84, 0xc7, 0x4d, 0xc7, 0x4d,
+  0xc1, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x3f, 0x14, 0x86, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa2, 0x11, 0x62, 0x10, 0x65, 0x34, 0x49, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0x23, 0x23, 0x22,
+  0x11, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x0d, 0x81, 0x06, 0x3d, 0x62,
+  0x10, 0x3f, 0x06, 0x87, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08,
+  0xc1, 0x10, 0x22, 0x11, 0x42, 0xa2, 0x11, 0x00, 0x86, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x22,
+  0x1a, 0xc4, 0x2b, 0x06, 0x3d, 0xc7, 0x4d, 0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08,
+  0x20, 0x00, 0x3f, 0x04, 0x85, 0x61, 0x08, 0x06, 0x3d, 0x23, 0x23, 0x20, 0x00, 0x62, 0x10, 0xa3,
+  0x1a, 0x45, 0x06, 0x3d, 0x82, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x3d, 0x03, 0x83, 0x06, 0x3d, 0x22,
+  0x11, 0x62, 0x10, 0x41, 0x08, 0x0b, 0x42, 0x61, 0x08, 0x80, 0x20, 0x00, 0x3f, 0x05, 0x88, 0x20,
+  0x00, 0x22, 0x11, 0xc7, 0x4d, 0xa2, 0x11, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x22, 0x11, 0xc4,
+  0x2b, 0x47, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x61,
+  0x08, 0x22, 0x11, 0x08, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x0a, 0x81, 0x61, 0x08, 0x65, 0x34,
+  0x02, 0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x42, 0x61, 0x08, 0x88, 0xa2, 0x11, 0x23, 0x23, 0x23, 0x23,
+  0xa3, 0x1a, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x0b, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x3f, 0x0c, 0x80, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x23, 0x23, 0xa2,
+  0x11, 0xc1, 0x10, 0x42, 0x61, 0x08, 0x81, 0xa2, 0x11, 0xc4, 0x2b, 0x0c, 0x80, 0x06, 0x3d, 0x3f,
+  0x0e, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x19, 0x82, 0xc7, 0x4d, 0xc1, 0x10, 0x20, 0x00, 0x3f, 0x0e,
+  0x81, 0x61, 0x08, 0x65, 0x34, 0x17, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00,
+  0x10, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x15, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x7f, 0x00,
+  0x00, 0x12, 0x81, 0x62, 0x10, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x61, 0x08, 0xc1,
+  0x10, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x11, 0x81, 0x41, 0x08, 0xa2, 0x11,
+  0x51, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a,
+  0x22, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x11, 0x82, 0x00, 0x00, 0x62, 0x10, 0x22, 0x1a, 0x4f,
+  0xc7, 0x4d, 0x88, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x65, 0x34, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x42, 0x00, 0x00, 0x83, 0x21, 0x08, 0x61,
+  0x08, 0x61, 0x08, 0x23, 0x23, 0x4e, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0xa2, 0x11, 0x01,
+  0x82, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x0d, 0x42, 0x00, 0x00, 0x87, 0x61,
+  0x08, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x4a,
+  0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x02, 0x82, 0xc7, 0x4d, 0xc7, 0x4d, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34, 0x02, 0x81,
+  0xa2, 0x11, 0x21, 0x08, 0x01, 0x84, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b,
+  0x02, 0x85, 0xc7, 0x4d, 0x06, 0x3d, 0xc1, 0x10, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x85,
+  0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x0a,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x23, 0x23, 0x04, 0x8e, 0xc4, 0x2b, 0x61, 0x08, 0x21,
+  0x08, 0x62, 0x10, 0x22, 0x1a, 0xc4, 0x2b, 0x23, 0x23, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4,
+  0x2b, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x02, 0x42, 0xc7, 0x4d, 0x84, 0x22, 0x11,
+  0x00, 0x00, 0x22, 0x11, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x08, 0x42, 0x00, 0x00, 0x00,
+  0x47, 0xc7, 0x4d, 0x8b, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x02, 0x42, 0xc7, 0x4d,
+  0x86, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x7f,
+  0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0x48, 0xc7,
+  0x4d, 0x87, 0x06, 0x3d, 0x23, 0x23, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0xa3, 0x1a,
+  0x06, 0x3d, 0x03, 0x43, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x02, 0x81, 0xa3,
+  0x1a, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x06, 0x85, 0x00, 0x00, 0x21, 0x08, 0x22, 0x1a, 0x61, 0x08,
+  0x62, 0x10, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x83, 0x22, 0x11, 0x20, 0x00, 0x62, 0x10, 0x06, 0x3d,
+  0x03, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x05, 0x87, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0xc7,
+  0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0xa3, 0x1a, 0x53, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22,
+  0x11, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x04, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x04, 0x82, 0x00, 0x00, 0x20, 0x00, 0x22, 0x1a, 0x01, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08,
+  0x61, 0x08, 0x06, 0x3d, 0x08, 0x47, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x61,
+  0x08, 0xc4, 0x2b, 0x06, 0x80, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x61, 0x08,
+  0x06, 0x3d, 0x02, 0x84, 0xc7, 0x4d, 0x22, 0x1a, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x47,
+  0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0xc4, 0x2b, 0x07, 0x80, 0x65,
+  0x34, 0x3f, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x03, 0x83, 0xc7, 0x4d, 0x65, 0x34,
+  0x61, 0x08, 0x61, 0x08, 0x07, 0x80, 0xc7, 0x4d, 0x43, 0x06, 0x3d, 0x86, 0x65, 0x34, 0xa2, 0x11,
+  0x62, 0x10, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x09, 0x80, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x02, 0x82, 0x00, 0x00, 0x21, 0x08, 0xa3, 0x1a, 0x03, 0x83, 0xc7, 0x4d, 0xa3, 0x1a, 0x00,
+  0x00, 0x22, 0x11, 0x06, 0x8a, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x0b, 0x81, 0xa3, 0x1a, 0x21,
+  0x08, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x03, 0x83, 0xc7, 0x4d, 0x61, 0x08,
+  0x41, 0x08, 0xc4, 0x2b, 0x06, 0x87, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0xc1, 0x10,
+  0x22, 0x11, 0xa3, 0x1a, 0x06, 0x3d, 0x3f, 0x12, 0x81, 0x00, 0x00, 0x62, 0x10, 0x03, 0x84, 0xc7,
+  0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61,
+  0x08, 0x65, 0x34, 0x13, 0x80, 0x61, 0x08, 0x3f, 0x01, 0x81, 0x00, 0x00, 0xc1, 0x10, 0x03, 0x83,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x07, 0x81, 0x23, 0x23, 0x21, 0x08, 0x15, 0x80,
+  0x22, 0x11, 0x3f, 0x01, 0x81, 0x00, 0x00, 0xa2, 0x11, 0x03, 0x83, 0xc7, 0x4d, 0x23, 0x23, 0x20,
+  0x00, 0x22, 0x11, 0x07, 0x82, 0xa2, 0x11, 0x00, 0x00, 0xa2, 0x11, 0x14, 0x81, 0x22, 0x1a, 0x20,
+  0x00, 0x3f, 0x00, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x03, 0x83, 0xc7, 0x4d, 0x22, 0x1a, 0x21, 0x08,
+  0x23, 0x23, 0x08, 0x81, 0x41, 0x08, 0x23, 0x23, 0x14, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x00,
+  0x81, 0x21, 0x08, 0x23, 0x23, 0x03, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x07,
+  0x82, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x14, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x00, 0x81,
+  0x41, 0x08, 0x23, 0x23, 0x03, 0x83, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x81,
+  0x62, 0x10, 0x06, 0x3d, 0x14, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x00, 0x81, 0x41, 0x08, 0x23,
+  0x23, 0x03, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x07, 0x82, 0x65, 0x34, 0x61, 0x08, 0x62,
+  0x10, 0x56, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x02, 0x83,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x08, 0x81, 0x21, 0x08, 0x61, 0x08, 0x56, 0xc7,
+  0x4d, 0x80, 0x61, 0x08, 0x3f, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x02, 0x83, 0xc7, 0x4d, 0x65,
+  0x34, 0x41, 0x08, 0x61, 0x08, 0x07, 0x81, 0xa3, 0x1a, 0x00, 0x00, 0x16, 0x80, 0xc7, 0x4d, 0x3f,
+  0x01, 0x81, 0x00, 0x00, 0x22, 0x1a, 0x02, 0x83, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0x22, 0x11,
+  0x07, 0x80, 0xa3, 0x1a, 0x17, 0x80, 0xc7, 0x4d, 0x3f, 0x01, 0x81, 0x00, 0x00, 0xc1, 0x10, 0x02,
+  0x83, 0xc7, 0x4d, 0xa3, 0x1a, 0x00, 0x00, 0x22, 0x1a, 0x07, 0x82, 0x22, 0x1a, 0x00, 0x00, 0x22,
+  0x11, 0x15, 0x80, 0xc7, 0x4d, 0x3f, 0x01, 0x81, 0x00, 0x00, 0x61, 0x08, 0x02, 0x83, 0xc7, 0x4d,
+  0xa2, 0x11, 0x21, 0x08, 0x23, 0x23, 0x07, 0x82, 0xa2, 0x11, 0x00, 0x00, 0x22, 0x1a, 0x15, 0x81,
+  0xc7, 0x4d, 0xc1, 0x10, 0x3f, 0x01, 0x80, 0x62, 0x10, 0x02, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x41,
+  0x08, 0xc4, 0x2b, 0x07, 0x82, 0xa2, 0x11, 0x00, 0x00, 0xa3, 0x1a, 0x15, 0x81, 0xc7, 0x4d, 0xc1,
+  0x10, 0x3f, 0x01, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x41, 0x08,
+  0xc4, 0x2b, 0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x21, 0x08, 0x23, 0x23, 0x02, 0x80, 0x65, 0x34,
+  0x52, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x01, 0x83, 0xc7,
+  0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0xc4,
+  0x2b, 0x01, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x23, 0x23, 0x51, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f,
+  0x01, 0x81, 0x21, 0x08, 0x23, 0x23, 0x01, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34,
+  0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0x01, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0xc1, 0x10, 0x51, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x01, 0x81, 0x00, 0x00, 0xc1, 0x10, 0x01,
+  0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41,
+  0x08, 0xc4, 0x2b, 0x02, 0x81, 0x62, 0x10, 0xc1, 0x10, 0x50, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61,
+  0x08, 0x3f, 0x05, 0x83, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x06, 0x83, 0xc7, 0x4d,
+  0x22, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x81, 0x61, 0x08, 0xc1, 0x10, 0x50, 0xc7, 0x4d, 0x3f,
+  0x04, 0x86, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34,
+  0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x81, 0x61, 0x08, 0xc1, 0x10,
+  0x50, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x02, 0x86, 0x41, 0x08, 0xc4, 0x2b, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41,
+  0x08, 0xc4, 0x2b, 0x02, 0x81, 0x61, 0x08, 0xc1, 0x10, 0x50, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x04, 0x85, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34,
+  0x06, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x02, 0x81, 0x61, 0x08, 0x22, 0x11,
+  0x50, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x04, 0x85, 0xc1, 0x10, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x06, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0x65,
+  0x34, 0x02, 0x81, 0x62, 0x10, 0x22, 0x1a, 0x4f, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f,
+  0x00, 0x00, 0x04, 0x82, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x01, 0x80, 0x65, 0x34, 0x06, 0x83,
+  0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0x65, 0x34, 0x01, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a,
+  0x4f, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x03, 0x85, 0x62, 0x10, 0x06,
+  0x3d, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x83, 0xc7, 0x4d, 0xa2, 0x11, 0x61,
+  0x08, 0x65, 0x34, 0x01, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x4f, 0xc7, 0x4d, 0x82, 0x61,
+  0x08, 0xc1, 0x10, 0x62, 0x10, 0x3f, 0x03, 0x85, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xa2, 0x11,
+  0x61, 0x08, 0x65, 0x34, 0x07, 0x87, 0xa2, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x4e, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23,
+  0x62, 0x10, 0x3f, 0x03, 0x85, 0x00, 0x00, 0x62, 0x10, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0xc4,
+  0x2b, 0x07, 0x87, 0xa2, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61,
+  0x08, 0x65, 0x34, 0x4e, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10, 0xc4, 0x2b, 0x61, 0x08, 0x3f,
+  0x03, 0x85, 0x00, 0x00, 0x61, 0x08, 0x41, 0x08, 0x20, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x07, 0x87,
+  0xa3, 0x1a, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d,
+  0x4e, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x42, 0x61, 0x08, 0x80, 0x21, 0x08,
+  0x3f, 0x00, 0x85, 0x41, 0x08, 0x23, 0x23, 0x23, 0x23, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x07,
+  0x87, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x06,
+  0x3d, 0x01, 0x4b, 0xc7, 0x4d, 0x89, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0xc4, 0x2b, 0x41, 0x08,
+  0x61, 0x08, 0x06, 0x3d, 0x23, 0x23, 0xa2, 0x11, 0x62, 0x10, 0x3f, 0x80, 0x65, 0x34, 0x0c, 0x85,
+  0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x02, 0x4b, 0xc7, 0x4d,
+  0x8a, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x23, 0x23, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x06,
+  0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x3d, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x4e, 0xc7, 0x4d,
+  0x83, 0x06, 0x3d, 0x65, 0x34, 0x62, 0x10, 0x22, 0x11, 0x02, 0x4b, 0xc7, 0x4d, 0x8a, 0x61, 0x08,
+  0x22, 0x11, 0x65, 0x34, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x22, 0x11, 0x62, 0x10, 0x62, 0x10,
+  0x61, 0x08, 0x21, 0x08, 0x3d, 0x81, 0x00, 0x00, 0xa2, 0x11, 0x4f, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0xa3, 0x1a, 0x02, 0x4a, 0xc7, 0x4d, 0x8b, 0xc4, 0x2b, 0x62, 0x10, 0x22, 0x1a, 0x62,
+  0x10, 0x62, 0x10, 0x21, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x22, 0x1a, 0x61, 0x08, 0x20,
+  0x00, 0x3d, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61,
+  0x08, 0xc4, 0x2b, 0x03, 0x49, 0xc7, 0x4d, 0x87, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10,
+  0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3d, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0xc4, 0x2b, 0x4d, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10,
+  0x06, 0x3d, 0x03, 0x48, 0xc7, 0x4d, 0x8c, 0x65, 0x34, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61,
+  0x08, 0x3d, 0x85, 0x00, 0x00, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x65, 0x34, 0x4b,
+  0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x04, 0x48, 0xc7, 0x4d, 0x8c, 0xc1, 0x10, 0x41, 0x08,
+  0xc1, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x41, 0x08, 0xa2, 0x11, 0x61, 0x08,
+  0x61, 0x08, 0x62, 0x10, 0x20, 0x00, 0x3d, 0x87, 0x00, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0xa2, 0x11,
+  0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x22, 0x11, 0x03, 0x48, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x43, 0xc7, 0x4d,
+  0x85, 0xa3, 0x1a, 0x21, 0x08, 0x23, 0x23, 0x06, 0x3d, 0xa3, 0x1a, 0x41, 0x08, 0x3d, 0x8a, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x61,
+  0x08, 0x22, 0x11, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x4c,
+  0xc7, 0x4d, 0x82, 0x22, 0x11, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x41,
+  0x08, 0xa2, 0x11, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0x08, 0xc4, 0x2b, 0x02, 0x80, 0xc4, 0x2b, 0x43, 0x61, 0x08, 0x80, 0x23, 0x23, 0x44, 0xc7, 0x4d,
+  0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3,
+  0x1a, 0x01, 0x42, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x43, 0x61, 0x08, 0x3e, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x41, 0x08, 0xc4, 0x2b, 0x04, 0x8a, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x23, 0x23, 0x62, 0x10, 0xc1, 0x10, 0x04, 0x47, 0xc7,
+  0x4d, 0x82, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x01,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x07, 0x83, 0x65, 0x34, 0x22, 0x1a, 0x61,
+  0x08, 0x62, 0x10, 0x42, 0x41, 0x08, 0x80, 0xc4, 0x2b, 0x04, 0x46, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0x62, 0x10, 0x22, 0x1a, 0x01, 0x44, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x01, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x84, 0x06, 0x3d, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10,
+  0x06, 0x3d, 0x02, 0x48, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x46, 0xc7, 0x4d,
+  0x80, 0xc1, 0x10, 0x3f, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x0c, 0x82,
+  0xa3, 0x1a, 0x41, 0x08, 0xa3, 0x1a, 0x4a, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x11,
+  0x47, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x09,
+  0x87, 0xc7, 0x4d, 0xc4, 0x2b, 0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22,
+  0x1a, 0x49, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x81, 0xa3,
+  0x1a, 0x20, 0x00, 0x3f, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x05, 0x80, 0x22, 0x1a,
+  0x42, 0x61, 0x08, 0x8a, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0xc7, 0x4d,
+  0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0xa2, 0x11, 0xc4, 0x2b, 0x02, 0x85, 0x06, 0x3d, 0x23, 0x23,
+  0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0xa3, 0x1a, 0x02, 0x45, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21,
+  0x08, 0x3f, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x03, 0x87, 0x06, 0x3d, 0x61, 0x08,
+  0x62, 0x10, 0xc1, 0x10, 0x22, 0x11, 0x22, 0x11, 0x22, 0x1a, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x8b,
+  0x65, 0x34, 0xc1, 0x10, 0x62, 0x10, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21,
+  0x08, 0x3f, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x11, 0x03, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x22, 0x1a, 0x02, 0x49, 0xc7, 0x4d, 0x80, 0x65, 0x34, 0x42, 0x23, 0x23, 0x83, 0x65, 0x34, 0xc7,
+  0x4d, 0xa2, 0x11, 0x22, 0x11, 0x04, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x00,
+  0x82, 0x00, 0x00, 0x21, 0x08, 0x23, 0x23, 0x04, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0x01,
+  0x4f, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x23, 0x23, 0x04, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41,
+  0x08, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x05, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x42, 0x61, 0x08, 0x80, 0xa3, 0x1a, 0x4a, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0x06, 0x3d, 0x01, 0x48, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x01, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x07, 0x85, 0x65, 0x34, 0xa3, 0x1a, 0xc1, 0x10, 0x62, 0x10, 0x41, 0x08, 0xa3, 0x1a,
+  0x04, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0xc1, 0x10, 0x4b, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41,
+  0x08, 0x3f, 0x0d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x22, 0x1a, 0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x23, 0x23, 0x01, 0x49, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x3f, 0x01, 0x80,
+  0xc1, 0x10, 0x09, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x22, 0x1a, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d,
+  0x65, 0x34, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x81, 0xa3, 0x1a,
+  0x20, 0x00, 0x3f, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0xa2, 0x11, 0x43, 0xc7, 0x4d, 0x8a, 0x06, 0x3d, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa2, 0x11, 0x23, 0x23, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x01, 0x4a, 0xc7,
+  0x4d, 0x80, 0x22, 0x11, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x82, 0x06,
+  0x3d, 0x61, 0x08, 0x61, 0x08, 0x01, 0x42, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x01, 0x81, 0x61, 0x08, 0x61, 0x08, 0x4d, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61,
+  0x08, 0x06, 0x3d, 0x01, 0x8c, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x22, 0x11, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x06, 0x3d, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x4d,
+  0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0xa3, 0x1a,
+  0x61, 0x08, 0xc4, 0x2b, 0x03, 0x81, 0x61, 0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x85, 0x61, 0x08,
+  0x22, 0x11, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0xc4, 0x2b, 0x4d, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa2,
+  0x11, 0x02, 0x8b, 0x23, 0x23, 0x62, 0x10, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61,
+  0x08, 0x61, 0x08, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x23, 0x23, 0x4e, 0xc7, 0x4d, 0x80, 0x22,
+  0x11, 0x3f, 0x01, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x61, 0x08,
+  0x01, 0x8c, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x23, 0x23, 0x22, 0x11,
+  0x61, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x62, 0x10, 0x62, 0x10, 0xc4, 0x2b, 0x4e, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x62, 0x10, 0x21, 0x08, 0x3f, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x46, 0xc7, 0x4d,
+  0x8f, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x22, 0x1a, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x21,
+  0x08, 0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0xc1, 0x10, 0x06,
+  0x3d, 0x4f, 0xc7, 0x4d, 0x83, 0xa2, 0x11, 0x41, 0x08, 0x22, 0x1a, 0x62, 0x10, 0x3f, 0x81, 0x61,
+  0x08, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xa3,
+  0x1a, 0x01, 0x86, 0xc4, 0x2b, 0xc4, 0x2b, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x22,
+  0x11, 0x50, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x65, 0x34, 0x61,
+  0x08, 0x3e, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x65, 0x34, 0x05, 0x42, 0xc7,
+  0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x0d, 0x88, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x21, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3d, 0x80, 0xc1, 0x10,
+  0x53, 0xc7, 0x4d, 0x00, 0x81, 0x62, 0x10, 0x22, 0x1a, 0x0c, 0x85, 0xc7, 0x4d, 0xc7, 0x4d, 0x22,
+  0x1a, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x20, 0x00, 0x3b,
+  0x81, 0x21, 0x08, 0xa3, 0x1a, 0x54, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0b,
+  0x84, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x61, 0x08, 0x3b, 0x81, 0x61, 0x08, 0x65, 0x34, 0x53, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62,
+  0x10, 0x20, 0x00, 0x22, 0x1a, 0x0a, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x23,
+  0x23, 0x45, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x3b, 0x80, 0x62, 0x10, 0x54, 0xc7, 0x4d, 0x84, 0xc4,
+  0x2b, 0x41, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x4a, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x3a, 0x80, 0x61, 0x08, 0x54, 0xc7, 0x4d, 0x84, 0xa2, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0xa2, 0x11, 0x09, 0x4b, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x39, 0x81, 0x21, 0x08, 0xa3,
+  0x1a, 0x53, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x42, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65,
+  0x34, 0x08, 0x4b, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x39, 0x81, 0x61, 0x08, 0x65, 0x34, 0x53, 0xc7,
+  0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0e, 0x45, 0xc7, 0x4d,
+  0x81, 0x22, 0x1a, 0x20, 0x00, 0x38, 0x80, 0x62, 0x10, 0x54, 0xc7, 0x4d, 0x00, 0x44, 0x00, 0x00,
+  0x81, 0x41, 0x08, 0x23, 0x23, 0x0d, 0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x38, 0x80,
+  0x22, 0x11, 0x53, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10,
+  0x06, 0x3d, 0x0c, 0x45, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x37, 0x81, 0x41, 0x08, 0xc4,
+  0x2b, 0x53, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x47, 0x00, 0x00, 0x80, 0x22, 0x11, 0x0c, 0x45, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x2c, 0x82, 0x41, 0x08, 0x41, 0x08, 0x20, 0x00, 0x07, 0x80,
+  0x62, 0x10, 0x53, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x47, 0x00, 0x00, 0x81, 0x61, 0x08,
+  0xc4, 0x2b, 0x0b, 0x45, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x2a, 0x86, 0x41, 0x08, 0x22,
+  0x11, 0x23, 0x23, 0xc4, 0x2b, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x05, 0x80, 0xc1, 0x10, 0x53,
+  0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x48, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x0a,
+  0x45, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x2a, 0x80, 0xc1, 0x10, 0x44, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x02, 0x81, 0x41, 0x08, 0x23, 0x23, 0x52, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x49, 0x00, 0x00, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x0a, 0x45, 0xc7, 0x4d,
+  0x81, 0x22, 0x1a, 0x20, 0x00, 0x29, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x81, 0xc4,
+  0x2b, 0x62, 0x10, 0x01, 0x80, 0x62, 0x10, 0x53, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x4a,
+  0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x08, 0x46, 0xc7, 0x4d, 0x42, 0x61, 0x08, 0x28, 0x81,
+  0x20, 0x00, 0x22, 0x1a, 0x47, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08,
+  0x06, 0x3d, 0x51, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x4c, 0x00, 0x00, 0x81, 0x61, 0x08,
+  0x06, 0x3d, 0x07, 0x46, 0xc7, 0x4d, 0x83, 0x62, 0x10, 0x22, 0x1a, 0x22, 0x11, 0x20, 0x00, 0x27,
+  0x81, 0x20, 0x00, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x80, 0x65, 0x34, 0x42, 0x62, 0x10, 0x80, 0x23,
+  0x23, 0x50, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x4d, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x07,
+  0x45, 0xc7, 0x4d, 0x84, 0xc4, 0x2b, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x61, 0x08, 0x28, 0x80,
+  0x22, 0x11, 0x49, 0xc7, 0x4d, 0x84, 0x23, 0x23, 0x62, 0x10, 0x22, 0x11, 0x62, 0x10, 0x22, 0x1a,
+  0x4e, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x4e, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23,
+  0x06, 0x45, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x28,
+  0x80, 0x62, 0x10, 0x4a, 0xc7, 0x4d, 0x85, 0x22, 0x11, 0x61, 0x08, 0x23, 0x23, 0x62, 0x10, 0xc1,
+  0x10, 0x06, 0x3d, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x50, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65,
+  0x34, 0x04, 0x45, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x22, 0x11, 0x28, 0x81, 0x21, 0x08, 0x23, 0x23, 0x49, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x61, 0x08,
+  0xc1, 0x10, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x81, 0x23, 0x23,
+  0x41, 0x08, 0x51, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x45, 0xc7, 0x4d, 0x85, 0x61,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x29, 0x80, 0x61, 0x08, 0x4a,
+  0xc7, 0x4d, 0x86, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06,
+  0x3d, 0x48, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x52, 0x00, 0x00, 0x81, 0x21, 0x08, 0x22,
+  0x11, 0x02, 0x45, 0xc7, 0x4d, 0x86, 0x23, 0x23, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0x06, 0x3d,
+  0x65, 0x34, 0x62, 0x10, 0x29, 0x81, 0x41, 0x08, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x86, 0xa3, 0x1a,
+  0x61, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x81,
+  0xa2, 0x11, 0x20, 0x00, 0x53, 0x00, 0x00, 0x81, 0x21, 0x08, 0x22, 0x11, 0x46, 0xc7, 0x4d, 0x86,
+  0x23, 0x23, 0x62, 0x10, 0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x62, 0x10, 0x2b, 0x80,
+  0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x86, 0x61, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08,
+  0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x54, 0x00, 0x00, 0x8a,
+  0x21, 0x08, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0x23, 0x23,
+  0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2c, 0x81, 0x41, 0x08,
+  0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d,
+  0x61, 0x08, 0xc1, 0x10, 0x45, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x55, 0x00, 0x00, 0x81, 0x61, 0x08,
+  0xc4, 0x2b, 0x45, 0x62, 0x10, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x80, 0x62, 0x10,
+  0x2d, 0x80, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x86, 0x22, 0x11, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x65, 0x34, 0x61, 0x08, 0x22, 0x1a, 0x43, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x54, 0x00,
+  0x00, 0x00, 0x82, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x43, 0x65, 0x34, 0x80, 0x06, 0x3d, 0x44,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x2d, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x4a, 0xc7, 0x4d,
+  0x8b, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x10, 0x44, 0x00, 0x00, 0x00, 0x4c, 0xc7,
+  0x4d, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x2e, 0x81, 0x61, 0x08, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x81,
+  0x61, 0x08, 0xc1, 0x10, 0x42, 0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d,
+  0x61, 0x08, 0x10, 0x44, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x06, 0x44, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x30, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x83, 0x23, 0x23,
+  0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x22, 0x11, 0x22, 0x1a,
+  0x41, 0x08, 0x10, 0x44, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x06, 0x45, 0xc7, 0x4d, 0x81, 0xa2, 0x11,
+  0x20, 0x00, 0x31, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10,
+  0x22, 0x1a, 0x61, 0x08, 0xa3, 0x1a, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08,
+  0x10, 0x44, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x06, 0x44, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x32, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x43, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0xa2, 0x11,
+  0x62, 0x10, 0xc1, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x1a, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x10, 0x45, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x06, 0x44, 0xc7, 0x4d, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x34, 0x87, 0x41, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0xa2, 0x11,
+  0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x20, 0x00, 0x10, 0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4,
+  0x2b, 0x06, 0x44, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x35, 0x84, 0x41, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x61, 0x08, 0xc4, 0x2b,
+  0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x10, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x05,
+  0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x38, 0x81, 0x61, 0x08, 0x06, 0x3d,
+  0x46, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x62, 0x10, 0x11, 0x45, 0x00, 0x00,
+  0x81, 0x41, 0x08, 0x23, 0x23, 0x04, 0x43, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x20, 0x00,
+  0x39, 0x82, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x22, 0x11,
+  0x61, 0x08, 0x12, 0x46, 0x00, 0x00, 0x8a, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0xa3, 0x1a, 0xc4,
+  0x2b, 0x65, 0x34, 0x06, 0x3d, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x3c, 0x82, 0x20,
+  0x00, 0x62, 0x10, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x21, 0x08, 0x12,
+  0x49, 0x00, 0x00, 0x85, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x21, 0x08,
+  0x3f, 0x00, 0x86, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x1a, 0x61,
+  0x08, 0x14, 0x7f, 0x00, 0x00, 0x12, 0x83, 0x41, 0x08, 0x62, 0x10, 0x62, 0x10, 0x21, 0x08, 0x17,
+  0x7f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x25, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x06, 0x84, 0x20, 0x00, 0x61,
+  0x08, 0x62, 0x10, 0x41, 0x08, 0x20, 0x00, 0x3f, 0x26, 0x86, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d,
+  0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x3f, 0x25, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x43,
+  0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x21, 0x08, 0x20, 0x00, 0x20, 0x00, 0x3f,
+  0x1a, 0x82, 0x41, 0x08, 0x41, 0x08, 0x20, 0x00, 0x01, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x46, 0xc7,
+  0x4d, 0x85, 0x06, 0x3d, 0x23, 0x23, 0xa3, 0x1a, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x3f, 0x16,
+  0x87, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc4, 0x2b, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0xa3,
+  0x1a, 0x4c, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x61, 0x08, 0x3f, 0x14, 0x81, 0x20, 0x00, 0x61, 0x08,
+  0x54, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x20, 0x00, 0x3f, 0x09, 0x81, 0x62, 0x10, 0x62,
+  0x10, 0x05, 0x82, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x55, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xa2,
+  0x11, 0x41, 0x08, 0x3f, 0x07, 0x83, 0x21, 0x08, 0xa3, 0x1a, 0x23, 0x23, 0x41, 0x08, 0x03, 0x82,
+  0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x58, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x06,
+  0x88, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08, 0x62,
+  0x10, 0xa3, 0x1a, 0x4c, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x65, 0x34, 0x06, 0x3d, 0x09, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x05, 0x80, 0x62, 0x10, 0x42, 0xc7, 0x4d, 0x83,
+  0x06, 0x3d, 0xc4, 0x2b, 0xc4, 0x2b, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0xc4, 0x2b,
+  0xc4, 0x2b, 0x06, 0x3d, 0x04, 0x85, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10,
+  0xa3, 0x1a, 0x09, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x04, 0x80, 0x61,
+  0x08, 0x01, 0x46, 0xc7, 0x4d, 0x89, 0xc4, 0x2b, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x06, 0x3d, 0xa2, 0x11, 0x43, 0x62, 0x10, 0x82, 0x41, 0x08,
+  0x41, 0x08, 0x22, 0x1a, 0x03, 0x80, 0x06, 0x3d, 0x42, 0x65, 0x34, 0x80, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x3f, 0x03, 0x80, 0x62, 0x10, 0x07, 0x86, 0x06, 0x3d, 0x62,
+  0x10, 0x61, 0x08, 0x23, 0x23, 0x23, 0x23, 0xa3, 0x1a, 0xc1, 0x10, 0x42, 0x61, 0x08, 0x8c, 0x22,
+  0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0x43, 0x62, 0x10, 0x85, 0x61, 0x08, 0x65,
+  0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x03, 0x80, 0x65, 0x34, 0x05, 0x83,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d,
+  0x45, 0xc7, 0x4d, 0x91, 0x06, 0x3d, 0xc1, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a,
+  0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x01, 0x81, 0x20, 0x00, 0x61, 0x08, 0x04,
+  0x83, 0x06, 0x3d, 0xc1, 0x10, 0x62, 0x10, 0xc4, 0x2b, 0x4f, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x23,
+  0x23, 0x45, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0xa3, 0x1a, 0x01, 0x81, 0xc7,
+  0x4d, 0x61, 0x08, 0x3f, 0x01, 0x89, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d,
+  0x06, 0x3d, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x59, 0xc7, 0x4d, 0x82, 0x22, 0x1a,
+  0x20, 0x00, 0x22, 0x11, 0x01, 0x82, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x00, 0x88, 0x41,
+  0x08, 0xc1, 0x10, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0xa3,
+  0x1a, 0x5a, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0xa2, 0x11, 0x02, 0x81, 0x65, 0x34, 0x41,
+  0x08, 0x3f, 0x00, 0x87, 0x61, 0x08, 0x65, 0x34, 0x65, 0x34, 0xc1, 0x10, 0x20, 0x00, 0x62, 0x10,
+  0x61, 0x08, 0x65, 0x34, 0x5b, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x81,
+  0x06, 0x3d, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x61, 0x08, 0x61,
+  0x08, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x23, 0x23, 0x0b, 0x82, 0x23,
+  0x23, 0xc1, 0x10, 0x23, 0x23, 0x07, 0x83, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x11, 0x44,
+  0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x21, 0x08, 0xa3, 0x1a, 0xa3, 0x1a, 0x21, 0x08,
+  0x22, 0x11, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x21, 0x08, 0x21, 0x08, 0xc1, 0x10, 0x0b, 0x83,
+  0xc1, 0x10, 0x21, 0x08, 0x41, 0x08, 0x22, 0x1a, 0x06, 0x83, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08,
+  0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x00, 0x8a, 0x00, 0x00, 0x61, 0x08, 0x61,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x11, 0xa2, 0x11, 0x23, 0x23, 0x23, 0x23, 0x06,
+  0x3d, 0x0b, 0x84, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x84, 0x65,
+  0x34, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x3f, 0x05, 0x83, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0xa2, 0x11, 0x54, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0xc1, 0x10, 0x23, 0x23, 0x04, 0x86,
+  0x06, 0x3d, 0xc1, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x3f, 0x05,
+  0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x5c, 0xc7, 0x4d, 0x85, 0x23, 0x23, 0xc1, 0x10,
+  0x22, 0x1a, 0xa3, 0x1a, 0x62, 0x10, 0xa3, 0x1a, 0x01, 0x80, 0x62, 0x10, 0x3f, 0x01, 0x81, 0x20,
+  0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x05, 0x80, 0x06,
+  0x3d, 0x05, 0x82, 0x06, 0x3d, 0xa3, 0x1a, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x89, 0x06, 0x3d, 0xa3,
+  0x1a, 0xc4, 0x2b, 0x22, 0x1a, 0x22, 0x11, 0x23, 0x23, 0x61, 0x08, 0xa2, 0x11, 0x65, 0x34, 0x61,
+  0x08, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x02, 0x83, 0xc4, 0x2b, 0x21, 0x08, 0x61, 0x08,
+  0x65, 0x34, 0x03, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x04, 0x82, 0x22, 0x11, 0x21, 0x08,
+  0x61, 0x08, 0x09, 0x88, 0xc4, 0x2b, 0x61, 0x08, 0xa3, 0x1a, 0xa3, 0x1a, 0x61, 0x08, 0xc4, 0x2b,
+  0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x83, 0xa3,
+  0x1a, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x03, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x04,
+  0x83, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x87, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0x22, 0x1a, 0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x80,
+  0x61, 0x08, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x02, 0x82,
+  0xa3, 0x1a, 0x41, 0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x80,
+  0x06, 0x3d, 0x07, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a,
+  0xa2, 0x11, 0x22, 0x11, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x82, 0x06, 0x3d, 0x61, 0x08, 0xc1,
+  0x10, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34, 0x45, 0xc7, 0x4d,
+  0x80, 0x61, 0x08, 0x0a, 0x88, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x61,
+  0x08, 0xa3, 0x1a, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x07, 0x45, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x41,
+  0x08, 0x23, 0x23, 0x46, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x22, 0x11, 0x48, 0xc7, 0x4d,
+  0x87, 0x06, 0x3d, 0x23, 0x23, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x03, 0x80, 0x22, 0x11, 0x04, 0x43, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x41,
+  0x08, 0xa2, 0x11, 0x54, 0xc7, 0x4d, 0x86, 0xc1, 0x10, 0x22, 0x11, 0x06, 0x3d, 0xa2, 0x11, 0xc4,
+  0x2b, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x03, 0x80, 0x22, 0x11, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x61, 0x08, 0x56, 0xc7, 0x4d, 0x80, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x04, 0x80, 0xa2, 0x11, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x5a, 0xc7, 0x4d,
+  0x81, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x0c, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0x22, 0x1a,
+  0x15, 0x44, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x07, 0x84, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x18, 0x81, 0xc7, 0x4d, 0xa2, 0x11, 0x3f, 0x03,
+  0x80, 0x62, 0x10, 0x08, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0x07, 0x80, 0x06, 0x3d, 0x11,
+  0x80, 0x22, 0x11, 0x3f, 0x04, 0x80, 0x06, 0x3d, 0x02, 0x80, 0x65, 0x34, 0x04, 0x49, 0xc7, 0x4d,
+  0x81, 0x22, 0x11, 0xa2, 0x11, 0x10, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x01, 0x81, 0x23, 0x23, 0x61, 0x08, 0x0b, 0x86, 0x06, 0x3d, 0xc4, 0x2b, 0xa2, 0x11, 0x62, 0x10,
+  0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x0e, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x8a, 0x20, 0x00, 0xa2,
+  0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0xa2, 0x11, 0xa3,
+  0x1a, 0x23, 0x23, 0x42, 0xc4, 0x2b, 0x8a, 0x23, 0x23, 0x22, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x61,
+  0x08, 0x22, 0x11, 0x23, 0x23, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0xc1, 0x10, 0x0d, 0x81, 0xa3,
+  0x1a, 0x41, 0x08, 0x3f, 0x03, 0x91, 0x00, 0x00, 0x62, 0x10, 0xc7, 0x4d, 0x23, 0x23, 0x20, 0x00,
+  0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0xc4, 0x2b, 0xa3, 0x1a, 0x22, 0x1a, 0xa3, 0x1a, 0xa3, 0x1a,
+  0x22, 0x1a, 0xa3, 0x1a, 0xc4, 0x2b, 0x65, 0x34, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0xc4, 0x2b,
+  0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0x08, 0x85, 0x06, 0x3d, 0xa3, 0x1a, 0x23, 0x23, 0xa3, 0x1a,
+  0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x05, 0x82, 0x21, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x01,
+  0x82, 0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x49, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x62,
+  0x10, 0xa3, 0x1a, 0x62, 0x10, 0x09, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0x21, 0x08, 0x21, 0x08, 0x7f,
+  0x00, 0x00, 0x07, 0x97, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d,
+  0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x3d,
+  0xc7, 0x4d, 0x65, 0x34, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x65, 0x34, 0x06, 0x3d, 0x07, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0a, 0x82, 0x00,
+  0x00, 0x20, 0x00, 0xa2, 0x11, 0x44, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0xa3, 0x1a, 0xc1, 0x10, 0x61,
+  0x08, 0x43, 0x62, 0x10, 0x82, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x81, 0x22,
+  0x11, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x0b, 0x82, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x01, 0x45,
+  0xc7, 0x4d, 0x43, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x41, 0x08, 0x7f, 0x00, 0x00,
+  0x0d, 0x82, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x54, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x17, 0x82, 0xc4, 0x2b,
+  0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x06,
+  0x3d, 0x14, 0x80, 0xa3, 0x1a, 0x43, 0x61, 0x08, 0x80, 0x20, 0x00, 0x3f, 0x0e, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x12, 0x87, 0xa2, 0x11, 0xc1, 0x10, 0x06, 0x3d, 0x61, 0x08,
+  0xa2, 0x11, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x3f, 0x0e, 0x84, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0x08, 0xc1, 0x10, 0x06, 0x3d, 0x0f, 0x89, 0x23, 0x23, 0xc4, 0x2b, 0xc7, 0x4d, 0x23, 0x23, 0x61,
+  0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08, 0x3f, 0x0e, 0x85, 0x00, 0x00,
+  0x21, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x23, 0x23, 0x0d, 0x84, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x0e,
+  0x83, 0x20, 0x00, 0xc1, 0x10, 0x06, 0x3d, 0xa3, 0x1a, 0x42, 0x61, 0x08, 0x81, 0xc1, 0x10, 0xc4,
+  0x2b, 0x0a, 0x84, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x83, 0xc1, 0x10, 0x20, 0x00, 0x22, 0x11, 0x61, 0x08, 0x3f, 0x0c, 0x80, 0x61, 0x08, 0x43, 0xc7,
+  0x4d, 0x89, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x20, 0x00, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11,
+  0x22, 0x1a, 0x23, 0x23, 0x06, 0x3d, 0x04, 0x83, 0x23, 0x23, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34,
+  0x42, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x62, 0x10, 0x41, 0x08, 0x65, 0x34, 0x65, 0x34, 0x61, 0x08,
+  0x3f, 0x0a, 0x81, 0x41, 0x08, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0xc1, 0x10, 0x41,
+  0x08, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x22, 0x11, 0xc1, 0x10, 0x23, 0x23, 0x02, 0x84, 0xc4,
+  0x2b, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x86, 0x22, 0x11, 0x00,
+  0x00, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x08, 0x83, 0x20, 0x00,
+  0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0xc1, 0x10, 0x61, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x22, 0x1a, 0x22, 0x1a, 0xc1, 0x10, 0x62, 0x10, 0x20, 0x00,
+  0x62, 0x10, 0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x41, 0x08, 0x41, 0x08, 0x23, 0x23,
+  0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x08, 0x84, 0x62, 0x10, 0x23, 0x23, 0x61, 0x08, 0x61,
+  0x08, 0x06, 0x3d, 0x03, 0x43, 0xc7, 0x4d, 0x87, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x45, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x62, 0x10,
+  0x20, 0x00, 0xa2, 0x11, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x06, 0x86, 0x20,
+  0x00, 0x22, 0x1a, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x04, 0x4e, 0xc7,
+  0x4d, 0x83, 0xc4, 0x2b, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x1a,
+  0x20, 0x00, 0x3f, 0x05, 0x88, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62,
+  0x10, 0x21, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x04, 0x4b, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x61, 0x08,
+  0x00, 0x00, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x05, 0x80, 0x61,
+  0x08, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x00, 0x00, 0x22, 0x11, 0x0e, 0x84, 0x65, 0x34, 0x61,
+  0x08, 0x21, 0x08, 0x21, 0x08, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x3f,
+  0x03, 0x81, 0x21, 0x08, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x20, 0x00, 0xa3, 0x1a,
+  0x07, 0x8a, 0x06, 0x3d, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0x22, 0x1a, 0x61, 0x08,
+  0x41, 0x08, 0x21, 0x08, 0x62, 0x10, 0x23, 0x23, 0x49, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x3f, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65,
+  0x34, 0x06, 0x89, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x41, 0x08, 0x41, 0x08, 0x21, 0x08, 0x41,
+  0x08, 0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x80,
+  0x61, 0x08, 0x44, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x86,
+  0x23, 0x23, 0x20, 0x00, 0x61, 0x08, 0x22, 0x11, 0xa2, 0x11, 0x23, 0x23, 0x65, 0x34, 0x01, 0x4d,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x20, 0x00, 0x3f, 0x01, 0x81, 0x20, 0x00, 0xa3, 0x1a, 0x44, 0xc7,
+  0x4d, 0x82, 0x23, 0x23, 0x20, 0x00, 0xc1, 0x10, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x00, 0x00,
+  0x61, 0x08, 0x53, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x01, 0x81, 0x41, 0x08, 0xc4,
+  0x2b, 0x44, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x21, 0x08, 0xa3, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x61,
+  0x08, 0x21, 0x08, 0x23, 0x23, 0x53, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x01, 0x81,
+  0x61, 0x08, 0x65, 0x34, 0x44, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x46, 0xc7,
+  0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x54, 0xc7, 0x4d, 0x3f, 0x02, 0x81,
+  0x61, 0x08, 0x06, 0x3d, 0x03, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x46, 0xc7,
+  0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x55, 0xc7, 0x4d, 0x3f, 0x02, 0x80, 0x62, 0x10,
+  0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0xc4, 0x2b,
+  0x21, 0x08, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x3f, 0x01, 0x80, 0x62, 0x10, 0x44,
+  0xc7, 0x4d, 0x82, 0x65, 0x34, 0x41, 0x08, 0xc1, 0x10, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x00,
+  0x00, 0x22, 0x11, 0x55, 0xc7, 0x4d, 0x80, 0xa3, 0x1a, 0x3f, 0x01, 0x80, 0x62, 0x10, 0x44, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x21, 0x08, 0x22, 0x1a, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x00, 0x00,
+  0x22, 0x1a, 0x55, 0xc7, 0x4d, 0x3f, 0x02, 0x80, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x1a,
+  0x21, 0x08, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x00, 0x00, 0xa3, 0x1a, 0x55, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x82, 0x22,
+  0x11, 0x41, 0x08, 0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x21, 0x08, 0x23, 0x23, 0x55,
+  0xc7, 0x4d, 0x80, 0x65, 0x34, 0x3f, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0x61, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x07, 0x82, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0x15, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x3f, 0x00, 0x81, 0x41, 0x08, 0x65, 0x34, 0x03, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06,
+  0x3d, 0x07, 0x82, 0x61, 0x08, 0x41, 0x08, 0x65, 0x34, 0x15, 0x80, 0x06, 0x3d, 0x3f, 0x01, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x02, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x82,
+  0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x16, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x81, 0x21, 0x08, 0x23,
+  0x23, 0x02, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x48, 0xc7, 0x4d, 0x82, 0x62, 0x10, 0x62,
+  0x10, 0x06, 0x3d, 0x04, 0x80, 0x65, 0x34, 0x10, 0x80, 0x62, 0x10, 0x3f, 0x01, 0x80, 0xa2, 0x11,
+  0x02, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10,
+  0x62, 0x10, 0x06, 0x3d, 0x03, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x0f, 0x80, 0x62, 0x10,
+  0x3f, 0x01, 0x80, 0xc1, 0x10, 0x02, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x47, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x81, 0x62, 0x10, 0xc1, 0x10, 0x0f,
+  0x80, 0x62, 0x10, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x02, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08,
+  0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0xc1, 0x10,
+  0x62, 0x10, 0x06, 0x3d, 0x0e, 0x80, 0x62, 0x10, 0x3f, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61,
+  0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0xa3,
+  0x1a, 0x41, 0x08, 0xc4, 0x2b, 0x0d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x02, 0x80, 0x65, 0x34,
+  0x01, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa2, 0x11, 0x0d, 0x80, 0x06, 0x3d,
+  0x3f, 0x02, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x01, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x47,
+  0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x81, 0x62, 0x10, 0x61,
+  0x08, 0x0d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x01, 0x82, 0x65, 0x34,
+  0x61, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x46, 0xc7,
+  0x4d, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0c, 0x80, 0x65, 0x34, 0x3f, 0x03, 0x80, 0x62,
+  0x10, 0x01, 0x80, 0x65, 0x34, 0x01, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08,
+  0x46, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x65, 0x34, 0x0c, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x3f, 0x03, 0x82, 0x65, 0x34, 0xc7, 0x4d, 0x65, 0x34, 0x01, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0xc4, 0x2b, 0x0c, 0x81,
+  0x06, 0x3d, 0x61, 0x08, 0x3f, 0x02, 0x83, 0x21, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x06, 0x3d, 0x01,
+  0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x22, 0x1a, 0x0c, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x02, 0x85, 0x00, 0x00, 0x22,
+  0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61,
+  0x08, 0x47, 0xc7, 0x4d, 0x81, 0x62, 0x10, 0xc1, 0x10, 0x0c, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f,
+  0x03, 0x84, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x81,
+  0x61, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x0b, 0x82, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x3f, 0x03, 0x84, 0x21, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x61, 0x08, 0x62,
+  0x10, 0x48, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61,
+  0x08, 0x0b, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3f, 0x03, 0x84, 0x41, 0x08, 0x62, 0x10,
+  0x21, 0x08, 0x00, 0x00, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d,
+  0x01, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x0a, 0x81, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x3f, 0x04, 0x84, 0x61, 0x08, 0x06, 0x3d, 0x23, 0x23, 0xc1, 0x10, 0x22, 0x1a, 0x48, 0xc7,
+  0x4d, 0x84, 0x23, 0x23, 0x41, 0x08, 0x62, 0x10, 0xc1, 0x10, 0xa2, 0x11, 0x43, 0x22, 0x1a, 0x83,
+  0x22, 0x11, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x42, 0xc7, 0x4d, 0x3f, 0x04, 0x80, 0x61,
+  0x08, 0x4d, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x45, 0x61, 0x08,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x82, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x3f, 0x04, 0x80,
+  0x62, 0x10, 0x4f, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x44, 0x65, 0x34, 0x82, 0x23, 0x23,
+  0x62, 0x10, 0x65, 0x34, 0x09, 0x81, 0xc7, 0x4d, 0xc7, 0x4d, 0x01, 0x7f, 0x00, 0x00, 0x04, 0x80,
+  0xc4, 0x2b, 0x55, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x65, 0x34, 0x08, 0x42, 0xc7, 0x4d,
+  0x01, 0x7f, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x0b, 0x48, 0xc7, 0x4d,
+  0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x08, 0x42, 0xc7, 0x4d, 0x00, 0x80, 0x21, 0x08, 0x7f,
+  0x00, 0x00, 0x03, 0x83, 0x00, 0x00, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0x0c, 0x47, 0xc7, 0x4d,
+  0x81, 0x62, 0x10, 0x23, 0x23, 0x08, 0x42, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x04,
+  0x85, 0x41, 0x08, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x0b, 0x46, 0xc7,
+  0x4d, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x07, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x04, 0x87, 0x41, 0x08, 0xc4, 0x2b, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x22, 0x1a,
+  0x06, 0x3d, 0x09, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa2, 0x11, 0x07, 0x43, 0xc7, 0x4d, 0x81,
+  0x61, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x03, 0x89, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d, 0x07, 0x46, 0xc7,
+  0x4d, 0x81, 0x61, 0x08, 0x22, 0x11, 0x06, 0x43, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61,
+  0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x02, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x80,
+  0xc4, 0x2b, 0x43, 0x61, 0x08, 0x81, 0x23, 0x23, 0x06, 0x3d, 0x04, 0x46, 0xc7, 0x4d, 0x81, 0x61,
+  0x08, 0x61, 0x08, 0x06, 0x43, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x02, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x8a, 0x65, 0x34, 0xa2,
+  0x11, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0x22, 0x1a, 0x23, 0x23, 0x23,
+  0x23, 0xc4, 0x2b, 0x42, 0x06, 0x3d, 0x84, 0x65, 0x34, 0xc4, 0x2b, 0xa3, 0x1a, 0x62, 0x10, 0x61,
+  0x08, 0x05, 0x44, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x41, 0x08, 0xc1, 0x10, 0x21, 0x08, 0x7f, 0x00,
+  0x00, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x22, 0x1a, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x08, 0x42, 0x41, 0x08, 0x44, 0x61, 0x08, 0x82, 0x62, 0x10, 0x21, 0x08,
+  0x61, 0x08, 0x05, 0x44, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0x21, 0x08, 0x7f,
+  0x00, 0x00, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0x06, 0x3d,
+  0x65, 0x34, 0xc4, 0x2b, 0x23, 0x23, 0xa3, 0x1a, 0xa3, 0x1a, 0x23, 0x23, 0xc4, 0x2b, 0x06, 0x3d,
+  0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x04, 0x45, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x62, 0x10, 0x22,
+  0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x56, 0xc7, 0x4d, 0x82,
+  0xa2, 0x11, 0x41, 0x08, 0x22, 0x1a, 0x03, 0x43, 0xc7, 0x4d, 0x84, 0xa3, 0x1a, 0x62, 0x10, 0x21,
+  0x08, 0x61, 0x08, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x55, 0xc7,
+  0x4d, 0x90, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x23, 0x23,
+  0xc4, 0x2b, 0xc4, 0x2b, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x06, 0x3d, 0x22, 0x11, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x4b, 0xc7, 0x4d,
+  0x00, 0x47, 0xc7, 0x4d, 0x86, 0x23, 0x23, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0xc4, 0x2b, 0x61,
+  0x08, 0x62, 0x10, 0x42, 0x61, 0x08, 0x87, 0x62, 0x10, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x65,
+  0x34, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d,
+  0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x61, 0x08,
+  0x22, 0x11, 0x06, 0x3d, 0x02, 0x44, 0x06, 0x3d, 0x02, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x06, 0x3d,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x81, 0x61, 0x08, 0xc1,
+  0x10, 0x44, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x05, 0x46, 0xc7,
+  0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x61,
+  0x08, 0x65, 0x34, 0x05, 0x44, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x84,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x23, 0x23, 0x02, 0x4a, 0xc7, 0x4d, 0x83, 0x65,
+  0x34, 0x62, 0x10, 0xc4, 0x2b, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x03, 0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x62, 0x10, 0x01, 0x84, 0x06, 0x3d, 0x62, 0x10, 0x61,
+  0x08, 0x23, 0x23, 0x06, 0x3d, 0x4e, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x62, 0x10, 0xa3, 0x1a, 0x41,
+  0x08, 0x7f, 0x00, 0x00, 0x03, 0x81, 0x41, 0x08, 0x23, 0x23, 0x03, 0x46, 0xc7, 0x4d, 0x86, 0xc4,
+  0x2b, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x65, 0x34, 0x01, 0x85, 0xc7,
+  0x4d, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x85, 0x23,
+  0x23, 0xc4, 0x2b, 0xc7, 0x4d, 0x22, 0x1a, 0x61, 0x08, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x0b, 0x45,
+  0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62,
+  0x10, 0x61, 0x08, 0xc1, 0x10, 0x42, 0x61, 0x08, 0x81, 0x41, 0x08, 0xc1, 0x10, 0x42, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x22, 0x1a, 0x01, 0x85, 0x61, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x61, 0x08, 0x22,
+  0x11, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x22, 0x1a, 0x05, 0x45, 0xc7, 0x4d,
+  0x00, 0x80, 0x61, 0x08, 0x02, 0x87, 0x23, 0x23, 0xa2, 0x11, 0xa2, 0x11, 0xa3, 0x1a, 0x65, 0x34,
+  0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x22, 0x1a, 0x01, 0x85,
+  0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x04,
+  0x81, 0x00, 0x00, 0xa2, 0x11, 0x07, 0x43, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x06, 0x3d,
+  0x06, 0x81, 0x22, 0x1a, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x89, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00,
+  0x00, 0x04, 0x81, 0x00, 0x00, 0x61, 0x08, 0x09, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62,
+  0x10, 0x23, 0x23, 0x06, 0x81, 0x61, 0x08, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61,
+  0x08, 0x01, 0x85, 0x23, 0x23, 0x61, 0x08, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x05, 0x81, 0x00, 0x00, 0x61, 0x08, 0x08, 0x43, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xc1,
+  0x10, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x81, 0xa2,
+  0x11, 0xa2, 0x11, 0x01, 0x85, 0x61, 0x08, 0x22, 0x1a, 0x22, 0x11, 0x62, 0x10, 0xc4, 0x2b, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x07, 0x44, 0xc7, 0x4d,
+  0x82, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x42,
+  0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x22,
+  0x11, 0x61, 0x08, 0x23, 0x23, 0xa2, 0x11, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x02, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x45, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x62, 0x10, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xc1, 0x10, 0x42, 0xc7, 0x4d,
+  0x8c, 0xc1, 0x10, 0x61, 0x08, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x23,
+  0x23, 0x06, 0x3d, 0x62, 0x10, 0x41, 0x08, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x02, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x05, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61,
+  0x08, 0x01, 0x8d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x23, 0x23, 0x41, 0x08, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x01,
+  0x85, 0x22, 0x1a, 0x20, 0x00, 0x61, 0x08, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x01, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x23, 0x23, 0x04, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x62,
+  0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x89, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0x06,
+  0x3d, 0x62, 0x10, 0x21, 0x08, 0x21, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x02, 0x86, 0x06, 0x3d, 0x62,
+  0x10, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x01, 0x42, 0x00, 0x00,
+  0x80, 0x22, 0x1a, 0x03, 0x48, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x42, 0xc7,
+  0x4d, 0x88, 0x23, 0x23, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc1, 0x10, 0x62, 0x10, 0xc4, 0x2b,
+  0x65, 0x34, 0x06, 0x3d, 0x03, 0x82, 0x22, 0x1a, 0x20, 0x00, 0xc1, 0x10, 0x01, 0x81, 0xc7, 0x4d,
+  0x62, 0x10, 0x3f, 0x00, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x03, 0x49, 0xc7, 0x4d, 0x81, 0x61,
+  0x08, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x22, 0x1a, 0x62,
+  0x10, 0x65, 0x34, 0x05, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x80, 0x22, 0x11, 0x3f, 0x00, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x03, 0x49, 0xc7, 0x4d, 0x89,
+  0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08,
+  0x62, 0x10, 0x65, 0x34, 0x06, 0x82, 0xa2, 0x11, 0x41, 0x08, 0xa3, 0x1a, 0x01, 0x83, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x02,
+  0x49, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34,
+  0xa3, 0x1a, 0x06, 0x3d, 0x06, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x01, 0x42, 0xc7, 0x4d,
+  0x00, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x03,
+  0x49, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x61, 0x08, 0x4c, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08,
+  0x65, 0x34, 0x01, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x81,
+  0x20, 0x00, 0x22, 0x1a, 0x0d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x23, 0x23, 0x4a, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x01, 0x44, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x7f, 0x00, 0x00,
+  0x44, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0e, 0x81, 0x61, 0x08, 0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x61, 0x08, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00,
+  0x00, 0x43, 0x00, 0x00, 0x80, 0x62, 0x10, 0x0e, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x65, 0x34, 0x53,
+  0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08,
+  0x65, 0x34, 0x0d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x53, 0xc7, 0x4d, 0x81, 0x06, 0x3d,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x81, 0x21, 0x08, 0x23, 0x23, 0x0d, 0x83, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x61, 0x08, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x82, 0x62, 0x10, 0x62, 0x10, 0x21,
+  0x08, 0x7f, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x61,
+  0x08, 0x61, 0x08, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x83, 0x62, 0x10, 0xc1, 0x10, 0xc1, 0x10, 0x21,
+  0x08, 0x39, 0x47, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0c, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0xa2, 0x11, 0x52, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x0b, 0x43, 0xc7, 0x4d, 0x82,
+  0x22, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x51, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0xc1, 0x10, 0xc7, 0x4d,
+  0x65, 0x34, 0x61, 0x08, 0x38, 0x47, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0a, 0x45, 0xc7,
+  0x4d, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x65, 0x34, 0x50, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0xc1, 0x10,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x20, 0x00, 0x36, 0x48, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22,
+  0x1a, 0x0a, 0x45, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x0f, 0x85,
+  0x61, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x2b, 0x54, 0x00, 0x00,
+  0x80, 0x61, 0x08, 0x09, 0x47, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34,
+  0x0e, 0x84, 0x61, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x2a, 0x56, 0x00, 0x00,
+  0x80, 0x62, 0x10, 0x09, 0x48, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34,
+  0x0c, 0x85, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x2a, 0x56,
+  0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x07, 0x48, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x62, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x23, 0x23, 0x0b, 0x85, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x29, 0x57, 0x00, 0x00, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x07,
+  0x48, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x83, 0x00, 0x00, 0x41, 0x08, 0x22, 0x11,
+  0x06, 0x3d, 0x09, 0x81, 0x61, 0x08, 0x61, 0x08, 0x01, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x06, 0x49, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x02, 0x83, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x07, 0x82, 0xc4, 0x2b, 0x61, 0x08,
+  0x23, 0x23, 0x01, 0x82, 0xc7, 0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x49, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x02,
+  0x42, 0x00, 0x00, 0x82, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x04, 0x82, 0x06, 0x3d, 0x61, 0x08,
+  0xc1, 0x10, 0x01, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x04, 0x4a, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41,
+  0x08, 0x03, 0x43, 0x00, 0x00, 0x88, 0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d,
+  0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f,
+  0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x04, 0x4a, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21,
+  0x08, 0x04, 0x44, 0x00, 0x00, 0x85, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08,
+  0x06, 0x3d, 0x01, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x42, 0x00,
+  0x00, 0x80, 0x61, 0x08, 0x03, 0x4b, 0xc7, 0x4d, 0x80, 0xa3, 0x1a, 0x06, 0x43, 0x00, 0x00, 0x84,
+  0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x02, 0x42, 0xc7, 0x4d, 0x80, 0xc1,
+  0x10, 0x7f, 0x00, 0x00, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x01, 0x4c, 0xc7, 0x4d,
+  0x80, 0x22, 0x1a, 0x06, 0x43, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x05, 0x42, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x01, 0x4c, 0xc7, 0x4d,
+  0x80, 0xc1, 0x10, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x23, 0x23, 0x04, 0x43, 0xc7,
+  0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x44, 0x00, 0x00, 0x80, 0x61, 0x08, 0x4e,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x48,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34,
+  0x4c, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x07, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10,
+  0x06, 0x3d, 0x47, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x45, 0x00, 0x00,
+  0x81, 0x20, 0x00, 0x22, 0x1a, 0x4b, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x06,
+  0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x48, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x47,
+  0x00, 0x00, 0x80, 0x61, 0x08, 0x4a, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x21, 0x08, 0x05, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x07, 0x81, 0xa3, 0x1a, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x47, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x86, 0x65,
+  0x34, 0x22, 0x11, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x04, 0x43, 0x00,
+  0x00, 0x80, 0x61, 0x08, 0x06, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x82, 0x21, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x8a, 0x06, 0x3d, 0xc4, 0x2b, 0x22,
+  0x1a, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61,
+  0x08, 0x04, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x04, 0x81, 0x65, 0x34, 0x62, 0x10,
+  0x7f, 0x00, 0x00, 0x49, 0x00, 0x00, 0x81, 0x21, 0x08, 0x41, 0x08, 0x44, 0x62, 0x10, 0x42, 0x61,
+  0x08, 0x81, 0x22, 0x1a, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x03, 0x44, 0x00, 0x00,
+  0x81, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x81, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x49, 0x00,
+  0x00, 0x83, 0x61, 0x08, 0xa3, 0x1a, 0xc4, 0x2b, 0x22, 0x1a, 0x42, 0xa2, 0x11, 0x82, 0x22, 0x1a,
+  0xc4, 0x2b, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x80, 0x22, 0x1a, 0x03, 0x44, 0x00, 0x00, 0x86, 0x20,
+  0x00, 0x22, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x49, 0x00, 0x00, 0x81, 0x62, 0x10, 0xc4, 0x2b, 0x4f, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x02, 0x46,
+  0x00, 0x00, 0x80, 0x21, 0x08, 0x42, 0x62, 0x10, 0x80, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x48, 0x00,
+  0x00, 0x82, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x4a, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0xa3, 0x1a,
+  0x42, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x02, 0x7f, 0x00, 0x00, 0x07, 0x4b, 0x00, 0x00,
+  0x82, 0x21, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x4a, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x61, 0x08, 0x61,
+  0x08, 0xc4, 0x2b, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x03, 0x7f, 0x00, 0x00, 0x07, 0x4a, 0x00,
+  0x00, 0x81, 0x21, 0x08, 0x22, 0x11, 0x4b, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x81,
+  0x61, 0x08, 0x41, 0x08, 0x06, 0x7f, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x81, 0x20, 0x00, 0x61,
+  0x08, 0x4b, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x0e, 0x7f, 0x00, 0x00, 0x06, 0x46, 0x00,
+  0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08,
+  0x3f, 0x18, 0x44, 0x00, 0x00, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08,
+  0x21, 0x08, 0x3f, 0x1e, 0x80, 0x61, 0x08, 0x47, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x41,
+  0x08, 0x3f, 0x20, 0x89, 0x41, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d,
+  0x23, 0x23, 0x22, 0x11, 0x62, 0x10, 0x41, 0x08, 0x3f, 0x23, 0x80, 0x21, 0x08, 0x43, 0x61, 0x08,
+  0x80, 0x21, 0x08, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x2c, 0x84, 0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x20, 0x00, 0x3f,
+  0x26, 0x81, 0x21, 0x08, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x20, 0x00,
+  0x3f, 0x24, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xa2, 0x11, 0x62,
+  0x10, 0x42, 0x41, 0x08, 0x80, 0x20, 0x00, 0x3f, 0x18, 0x83, 0x20, 0x00, 0x61, 0x08, 0x61, 0x08,
+  0x41, 0x08, 0x01, 0x81, 0x61, 0x08, 0x65, 0x34, 0x47, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0xc4, 0x2b,
+  0xc4, 0x2b, 0x22, 0x1a, 0x62, 0x10, 0x3f, 0x16, 0x87, 0x41, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x06,
+  0x3d, 0xc4, 0x2b, 0x22, 0x11, 0x61, 0x08, 0x23, 0x23, 0x4c, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62,
+  0x10, 0x3f, 0x14, 0x81, 0x21, 0x08, 0x22, 0x11, 0x54, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0x41, 0x08, 0x3f, 0x09, 0x81, 0x62, 0x10, 0x61, 0x08, 0x05, 0x81, 0x41, 0x08, 0x22, 0x11, 0x57,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x07, 0x83, 0x21, 0x08, 0x23, 0x23, 0xc4, 0x2b,
+  0x61, 0x08, 0x03, 0x81, 0x61, 0x08, 0x22, 0x1a, 0x59, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x62, 0x10,
+  0x3f, 0x06, 0x83, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0x43, 0x61, 0x08, 0x80, 0xc4,
+  0x2b, 0x4c, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0xa3, 0x1a, 0x65, 0x34, 0x08, 0x42, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x05, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06,
+  0x3d, 0x43, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x22, 0x1a, 0x22, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x03,
+  0x85, 0xc4, 0x2b, 0x61, 0x08, 0x21, 0x08, 0x00, 0x00, 0x41, 0x08, 0xa2, 0x11, 0x09, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x3f, 0x05, 0x48, 0xc7, 0x4d, 0x80, 0xa3, 0x1a, 0x44,
+  0x61, 0x08, 0x83, 0xa2, 0x11, 0x65, 0x34, 0xc4, 0x2b, 0xc1, 0x10, 0x44, 0x61, 0x08, 0x81, 0x21,
+  0x08, 0x22, 0x11, 0x03, 0x8a, 0x06, 0x3d, 0xc4, 0x2b, 0x23, 0x23, 0x23, 0x23, 0x65, 0x34, 0x06,
+  0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x06, 0x44, 0xc7, 0x4d,
+  0x8a, 0x65, 0x34, 0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0x65, 0x34, 0xc4, 0x2b, 0x22, 0x1a, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x08, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x91, 0x65, 0x34, 0x61, 0x08, 0x61,
+  0x08, 0x23, 0x23, 0x06, 0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62,
+  0x10, 0x41, 0x08, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3f,
+  0x03, 0x80, 0x65, 0x34, 0x05, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x4e, 0xc7, 0x4d, 0x00,
+  0x8f, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06,
+  0x3d, 0x22, 0x11, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61,
+  0x08, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x83, 0x06, 0x3d, 0x61, 0x08,
+  0x62, 0x10, 0x65, 0x34, 0x4f, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x00,
+  0x81, 0x00, 0x00, 0x22, 0x1a, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x01, 0x89, 0x00, 0x00,
+  0x41, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x65, 0x34, 0x65, 0x34, 0x22, 0x1a, 0x62, 0x10, 0x61, 0x08,
+  0xc4, 0x2b, 0x59, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0x22, 0x11, 0x01, 0x82, 0xc7, 0x4d,
+  0xa3, 0x1a, 0x21, 0x08, 0x3f, 0x00, 0x82, 0x41, 0x08, 0x22, 0x1a, 0x62, 0x10, 0x42, 0x41, 0x08,
+  0x82, 0x20, 0x00, 0x62, 0x10, 0xc4, 0x2b, 0x5a, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x20, 0x00, 0xa2,
+  0x11, 0x02, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x00, 0x89, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d,
+  0x22, 0x11, 0x20, 0x00, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x19, 0x82,
+  0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x02, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x3f, 0x00, 0x8a, 0x61,
+  0x08, 0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61,
+  0x08, 0x62, 0x10, 0x22, 0x1a, 0x0b, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0x07, 0x83, 0x06,
+  0x3d, 0xa2, 0x11, 0x61, 0x08, 0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x3f, 0x00, 0x8a,
+  0x21, 0x08, 0x22, 0x1a, 0xa2, 0x11, 0x21, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0xa2, 0x11, 0x61, 0x08,
+  0x41, 0x08, 0x61, 0x08, 0x22, 0x11, 0x0b, 0x83, 0xa2, 0x11, 0x41, 0x08, 0x21, 0x08, 0xc1, 0x10,
+  0x06, 0x83, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x3f, 0x00, 0x89, 0x00, 0x00, 0x41, 0x08, 0x41, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x22,
+  0x1a, 0x23, 0x23, 0xc4, 0x2b, 0x65, 0x34, 0x4d, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10, 0x41,
+  0x08, 0x23, 0x23, 0x05, 0x84, 0xc4, 0x2b, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x03,
+  0x80, 0x61, 0x08, 0x3f, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x22, 0x1a, 0x54, 0xc7,
+  0x4d, 0x82, 0x06, 0x3d, 0x22, 0x1a, 0xc4, 0x2b, 0x05, 0x85, 0x22, 0x11, 0x61, 0x08, 0x23, 0x23,
+  0x22, 0x1a, 0x62, 0x10, 0xa3, 0x1a, 0x3f, 0x05, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x42,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x59, 0xc7, 0x4d, 0x88, 0x65, 0x34, 0x22, 0x11, 0xa2,
+  0x11, 0x23, 0x23, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x01, 0x81,
+  0x20, 0x00, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d,
+  0x04, 0x81, 0x65, 0x34, 0x06, 0x3d, 0x04, 0x82, 0x06, 0x3d, 0x22, 0x11, 0x23, 0x23, 0x49, 0xc7,
+  0x4d, 0x87, 0xa2, 0x11, 0x23, 0x23, 0xa3, 0x1a, 0xc1, 0x10, 0x23, 0x23, 0x61, 0x08, 0xc1, 0x10,
+  0xc4, 0x2b, 0x3f, 0x02, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x20,
+  0x00, 0x61, 0x08, 0x65, 0x34, 0x03, 0x82, 0xc4, 0x2b, 0x62, 0x10, 0x23, 0x23, 0x04, 0x82, 0x61,
+  0x08, 0x00, 0x00, 0x61, 0x08, 0x09, 0x88, 0x65, 0x34, 0x61, 0x08, 0xa2, 0x11, 0x23, 0x23, 0x61,
+  0x08, 0xc4, 0x2b, 0xc1, 0x10, 0x61, 0x08, 0x21, 0x08, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x43, 0xc7,
+  0x4d, 0x83, 0xa3, 0x1a, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x83, 0x06, 0x3d, 0x61, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x03, 0x84, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d,
+  0x08, 0x82, 0x65, 0x34, 0x06, 0x3d, 0x61, 0x08, 0x02, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x03, 0x43, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x20, 0x00, 0x04, 0x82, 0x22, 0x1a, 0x21, 0x08,
+  0xc1, 0x10, 0x44, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d,
+  0x07, 0x88, 0xa3, 0x1a, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0x61, 0x08, 0xa2, 0x11, 0xa3, 0x1a,
+  0x61, 0x08, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x82, 0x06, 0x3d, 0xa2, 0x11, 0xa2, 0x11, 0x42,
+  0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x0c, 0x86,
+  0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x22, 0x1a, 0xc1, 0x10, 0x7f, 0x00,
+  0x00, 0x08, 0x44, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x46, 0xc7,
+  0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x22, 0x1a,
+  0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x03,
+  0x80, 0x22, 0x11, 0x03, 0x44, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0xa3, 0x1a, 0x54, 0xc7,
+  0x4d, 0x86, 0xa2, 0x11, 0x61, 0x08, 0xc7, 0x4d, 0xa3, 0x1a, 0xc4, 0x2b, 0x22, 0x1a, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x03, 0x80, 0x22, 0x11, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x56,
+  0xc7, 0x4d, 0x00, 0x42, 0xc7, 0x4d, 0x00, 0x7f, 0x00, 0x00, 0x04, 0x80, 0xa2, 0x11, 0x07, 0x83,
+  0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x14, 0x44, 0xc7, 0x4d, 0x80, 0xc4, 0x2b, 0x3f,
+  0x0d, 0x83, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08, 0x22, 0x11, 0x15, 0x44, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x07, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x61, 0x08,
+  0x06, 0x3d, 0x18, 0x81, 0xc7, 0x4d, 0xa2, 0x11, 0x3f, 0x03, 0x80, 0x62, 0x10, 0x08, 0x82, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x07, 0x81, 0xc4, 0x2b, 0x06, 0x3d, 0x10, 0x80, 0x22, 0x11, 0x3f,
+  0x04, 0x80, 0x06, 0x3d, 0x02, 0x80, 0xc4, 0x2b, 0x03, 0x4a, 0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61,
+  0x08, 0x06, 0x3d, 0x0f, 0x80, 0x61, 0x08, 0x3f, 0x03, 0x81, 0x41, 0x08, 0x23, 0x23, 0x01, 0x82,
+  0xa3, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x03, 0x45, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0xc4, 0x2b, 0x22,
+  0x1a, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x0e, 0x80, 0x62, 0x10, 0x3f,
+  0x03, 0x83, 0x00, 0x00, 0x22, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0x43, 0x61, 0x08, 0x90, 0xc1, 0x10,
+  0x22, 0x11, 0x22, 0x1a, 0xa3, 0x1a, 0x23, 0x23, 0xa3, 0x1a, 0x22, 0x1a, 0x22, 0x11, 0x61, 0x08,
+  0x61, 0x08, 0x22, 0x11, 0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08,
+  0x0d, 0x81, 0xa2, 0x11, 0x21, 0x08, 0x3f, 0x03, 0x8a, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x23,
+  0x23, 0x00, 0x00, 0x61, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34, 0xc4, 0x2b, 0x42,
+  0x65, 0x34, 0x82, 0xc4, 0x2b, 0x65, 0x34, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62,
+  0x10, 0x21, 0x08, 0x61, 0x08, 0x08, 0x85, 0x06, 0x3d, 0xa2, 0x11, 0x22, 0x11, 0x22, 0x11, 0x61,
+  0x08, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x89, 0x00, 0x00, 0x21, 0x08, 0x22, 0x1a, 0x06, 0x3d,
+  0x61, 0x08, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x84,
+  0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x09, 0x81, 0x23, 0x23, 0x41, 0x08,
+  0x7f, 0x00, 0x00, 0x09, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85, 0x65,
+  0x34, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x23, 0x23, 0x42, 0x65, 0x34, 0x88, 0x23,
+  0x23, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x06,
+  0x3d, 0x07, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x0a, 0x82, 0x00, 0x00, 0x20, 0x00,
+  0xc1, 0x10, 0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x65, 0x34, 0x22, 0x1a, 0x45, 0x61, 0x08, 0x81,
+  0xa3, 0x1a, 0x06, 0x3d, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0c, 0x82, 0x00,
+  0x00, 0x41, 0x08, 0x23, 0x23, 0x48, 0xc7, 0x4d, 0x00, 0x80, 0x06, 0x3d, 0x4f, 0xc7, 0x4d, 0x81,
+  0x22, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0c, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x06,
+  0x3d, 0x02, 0x55, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0d,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x05, 0x50, 0xc7, 0x4d, 0x84, 0xa3, 0x1a,
+  0x61, 0x08, 0x22, 0x1a, 0x22, 0x11, 0x21, 0x08, 0x3f, 0x0d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61,
+  0x08, 0x06, 0x3d, 0x14, 0x86, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0xc7, 0x4d, 0x22,
+  0x11, 0x21, 0x08, 0x3f, 0x0c, 0x42, 0x00, 0x00, 0x81, 0x62, 0x10, 0xa3, 0x1a, 0x11, 0x89, 0x06,
+  0x3d, 0xc1, 0x10, 0x22, 0x1a, 0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x22,
+  0x11, 0x21, 0x08, 0x3f, 0x0c, 0x42, 0x00, 0x00, 0x82, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x0f,
+  0x85, 0xc4, 0x2b, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x42, 0xc7, 0x4d,
+  0x80, 0x62, 0x10, 0x3f, 0x0e, 0x86, 0x00, 0x00, 0x21, 0x08, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10,
+  0xa2, 0x11, 0x06, 0x3d, 0x0d, 0x83, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc1, 0x10, 0x42, 0xc7,
+  0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x21, 0x08, 0x3f, 0x0c, 0x89, 0x20, 0x00, 0x22,
+  0x11, 0xc7, 0x4d, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x06,
+  0x3d, 0x09, 0x84, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d,
+  0x84, 0x22, 0x1a, 0x20, 0x00, 0x22, 0x11, 0xa2, 0x11, 0x21, 0x08, 0x3f, 0x0b, 0x80, 0x61, 0x08,
+  0x44, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x42, 0x61, 0x08, 0x82, 0xc1, 0x10,
+  0x22, 0x1a, 0x65, 0x34, 0x04, 0x83, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x86, 0x06, 0x3d, 0x62, 0x10, 0x20, 0x00, 0x23, 0x23, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08,
+  0x3f, 0x0a, 0x80, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x87, 0x22, 0x1a, 0x62, 0x10, 0x41, 0x08, 0x61,
+  0x08, 0x22, 0x1a, 0xa3, 0x1a, 0x22, 0x1a, 0xc4, 0x2b, 0x01, 0x85, 0x06, 0x3d, 0x22, 0x1a, 0x62,
+  0x10, 0x21, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x86, 0x22, 0x11, 0x20, 0x00, 0x62,
+  0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x08, 0x83, 0x20, 0x00, 0x61, 0x08,
+  0x41, 0x08, 0x22, 0x1a, 0x02, 0x42, 0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0xa3, 0x1a, 0x62, 0x10, 0x21,
+  0x08, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0xc1, 0x10, 0x61, 0x08, 0x41, 0x08, 0x21, 0x08, 0x61,
+  0x08, 0xc4, 0x2b, 0x44, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x41, 0x08, 0x41, 0x08, 0x23, 0x23, 0x42,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x07, 0x84, 0x62, 0x10, 0x06, 0x3d, 0x22, 0x11,
+  0x41, 0x08, 0xa2, 0x11, 0x02, 0x44, 0xc7, 0x4d, 0x87, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08, 0x62,
+  0x10, 0x62, 0x10, 0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x61,
+  0x08, 0x21, 0x08, 0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x3f, 0x06, 0x86,
+  0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x21, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x02, 0x4f,
+  0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x41, 0x08, 0x20, 0x00, 0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x61, 0x08, 0x3f, 0x05, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x83, 0x23, 0x23,
+  0x62, 0x10, 0x41, 0x08, 0x22, 0x1a, 0x04, 0x4a, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0xc1, 0x10, 0x21,
+  0x08, 0x21, 0x08, 0xa2, 0x11, 0x47, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x04, 0x80,
+  0x62, 0x10, 0x45, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0c, 0x85, 0x06, 0x3d,
+  0xa2, 0x11, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0xa3, 0x1a, 0x49, 0xc7, 0x4d, 0x81, 0xa2, 0x11,
+  0x20, 0x00, 0x3f, 0x03, 0x80, 0x22, 0x11, 0x45, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x62, 0x10, 0x08,
+  0x89, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x21, 0x08, 0x62,
+  0x10, 0x22, 0x11, 0x06, 0x3d, 0x4b, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x02, 0x81, 0x41, 0x08,
+  0xc4, 0x2b, 0x04, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x08, 0x86, 0xa3, 0x1a, 0x00, 0x00,
+  0x21, 0x08, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x4e, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x3f, 0x01, 0x80, 0x61, 0x08, 0x46, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x07,
+  0x83, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21,
+  0x08, 0x3f, 0x00, 0x80, 0xc1, 0x10, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11,
+  0x06, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x80, 0x61, 0x08,
+  0x3f, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x04, 0x83, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11,
+  0x06, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x55, 0xc7, 0x4d, 0x81, 0xc4, 0x2b,
+  0x41, 0x08, 0x3d, 0x82, 0x21, 0x08, 0x41, 0x08, 0x23, 0x23, 0x04, 0x83, 0xc7, 0x4d, 0x65, 0x34,
+  0x61, 0x08, 0xa3, 0x1a, 0x06, 0x83, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x12, 0x43,
+  0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x3d, 0x81, 0x61, 0x08, 0x62, 0x10, 0x05, 0x83, 0xc7, 0x4d, 0x65,
+  0x34, 0x61, 0x08, 0x23, 0x23, 0x06, 0x83, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x12,
+  0x43, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x3b, 0x81, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x83,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34,
+  0x62, 0x10, 0xc4, 0x2b, 0x13, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3b, 0x83, 0x61, 0x08, 0x65,
+  0x34, 0x61, 0x08, 0x65, 0x34, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4,
+  0x2b, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x13, 0x43, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x39, 0x84, 0x41, 0x08, 0x23, 0x23, 0x65, 0x34, 0x61, 0x08,
+  0x65, 0x34, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x84,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x13, 0x44, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x39, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x03, 0x84, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4,
+  0x2b, 0x62, 0x10, 0x65, 0x34, 0x13, 0x44, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x38, 0x84,
+  0x22, 0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10,
+  0x65, 0x34, 0x13, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x37, 0x85, 0x41, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23,
+  0x23, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06,
+  0x3d, 0x13, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x36, 0x85, 0x62, 0x10, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23,
+  0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d,
+  0x13, 0x45, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x36, 0x80, 0x61, 0x08, 0x42, 0xc7, 0x4d,
+  0x00, 0x80, 0x22, 0x11, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34,
+  0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x13, 0x46, 0xc7, 0x4d,
+  0x80, 0xc1, 0x10, 0x35, 0x81, 0x21, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61,
+  0x08, 0x03, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x13, 0x46, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x41, 0x08, 0x34, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x61, 0x08,
+  0x02, 0x42, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x65, 0x34, 0x07, 0x80, 0x06, 0x3d, 0x0b, 0x46, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x34, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x62, 0x10, 0x02, 0x42,
+  0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x05, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x65,
+  0x34, 0x62, 0x10, 0x65, 0x34, 0x02, 0x44, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0xc4, 0x2b, 0x0a, 0x46,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x33, 0x80, 0x22, 0x11, 0x43, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x62, 0x10, 0x65, 0x34, 0x01, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b,
+  0x04, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0x65, 0x34, 0x01, 0x45, 0xc7, 0x4d, 0x82,
+  0x06, 0x3d, 0x61, 0x08, 0x65, 0x34, 0x09, 0x46, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x32,
+  0x81, 0x21, 0x08, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x01,
+  0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xc4, 0x2b, 0x04, 0x42, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x62, 0x10, 0xc4, 0x2b, 0x02, 0x45, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x06, 0x3d,
+  0x08, 0x47, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x32, 0x81, 0x61, 0x08, 0x65, 0x34, 0x44, 0xc7, 0x4d,
+  0x00, 0x80, 0xa2, 0x11, 0x01, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0x04,
+  0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x02, 0x46, 0xc7, 0x4d, 0x82, 0x22,
+  0x1a, 0x61, 0x08, 0x06, 0x3d, 0x07, 0x47, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x31, 0x80,
+  0x62, 0x10, 0x45, 0xc7, 0x4d, 0x81, 0x22, 0x11, 0x61, 0x08, 0x01, 0x42, 0xc7, 0x4d, 0x82, 0x65,
+  0x34, 0x61, 0x08, 0x23, 0x23, 0x04, 0x42, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11,
+  0x02, 0x47, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x48, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x31, 0x80, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d,
+  0x43, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x04, 0x43, 0xc7, 0x4d, 0x81, 0x61,
+  0x08, 0x61, 0x08, 0x02, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x05, 0x49,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x31, 0x80, 0xa2, 0x11, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61,
+  0x08, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x04, 0x43, 0xc7,
+  0x4d, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x11, 0x61,
+  0x08, 0x06, 0x3d, 0x04, 0x49, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x30, 0x81, 0x21, 0x08, 0x23, 0x23,
+  0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0xa2, 0x11, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0xa2, 0x11, 0x04, 0x43, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x02,
+  0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x04, 0x49, 0xc7, 0x4d, 0x81, 0xc4,
+  0x2b, 0x41, 0x08, 0x2f, 0x81, 0x41, 0x08, 0x65, 0x34, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x04, 0x43, 0xc7,
+  0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x48, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x62,
+  0x10, 0xc4, 0x2b, 0x03, 0x4a, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x2f, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x46, 0xc7, 0x4d, 0x00, 0x80, 0x62, 0x10, 0x43, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x61,
+  0x08, 0x04, 0x43, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa2, 0x11, 0x02, 0x49, 0xc7, 0x4d,
+  0x81, 0x61, 0x08, 0x61, 0x08, 0x03, 0x4a, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2f, 0x80, 0x62, 0x10,
+  0x47, 0xc7, 0x4d, 0x83, 0x22, 0x11, 0x41, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81,
+  0x61, 0x08, 0x61, 0x08, 0x04, 0x44, 0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x02, 0x48, 0xc7,
+  0x4d, 0x83, 0x23, 0x23, 0x61, 0x08, 0x21, 0x08, 0xa3, 0x1a, 0x02, 0x4a, 0xc7, 0x4d, 0x81, 0xa3,
+  0x1a, 0x20, 0x00, 0x2e, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d, 0x88, 0x22, 0x1a, 0x00,
+  0x00, 0x21, 0x08, 0x62, 0x10, 0xc1, 0x10, 0x22, 0x1a, 0xa3, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x05,
+  0x43, 0xc7, 0x4d, 0x82, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x44, 0xc7, 0x4d, 0x87, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x01,
+  0x4a, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x41, 0x08, 0x2d, 0x83, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x88, 0x22, 0x1a, 0x41, 0x08, 0x22, 0x11, 0x61, 0x08, 0x61, 0x08,
+  0x21, 0x08, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x05, 0x43, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0xc4, 0x2b, 0x02, 0x8c, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x62,
+  0x10, 0x41, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x01,
+  0x4b, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x2d, 0x84, 0xc1, 0x10, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10,
+  0x65, 0x34, 0x44, 0xc7, 0x4d, 0x87, 0x22, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34,
+  0xc4, 0x2b, 0xc4, 0x2b, 0x65, 0x34, 0x06, 0x44, 0xc7, 0x4d, 0x8c, 0x61, 0x08, 0x61, 0x08, 0x65,
+  0x34, 0x65, 0x34, 0xc4, 0x2b, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x23, 0x23, 0x06, 0x3d, 0x02, 0x82, 0xa2, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x4c, 0xc7, 0x4d,
+  0x80, 0xc1, 0x10, 0x2c, 0x86, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62,
+  0x10, 0x23, 0x23, 0x43, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x50, 0xc7, 0x4d,
+  0x89, 0x23, 0x23, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x22,
+  0x11, 0x23, 0x23, 0x06, 0x3d, 0x05, 0x82, 0x65, 0x34, 0x62, 0x10, 0xa3, 0x1a, 0x01, 0x4a, 0xc7,
+  0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x2b, 0x84, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x06, 0x3d, 0x42, 0x61, 0x08, 0x85, 0x23, 0x23, 0xc4, 0x2b, 0xc4, 0x2b, 0x22, 0x1a, 0x41, 0x08,
+  0x23, 0x23, 0x51, 0xc7, 0x4d, 0x84, 0x23, 0x23, 0x61, 0x08, 0x22, 0x11, 0x23, 0x23, 0x65, 0x34,
+  0x4a, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08, 0x01, 0x4a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61,
+  0x08, 0x2b, 0x80, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x87, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x61,
+  0x08, 0x41, 0x08, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x0c, 0x54, 0xc7, 0x4d, 0x82, 0xa3, 0x1a,
+  0x61, 0x08, 0xc4, 0x2b, 0x4c, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x2b, 0x82, 0x61, 0x08, 0xc7, 0x4d,
+  0x06, 0x3d, 0x44, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0xa3, 0x1a, 0x62, 0x10,
+  0x41, 0x08, 0xa2, 0x11, 0x0d, 0x51, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x62, 0x10, 0x00, 0x00, 0x61,
+  0x08, 0x4c, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2b, 0x82, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x45,
+  0xc7, 0x4d, 0x83, 0xa3, 0x1a, 0x62, 0x10, 0x65, 0x34, 0x62, 0x10, 0x42, 0x61, 0x08, 0x80, 0xc4,
+  0x2b, 0x12, 0x49, 0xc7, 0x4d, 0x85, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0xc1, 0x10, 0x61, 0x08,
+  0x65, 0x34, 0x4b, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2b, 0x83, 0x61, 0x08, 0x65, 0x34, 0x62, 0x10,
+  0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x8b, 0x23, 0x23, 0x22, 0x1a, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d,
+  0x62, 0x10, 0x23, 0x23, 0x23, 0x23, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x10, 0x47,
+  0xc7, 0x4d, 0x87, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x06, 0x3d, 0x61,
+  0x08, 0xa2, 0x11, 0x4a, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x2b, 0x90, 0x61, 0x08, 0x06,
+  0x3d, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x41, 0x08, 0xa2,
+  0x11, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x11, 0x42,
+  0x61, 0x08, 0x80, 0xc4, 0x2b, 0x0f, 0x44, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x22, 0x11, 0x61, 0x08,
+  0x61, 0x08, 0xc4, 0x2b, 0x02, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x49, 0xc7, 0x4d, 0x81,
+  0x22, 0x11, 0x21, 0x08, 0x2b, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x61, 0x08, 0x22, 0x1a, 0x42, 0xc7,
+  0x4d, 0x86, 0xc4, 0x2b, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x23, 0x23,
+  0x42, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x22, 0x11, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a,
+  0x06, 0x3d, 0x0c, 0x42, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0xa3,
+  0x1a, 0x06, 0x3d, 0x03, 0x82, 0xa3, 0x1a, 0x41, 0x08, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x83, 0xc4,
+  0x2b, 0x61, 0x08, 0xa2, 0x11, 0x61, 0x08, 0x2a, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0xa3, 0x1a, 0x61,
+  0x08, 0x42, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc4, 0x2b, 0x61,
+  0x08, 0x23, 0x23, 0x44, 0xc7, 0x4d, 0x00, 0x88, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10,
+  0x61, 0x08, 0x22, 0x1a, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d, 0x07, 0x86, 0x65, 0x34, 0xa3, 0x1a,
+  0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0xa2, 0x11, 0x06, 0x3d, 0x05, 0x82, 0x06, 0x3d, 0x61, 0x08,
+  0xc1, 0x10, 0x47, 0xc7, 0x4d, 0x84, 0x65, 0x34, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08,
+  0x2a, 0x84, 0x62, 0x10, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x85,
+  0x22, 0x11, 0xc1, 0x10, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x01, 0x45, 0xc7, 0x4d,
+  0x87, 0x65, 0x34, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08, 0x61, 0x08, 0x62,
+  0x10, 0x45, 0x61, 0x08, 0x85, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x06,
+  0x3d, 0x07, 0x83, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x86, 0x23,
+  0x23, 0x62, 0x10, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x29, 0x84, 0x41,
+  0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x85, 0xa3, 0x1a, 0x61,
+  0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0xa2, 0x11, 0x03, 0x46, 0xc7, 0x4d, 0x83, 0x06, 0x3d,
+  0x65, 0x34, 0xa3, 0x1a, 0x22, 0x11, 0x45, 0x61, 0x08, 0x83, 0x22, 0x11, 0xa3, 0x1a, 0xc4, 0x2b,
+  0x06, 0x3d, 0x0a, 0x8c, 0xc7, 0x4d, 0xa3, 0x1a, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0xa3, 0x1a,
+  0x23, 0x23, 0x23, 0x23, 0x22, 0x1a, 0x61, 0x08, 0x41, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x42, 0xc7,
+  0x4d, 0x80, 0x62, 0x10, 0x2a, 0x8c, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x61, 0x08, 0xc1, 0x10,
+  0x05, 0x5f, 0xc7, 0x4d, 0x83, 0x62, 0x10, 0x20, 0x00, 0x62, 0x10, 0x62, 0x10, 0x43, 0x61, 0x08,
+  0x81, 0xa2, 0x11, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x2a, 0x8c, 0x61, 0x08, 0x65,
+  0x34, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x65,
+  0x34, 0xa3, 0x1a, 0x62, 0x10, 0x61, 0x08, 0x08, 0x5b, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10,
+  0x62, 0x10, 0x44, 0x06, 0x3d, 0x46, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x2a, 0x8b, 0x61,
+  0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x23, 0x23, 0x23, 0x23, 0x62, 0x10, 0x06,
+  0x3d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x09, 0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x58, 0xc7, 0x4d,
+  0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x48, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x22, 0x1a, 0xc7,
+  0x4d, 0x23, 0x23, 0x21, 0x08, 0x2a, 0x8b, 0x41, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x23,
+  0x23, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x62, 0x10, 0x09,
+  0x82, 0x23, 0x23, 0x62, 0x10, 0x65, 0x34, 0x09, 0x4d, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08,
+  0x4a, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x2b, 0x8b, 0x62, 0x10,
+  0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d,
+  0xa3, 0x1a, 0x61, 0x08, 0x06, 0x3d, 0x08, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x08, 0x4d,
+  0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0x47, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x65, 0x34, 0x65, 0x34, 0x41, 0x08, 0x2c, 0x81, 0x62, 0x10, 0x06,
+  0x3d, 0x42, 0xc7, 0x4d, 0x85, 0x22, 0x1a, 0x22, 0x11, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x65,
+  0x34, 0x08, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0xc4, 0x2b, 0x07, 0x4d, 0xc7, 0x4d, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x87,
+  0x65, 0x34, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0xa3, 0x1a, 0xc4, 0x2b, 0x41, 0x08,
+  0x2d, 0x89, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08,
+  0xc1, 0x10, 0x41, 0x08, 0x23, 0x23, 0x08, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x4d,
+  0xc7, 0x4d, 0x93, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4,
+  0x2b, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0xc1, 0x10, 0xa3, 0x1a, 0x21, 0x08, 0x2e, 0x84, 0x41, 0x08, 0x61,
+  0x08, 0xc4, 0x2b, 0x06, 0x3d, 0x61, 0x08, 0x42, 0x00, 0x00, 0x80, 0x22, 0x1a, 0x08, 0x82, 0x06,
+  0x3d, 0x62, 0x10, 0xa2, 0x11, 0x04, 0x4f, 0xc7, 0x4d, 0x89, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x85, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x11, 0x31, 0x81,
+  0x21, 0x08, 0x41, 0x08, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x10, 0x09, 0x80, 0x61, 0x08,
+  0x03, 0x51, 0xc7, 0x4d, 0x85, 0x62, 0x10, 0xa2, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x41,
+  0x08, 0x01, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x06, 0x3d, 0xc7,
+  0x4d, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0x35, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x09,
+  0x80, 0xc1, 0x10, 0x02, 0x52, 0xc7, 0x4d, 0x83, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08,
+  0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x84, 0x62, 0x10, 0x06, 0x3d,
+  0xc7, 0x4d, 0x61, 0x08, 0x21, 0x08, 0x36, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x09, 0x81,
+  0x22, 0x1a, 0x61, 0x08, 0x01, 0x53, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x44, 0x00, 0x00,
+  0x88, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x06, 0x3d, 0x65,
+  0x34, 0x41, 0x08, 0x37, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x08, 0x82, 0xc4,
+  0x2b, 0x41, 0x08, 0x23, 0x23, 0x54, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x45, 0x00, 0x00, 0x87, 0x61,
+  0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x06, 0x3d, 0x61, 0x08, 0x39,
+  0x82, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x08, 0x82, 0x65, 0x34, 0x61, 0x08, 0x22, 0x11, 0x02,
+  0x50, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x45, 0x00, 0x00, 0x86, 0x21, 0x08, 0x65, 0x34,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x3a, 0x82, 0x00, 0x00, 0x20, 0x00,
+  0x22, 0x1a, 0x09, 0x81, 0x61, 0x08, 0x61, 0x08, 0x53, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x62, 0x10,
+  0x41, 0x08, 0x45, 0x00, 0x00, 0x83, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x3c, 0x82,
+  0x00, 0x00, 0x00, 0x00, 0xc1, 0x10, 0x09, 0x82, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x06, 0x4a,
+  0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0xc4, 0x2b, 0x06, 0x83, 0x22, 0x11, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x61, 0x08, 0x3c, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x09, 0x82, 0xa3, 0x1a, 0x21,
+  0x08, 0x23, 0x23, 0x05, 0x4a, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xc7, 0x4d,
+  0xc4, 0x2b, 0x41, 0x08, 0x04, 0x83, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x3c, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08,
+  0x50, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x44, 0x00, 0x00, 0x83, 0x62, 0x10, 0x06, 0x3d, 0xa3, 0x1a, 0x21, 0x08, 0x3c, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x09, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x04, 0x49,
+  0xc7, 0x4d, 0x82, 0x22, 0x11, 0x41, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x84, 0x22, 0x1a, 0x20,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x01, 0x81, 0x61, 0x08, 0x62, 0x10, 0x3d, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x1a, 0x09, 0x82, 0x22, 0x11, 0x41, 0x08, 0xc4, 0x2b, 0x03,
+  0x49, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x41, 0x08, 0x22, 0x1a, 0x43, 0xc7, 0x4d, 0x85, 0xc4, 0x2b,
+  0x41, 0x08, 0x22, 0x11, 0x23, 0x23, 0x22, 0x1a, 0x41, 0x08, 0x3f, 0x00, 0x42, 0x00, 0x00, 0x80,
+  0x61, 0x08, 0x09, 0x82, 0xc4, 0x2b, 0x41, 0x08, 0x22, 0x11, 0x4c, 0xc7, 0x4d, 0x82, 0xc4, 0x2b,
+  0x61, 0x08, 0xc1, 0x10, 0x44, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x62, 0x10, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x0a, 0x82, 0x61,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x48, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0xa3, 0x1a, 0x01, 0x44,
+  0xc7, 0x4d, 0x84, 0x61, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x01, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x09, 0x82, 0x22, 0x1a, 0x21, 0x08, 0xa3, 0x1a,
+  0x02, 0x51, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x21,
+  0x08, 0x3f, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa3, 0x1a, 0x09, 0x83, 0x06, 0x3d,
+  0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x51, 0xc7, 0x4d, 0x85, 0xc1, 0x10, 0x61, 0x08, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x3f, 0x00, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0a,
+  0x81, 0x22, 0x11, 0x21, 0x08, 0x03, 0x50, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x3f, 0x00, 0x42, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x09, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34, 0x0b, 0x46, 0xc7, 0x4d, 0x85, 0x61,
+  0x08, 0x22, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0x21, 0x08, 0x3f, 0x00, 0x42, 0x00, 0x00,
+  0x81, 0x41, 0x08, 0xc4, 0x2b, 0x0a, 0x83, 0xa3, 0x1a, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x09,
+  0x47, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0xa2, 0x11, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x3f, 0x02,
+  0x42, 0x00, 0x00, 0x80, 0x22, 0x11, 0x0c, 0x82, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x08, 0x46,
+  0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x3f,
+  0x02, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0b, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0xc1,
+  0x10, 0x0f, 0x84, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x03, 0x42,
+  0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x85, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x20,
+  0x00, 0xc1, 0x10, 0x06, 0x3d, 0x0d, 0x83, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x3f,
+  0x04, 0x42, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x0b, 0x85, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x0b, 0x82, 0x65, 0x34, 0x61, 0x08, 0xc1, 0x10, 0x01,
+  0x81, 0x22, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0c,
+  0x85, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x61, 0x08, 0xc4, 0x2b, 0x0a, 0x82, 0xc1,
+  0x10, 0x21, 0x08, 0x23, 0x23, 0x01, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x21, 0x08, 0x7f, 0x00, 0x00,
+  0x02, 0x42, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0b, 0x87, 0xc7, 0x4d, 0xc7, 0x4d, 0x06,
+  0x3d, 0xc1, 0x10, 0x41, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x07, 0x83, 0x23, 0x23, 0x41,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x3f,
+  0x01, 0x42, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x0c, 0x42, 0xc7, 0x4d, 0x85, 0xa3, 0x1a,
+  0x62, 0x10, 0x20, 0x00, 0x62, 0x10, 0x22, 0x1a, 0x65, 0x34, 0x03, 0x84, 0x06, 0x3d, 0xc4, 0x2b,
+  0x62, 0x10, 0x41, 0x08, 0x23, 0x23, 0x02, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x7f, 0x00, 0x00,
+  0x01, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0d, 0x42, 0xc7, 0x4d, 0x83, 0x65, 0x34, 0x61, 0x08,
+  0x21, 0x08, 0x00, 0x00, 0x44, 0x61, 0x08, 0x83, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a,
+  0x03, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x81, 0x41,
+  0x08, 0xc4, 0x2b, 0x0c, 0x43, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x45, 0x00, 0x00, 0x82,
+  0x61, 0x08, 0xc1, 0x10, 0x65, 0x34, 0x04, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x02, 0x43, 0x00, 0x00, 0x80, 0x61, 0x08, 0x0d, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x45, 0x00,
+  0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x42, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00,
+  0x02, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0d, 0x42, 0xc7, 0x4d, 0x80, 0xc1, 0x10,
+  0x45, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x04, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x7f,
+  0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x0c, 0x43, 0xc7, 0x4d, 0x81,
+  0xa3, 0x1a, 0x20, 0x00, 0x45, 0x00, 0x00, 0x80, 0x22, 0x11, 0x04, 0x43, 0xc7, 0x4d, 0x80, 0x62,
+  0x10, 0x7f, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x0b, 0x43, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x03, 0x42,
+  0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x03, 0x43, 0x00, 0x00, 0x81, 0x41,
+  0x08, 0x23, 0x23, 0x0b, 0x44, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x45, 0x00, 0x00, 0x81, 0x41, 0x08,
+  0x65, 0x34, 0x02, 0x43, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00,
+  0x80, 0x61, 0x08, 0x0b, 0x44, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x01, 0x44, 0x00, 0x00, 0x80, 0x22,
+  0x1a, 0x01, 0x43, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x44, 0x00,
+  0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x0a, 0x44, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x02,
+  0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x06,
+  0x44, 0x00, 0x00, 0x80, 0x22, 0x11, 0x0a, 0x44, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x04,
+  0x82, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f,
+  0x00, 0x00, 0x06, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x45, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x81, 0x65, 0x34,
+  0x62, 0x10, 0x7f, 0x00, 0x00, 0x07, 0x44, 0x00, 0x00, 0x81, 0x20, 0x00, 0x22, 0x1a, 0x09, 0x45,
+  0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x81, 0x61,
+  0x08, 0x06, 0x3d, 0x08, 0x45, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x61, 0x08, 0x02, 0x43, 0x00, 0x00,
+  0x42, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0a, 0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x08,
+  0x45, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x02, 0x7f, 0x00, 0x00, 0x11, 0x45, 0x00, 0x00,
+  0x80, 0x61, 0x08, 0x07, 0x46, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x02, 0x7f, 0x00, 0x00,
+  0x11, 0x45, 0x00, 0x00, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x05, 0x46, 0xc7, 0x4d, 0x82, 0x23, 0x23,
+  0x61, 0x08, 0x61, 0x08, 0x02, 0x7f, 0x00, 0x00, 0x12, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06,
+  0x3d, 0x03, 0x46, 0xc7, 0x4d, 0x84, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x41, 0x08,
+  0x01, 0x7f, 0x00, 0x00, 0x12, 0x45, 0x00, 0x00, 0x81, 0x20, 0x00, 0xc1, 0x10, 0x01, 0x47, 0xc7,
+  0x4d, 0x85, 0x23, 0x23, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x01, 0x7f,
+  0x00, 0x00, 0x12, 0x45, 0x00, 0x00, 0x82, 0x41, 0x08, 0x41, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d,
+  0x87, 0x65, 0x34, 0xc1, 0x10, 0x62, 0x10, 0x22, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61,
+  0x08, 0x01, 0x7f, 0x00, 0x00, 0x12, 0x44, 0x00, 0x00, 0x85, 0x61, 0x08, 0x23, 0x23, 0x61, 0x08,
+  0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0x42, 0x22, 0x11, 0x84, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x61, 0x08, 0xc4, 0x2b, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x01, 0x7f, 0x00, 0x00, 0x11, 0x44,
+  0x00, 0x00, 0x85, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x23, 0x23, 0x22, 0x11, 0x44,
+  0x61, 0x08, 0x81, 0x22, 0x11, 0xc4, 0x2b, 0x45, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x01, 0x7f, 0x00,
+  0x00, 0x10, 0x44, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x0a, 0x45, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x61, 0x08, 0x02, 0x7f, 0x00, 0x00, 0x0d, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x06, 0x3d,
+  0x05, 0x45, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0xa3, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06,
+  0x3d, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x0f, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x05,
+  0x45, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x65, 0x34, 0xa3, 0x1a,
+  0x62, 0x10, 0x20, 0x00, 0x3f, 0x0f, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x05, 0x45,
+  0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x02, 0x81, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x10, 0x45,
+  0x00, 0x00, 0x81, 0x21, 0x08, 0x22, 0x1a, 0x05, 0x45, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08,
+  0x20, 0x00, 0x3f, 0x15, 0x45, 0x00, 0x00, 0x80, 0x61, 0x08, 0x04, 0x46, 0xc7, 0x4d, 0x82, 0xc4,
+  0x2b, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x16, 0x44, 0x00, 0x00, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x03,
+  0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x18, 0x44, 0x00, 0x00, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x01, 0x45, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x3f,
+  0x1a, 0x44, 0x00, 0x00, 0x83, 0x20, 0x00, 0xc1, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0x42, 0x06, 0x3d,
+  0x83, 0xc4, 0x2b, 0x22, 0x11, 0x62, 0x10, 0x21, 0x08, 0x3f, 0x1d, 0x44, 0x00, 0x00, 0x81, 0x20,
+  0x00, 0x41, 0x08, 0x42, 0x61, 0x08, 0x81, 0x41, 0x08, 0x41, 0x08, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x28, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2c, 0x7f, 0x00, 0x00, 0x2b,
+  0x85, 0x00, 0x00, 0x20, 0x00, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x7f, 0x00, 0x00,
+  0x26, 0x82, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x82, 0x23, 0x23, 0x61, 0x08, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x1d, 0x46, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x04, 0x81, 0xa3, 0x1a,
+  0x61, 0x08, 0x42, 0x41, 0x08, 0x80, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x17, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0xa3, 0x1a, 0x07,
+  0x85, 0x06, 0x3d, 0xc4, 0x2b, 0xc4, 0x2b, 0xa3, 0x1a, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x14, 0x88,
+  0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x65, 0x34, 0x06, 0x3d, 0x65, 0x34, 0xa2, 0x11, 0x61, 0x08,
+  0xa3, 0x1a, 0x0c, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x0a, 0x81, 0x00,
+  0x00, 0x20, 0x00, 0x05, 0x83, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x13, 0x82, 0x06,
+  0x3d, 0x22, 0x11, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08,
+  0x45, 0x00, 0x00, 0x82, 0x20, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x16, 0x81, 0xc4, 0x2b, 0x62, 0x10,
+  0x7f, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x22, 0x11, 0x06, 0x3d, 0x62, 0x10, 0x43, 0x00, 0x00,
+  0x82, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x0a, 0x4d, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x7f, 0x00, 0x00, 0x06, 0x83, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x06, 0x3d, 0x43, 0x61, 0x08,
+  0x80, 0xa3, 0x1a, 0x01, 0x4a, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0xa3, 0x1a, 0xc4, 0x2b, 0x4b, 0xc7,
+  0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x06, 0x80, 0x06, 0x3d, 0x02, 0x81, 0x06,
+  0x3d, 0x06, 0x3d, 0x02, 0x85, 0xc7, 0x4d, 0x06, 0x3d, 0xa3, 0x1a, 0x22, 0x1a, 0xc4, 0x2b, 0x06,
+  0x3d, 0x43, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0x21, 0x08, 0x61,
+  0x08, 0x06, 0x3d, 0x03, 0x46, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x7f, 0x00,
+  0x00, 0x03, 0x81, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x82, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x42,
+  0x61, 0x08, 0x84, 0x62, 0x10, 0xc1, 0x10, 0x23, 0x23, 0x65, 0x34, 0x22, 0x11, 0x43, 0x61, 0x08,
+  0x83, 0x62, 0x10, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x8a, 0x06, 0x3d, 0xc4,
+  0x2b, 0x23, 0x23, 0x23, 0x23, 0x65, 0x34, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0xc1,
+  0x10, 0x41, 0x08, 0x3f, 0x0a, 0x8c, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34,
+  0x06, 0x3d, 0xc4, 0x2b, 0xa3, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0x06, 0x3d,
+  0x02, 0x8d, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08,
+  0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x42, 0xc7,
+  0x4d, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x3f, 0x01, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d,
+  0x82, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x0d, 0x80, 0x23, 0x23, 0x42, 0x61, 0x08, 0x81, 0x23,
+  0x23, 0x65, 0x34, 0x02, 0x83, 0xa3, 0x1a, 0x61, 0x08, 0x21, 0x08, 0xa3, 0x1a, 0x01, 0x81, 0x06,
+  0x3d, 0x62, 0x10, 0x3f, 0x02, 0x81, 0x62, 0x10, 0x65, 0x34, 0x43, 0xc7, 0x4d, 0x83, 0x06, 0x3d,
+  0x22, 0x11, 0x61, 0x08, 0x23, 0x23, 0x0f, 0x81, 0x06, 0x3d, 0xc4, 0x2b, 0x06, 0x82, 0xa2, 0x11,
+  0x20, 0x00, 0x61, 0x08, 0x02, 0x81, 0xa2, 0x11, 0x20, 0x00, 0x3f, 0x00, 0x89, 0x00, 0x00, 0x21,
+  0x08, 0x61, 0x08, 0x22, 0x11, 0xc4, 0x2b, 0x65, 0x34, 0xa3, 0x1a, 0x61, 0x08, 0x61, 0x08, 0xa3,
+  0x1a, 0x19, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x3f, 0x05, 0x82, 0x20, 0x00, 0x22, 0x11,
+  0x61, 0x08, 0x42, 0x41, 0x08, 0x82, 0x20, 0x00, 0x61, 0x08, 0xa3, 0x1a, 0x5a, 0xc7, 0x4d, 0x82,
+  0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x3f, 0x05, 0x89, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xa3,
+  0x1a, 0x41, 0x08, 0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0xc7, 0x4d, 0x06, 0x3d, 0x59, 0xc7, 0x4d,
+  0x82, 0xa2, 0x11, 0x41, 0x08, 0xa3, 0x1a, 0x03, 0x80, 0x61, 0x08, 0x3f, 0x01, 0x89, 0x23, 0x23,
+  0xc7, 0x4d, 0x61, 0x08, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0x65, 0x34, 0xc1, 0x10, 0x62, 0x10,
+  0xc1, 0x10, 0x0b, 0x83, 0x23, 0x23, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0x06, 0x83, 0xc7, 0x4d,
+  0xa3, 0x1a, 0x62, 0x10, 0xc1, 0x10, 0x04, 0x80, 0xc1, 0x10, 0x3f, 0x01, 0x86, 0x61, 0x08, 0x23,
+  0x23, 0x41, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x42, 0x61, 0x08, 0x0b, 0x84,
+  0x23, 0x23, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x05, 0x83, 0x65, 0x34, 0x61, 0x08,
+  0x61, 0x08, 0xc4, 0x2b, 0x44, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x3f, 0x01, 0x89, 0x21, 0x08, 0x61,
+  0x08, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0x23, 0x23, 0x22, 0x1a, 0x65, 0x34, 0x65, 0x34, 0x06,
+  0x3d, 0x0c, 0x83, 0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0xa2, 0x11, 0x05, 0x84, 0xc4, 0x2b, 0x65,
+  0x34, 0x22, 0x11, 0x62, 0x10, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x3f, 0x02, 0x81,
+  0x00, 0x00, 0xc1, 0x10, 0x02, 0x51, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0xa3, 0x1a, 0x23, 0x23, 0x05,
+  0x89, 0x22, 0x1a, 0x61, 0x08, 0x22, 0x1a, 0xa3, 0x1a, 0x61, 0x08, 0x22, 0x11, 0x06, 0x3d, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x3f, 0x01, 0x82, 0x00, 0x00, 0x61, 0x08, 0x65, 0x34, 0x01, 0x82,
+  0xc7, 0x4d, 0x06, 0x3d, 0x06, 0x3d, 0x59, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x22, 0x1a, 0xc1, 0x10,
+  0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x3f, 0x02, 0x81, 0x00, 0x00, 0x61,
+  0x08, 0x02, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10, 0x04, 0x82, 0xc7, 0x4d, 0x65, 0x34, 0x06,
+  0x3d, 0x04, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0xa2, 0x11, 0x09, 0x88, 0x22, 0x1a, 0x22, 0x1a, 0xc4,
+  0x2b, 0x61, 0x08, 0x23, 0x23, 0xc1, 0x10, 0x61, 0x08, 0x65, 0x34, 0x62, 0x10, 0x3f, 0x01, 0x81,
+  0x41, 0x08, 0x23, 0x23, 0x02, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0xa3, 0x1a, 0x02, 0x83,
+  0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x03, 0x84, 0xc7, 0x4d, 0x22, 0x1a, 0x21, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x07, 0x89, 0xc7, 0x4d, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0xc4, 0x2b,
+  0x61, 0x08, 0x23, 0x23, 0xa2, 0x11, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x02, 0x80, 0x06, 0x3d, 0x02,
+  0x83, 0x65, 0x34, 0x41, 0x08, 0x00, 0x00, 0x22, 0x1a, 0x02, 0x83, 0xc7, 0x4d, 0xc1, 0x10, 0x21,
+  0x08, 0xa3, 0x1a, 0x03, 0x84, 0xc7, 0x4d, 0x61, 0x08, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x07,
+  0x88, 0x06, 0x3d, 0x65, 0x34, 0x06, 0x3d, 0x22, 0x11, 0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0xc4,
+  0x2b, 0xc1, 0x10, 0x3f, 0x02, 0x80, 0x62, 0x10, 0x03, 0x83, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08,
+  0x23, 0x23, 0x01, 0x84, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x06, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x07, 0x88, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xa2, 0x11,
+  0x61, 0x08, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x3f, 0x02, 0x80, 0x62, 0x10, 0x04, 0x88, 0xa3,
+  0x1a, 0x22, 0x11, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0xc4,
+  0x2b, 0x05, 0x83, 0x22, 0x11, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x07, 0x88, 0xc7, 0x4d, 0x65,
+  0x34, 0x61, 0x08, 0x62, 0x10, 0x23, 0x23, 0x22, 0x11, 0xc1, 0x10, 0xa3, 0x1a, 0x21, 0x08, 0x3f,
+  0x02, 0x80, 0x62, 0x10, 0x08, 0x83, 0xc7, 0x4d, 0x22, 0x11, 0x41, 0x08, 0x22, 0x1a, 0x06, 0x83,
+  0x06, 0x3d, 0xc1, 0x10, 0x22, 0x11, 0x06, 0x3d, 0x08, 0x87, 0x22, 0x1a, 0x65, 0x34, 0xa3, 0x1a,
+  0x61, 0x08, 0xc4, 0x2b, 0x22, 0x11, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x02, 0x80, 0x61, 0x08, 0x07,
+  0x83, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x22, 0x11, 0x14, 0x86, 0x23, 0x23, 0x61, 0x08, 0x06,
+  0x3d, 0xc4, 0x2b, 0x23, 0x23, 0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x07, 0x82,
+  0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x56, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x06, 0x3d, 0x01, 0x81,
+  0x22, 0x1a, 0x20, 0x00, 0x3f, 0x03, 0x80, 0x61, 0x08, 0x08, 0x82, 0x61, 0x08, 0x62, 0x10, 0x06,
+  0x3d, 0x19, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x3f, 0x0d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x3f, 0x2b,
+  0x82, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x06, 0x52, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08,
+  0x3f, 0x03, 0x80, 0x65, 0x34, 0x02, 0x46, 0xc7, 0x4d, 0x80, 0x06, 0x3d, 0x07, 0x81, 0x65, 0x34,
+  0x06, 0x3d, 0x50, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x3f, 0x03, 0x80, 0xc4, 0x2b, 0x01,
+  0x81, 0xc7, 0x4d, 0xc4, 0x2b, 0x0a, 0x43, 0xc7, 0x4d, 0x82, 0xa3, 0x1a, 0x61, 0x08, 0x65, 0x34,
+  0x4f, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x3f, 0x03, 0x85, 0xa2, 0x11, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x62, 0x10, 0xc4, 0x2b, 0x4a, 0xc7, 0x4d, 0x86, 0x65, 0x34, 0xa3, 0x1a, 0xc1,
+  0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x0d, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x3f,
+  0x04, 0x89, 0x61, 0x08, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08,
+  0xc1, 0x10, 0x22, 0x11, 0x22, 0x1a, 0x42, 0xa3, 0x1a, 0x8b, 0x22, 0x1a, 0x22, 0x11, 0x61, 0x08,
+  0x61, 0x08, 0xc1, 0x10, 0x22, 0x1a, 0xc4, 0x2b, 0x06, 0x3d, 0x22, 0x1a, 0x20, 0x00, 0x62, 0x10,
+  0x06, 0x3d, 0x07, 0x44, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x61, 0x08, 0x3f, 0x04, 0x88, 0x41, 0x08,
+  0xc4, 0x2b, 0x65, 0x34, 0x41, 0x08, 0x62, 0x10, 0xa3, 0x1a, 0x06, 0x3d, 0x06, 0x3d, 0x65, 0x34,
+  0x44, 0xc4, 0x2b, 0x81, 0x06, 0x3d, 0x06, 0x3d, 0x01, 0x86, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x65, 0x34, 0x07, 0x85, 0xc7, 0x4d, 0xa2, 0x11, 0x22, 0x11,
+  0x22, 0x11, 0x61, 0x08, 0x41, 0x08, 0x3f, 0x06, 0x82, 0x61, 0x08, 0xc7, 0x4d, 0xa2, 0x11, 0x42,
+  0x61, 0x08, 0x81, 0xa2, 0x11, 0x65, 0x34, 0x48, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x62,
+  0x10, 0xa3, 0x1a, 0xc1, 0x10, 0x61, 0x08, 0x07, 0x82, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x3f,
+  0x0a, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x02, 0x85, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x61, 0x08,
+  0x22, 0x11, 0xa3, 0x1a, 0x43, 0xc4, 0x2b, 0x84, 0x22, 0x1a, 0x61, 0x08, 0x62, 0x10, 0xc1, 0x10,
+  0x65, 0x34, 0x01, 0x80, 0x06, 0x3d, 0x07, 0x81, 0xc7, 0x4d, 0x61, 0x08, 0x3f, 0x0c, 0x80, 0x61,
+  0x08, 0x45, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0xa3, 0x1a, 0x22, 0x11, 0x44, 0x61, 0x08, 0x81, 0x22,
+  0x1a, 0x65, 0x34, 0x0b, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08, 0x3f, 0x0c, 0x81, 0x21, 0x08,
+  0xa2, 0x11, 0x5a, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x61, 0x08, 0x3f, 0x0e, 0x81, 0x61, 0x08, 0xc4,
+  0x2b, 0x58, 0xc7, 0x4d, 0x81, 0x65, 0x34, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x10, 0x81, 0x62, 0x10,
+  0x65, 0x34, 0x56, 0xc7, 0x4d, 0x83, 0xc4, 0x2b, 0x62, 0x10, 0x21, 0x08, 0x20, 0x00, 0x7f, 0x00,
+  0x00, 0x10, 0x81, 0x62, 0x10, 0xc4, 0x2b, 0x54, 0xc7, 0x4d, 0x85, 0xa3, 0x1a, 0x61, 0x08, 0x22,
+  0x11, 0x61, 0x08, 0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x10, 0x82, 0x41, 0x08, 0xa2, 0x11,
+  0x06, 0x3d, 0x51, 0xc7, 0x4d, 0x87, 0xa2, 0x11, 0x22, 0x11, 0x06, 0x3d, 0xc1, 0x10, 0x61, 0x08,
+  0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x10, 0x82, 0x20, 0x00, 0x62, 0x10, 0xa3,
+  0x1a, 0x4f, 0xc7, 0x4d, 0x85, 0xc4, 0x2b, 0x65, 0x34, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x23,
+  0x23, 0x01, 0x81, 0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00, 0x83, 0x20,
+  0x00, 0x62, 0x10, 0xc1, 0x10, 0xc4, 0x2b, 0x4e, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x61,
+  0x08, 0x06, 0x3d, 0x01, 0x82, 0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x42,
+  0x00, 0x00, 0x80, 0x21, 0x08, 0x42, 0x61, 0x08, 0x82, 0x62, 0x10, 0x22, 0x11, 0x65, 0x34, 0x4a,
+  0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x65, 0x34, 0x01, 0x83, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x06, 0x3d, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08,
+  0xa3, 0x1a, 0x01, 0x87, 0x22, 0x1a, 0x21, 0x08, 0x00, 0x00, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x61, 0x08, 0xa2, 0x11, 0x02, 0x42, 0xc7, 0x4d, 0x83, 0x23, 0x23, 0x62, 0x10, 0x62, 0x10, 0x65,
+  0x34, 0x02, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00,
+  0x0a, 0x42, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x03, 0x8f, 0xc4, 0x2b, 0x62, 0x10, 0x21,
+  0x08, 0x61, 0x08, 0xa2, 0x11, 0xa3, 0x1a, 0x22, 0x1a, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x21, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x02, 0x42, 0xc7, 0x4d, 0x83,
+  0x61, 0x08, 0x21, 0x08, 0x23, 0x23, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x09, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0x08, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x8b, 0x23, 0x23, 0x61, 0x08, 0x41, 0x08, 0x61,
+  0x08, 0x61, 0x08, 0xc1, 0x10, 0xc1, 0x10, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 0x62, 0x10, 0xa3,
+  0x1a, 0x03, 0x42, 0xc7, 0x4d, 0x85, 0xa3, 0x1a, 0x41, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x41, 0x08, 0x7f, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x49, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x43, 0x61, 0x08, 0x81, 0xc1, 0x10, 0xc4, 0x2b, 0x04, 0x42, 0xc7,
+  0x4d, 0x83, 0x65, 0x34, 0x61, 0x08, 0x21, 0x08, 0x23, 0x23, 0x01, 0x81, 0x22, 0x1a, 0x21, 0x08,
+  0x7f, 0x00, 0x00, 0x06, 0x84, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x22, 0x1a, 0x57,
+  0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x03, 0x81, 0x22, 0x11, 0x20,
+  0x00, 0x7f, 0x00, 0x00, 0x05, 0x85, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc1, 0x10, 0x41, 0x08,
+  0xa3, 0x1a, 0x55, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d,
+  0x04, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x04, 0x81, 0x41, 0x08, 0xa3, 0x1a, 0x02, 0x83, 0x61,
+  0x08, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x52, 0xc7, 0x4d, 0x00, 0x83, 0x61, 0x08, 0x00, 0x00,
+  0x62, 0x10, 0x65, 0x34, 0x05, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x7f, 0x00, 0x00, 0x03, 0x80, 0xc1,
+  0x10, 0x44, 0xc7, 0x4d, 0x83, 0xa2, 0x11, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x08, 0x47, 0xc7,
+  0x4d, 0x84, 0x65, 0x34, 0x62, 0x10, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34, 0x07, 0x81, 0x65, 0x34,
+  0x61, 0x08, 0x7f, 0x00, 0x00, 0x01, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x80, 0x65, 0x34, 0x01,
+  0x80, 0x65, 0x34, 0x07, 0x45, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0xc1, 0x10, 0x41, 0x08, 0x20, 0x00,
+  0x61, 0x08, 0x06, 0x3d, 0x09, 0x81, 0x23, 0x23, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x81, 0x41, 0x08,
+  0xc4, 0x2b, 0x47, 0xc7, 0x4d, 0x82, 0x22, 0x1a, 0x61, 0x08, 0x65, 0x34, 0x07, 0x89, 0xc7, 0x4d,
+  0x06, 0x3d, 0x23, 0x23, 0x22, 0x1a, 0x22, 0x11, 0x61, 0x08, 0x41, 0x08, 0x21, 0x08, 0x62, 0x10,
+  0xa2, 0x11, 0x0c, 0x81, 0xc1, 0x10, 0x20, 0x00, 0x3d, 0x81, 0x20, 0x00, 0x22, 0x11, 0x48, 0xc7,
+  0x4d, 0x82, 0x22, 0x11, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x87, 0x65, 0x34, 0x61, 0x08, 0x00, 0x00,
+  0x21, 0x08, 0x41, 0x08, 0x62, 0x10, 0x22, 0x11, 0xc4, 0x2b, 0x0e, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x7d, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x48, 0xc7, 0x4d, 0x00, 0x80, 0x62, 0x10, 0x07,
+  0x85, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0xc1, 0x10, 0x23, 0x23, 0x06, 0x3d, 0x12, 0x81, 0x65,
+  0x34, 0x61, 0x08, 0x3b, 0x84, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x05,
+  0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x07, 0x83, 0xc7, 0x4d, 0x22, 0x1a, 0x62, 0x10, 0x06,
+  0x3d, 0x15, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x3a, 0x84, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x65,
+  0x34, 0xc1, 0x10, 0x05, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0x07, 0x82, 0xc7, 0x4d, 0xc1,
+  0x10, 0x62, 0x10, 0x3f, 0x12, 0x85, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11,
+  0x22, 0x11, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x07, 0x82, 0xc7, 0x4d, 0x61, 0x08,
+  0x61, 0x08, 0x17, 0x81, 0x65, 0x34, 0x61, 0x08, 0x38, 0x85, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0x05, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x07, 0x82,
+  0xc7, 0x4d, 0x61, 0x08, 0x22, 0x11, 0x18, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x36, 0x86, 0x61, 0x08,
+  0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x05, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0xa2, 0x11, 0x07, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0x22, 0x1a, 0x18, 0x81, 0xc7, 0x4d,
+  0x61, 0x08, 0x36, 0x80, 0x61, 0x08, 0x42, 0xc7, 0x4d, 0x08, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x22,
+  0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a, 0x18, 0x82, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0x34, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x01, 0x80, 0x23, 0x23, 0x05, 0x82,
+  0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x23, 0x23, 0x19, 0x82,
+  0xc7, 0x4d, 0x22, 0x11, 0x20, 0x00, 0x33, 0x80, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x01, 0x80, 0xa3,
+  0x1a, 0x05, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4,
+  0x2b, 0x19, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x32, 0x81, 0x41, 0x08, 0x23, 0x23, 0x43,
+  0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x1a, 0x05, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3,
+  0x1a, 0x07, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x1a, 0x82, 0xc7, 0x4d, 0x22, 0x1a, 0x20,
+  0x00, 0x31, 0x80, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0x22, 0x11, 0x05,
+  0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x07, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x04,
+  0x81, 0xc4, 0x2b, 0x65, 0x34, 0x13, 0x82, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x30, 0x81, 0x21,
+  0x08, 0xa3, 0x1a, 0x45, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x06, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23,
+  0x23, 0x07, 0x82, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0x04, 0x82, 0x06, 0x3d, 0xa2, 0x11, 0xc4,
+  0x2b, 0x54, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x21, 0x08, 0x2f, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x45,
+  0xc7, 0x4d, 0x81, 0x61, 0x08, 0x61, 0x08, 0x05, 0x82, 0x65, 0x34, 0x62, 0x10, 0x23, 0x23, 0x10,
+  0x82, 0x06, 0x3d, 0x61, 0x08, 0xc4, 0x2b, 0x53, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x2e,
+  0x81, 0x20, 0x00, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x81, 0xa2, 0x11, 0x61, 0x08, 0x45, 0xc7, 0x4d,
+  0x00, 0x81, 0x62, 0x10, 0x23, 0x23, 0x09, 0x80, 0xc4, 0x2b, 0x06, 0x82, 0x65, 0x34, 0x61, 0x08,
+  0x65, 0x34, 0x53, 0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x20, 0x00, 0x2d, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x46, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x62, 0x10, 0x45, 0xc7, 0x4d, 0x00, 0x81, 0x62, 0x10, 0x23,
+  0x23, 0x07, 0x80, 0x06, 0x3d, 0x09, 0x82, 0x23, 0x23, 0x61, 0x08, 0x65, 0x34, 0x52, 0xc7, 0x4d,
+  0x81, 0x06, 0x3d, 0x62, 0x10, 0x2d, 0x80, 0x22, 0x11, 0x47, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0x06, 0x3d, 0x05, 0x81, 0x62, 0x10, 0xa3, 0x1a, 0x09, 0x80, 0xc4, 0x2b, 0x08, 0x82, 0xa2,
+  0x11, 0x61, 0x08, 0x65, 0x34, 0x52, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x2c, 0x81, 0x61, 0x08, 0x65,
+  0x34, 0x47, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0x04, 0x82, 0x06, 0x3d, 0x61,
+  0x08, 0xa3, 0x1a, 0x09, 0x80, 0x23, 0x23, 0x09, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x0f,
+  0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x2b, 0x80, 0x61, 0x08, 0x49, 0xc7, 0x4d,
+  0x81, 0x61, 0x08, 0x22, 0x1a, 0x44, 0xc7, 0x4d, 0x01, 0x80, 0x22, 0x1a, 0x07, 0x82, 0x06, 0x3d,
+  0x62, 0x10, 0xa3, 0x1a, 0x09, 0x82, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x52, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x2a, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x49, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x61, 0x08,
+  0x44, 0xc7, 0x4d, 0x0b, 0x81, 0x61, 0x08, 0x22, 0x11, 0x4a, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0x22, 0x11, 0x51, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08, 0x29, 0x80, 0x61, 0x08, 0x4a,
+  0xc7, 0x4d, 0x81, 0x22, 0x1a, 0x62, 0x10, 0x44, 0xc7, 0x4d, 0x0b, 0x81, 0x61, 0x08, 0x61, 0x08,
+  0x4b, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x62, 0x10, 0x22, 0x1a, 0x0e, 0x42, 0xc7, 0x4d, 0x80, 0x62,
+  0x10, 0x28, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x4a, 0xc7, 0x4d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x65,
+  0x34, 0x0f, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x4c, 0xc7, 0x4d, 0x80, 0x22, 0x1a, 0x10, 0x82, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x28, 0x81, 0x21, 0x08, 0x23, 0x23, 0x4a, 0xc7, 0x4d, 0x82, 0x06,
+  0x3d, 0x61, 0x08, 0xa3, 0x1a, 0x03, 0x82, 0xc7, 0x4d, 0x61, 0x08, 0xc1, 0x10, 0x08, 0x82, 0x22,
+  0x1a, 0x61, 0x08, 0x06, 0x3d, 0x0c, 0x82, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x0d, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x26, 0x82, 0x41, 0x08, 0x62, 0x10, 0x22, 0x11, 0x4a,
+  0xc7, 0x4d, 0x82, 0x23, 0x23, 0x41, 0x08, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x0a, 0x82, 0x23, 0x23,
+  0x61, 0x08, 0xc4, 0x2b, 0x0b, 0x84, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d,
+  0x0c, 0x42, 0xc7, 0x4d, 0x80, 0x62, 0x10, 0x26, 0x82, 0x61, 0x08, 0x22, 0x1a, 0x62, 0x10, 0x49,
+  0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x44, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x09, 0x82, 0x65, 0x34, 0x61, 0x08, 0xa3, 0x1a, 0x4d, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x62,
+  0x10, 0xa2, 0x11, 0x0c, 0x42, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x25, 0x84, 0x61, 0x08, 0x65, 0x34,
+  0x06, 0x3d, 0x61, 0x08, 0x22, 0x1a, 0x48, 0xc7, 0x4d, 0x84, 0xa2, 0x11, 0x20, 0x00, 0x00, 0x00,
+  0x61, 0x08, 0x06, 0x3d, 0x43, 0xc7, 0x4d, 0x00, 0x80, 0x61, 0x08, 0x08, 0x82, 0x06, 0x3d, 0x62,
+  0x10, 0xc1, 0x10, 0x4e, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x0c, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0x24, 0x85, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2,
+  0x11, 0x61, 0x08, 0xa3, 0x1a, 0x46, 0xc7, 0x4d, 0x85, 0x65, 0x34, 0x61, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x41, 0x08, 0xa3, 0x1a, 0x43, 0xc7, 0x4d, 0x81, 0xc1, 0x10, 0x62, 0x10, 0x09, 0x81, 0x61,
+  0x08, 0x61, 0x08, 0x4b, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x23, 0x23, 0x61, 0x08, 0x21, 0x08, 0x41,
+  0x08, 0x62, 0x10, 0x06, 0x3d, 0x0b, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x23,
+  0x88, 0x21, 0x08, 0xa3, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x22, 0x11, 0x61, 0x08, 0x61,
+  0x08, 0x23, 0x23, 0x44, 0xc4, 0x2b, 0x80, 0x61, 0x08, 0x43, 0x00, 0x00, 0x87, 0x41, 0x08, 0x61,
+  0x08, 0xa3, 0x1a, 0xc4, 0x2b, 0x65, 0x34, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x82, 0xa3,
+  0x1a, 0x62, 0x10, 0x65, 0x34, 0x48, 0xc7, 0x4d, 0x88, 0x06, 0x3d, 0x22, 0x1a, 0x61, 0x08, 0x41,
+  0x08, 0x61, 0x08, 0xc1, 0x10, 0xc4, 0x2b, 0x62, 0x10, 0xc1, 0x10, 0x0b, 0x42, 0xc7, 0x4d, 0x80,
+  0x62, 0x10, 0x23, 0x8e, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x23, 0x23, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08,
+  0x21, 0x08, 0x42, 0x00, 0x00, 0x88, 0x20, 0x00, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x41, 0x08,
+  0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x08, 0x82, 0x06, 0x3d, 0x62, 0x10, 0xa3, 0x1a,
+  0x45, 0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0x23, 0x23, 0xc1, 0x10, 0x62, 0x10, 0x41, 0x08, 0x61, 0x08,
+  0x22, 0x1a, 0x65, 0x34, 0xc7, 0x4d, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0x23, 0x23, 0x0a, 0x42,
+  0xc7, 0x4d, 0x80, 0x61, 0x08, 0x23, 0x83, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x06, 0x3d, 0x43,
+  0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x65, 0x34, 0x61, 0x08, 0x22, 0x11, 0x65, 0x34, 0x23, 0x23, 0x41,
+  0x08, 0x42, 0x00, 0x00, 0x87, 0x41, 0x08, 0x23, 0x23, 0x06, 0x3d, 0x23, 0x23, 0x22, 0x11, 0xc1,
+  0x10, 0xa2, 0x11, 0x06, 0x3d, 0x0a, 0x82, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x01, 0x88, 0x65,
+  0x34, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x61, 0x08, 0xc4, 0x2b, 0x06,
+  0x3d, 0x02, 0x84, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x0a, 0x83, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x21, 0x84, 0x20, 0x00, 0xa3, 0x1a, 0x06, 0x3d, 0x62,
+  0x10, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x62, 0x10, 0x65,
+  0x34, 0xc7, 0x4d, 0xa3, 0x1a, 0x43, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x50, 0xc7, 0x4d,
+  0x81, 0xc4, 0x2b, 0x41, 0x08, 0x42, 0x62, 0x10, 0x85, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0xc1,
+  0x10, 0x23, 0x23, 0x06, 0x3d, 0x04, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0xc1, 0x10,
+  0x0a, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x41, 0x08, 0x21, 0x83, 0x41, 0x08, 0x65, 0x34,
+  0x06, 0x3d, 0x62, 0x10, 0x42, 0xc7, 0x4d, 0x80, 0xc4, 0x2b, 0x42, 0x62, 0x10, 0x80, 0xa3, 0x1a,
+  0x01, 0x80, 0xc1, 0x10, 0x44, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x51, 0xc7, 0x4d, 0x86, 0xa3, 0x1a,
+  0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x06, 0x3d, 0x06, 0x42, 0xc7, 0x4d,
+  0x80, 0x06, 0x3d, 0x42, 0x61, 0x08, 0x80, 0xc4, 0x2b, 0x09, 0x83, 0xc7, 0x4d, 0xc7, 0x4d, 0x06,
+  0x3d, 0x61, 0x08, 0x21, 0x8a, 0x41, 0x08, 0x06, 0x3d, 0x06, 0x3d, 0x61, 0x08, 0x06, 0x3d, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x65, 0x34, 0x01, 0x81, 0x65, 0x34, 0x62,
+  0x10, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x51, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x06,
+  0x3d, 0x08, 0x43, 0xc7, 0x4d, 0x85, 0x23, 0x23, 0x62, 0x10, 0x62, 0x10, 0x22, 0x1a, 0x41, 0x08,
+  0x61, 0x08, 0x08, 0x43, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x21, 0x84, 0x41, 0x08, 0x06, 0x3d, 0x06,
+  0x3d, 0x62, 0x10, 0x65, 0x34, 0x42, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0x06,
+  0x3d, 0xa3, 0x1a, 0x62, 0x10, 0x46, 0x00, 0x00, 0x81, 0x62, 0x10, 0xa3, 0x1a, 0x5e, 0xc7, 0x4d,
+  0x87, 0xa2, 0x11, 0x61, 0x08, 0x62, 0x10, 0xc4, 0x2b, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x23,
+  0x23, 0x07, 0x43, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x21, 0x84, 0x41, 0x08, 0x65, 0x34, 0xc7, 0x4d,
+  0x61, 0x08, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x84, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x41, 0x08, 0x46, 0x00, 0x00, 0x84, 0x20, 0x00, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23,
+  0x5a, 0xc7, 0x4d, 0x8a, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0xa2, 0x11, 0x06, 0x3d, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x62, 0x10, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x05, 0x44, 0xc7, 0x4d, 0x81, 0x23,
+  0x23, 0x21, 0x08, 0x20, 0x84, 0x21, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x22, 0x11, 0xc1, 0x10, 0x42,
+  0xc7, 0x4d, 0x84, 0x61, 0x08, 0xa3, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x46, 0x00, 0x00,
+  0x87, 0x41, 0x08, 0x23, 0x23, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x22, 0x1a, 0x06,
+  0x3d, 0x55, 0xc7, 0x4d, 0x80, 0xc4, 0x2b, 0x42, 0x61, 0x08, 0x80, 0x65, 0x34, 0x01, 0x85, 0xc7,
+  0x4d, 0xc7, 0x4d, 0x62, 0x10, 0x00, 0x00, 0x20, 0x00, 0x22, 0x1a, 0x04, 0x45, 0xc7, 0x4d, 0x81,
+  0xc4, 0x2b, 0x41, 0x08, 0x20, 0x8c, 0x20, 0x00, 0x22, 0x1a, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10,
+  0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08,
+  0x46, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x01, 0x80, 0xc4, 0x2b, 0x43, 0x61, 0x08, 0x80,
+  0x23, 0x23, 0x50, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0xa3, 0x1a, 0x42, 0x61, 0x08, 0x80, 0x65, 0x34,
+  0x04, 0x85, 0xc7, 0x4d, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x46,
+  0xc7, 0x4d, 0x82, 0xc1, 0x10, 0x61, 0x08, 0x62, 0x10, 0x20, 0x8c, 0x61, 0x08, 0xc7, 0x4d, 0x06,
+  0x3d, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0xc7,
+  0x4d, 0x23, 0x23, 0x20, 0x00, 0x45, 0x00, 0x00, 0x81, 0x61, 0x08, 0x65, 0x34, 0x03, 0x8a, 0x06,
+  0x3d, 0xa3, 0x1a, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xa3, 0x1a, 0x23, 0x23, 0x65,
+  0x34, 0x06, 0x3d, 0x06, 0x3d, 0x45, 0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x65, 0x34, 0x23, 0x23, 0xc1,
+  0x10, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x06, 0x81, 0xc7, 0x4d, 0x62, 0x10, 0x42,
+  0x00, 0x00, 0x80, 0x22, 0x11, 0x48, 0xc7, 0x4d, 0x84, 0x06, 0x3d, 0x62, 0x10, 0xc1, 0x10, 0x23,
+  0x23, 0x41, 0x08, 0x1f, 0x8c, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x62, 0x10, 0x65,
+  0x34, 0xc4, 0x2b, 0x62, 0x10, 0x06, 0x3d, 0x23, 0x23, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10, 0x45,
+  0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x06, 0x88, 0x06, 0x3d, 0xa3, 0x1a, 0xc1, 0x10, 0x61,
+  0x08, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x62, 0x10, 0x43, 0x61, 0x08, 0x43, 0x62,
+  0x10, 0x82, 0x61, 0x08, 0x22, 0x1a, 0x65, 0x34, 0x08, 0x81, 0x06, 0x3d, 0x61, 0x08, 0x42, 0x00,
+  0x00, 0x00, 0x80, 0x65, 0x34, 0x46, 0xc7, 0x4d, 0x85, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06,
+  0x3d, 0xc7, 0x4d, 0x61, 0x08, 0x1f, 0x8c, 0x20, 0x00, 0x22, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2,
+  0x11, 0x62, 0x10, 0x62, 0x10, 0xc1, 0x10, 0xc7, 0x4d, 0xa3, 0x1a, 0x61, 0x08, 0xc7, 0x4d, 0xa2,
+  0x11, 0x45, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x09, 0x8d, 0x06, 0x3d, 0x06, 0x3d, 0x65,
+  0x34, 0x23, 0x23, 0x22, 0x1a, 0xa2, 0x11, 0x22, 0x11, 0x22, 0x11, 0xa2, 0x11, 0xa2, 0x11, 0xa3,
+  0x1a, 0xc4, 0x2b, 0x06, 0x3d, 0x06, 0x3d, 0x0b, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x43, 0x00, 0x00,
+  0x80, 0xc1, 0x10, 0x05, 0x87, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x21, 0x08, 0x1f, 0x8b, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4,
+  0x2b, 0xa3, 0x1a, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x65, 0x34, 0xa3, 0x1a, 0x45,
+  0x00, 0x00, 0x81, 0x21, 0x08, 0xa3, 0x1a, 0x08, 0x5a, 0xc7, 0x4d, 0x81, 0x23, 0x23, 0x21, 0x08,
+  0x43, 0x00, 0x00, 0x89, 0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x22, 0x11, 0x61, 0x08,
+  0x62, 0x10, 0x62, 0x10, 0x22, 0x11, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x61, 0x08,
+  0x1f, 0x81, 0x20, 0x00, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x86, 0xa2, 0x11, 0x65, 0x34, 0xc7, 0x4d,
+  0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x62, 0x10, 0x46, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x08, 0x5a,
+  0xc7, 0x4d, 0x80, 0xa2, 0x11, 0x45, 0x00, 0x00, 0x44, 0x61, 0x08, 0x81, 0x22, 0x1a, 0x06, 0x3d,
+  0x45, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x20, 0x88, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7, 0x4d,
+  0xa3, 0x1a, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x48, 0x00, 0x00, 0x80, 0x61, 0x08,
+  0x08, 0x42, 0xc7, 0x4d, 0x82, 0x65, 0x34, 0x61, 0x08, 0x23, 0x23, 0x13, 0x81, 0xc7, 0x4d, 0x61,
+  0x08, 0x45, 0x00, 0x00, 0x80, 0x61, 0x08, 0x01, 0x46, 0xc7, 0x4d, 0x83, 0x06, 0x3d, 0x65, 0x34,
+  0xc7, 0x4d, 0xa2, 0x11, 0x21, 0x87, 0x61, 0x08, 0x22, 0x1a, 0xc7, 0x4d, 0x06, 0x3d, 0x41, 0x08,
+  0xc1, 0x10, 0x23, 0x23, 0x62, 0x10, 0x48, 0x00, 0x00, 0x80, 0x61, 0x08, 0x08, 0x85, 0xc7, 0x4d,
+  0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x12, 0x82, 0xc7, 0x4d, 0x06, 0x3d,
+  0x62, 0x10, 0x44, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x48, 0xc7, 0x4d, 0x84, 0x65, 0x34,
+  0xc1, 0x10, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0x21, 0x85, 0x21, 0x08, 0x61, 0x08, 0x61, 0x08,
+  0x00, 0x00, 0x20, 0x00, 0x21, 0x08, 0x49, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x07, 0x84,
+  0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x12, 0x83, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x23, 0x23, 0x41, 0x08, 0x44, 0x00, 0x00, 0x80, 0x61, 0x08, 0x01, 0x48, 0xc7, 0x4d, 0x83, 0x61,
+  0x08, 0x06, 0x3d, 0xc4, 0x2b, 0x21, 0x08, 0x29, 0x47, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x07, 0x83, 0xc4, 0x2b, 0x62, 0x10, 0x61, 0x08, 0x06, 0x3d, 0x13, 0x82, 0xc7, 0x4d, 0xc7, 0x4d,
+  0x61, 0x08, 0x44, 0x00, 0x00, 0x81, 0x20, 0x00, 0x23, 0x23, 0x02, 0x44, 0xc7, 0x4d, 0x86, 0xa3,
+  0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0xc4, 0x2b, 0xc4, 0x2b, 0x21, 0x08, 0x2b, 0x46, 0x00,
+  0x00, 0x80, 0x22, 0x11, 0x06, 0x83, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x14, 0x82,
+  0xc7, 0x4d, 0x65, 0x34, 0x61, 0x08, 0x44, 0x00, 0x00, 0x03, 0x81, 0xc4, 0x2b, 0xc1, 0x10, 0x42,
+  0xc7, 0x4d, 0x87, 0x06, 0x3d, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x22, 0x11, 0xc4,
+  0x2b, 0x21, 0x08, 0x31, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x05, 0x82, 0x61, 0x08, 0x61,
+  0x08, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x80, 0x22, 0x11, 0x44, 0x00, 0x00, 0x85, 0x61, 0x08, 0xc4,
+  0x2b, 0xc7, 0x4d, 0xc7, 0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x02, 0x88, 0xc7, 0x4d, 0xc7, 0x4d, 0x61,
+  0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0xa3, 0x1a, 0x20, 0x00, 0x31, 0x82, 0x00,
+  0x00, 0x21, 0x08, 0x23, 0x23, 0x04, 0x82, 0x22, 0x1a, 0x41, 0x08, 0x22, 0x1a, 0x56, 0xc7, 0x4d,
+  0x81, 0x65, 0x34, 0x61, 0x08, 0x43, 0x00, 0x00, 0x88, 0x41, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xc4, 0x2b, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85, 0x61,
+  0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0x32, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0x08, 0x03, 0x82, 0x65, 0x34, 0x61, 0x08, 0x61, 0x08, 0x57, 0xc7, 0x4d, 0x80, 0x61,
+  0x08, 0x44, 0x00, 0x00, 0x88, 0x61, 0x08, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2, 0x11, 0x41, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0x08, 0x06, 0x3d, 0x42, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0xc4, 0x2b, 0xc7,
+  0x4d, 0x22, 0x1a, 0x61, 0x08, 0x21, 0x08, 0x32, 0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65,
+  0x34, 0x02, 0x82, 0x61, 0x08, 0x61, 0x08, 0x65, 0x34, 0x56, 0xc7, 0x4d, 0x81, 0xa3, 0x1a, 0x21,
+  0x08, 0x44, 0x00, 0x00, 0x42, 0x61, 0x08, 0x80, 0x20, 0x00, 0x42, 0x00, 0x00, 0x81, 0x20, 0x00,
+  0xc4, 0x2b, 0x42, 0xc7, 0x4d, 0x83, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0x61, 0x08, 0x34, 0x42,
+  0x00, 0x00, 0x80, 0x22, 0x11, 0x01, 0x82, 0xa3, 0x1a, 0x21, 0x08, 0x22, 0x11, 0x02, 0x53, 0xc7,
+  0x4d, 0x81, 0xc4, 0x2b, 0x61, 0x08, 0x4d, 0x00, 0x00, 0x80, 0x23, 0x23, 0x42, 0xc7, 0x4d, 0x83,
+  0x61, 0x08, 0x23, 0x23, 0x65, 0x34, 0x41, 0x08, 0x35, 0x87, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08,
+  0x65, 0x34, 0x06, 0x3d, 0x62, 0x10, 0x62, 0x10, 0x06, 0x3d, 0x02, 0x52, 0xc7, 0x4d, 0x81, 0x06,
+  0x3d, 0x62, 0x10, 0x4e, 0x00, 0x00, 0x80, 0xa2, 0x11, 0x42, 0xc7, 0x4d, 0x82, 0x62, 0x10, 0x22,
+  0x1a, 0x62, 0x10, 0x36, 0x42, 0x00, 0x00, 0x83, 0x61, 0x08, 0x22, 0x1a, 0x00, 0x00, 0x22, 0x11,
+  0x03, 0x51, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x4f, 0x00, 0x00, 0x80, 0x61, 0x08, 0x42,
+  0xc7, 0x4d, 0x81, 0x61, 0x08, 0x20, 0x00, 0x37, 0x42, 0x00, 0x00, 0x83, 0x20, 0x00, 0x41, 0x08,
+  0x61, 0x08, 0x65, 0x34, 0x03, 0x50, 0xc7, 0x4d, 0x81, 0x06, 0x3d, 0x62, 0x10, 0x50, 0x00, 0x00,
+  0x84, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x65, 0x34, 0x41, 0x08, 0x38, 0x44, 0x00, 0x00, 0x80,
+  0x61, 0x08, 0x05, 0x4e, 0xc7, 0x4d, 0x81, 0xc4, 0x2b, 0x62, 0x10, 0x51, 0x00, 0x00, 0x84, 0x41,
+  0x08, 0x65, 0x34, 0xc7, 0x4d, 0x23, 0x23, 0x21, 0x08, 0x38, 0x44, 0x00, 0x00, 0x80, 0x22, 0x1a,
+  0x05, 0x4d, 0xc7, 0x4d, 0x83, 0x22, 0x1a, 0x41, 0x08, 0x61, 0x08, 0x62, 0x10, 0x51, 0x00, 0x00,
+  0x82, 0xa3, 0x1a, 0xc7, 0x4d, 0x22, 0x11, 0x3a, 0x42, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b,
+  0x05, 0x4b, 0xc7, 0x4d, 0x86, 0x06, 0x3d, 0x61, 0x08, 0x20, 0x00, 0x62, 0x10, 0x65, 0x34, 0x23,
+  0x23, 0x21, 0x08, 0x50, 0x00, 0x00, 0x82, 0x61, 0x08, 0xc7, 0x4d, 0x62, 0x10, 0x3a, 0x42, 0x00,
+  0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x06, 0x49, 0xc7, 0x4d, 0x87, 0x23, 0x23, 0x62, 0x10, 0x00,
+  0x00, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x50, 0x00, 0x00, 0x82, 0x20,
+  0x00, 0x62, 0x10, 0x20, 0x00, 0x3a, 0x42, 0x00, 0x00, 0x80, 0x62, 0x10, 0x07, 0x47, 0xc7, 0x4d,
+  0x86, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x01,
+  0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x07, 0x46, 0xc7,
+  0x4d, 0x87, 0x65, 0x34, 0x61, 0x08, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0x06, 0x3d, 0x62, 0x10,
+  0x22, 0x1a, 0x01, 0x81, 0xa3, 0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0x08, 0x08, 0x45, 0xc7, 0x4d, 0x82, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x02, 0x81,
+  0x61, 0x08, 0x61, 0x08, 0x01, 0x81, 0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x61, 0x08, 0x08, 0x4b, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x62, 0x10, 0x65, 0x34,
+  0x01, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x09,
+  0x4a, 0xc7, 0x4d, 0x82, 0x06, 0x3d, 0x61, 0x08, 0xa3, 0x1a, 0x01, 0x80, 0xc1, 0x10, 0x7f, 0x00,
+  0x00, 0x0f, 0x82, 0x00, 0x00, 0x62, 0x10, 0x06, 0x3d, 0x09, 0x4a, 0xc7, 0x4d, 0x81, 0x61, 0x08,
+  0x61, 0x08, 0x01, 0x81, 0xa3, 0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x21,
+  0x08, 0x23, 0x23, 0x09, 0x4a, 0xc7, 0x4d, 0x85, 0xc1, 0x10, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d,
+  0x65, 0x34, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0e, 0x82, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x0a,
+  0x49, 0xc7, 0x4d, 0x85, 0x22, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10,
+  0x7f, 0x00, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xc4, 0x2b, 0x0a, 0x48, 0xc7,
+  0x4d, 0x82, 0xa3, 0x1a, 0x62, 0x10, 0x06, 0x3d, 0x01, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0f,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x0a, 0x47, 0xc7, 0x4d, 0x82, 0xa3, 0x1a,
+  0x62, 0x10, 0x06, 0x3d, 0x01, 0x80, 0x61, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0xc1, 0x10, 0x0b, 0x46, 0xc7, 0x4d, 0x82, 0x23, 0x23, 0x61, 0x08, 0x23, 0x23,
+  0x01, 0x80, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x0f, 0x42, 0x00, 0x00, 0x81, 0x21, 0x08, 0xa2, 0x11,
+  0x0c, 0x44, 0xc7, 0x4d, 0x86, 0xa3, 0x1a, 0x21, 0x08, 0x62, 0x10, 0x65, 0x34, 0xc7, 0x4d, 0xa3,
+  0x1a, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x42, 0x00, 0x00, 0x81, 0x41, 0x08, 0x23, 0x23, 0x0c,
+  0x43, 0xc7, 0x4d, 0x86, 0xa3, 0x1a, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0xc7, 0x4d, 0xc4, 0x2b,
+  0x41, 0x08, 0x7f, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00, 0x81, 0x61, 0x08, 0xc4, 0x2b, 0x0c, 0x42,
+  0xc7, 0x4d, 0x86, 0x61, 0x08, 0x61, 0x08, 0x23, 0x23, 0x61, 0x08, 0xa3, 0x1a, 0x65, 0x34, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x10, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0xc4, 0x2b, 0x0c, 0x88, 0xc7,
+  0x4d, 0x65, 0x34, 0x62, 0x10, 0xc4, 0x2b, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0x62,
+  0x10, 0x7f, 0x00, 0x00, 0x10, 0x44, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x0b, 0x88, 0xc7,
+  0x4d, 0xc1, 0x10, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0xa3, 0x1a, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x10, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10, 0x65, 0x34, 0x0a, 0x88, 0x65,
+  0x34, 0x62, 0x10, 0xa3, 0x1a, 0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x61,
+  0x08, 0x7f, 0x00, 0x00, 0x11, 0x45, 0x00, 0x00, 0x82, 0x62, 0x10, 0x22, 0x1a, 0x06, 0x3d, 0x07,
+  0x89, 0x06, 0x3d, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xc7, 0x4d, 0xc1, 0x10, 0x21,
+  0x08, 0x62, 0x10, 0xc1, 0x10, 0x7f, 0x00, 0x00, 0x11, 0x46, 0x00, 0x00, 0x82, 0x21, 0x08, 0x61,
+  0x08, 0x23, 0x23, 0x05, 0x8a, 0x06, 0x3d, 0xc1, 0x10, 0x61, 0x08, 0x23, 0x23, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x41, 0x08, 0x61, 0x08, 0xa3, 0x1a, 0xa2, 0x11, 0x7f, 0x00, 0x00, 0x12, 0x47,
+  0x00, 0x00, 0x83, 0x41, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0x06, 0x3d, 0x01, 0x83, 0x65, 0x34, 0x61,
+  0x08, 0x41, 0x08, 0x22, 0x11, 0x42, 0xc7, 0x4d, 0x85, 0x22, 0x11, 0x41, 0x08, 0x65, 0x34, 0xc7,
+  0x4d, 0x22, 0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x11, 0x49, 0x00, 0x00, 0x86, 0x41, 0x08, 0x62,
+  0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x20, 0x00, 0x61, 0x08, 0x43, 0xc7, 0x4d, 0x85, 0x22,
+  0x11, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x22, 0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x12, 0x48,
+  0x00, 0x00, 0x86, 0x62, 0x10, 0x62, 0x10, 0x61, 0x08, 0x62, 0x10, 0x61, 0x08, 0x22, 0x11, 0x06,
+  0x3d, 0x43, 0xc7, 0x4d, 0x85, 0x61, 0x08, 0x62, 0x10, 0x06, 0x3d, 0xc7, 0x4d, 0xa3, 0x1a, 0x20,
+  0x00, 0x7f, 0x00, 0x00, 0x12, 0x47, 0x00, 0x00, 0x84, 0x62, 0x10, 0x65, 0x34, 0x06, 0x3d, 0x65,
+  0x34, 0x06, 0x3d, 0x04, 0x87, 0xc7, 0x4d, 0xc7, 0x4d, 0x61, 0x08, 0x61, 0x08, 0xc7, 0x4d, 0xc7,
+  0x4d, 0xa3, 0x1a, 0x20, 0x00, 0x7f, 0x00, 0x00, 0x12, 0x46, 0x00, 0x00, 0x81, 0x20, 0x00, 0xa2,
+  0x11, 0x08, 0x86, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0xa2, 0x11, 0xc7, 0x4d, 0xc7, 0x4d, 0xa2,
+  0x11, 0x7f, 0x00, 0x00, 0x14, 0x45, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d, 0x08, 0x86, 0xc7,
+  0x4d, 0x23, 0x23, 0x41, 0x08, 0xc4, 0x2b, 0xc7, 0x4d, 0xc4, 0x2b, 0x62, 0x10, 0x01, 0x7f, 0x00,
+  0x00, 0x12, 0x45, 0x00, 0x00, 0x80, 0xc1, 0x10, 0x09, 0x87, 0xc7, 0x4d, 0x61, 0x08, 0x62, 0x10,
+  0x06, 0x3d, 0x23, 0x23, 0x62, 0x10, 0xc1, 0x10, 0x62, 0x10, 0x3f, 0x14, 0x43, 0x00, 0x00, 0x81,
+  0x41, 0x08, 0xc4, 0x2b, 0x09, 0x81, 0xc4, 0x2b, 0x41, 0x08, 0x42, 0x61, 0x08, 0x83, 0x23, 0x23,
+  0xc7, 0x4d, 0x23, 0x23, 0x41, 0x08, 0x3f, 0x13, 0x43, 0x00, 0x00, 0x81, 0x62, 0x10, 0x06, 0x3d,
+  0x08, 0x85, 0xc7, 0x4d, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x22, 0x1a, 0x06, 0x3d, 0x42, 0xc7,
+  0x4d, 0x80, 0x62, 0x10, 0x3f, 0x14, 0x42, 0x00, 0x00, 0x80, 0x61, 0x08, 0x08, 0x83, 0xc7, 0x4d,
+  0x23, 0x23, 0x41, 0x08, 0x61, 0x08, 0x45, 0xc7, 0x4d, 0x80, 0x61, 0x08, 0x3f, 0x14, 0x42, 0x00,
+  0x00, 0x80, 0x22, 0x11, 0x07, 0x84, 0xc7, 0x4d, 0x06, 0x3d, 0x62, 0x10, 0x61, 0x08, 0x65, 0x34,
+  0x45, 0xc7, 0x4d, 0x80, 0xc1, 0x10, 0x3f, 0x14, 0x42, 0x00, 0x00, 0x80, 0x22, 0x11, 0x05, 0x85,
+  0xc7, 0x4d, 0xc7, 0x4d, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0x22, 0x1a, 0x46, 0xc7, 0x4d, 0x80,
+  0x61, 0x08, 0x3f, 0x13, 0x84, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x62, 0x10, 0x22, 0x11, 0x46,
+  0xc7, 0x4d, 0x8c, 0x06, 0x3d, 0x61, 0x08, 0x21, 0x08, 0xc1, 0x10, 0xc7, 0x4d, 0x65, 0x34, 0x61,
+  0x08, 0xa2, 0x11, 0x06, 0x3d, 0x65, 0x34, 0xa2, 0x11, 0x62, 0x10, 0x41, 0x08, 0x3f, 0x12, 0x86,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x06, 0x3d, 0x61, 0x08, 0x61, 0x08, 0x06, 0x3d, 0x44, 0xc7,
+  0x4d, 0x8b, 0x23, 0x23, 0x62, 0x10, 0x41, 0x08, 0xc1, 0x10, 0x06, 0x3d, 0xa2, 0x11, 0x61, 0x08,
+  0x00, 0x00, 0x21, 0x08, 0x62, 0x10, 0x61, 0x08, 0x20, 0x00, 0x3f, 0x13, 0x92, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0x08, 0x06, 0x3d, 0xc7, 0x4d, 0x23, 0x23, 0x61, 0x08, 0x61, 0x08, 0xc4, 0x2b, 0xc4,
+  0x2b, 0x23, 0x23, 0x22, 0x11, 0x62, 0x10, 0x41, 0x08, 0x62, 0x10, 0x22, 0x1a, 0xa3, 0x1a, 0x61,
+  0x08, 0x21, 0x08, 0x7f, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x65, 0x34,
+  0x02, 0x80, 0x23, 0x23, 0x42, 0x61, 0x08, 0x86, 0x62, 0x10, 0x61, 0x08, 0x61, 0x08, 0xa3, 0x1a,
+  0xc4, 0x2b, 0x61, 0x08, 0x41, 0x08, 0x7f, 0x00, 0x00, 0x19, 0x83, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x00, 0x22, 0x1a, 0x05, 0x43, 0x06, 0x3d, 0x82, 0xc4, 0x2b, 0x61, 0x08, 0x61, 0x08, 0x7f, 0x00,
+  0x00, 0x1a, 0x42, 0x00, 0x00, 0x81, 0x41, 0x08, 0xc4, 0x2b, 0x06, 0x83, 0x65, 0x34, 0x22, 0x1a,
+  0x61, 0x08, 0x41, 0x08, 0x02, 0x7f, 0x00, 0x00, 0x18, 0x44, 0x00, 0x00, 0x89, 0x62, 0x10, 0x61,
+  0x08, 0xa2, 0x11, 0xa2, 0x11, 0x22, 0x1a, 0x22, 0x11, 0x61, 0x08, 0x62, 0x10, 0x41, 0x08, 0x20,
+  0x00, 0x7f, 0x00, 0x00, 0x1d, 0x7f, 0x00, 0x00, 0x2b, 0x7f, 0x00, 0x00, 0x2c, 0x7f, 0x00, 0x00,
+  0x2c, 0x7f, 0x00, 0x00, 0x2d, 0x7f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2f,
+};
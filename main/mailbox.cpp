@@ -0,0 +1,93 @@
+#include "mailbox.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "esp_log.h"
+#include "report_format.hpp"
+
+namespace mailbox {
+namespace {
+
+constexpr const char *kTag = "mailbox";
+constexpr size_t kMaxMailboxes = 4;
+
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+Stats *g_mailboxes[kMaxMailboxes];
+size_t g_mailbox_count = 0;
+
+using report_format::appendf;
+
+}  // namespace
+
+namespace detail {
+
+void attach(Stats *stats)
+{
+    if (stats->queue == nullptr) {
+        ESP_LOGE(kTag, "%s: queue create failed", stats->name);
+        return;
+    }
+    portENTER_CRITICAL(&g_lock);
+    const bool full = g_mailbox_count >= kMaxMailboxes;
+    if (!full) {
+        g_mailboxes[g_mailbox_count++] = stats;
+    }
+    portEXIT_CRITICAL(&g_lock);
+    if (full) {
+        ESP_LOGW(kTag, "%s: not listed, raise kMaxMailboxes", stats->name);
+    }
+}
+
+void note_post(Stats *stats, bool ok)
+{
+    if (!ok) {
+        stats->full.fetch_add(1, std::memory_order_relaxed);
+        metrics::add(metrics::Counter::kQueueFull);
+        return;
+    }
+    stats->posted.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t depth = uxQueueMessagesWaiting(stats->queue);
+    uint32_t seen = stats->high_water.load(std::memory_order_relaxed);
+    while (depth > seen && !stats->high_water.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {
+    }
+}
+
+void note_receive(Stats *stats)
+{
+    if (stats->depth_histogram != metrics::Histogram::kCount) {
+        metrics::observe(stats->depth_histogram, uxQueueMessagesWaiting(stats->queue) + 1);
+    }
+}
+
+}  // namespace detail
+
+size_t format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    Stats *mailboxes[kMaxMailboxes];
+    portENTER_CRITICAL(&g_lock);
+    const size_t count = g_mailbox_count;
+    std::copy(g_mailboxes, g_mailboxes + count, mailboxes);
+    portEXIT_CRITICAL(&g_lock);
+
+    size_t used = 0;
+    if (count == 0) {
+        return 0;
+    }
+    appendf(out, out_len, &used, "mailbox depth  high posted full\n");
+    for (size_t i = 0; i < count; ++i) {
+        const Stats &s = *mailboxes[i];
+        appendf(out, out_len, &used, "%-7s %2u/%-2u %4u %6u %4u\n", s.name,
+                static_cast<unsigned>(uxQueueMessagesWaiting(s.queue)), static_cast<unsigned>(s.capacity),
+                static_cast<unsigned>(s.high_water.load()), static_cast<unsigned>(s.posted.load()),
+                static_cast<unsigned>(s.full.load()));
+    }
+    return used;
+}
+
+}  // namespace mailbox
@@ -0,0 +1,245 @@
+#include "mem_monitor.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "report_format.hpp"
+
+namespace mem_monitor {
+namespace {
+
+constexpr const char *kTag = "mem_monitor";
+constexpr size_t kTagCount = static_cast<size_t>(Tag::kCount);
+constexpr const char *kTagNames[kTagCount] = {"libssh2", "lvgl", "terminal", "keys"};
+
+// mbedTLS is configured for internal-only allocations, so session setup
+// (key exchange bignums, cipher contexts) depends on internal RAM. Below
+// these the first libssh2_session_init/handshake allocations start failing.
+constexpr uint32_t kSessionMinLargestBlock = 12 * 1024;
+constexpr uint32_t kSessionMinInternalFree = 40 * 1024;
+
+// Internal-heap fragmentation (1 - largest/free) warning band.
+constexpr uint32_t kFragWarnPct = 70;
+constexpr uint32_t kFragClearPct = 55;
+
+constexpr uint16_t kBlockMagic = 0xA11C;
+
+// Prefix of every tagged block; keeps the payload 8-byte aligned.
+struct alignas(8) BlockHeader {
+    uint32_t size;
+    uint16_t magic;
+    uint8_t tag;
+    uint8_t reserved;
+};
+static_assert(sizeof(BlockHeader) == 8, "tagged block header must stay 8 bytes");
+
+struct TagStats {
+    size_t live = 0;
+    size_t peak = 0;
+    uint32_t allocs = 0;
+    uint32_t failures = 0;
+};
+
+struct RegionSample {
+    uint32_t free = 0;
+    uint32_t largest = 0;
+    uint32_t min_free = 0;
+    uint32_t total = 0;
+};
+
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+TagStats g_tags[kTagCount];
+uint32_t g_peak_frag_pct = 0;
+bool g_frag_warned = false;
+
+using report_format::appendf;
+
+void account(Tag tag, ptrdiff_t delta, bool new_block)
+{
+    TagStats &stats = g_tags[static_cast<size_t>(tag)];
+    portENTER_CRITICAL(&g_lock);
+    stats.live = static_cast<size_t>(static_cast<ptrdiff_t>(stats.live) + delta);
+    stats.peak = std::max(stats.peak, stats.live);
+    if (new_block) {
+        stats.allocs++;
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void count_failure(Tag tag)
+{
+    portENTER_CRITICAL(&g_lock);
+    g_tags[static_cast<size_t>(tag)].failures++;
+    portEXIT_CRITICAL(&g_lock);
+}
+
+RegionSample sample_region(uint32_t caps)
+{
+    RegionSample s;
+    s.free = heap_caps_get_free_size(caps);
+    s.largest = heap_caps_get_largest_free_block(caps);
+    s.min_free = heap_caps_get_minimum_free_size(caps);
+    s.total = heap_caps_get_total_size(caps);
+    return s;
+}
+
+uint32_t frag_pct(const RegionSample &s)
+{
+    if (s.free == 0) {
+        return 0;
+    }
+    return 100 - static_cast<uint32_t>(static_cast<uint64_t>(s.largest) * 100 / s.free);
+}
+
+RegionSample sample_internal()
+{
+    return sample_region(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+RegionSample sample_psram()
+{
+    return sample_region(MALLOC_CAP_SPIRAM);
+}
+
+}  // namespace
+
+void *tagged_malloc(Tag tag, size_t size)
+{
+    auto *header = static_cast<BlockHeader *>(std::malloc(sizeof(BlockHeader) + size));
+    if (header == nullptr) {
+        count_failure(tag);
+        return nullptr;
+    }
+    header->size = static_cast<uint32_t>(size);
+    header->magic = kBlockMagic;
+    header->tag = static_cast<uint8_t>(tag);
+    header->reserved = 0;
+    account(tag, static_cast<ptrdiff_t>(size), true);
+    return header + 1;
+}
+
+void *tagged_realloc(Tag tag, void *ptr, size_t size)
+{
+    if (ptr == nullptr) {
+        return tagged_malloc(tag, size);
+    }
+    if (size == 0) {
+        tagged_free(ptr);
+        return nullptr;
+    }
+    BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+    if (header->magic != kBlockMagic) {
+        ESP_LOGE(kTag, "realloc of untagged block %p", ptr);
+        return nullptr;
+    }
+    const Tag owner = static_cast<Tag>(header->tag);
+    const size_t old_size = header->size;
+    auto *grown = static_cast<BlockHeader *>(std::realloc(header, sizeof(BlockHeader) + size));
+    if (grown == nullptr) {
+        count_failure(owner);
+        return nullptr;
+    }
+    grown->size = static_cast<uint32_t>(size);
+    account(owner, static_cast<ptrdiff_t>(size) - static_cast<ptrdiff_t>(old_size), false);
+    return grown + 1;
+}
+
+void tagged_free(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+    if (header->magic != kBlockMagic) {
+        ESP_LOGE(kTag, "free of untagged block %p", ptr);
+        return;
+    }
+    account(static_cast<Tag>(header->tag), -static_cast<ptrdiff_t>(header->size), false);
+    header->magic = 0;
+    std::free(header);
+}
+
+void set_usage(Tag tag, size_t bytes)
+{
+    TagStats &stats = g_tags[static_cast<size_t>(tag)];
+    portENTER_CRITICAL(&g_lock);
+    stats.live = bytes;
+    stats.peak = std::max(stats.peak, bytes);
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void sample()
+{
+    const RegionSample internal = sample_internal();
+    const uint32_t frag = frag_pct(internal);
+    g_peak_frag_pct = std::max(g_peak_frag_pct, frag);
+
+    if (!g_frag_warned && frag >= kFragWarnPct) {
+        g_frag_warned = true;
+        ESP_LOGW(kTag, "internal heap fragmented: %" PRIu32 "%% (free %" PRIu32 ", largest %" PRIu32 ")", frag,
+                 internal.free, internal.largest);
+    } else if (g_frag_warned && frag <= kFragClearPct) {
+        g_frag_warned = false;
+        ESP_LOGI(kTag, "internal heap fragmentation back to %" PRIu32 "%%", frag);
+    }
+}
+
+bool check_session_headroom(const char *stage)
+{
+    const RegionSample internal = sample_internal();
+    const RegionSample psram = sample_psram();
+    ESP_LOGI(kTag,
+             "heap[%s] internal free=%" PRIu32 " largest=%" PRIu32 " min=%" PRIu32 " frag=%" PRIu32
+             "%% psram free=%" PRIu32 " largest=%" PRIu32,
+             stage, internal.free, internal.largest, internal.min_free, frag_pct(internal), psram.free,
+             psram.largest);
+
+    if (internal.largest < kSessionMinLargestBlock || internal.free < kSessionMinInternalFree) {
+        ESP_LOGW(kTag, "heap[%s] below session headroom (need largest>=%" PRIu32 " free>=%" PRIu32 ")", stage,
+                 kSessionMinLargestBlock, kSessionMinInternalFree);
+        return false;
+    }
+    return true;
+}
+
+size_t format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    const RegionSample internal = sample_internal();
+    const RegionSample psram = sample_psram();
+    TagStats tags[kTagCount];
+    portENTER_CRITICAL(&g_lock);
+    std::copy(std::begin(g_tags), std::end(g_tags), tags);
+    portEXIT_CRITICAL(&g_lock);
+
+    size_t used = 0;
+    appendf(out, out_len, &used, "%-8s %7s %7s %7s %4s\n", "HEAP", "FREE", "LARGEST", "MINFREE", "FRAG");
+    appendf(out, out_len, &used, "%-8s %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %3" PRIu32 "%%\n", "internal",
+            internal.free, internal.largest, internal.min_free, frag_pct(internal));
+    if (psram.total > 0) {
+        appendf(out, out_len, &used, "%-8s %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %3" PRIu32 "%%\n", "psram",
+                psram.free, psram.largest, psram.min_free, frag_pct(psram));
+    }
+    appendf(out, out_len, &used, "internal frag peak %" PRIu32 "%%, session headroom %s\n", g_peak_frag_pct,
+            (internal.largest >= kSessionMinLargestBlock && internal.free >= kSessionMinInternalFree) ? "ok"
+                                                                                                      : "LOW");
+    appendf(out, out_len, &used, "%-8s %7s %7s %6s %4s\n", "TAG", "LIVE", "PEAK", "ALLOCS", "FAIL");
+    for (size_t i = 0; i < kTagCount; ++i) {
+        appendf(out, out_len, &used, "%-8s %7u %7u %6" PRIu32 " %4" PRIu32 "\n", kTagNames[i],
+                static_cast<unsigned>(tags[i].live), static_cast<unsigned>(tags[i].peak), tags[i].allocs,
+                tags[i].failures);
+    }
+    return used;
+}
+
+}  // namespace mem_monitor
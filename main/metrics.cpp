@@ -0,0 +1,194 @@
+#include "metrics.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <iterator>
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "report_format.hpp"
+
+namespace metrics {
+namespace {
+
+constexpr const char *kTag = "metrics";
+
+constexpr size_t kCounterCount = static_cast<size_t>(Counter::kCount);
+constexpr const char *kCounterNames[kCounterCount] = {
+    "rx_bytes",     "tx_bytes",        "rx_reads",     "key_irqs",     "key_events",    "key_presses",
+    "key_releases", "enc_transitions", "ssh_attempts", "ssh_connects", "lock_timeouts", "key_drops",
+    "queue_full",   "rx_yields",       "rx_sleeps",
+};
+
+struct HistogramInfo {
+    const char *name;
+    const char *unit;
+};
+constexpr size_t kHistogramCount = static_cast<size_t>(Histogram::kCount);
+constexpr HistogramInfo kHistograms[kHistogramCount] = {
+    {"append_text", "us"},
+    {"flush", "us"},
+    {"lock_wait", "us"},
+    {"handshake", "ms"},
+    {"rx_chunk", "B"},
+    {"key_render", "us"},
+    {"net_queue", "n"},
+    {"ui_queue", "n"},
+    {"job", "ms"},
+    {"screen_render", "us"},
+};
+
+// Bucket 0 holds 0; bucket i holds [2^(i-1), 2^i); the last one is open.
+constexpr size_t kBuckets = 24;
+static_assert(kBuckets < 32, "bucket bounds are computed in 32 bits");
+
+struct HistogramState {
+    uint32_t buckets[kBuckets];
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+};
+
+std::atomic<uint32_t> g_counters[kCounterCount];
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+HistogramState g_histograms[kHistogramCount];
+
+using report_format::appendf;
+
+size_t bucket_for(uint32_t sample)
+{
+    const size_t bits = sample == 0 ? 0 : 32 - static_cast<size_t>(__builtin_clz(sample));
+    return std::min(bits, kBuckets - 1);
+}
+
+uint32_t bucket_upper(size_t bucket)
+{
+    return bucket == 0 ? 0 : (1u << bucket) - 1;
+}
+
+// Upper bound of the bucket holding the pct-th percentile sample.
+uint32_t percentile(const HistogramState &h, uint32_t pct)
+{
+    if (h.count == 0) {
+        return 0;
+    }
+    const uint64_t rank = (static_cast<uint64_t>(h.count) * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += h.buckets[i];
+        if (seen >= rank) {
+            return std::min(bucket_upper(i), h.max);
+        }
+    }
+    return h.max;
+}
+
+void snapshot_histograms(HistogramState *out)
+{
+    portENTER_CRITICAL(&g_lock);
+    std::copy(std::begin(g_histograms), std::end(g_histograms), out);
+    portEXIT_CRITICAL(&g_lock);
+}
+
+}  // namespace
+
+void IRAM_ATTR add(Counter counter, uint32_t n)
+{
+    g_counters[static_cast<size_t>(counter)].fetch_add(n, std::memory_order_relaxed);
+}
+
+uint32_t value(Counter counter)
+{
+    return g_counters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+}
+
+void observe(Histogram histogram, uint32_t sample)
+{
+    HistogramState &h = g_histograms[static_cast<size_t>(histogram)];
+    const size_t bucket = bucket_for(sample);
+    portENTER_CRITICAL(&g_lock);
+    h.buckets[bucket]++;
+    h.count++;
+    h.sum += sample;
+    h.max = std::max(h.max, sample);
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void reset()
+{
+    for (std::atomic<uint32_t> &counter : g_counters) {
+        counter.store(0);
+    }
+    portENTER_CRITICAL(&g_lock);
+    std::fill(std::begin(g_histograms), std::end(g_histograms), HistogramState{});
+    portEXIT_CRITICAL(&g_lock);
+}
+
+size_t format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    HistogramState histograms[kHistogramCount];
+    snapshot_histograms(histograms);
+
+    size_t used = 0;
+    appendf(out, out_len, &used, "uptime %" PRId64 " s\n", esp_timer_get_time() / 1000000);
+    for (size_t i = 0; i < kCounterCount; ++i) {
+        appendf(out, out_len, &used, "%-15s %10" PRIu32 "\n", kCounterNames[i],
+                g_counters[i].load(std::memory_order_relaxed));
+    }
+    appendf(out, out_len, &used, "%-14s %6s %7s %7s %7s %7s\n", "HISTOGRAM", "COUNT", "AVG", "P50", "P99", "MAX");
+    for (size_t i = 0; i < kHistogramCount; ++i) {
+        const HistogramState &h = histograms[i];
+        const uint32_t avg = h.count > 0 ? static_cast<uint32_t>(h.sum / h.count) : 0;
+        appendf(out, out_len, &used, "%-11s %2s %6" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32 "\n",
+                kHistograms[i].name, kHistograms[i].unit, h.count, avg, percentile(h, 50), percentile(h, 99), h.max);
+    }
+    return used;
+}
+
+esp_err_t append_snapshot(const char *path)
+{
+    if (path == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    FILE *f = std::fopen(path, "a");
+    if (f == nullptr) {
+        ESP_LOGW(kTag, "open %s failed (errno=%d)", path, errno);
+        return ESP_FAIL;
+    }
+
+    HistogramState histograms[kHistogramCount];
+    snapshot_histograms(histograms);
+
+#ifdef POCKETSSH_VERSION
+    const char *build = POCKETSSH_VERSION;
+#else
+    const char *build = "dev";
+#endif
+    std::fprintf(f, "{\"t\":%" PRId64 ",\"build\":\"%s\",\"c\":{", esp_timer_get_time() / 1000000, build);
+    for (size_t i = 0; i < kCounterCount; ++i) {
+        std::fprintf(f, "%s\"%s\":%" PRIu32, i == 0 ? "" : ",", kCounterNames[i],
+                     g_counters[i].load(std::memory_order_relaxed));
+    }
+    std::fputs("},\"h\":{", f);
+    for (size_t i = 0; i < kHistogramCount; ++i) {
+        const HistogramState &h = histograms[i];
+        std::fprintf(f, "%s\"%s_%s\":[%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "]", i == 0 ? "" : ",",
+                     kHistograms[i].name, kHistograms[i].unit, h.count, percentile(h, 50), percentile(h, 99), h.max);
+    }
+    std::fputs("}}\n", f);
+    const bool ok = std::ferror(f) == 0;
+    std::fclose(f);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+}  // namespace metrics
@@ -0,0 +1,270 @@
+#include "power_mgmt.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "esp_clk_tree.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "report_format.hpp"
+
+namespace power_mgmt {
+namespace {
+
+constexpr const char *kTag = "power_mgmt";
+constexpr size_t kLockCount = static_cast<size_t>(Lock::kCount);
+constexpr const char *kLockNames[kLockCount] = {"network", "handshake", "render"};
+
+// Typical ESP32-S3 CPU-side draw (modem sleep, both cores active) used for
+// the estimate in the report; the WiFi radio and backlight come on top.
+constexpr float kCpuMaAtMax = 50.0f;
+constexpr float kCpuMaAtMin = 27.0f;
+
+struct LockState {
+    esp_pm_lock_handle_t handle = nullptr;
+    uint32_t depth = 0;
+    int64_t since_us = 0;
+    int64_t held_us = 0;
+    uint32_t acquisitions = 0;
+};
+
+// Per-mode (index 0: fixed max, 1: DFS) workload timings.
+struct ModeStats {
+    int64_t wall_us = 0;
+    uint32_t frames = 0;
+    int64_t frame_us = 0;
+    uint32_t handshakes = 0;
+    int64_t handshake_us = 0;
+    uint32_t last_handshake_us = 0;
+};
+
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+LockState g_locks[kLockCount];
+uint32_t g_total_depth = 0;
+int64_t g_boost_since_us = 0;
+int64_t g_boost_us = 0;
+int64_t g_window_start_us = 0;
+ModeStats g_modes[2];
+bool g_dfs_enabled = false;
+bool g_light_sleep = false;
+int64_t g_mode_since_us = 0;
+int64_t g_frame_start_us = 0;
+
+using report_format::appendf;
+
+esp_err_t configure(bool dfs, bool light_sleep)
+{
+    esp_pm_config_t cfg = {};
+    cfg.max_freq_mhz = kMaxCpuMhz;
+    cfg.min_freq_mhz = dfs ? kMinCpuMhz : kMaxCpuMhz;
+    cfg.light_sleep_enable = light_sleep;
+    return esp_pm_configure(&cfg);
+}
+
+void render_event_cb(lv_event_t *e)
+{
+    const lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_REFR_START) {
+        acquire(Lock::kRender);
+        g_frame_start_us = esp_timer_get_time();
+    } else if (code == LV_EVENT_REFR_READY) {
+        const int64_t elapsed = esp_timer_get_time() - g_frame_start_us;
+        ModeStats &mode = g_modes[g_dfs_enabled ? 1 : 0];
+        mode.frames++;
+        mode.frame_us += elapsed;
+        release(Lock::kRender);
+    }
+}
+
+}  // namespace
+
+esp_err_t init()
+{
+    for (size_t i = 0; i < kLockCount; ++i) {
+        esp_err_t err = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, kLockNames[i], &g_locks[i].handle);
+        if (err != ESP_OK) {
+            // Without CONFIG_PM_ENABLE the CPU stays at its default frequency.
+            ESP_LOGW(kTag, "pm lock '%s' unavailable (%s)", kLockNames[i], esp_err_to_name(err));
+            g_locks[i].handle = nullptr;
+        }
+    }
+    g_window_start_us = esp_timer_get_time();
+    return set_dfs_enabled(true);
+}
+
+esp_err_t set_dfs_enabled(bool enabled)
+{
+    esp_err_t err = configure(enabled, g_light_sleep);
+    if (err != ESP_OK) {
+        ESP_LOGW(kTag, "esp_pm_configure(%s) failed: %s", enabled ? "dfs" : "fixed", esp_err_to_name(err));
+        g_dfs_enabled = false;
+        return err;
+    }
+    const int64_t now = esp_timer_get_time();
+    if (g_mode_since_us != 0) {
+        g_modes[g_dfs_enabled ? 1 : 0].wall_us += now - g_mode_since_us;
+    }
+    g_mode_since_us = now;
+    g_dfs_enabled = enabled;
+    ESP_LOGI(kTag, "CPU %s (%d-%d MHz)", enabled ? "DFS" : "fixed", enabled ? kMinCpuMhz : kMaxCpuMhz, kMaxCpuMhz);
+    return ESP_OK;
+}
+
+bool dfs_enabled()
+{
+    return g_dfs_enabled;
+}
+
+esp_err_t set_light_sleep_enabled(bool enabled)
+{
+    if (enabled == g_light_sleep) {
+        return ESP_OK;
+    }
+    esp_err_t err = configure(g_dfs_enabled, enabled);
+    if (err != ESP_OK) {
+        ESP_LOGW(kTag, "light sleep %s failed: %s", enabled ? "enable" : "disable", esp_err_to_name(err));
+        return err;
+    }
+    g_light_sleep = enabled;
+    ESP_LOGD(kTag, "light sleep %s", enabled ? "on" : "off");
+    return ESP_OK;
+}
+
+bool light_sleep_enabled()
+{
+    return g_light_sleep;
+}
+
+void acquire(Lock lock)
+{
+    LockState &state = g_locks[static_cast<size_t>(lock)];
+    if (state.handle != nullptr) {
+        esp_pm_lock_acquire(state.handle);
+    }
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_lock);
+    if (state.depth++ == 0) {
+        state.since_us = now;
+        state.acquisitions++;
+    }
+    if (g_total_depth++ == 0) {
+        g_boost_since_us = now;
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+void release(Lock lock)
+{
+    LockState &state = g_locks[static_cast<size_t>(lock)];
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_lock);
+    if (state.depth > 0 && --state.depth == 0) {
+        state.held_us += now - state.since_us;
+    }
+    if (g_total_depth > 0 && --g_total_depth == 0) {
+        g_boost_us += now - g_boost_since_us;
+    }
+    portEXIT_CRITICAL(&g_lock);
+    if (state.handle != nullptr) {
+        esp_pm_lock_release(state.handle);
+    }
+}
+
+void attach_render_hooks(lv_display_t *disp)
+{
+    if (disp == nullptr) {
+        return;
+    }
+    lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_REFR_READY, nullptr);
+}
+
+void record_handshake_us(uint32_t us)
+{
+    ModeStats &mode = g_modes[g_dfs_enabled ? 1 : 0];
+    mode.handshakes++;
+    mode.handshake_us += us;
+    mode.last_handshake_us = us;
+    ESP_LOGI(kTag, "handshake %" PRIu32 " ms (%s)", us / 1000, g_dfs_enabled ? "dfs" : "fixed");
+}
+
+void reset_stats()
+{
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_lock);
+    for (LockState &state : g_locks) {
+        state.held_us = 0;
+        state.acquisitions = 0;
+        state.since_us = now;
+    }
+    g_boost_us = 0;
+    g_boost_since_us = now;
+    g_window_start_us = now;
+    portEXIT_CRITICAL(&g_lock);
+    for (ModeStats &mode : g_modes) {
+        mode = ModeStats{};
+    }
+    g_mode_since_us = now;
+}
+
+size_t format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    // Snapshot, counting locks that are still held up to now.
+    const int64_t now = esp_timer_get_time();
+    int64_t held_us[kLockCount];
+    uint32_t acquisitions[kLockCount];
+    portENTER_CRITICAL(&g_lock);
+    for (size_t i = 0; i < kLockCount; ++i) {
+        held_us[i] = g_locks[i].held_us + (g_locks[i].depth > 0 ? now - g_locks[i].since_us : 0);
+        acquisitions[i] = g_locks[i].acquisitions;
+    }
+    const int64_t boost_us = g_boost_us + (g_total_depth > 0 ? now - g_boost_since_us : 0);
+    const int64_t window_us = std::max<int64_t>(1, now - g_window_start_us);
+    portEXIT_CRITICAL(&g_lock);
+
+    uint32_t cpu_hz = 0;
+    esp_clk_tree_src_get_freq_hz(SOC_MOD_CLK_CPU, ESP_CLK_TREE_SRC_FREQ_PRECISION_CACHED, &cpu_hz);
+
+    size_t used = 0;
+    appendf(out, out_len, &used, "dfs: %s, cpu now %" PRIu32 " MHz\n",
+            g_dfs_enabled ? "on (80-240 MHz)" : "off (240 MHz)", cpu_hz / 1000000);
+    appendf(out, out_len, &used, "light sleep: %s\n", g_light_sleep ? "on" : "off");
+    appendf(out, out_len, &used, "window %" PRId64 " s\n", window_us / 1000000);
+    appendf(out, out_len, &used, "%-10s %6s %7s\n", "LOCK", "HELD", "ACQ");
+    for (size_t i = 0; i < kLockCount; ++i) {
+        appendf(out, out_len, &used, "%-10s %5.1f%% %7" PRIu32 "\n", kLockNames[i],
+                100.0 * static_cast<double>(held_us[i]) / static_cast<double>(window_us), acquisitions[i]);
+    }
+
+    static const char *const kModeNames[2] = {"fixed", "dfs"};
+    for (int m = 0; m < 2; ++m) {
+        const ModeStats &mode = g_modes[m];
+        const int64_t wall_us = mode.wall_us + ((g_dfs_enabled ? 1 : 0) == m ? now - g_mode_since_us : 0);
+        if (mode.frames > 0 && wall_us > 0) {
+            appendf(out, out_len, &used, "render[%s]: %.1f fps, %.1f ms/frame\n", kModeNames[m],
+                    mode.frames * 1e6 / static_cast<double>(wall_us),
+                    static_cast<double>(mode.frame_us) / 1000.0 / mode.frames);
+        }
+        if (mode.handshakes > 0) {
+            appendf(out, out_len, &used, "handshake[%s]: last %" PRIu32 " ms, avg %" PRId64 " ms (%" PRIu32 ")\n",
+                    kModeNames[m], mode.last_handshake_us / 1000,
+                    mode.handshake_us / 1000 / mode.handshakes, mode.handshakes);
+        }
+    }
+
+    const double duty = static_cast<double>(boost_us) / static_cast<double>(window_us);
+    const double est_ma = g_dfs_enabled ? duty * kCpuMaAtMax + (1.0 - duty) * kCpuMaAtMin : kCpuMaAtMax;
+    appendf(out, out_len, &used, "max-freq duty %.1f%%, est CPU %.0f mA (fixed: %.0f mA)\n",
+            duty * 100.0, est_ma, static_cast<double>(kCpuMaAtMax));
+    return used;
+}
+
+}  // namespace power_mgmt
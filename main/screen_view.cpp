@@ -0,0 +1,127 @@
+#include "screen_view.hpp"
+
+namespace screen_view {
+
+lv_obj_t *View::create(lv_obj_t *parent)
+{
+    column_ = lv_obj_create(parent);
+    lv_obj_set_flex_flow(column_, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(column_, 0, 0);
+    lv_obj_set_scroll_dir(column_, LV_DIR_VER);
+    lv_obj_add_flag(column_, LV_OBJ_FLAG_HIDDEN);
+
+    top_ = 0;
+    history_ = 0;
+    last_row_ = vt_screen::kRows - 1;
+    for (uint16_t p = 0; p < vt_screen::kRingRows; ++p) {
+        lv_obj_t *row = lv_label_create(column_);
+        rows_[(top_ + vt_screen::kRows + p) % vt_screen::kRingRows] = row;
+        lv_obj_set_width(row, lv_pct(100));
+        lv_label_set_text(row, "");
+        // Hidden while unused: an empty label still takes a line.
+        if (!in_use(p)) {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    return column_;
+}
+
+void View::set_shown(bool shown)
+{
+    if (column_ == nullptr) {
+        return;
+    }
+    if (shown) {
+        lv_obj_clear_flag(column_, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(column_, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void View::apply(const vt_screen::Frame &frame)
+{
+    if (column_ == nullptr) {
+        return;
+    }
+    // Taken before the labels change, from the layout the user is looking at.
+    const bool at_bottom = lv_obj_get_scroll_bottom(column_) <= 0;
+
+    // Rotate the column to the frame's top: scrolling wraps the labels at
+    // the top round to the bottom, a reverse scroll the other way. Each
+    // label moved is one child reordered; its text is not touched.
+    const uint16_t shift = (frame.top + vt_screen::kRingRows - top_) % vt_screen::kRingRows;
+    if (shift <= vt_screen::kRingRows / 2) {
+        for (uint16_t p = 0; p < shift; ++p) {
+            lv_obj_move_foreground(at(p));
+        }
+    } else {
+        for (uint16_t p = vt_screen::kRingRows; p-- > shift;) {
+            lv_obj_move_background(at(p));
+        }
+    }
+    top_ = frame.top;
+    history_ = frame.history;
+    last_row_ = frame.last_row;
+
+    for (uint16_t s = 0; s < vt_screen::kRingRows; ++s) {
+        if ((frame.rows & (vt_screen::RowMask{1} << s)) != 0) {
+            lv_label_set_text(rows_[s], frame.text[s]);
+        }
+    }
+    // Only labels whose state changes: showing one invalidates it.
+    for (uint16_t p = 0; p < vt_screen::kRingRows; ++p) {
+        lv_obj_t *row = at(p);
+        const bool hidden = lv_obj_has_flag(row, LV_OBJ_FLAG_HIDDEN);
+        if (in_use(p) == hidden) {
+            if (hidden) {
+                lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+            } else {
+                lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+    }
+
+    if (at_bottom) {
+        lv_obj_update_layout(column_);
+        if (lv_obj_get_scroll_bottom(column_) > 0) {
+            lv_obj_scroll_to_y(column_, LV_COORD_MAX, LV_ANIM_OFF);
+        }
+    }
+}
+
+bool View::in_use(uint16_t position) const
+{
+    return position + history_ >= vt_screen::kScrollbackRows &&
+           position <= vt_screen::kScrollbackRows + last_row_;
+}
+
+void View::clear()
+{
+    if (column_ == nullptr) {
+        return;
+    }
+    for (lv_obj_t *row : rows_) {
+        lv_label_set_text(row, "");
+    }
+    history_ = 0;
+    for (uint16_t p = 0; p < vt_screen::kScrollbackRows; ++p) {
+        lv_obj_add_flag(at(p), LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void View::text(std::string *out) const
+{
+    out->clear();
+    if (column_ == nullptr) {
+        return;
+    }
+    const uint16_t last = vt_screen::kScrollbackRows + last_row_;
+    for (uint16_t p = vt_screen::kScrollbackRows - history_; p <= last; ++p) {
+        out->append(lv_label_get_text(at(p)));
+        if (p < last) {
+            out->push_back('\n');
+        }
+    }
+}
+
+}  // namespace screen_view
@@ -0,0 +1,503 @@
+#include "ssh_config.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <limits>
+#include <set>
+
+namespace ssh_config {
+namespace {
+
+std::string trim_ascii(const std::string &value)
+{
+    size_t start = 0;
+    while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])) != 0) {
+        ++start;
+    }
+
+    size_t end = value.size();
+    while (end > start && std::isspace(static_cast<unsigned char>(value[end - 1])) != 0) {
+        --end;
+    }
+
+    return value.substr(start, end - start);
+}
+
+std::string strip_inline_comment(const std::string &line)
+{
+    bool in_quotes = false;
+    char quote_char = '\0';
+
+    for (size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if ((c == '"' || c == '\'') && (!in_quotes || c == quote_char)) {
+            if (in_quotes) {
+                in_quotes = false;
+                quote_char = '\0';
+            } else {
+                in_quotes = true;
+                quote_char = c;
+            }
+            continue;
+        }
+        if (!in_quotes && c == '#') {
+            return line.substr(0, i);
+        }
+    }
+    return line;
+}
+
+std::string trim_matching_quotes(const std::string &value)
+{
+    if (value.size() >= 2) {
+        const char first = value.front();
+        const char last = value.back();
+        if ((first == '"' && last == '"') || (first == '\'' && last == '\'')) {
+            return value.substr(1, value.size() - 2);
+        }
+    }
+    return value;
+}
+
+bool split_directive(const std::string &line, std::string *key, std::string *value)
+{
+    if (key == nullptr || value == nullptr) {
+        return false;
+    }
+
+    const size_t eq = line.find('=');
+    if (eq != std::string::npos) {
+        *key = trim_ascii(line.substr(0, eq));
+        *value = trim_ascii(line.substr(eq + 1));
+        return !key->empty() && !value->empty();
+    }
+
+    const size_t ws = line.find_first_of(" \t");
+    if (ws == std::string::npos) {
+        return false;
+    }
+
+    *key = trim_ascii(line.substr(0, ws));
+    *value = trim_ascii(line.substr(ws + 1));
+    return !key->empty() && !value->empty();
+}
+
+bool parse_int32(const std::string &value, int *out)
+{
+    if (out == nullptr || value.empty()) {
+        return false;
+    }
+
+    char *end = nullptr;
+    const long parsed = std::strtol(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0') {
+        return false;
+    }
+    if (parsed < std::numeric_limits<int>::min() || parsed > std::numeric_limits<int>::max()) {
+        return false;
+    }
+
+    *out = static_cast<int>(parsed);
+    return true;
+}
+
+bool parse_bool_flag(const std::string &value, bool *out)
+{
+    if (out == nullptr) {
+        return false;
+    }
+
+    const std::string lowered = lowercase_ascii(trim_ascii(value));
+    if (lowered == "yes" || lowered == "true" || lowered == "on" || lowered == "1") {
+        *out = true;
+        return true;
+    }
+    if (lowered == "no" || lowered == "false" || lowered == "off" || lowered == "0") {
+        *out = false;
+        return true;
+    }
+    return false;
+}
+
+std::string expand_identity_file_path(std::string path)
+{
+    path = trim_matching_quotes(trim_ascii(path));
+    if (path.empty()) {
+        return path;
+    }
+
+    if (path.rfind("~/.ssh/", 0) == 0) {
+        return std::string(kKeysRoot) + path.substr(7);
+    }
+
+    if (path.rfind("/sdcard/ssh_keys/", 0) == 0) {
+        return path;
+    }
+
+    if (path[0] != '/') {
+        return std::string(kKeysRoot) + path;
+    }
+
+    return path;
+}
+
+bool host_block_matches(const HostBlock &block, const std::string &alias)
+{
+    bool has_positive = false;
+    bool positive_match = false;
+
+    for (const std::string &raw_pattern : block.patterns) {
+        if (raw_pattern.empty()) {
+            continue;
+        }
+
+        if (raw_pattern[0] == '!') {
+            const std::string neg = raw_pattern.substr(1);
+            if (!neg.empty() && wildcard_match(neg, alias)) {
+                return false;
+            }
+            continue;
+        }
+
+        has_positive = true;
+        if (wildcard_match(raw_pattern, alias)) {
+            positive_match = true;
+        }
+    }
+
+    return has_positive && positive_match;
+}
+
+void apply_option(const std::string &directive, const std::string &raw_value, Options *target)
+{
+    if (target == nullptr) {
+        return;
+    }
+
+    const std::string value = trim_matching_quotes(trim_ascii(raw_value));
+
+    if (directive == "hostname") {
+        target->host_name = value;
+        target->has_host_name = true;
+        return;
+    }
+    if (directive == "user") {
+        target->user = value;
+        target->has_user = true;
+        return;
+    }
+    if (directive == "port") {
+        int parsed_port = 0;
+        if (parse_int32(value, &parsed_port) && parsed_port > 0 && parsed_port <= 65535) {
+            target->port = parsed_port;
+            target->has_port = true;
+        }
+        return;
+    }
+    if (directive == "identityfile") {
+        const std::string expanded = expand_identity_file_path(value);
+        if (!expanded.empty()) {
+            target->identity_files.push_back(expanded);
+        }
+        return;
+    }
+    if (directive == "identitiesonly") {
+        bool parsed = false;
+        if (parse_bool_flag(value, &parsed)) {
+            target->identities_only = parsed;
+            target->has_identities_only = true;
+        }
+        return;
+    }
+    if (directive == "connecttimeout") {
+        int timeout = 0;
+        if (parse_int32(value, &timeout) && timeout >= 0) {
+            target->connect_timeout = timeout;
+            target->has_connect_timeout = true;
+        }
+        return;
+    }
+    if (directive == "serveraliveinterval") {
+        int interval = 0;
+        if (parse_int32(value, &interval) && interval >= 0) {
+            target->server_alive_interval = interval;
+            target->has_server_alive_interval = true;
+        }
+        return;
+    }
+    if (directive == "serveralivecountmax") {
+        int max_count = 0;
+        if (parse_int32(value, &max_count) && max_count >= 0) {
+            target->server_alive_count_max = max_count;
+            target->has_server_alive_count_max = true;
+        }
+        return;
+    }
+    if (directive == "stricthostkeychecking") {
+        target->strict_host_key_checking = lowercase_ascii(value);
+        target->has_strict_host_key_checking = true;
+        return;
+    }
+    if (directive == "network" || directive == "tpagernetwork") {
+        target->network = value;
+        target->has_network = true;
+        return;
+    }
+}
+
+void merge_options(const Options &source, Options *target)
+{
+    if (target == nullptr) {
+        return;
+    }
+
+    if (source.has_host_name) {
+        target->host_name = source.host_name;
+        target->has_host_name = true;
+    }
+    if (source.has_user) {
+        target->user = source.user;
+        target->has_user = true;
+    }
+    if (source.has_port) {
+        target->port = source.port;
+        target->has_port = true;
+    }
+    if (source.has_identities_only) {
+        target->identities_only = source.identities_only;
+        target->has_identities_only = true;
+    }
+    if (!source.identity_files.empty()) {
+        target->identity_files.insert(target->identity_files.end(),
+                                      source.identity_files.begin(),
+                                      source.identity_files.end());
+    }
+    if (source.has_connect_timeout) {
+        target->connect_timeout = source.connect_timeout;
+        target->has_connect_timeout = true;
+    }
+    if (source.has_server_alive_interval) {
+        target->server_alive_interval = source.server_alive_interval;
+        target->has_server_alive_interval = true;
+    }
+    if (source.has_server_alive_count_max) {
+        target->server_alive_count_max = source.server_alive_count_max;
+        target->has_server_alive_count_max = true;
+    }
+    if (source.has_strict_host_key_checking) {
+        target->strict_host_key_checking = source.strict_host_key_checking;
+        target->has_strict_host_key_checking = true;
+    }
+    if (source.has_network) {
+        target->network = source.network;
+        target->has_network = true;
+    }
+}
+
+}  // namespace
+
+std::vector<std::string> split_nonempty_whitespace(const std::string &input)
+{
+    std::vector<std::string> parts;
+    std::string token;
+    for (char c : input) {
+        if (c == ' ' || c == '\t') {
+            if (!token.empty()) {
+                parts.push_back(token);
+                token.clear();
+            }
+            continue;
+        }
+        token.push_back(c);
+    }
+    if (!token.empty()) {
+        parts.push_back(token);
+    }
+    return parts;
+}
+
+std::vector<std::string> split_quoted_arguments(const std::string &input, size_t start_pos)
+{
+    std::vector<std::string> args;
+    std::string token;
+    bool in_quotes = false;
+    char quote_char = '\0';
+
+    for (size_t i = start_pos; i < input.size(); ++i) {
+        const char c = input[i];
+
+        if ((c == '"' || c == '\'') && (!in_quotes || c == quote_char)) {
+            if (in_quotes) {
+                in_quotes = false;
+                quote_char = '\0';
+            } else {
+                in_quotes = true;
+                quote_char = c;
+            }
+            continue;
+        }
+
+        if (!in_quotes && (c == ' ' || c == '\t')) {
+            if (!token.empty()) {
+                args.push_back(token);
+                token.clear();
+            }
+            continue;
+        }
+
+        token.push_back(c);
+    }
+
+    if (!token.empty()) {
+        args.push_back(token);
+    }
+
+    return args;
+}
+
+std::string lowercase_ascii(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return value;
+}
+
+std::string base_name(const std::string &path)
+{
+    const size_t sep = path.find_last_of('/');
+    if (sep == std::string::npos) {
+        return path;
+    }
+    return path.substr(sep + 1);
+}
+
+bool wildcard_match(const std::string &pattern, const std::string &candidate)
+{
+    const std::string pat = lowercase_ascii(pattern);
+    const std::string text = lowercase_ascii(candidate);
+
+    size_t p = 0;
+    size_t t = 0;
+    size_t star = std::string::npos;
+    size_t match = 0;
+
+    while (t < text.size()) {
+        if (p < pat.size() && (pat[p] == '?' || pat[p] == text[t])) {
+            ++p;
+            ++t;
+        } else if (p < pat.size() && pat[p] == '*') {
+            star = p++;
+            match = t;
+        } else if (star != std::string::npos) {
+            p = star + 1;
+            t = ++match;
+        } else {
+            return false;
+        }
+    }
+
+    while (p < pat.size() && pat[p] == '*') {
+        ++p;
+    }
+
+    return p == pat.size();
+}
+
+bool parse(FILE *file, Config *parsed)
+{
+    if (file == nullptr || parsed == nullptr) {
+        return false;
+    }
+
+    *parsed = {};
+
+    std::set<std::string> alias_seen;
+    HostBlock *active_host = nullptr;
+    bool saw_host = false;
+    char line_buffer[512];
+    while (std::fgets(line_buffer, sizeof(line_buffer), file) != nullptr) {
+        std::string line = line_buffer;
+        line = trim_ascii(strip_inline_comment(line));
+        if (line.empty()) {
+            continue;
+        }
+
+        std::string key;
+        std::string value;
+        if (!split_directive(line, &key, &value)) {
+            continue;
+        }
+
+        const std::string directive = lowercase_ascii(key);
+        if (directive == "host") {
+            const std::vector<std::string> patterns = split_nonempty_whitespace(value);
+            if (patterns.empty()) {
+                continue;
+            }
+
+            saw_host = true;
+            parsed->host_blocks.push_back({});
+            active_host = &parsed->host_blocks.back();
+            active_host->patterns = patterns;
+
+            for (const std::string &pattern : patterns) {
+                if (pattern.empty() || pattern[0] == '!') {
+                    continue;
+                }
+                if (pattern.find('*') != std::string::npos || pattern.find('?') != std::string::npos) {
+                    continue;
+                }
+                if (alias_seen.insert(pattern).second) {
+                    parsed->aliases.push_back(pattern);
+                }
+            }
+            continue;
+        }
+
+        Options *target = (!saw_host || active_host == nullptr)
+                              ? &parsed->global_options
+                              : &active_host->options;
+        apply_option(directive, value, target);
+    }
+
+    return std::ferror(file) == 0;
+}
+
+bool resolve(const Config &config, const std::string &alias, Resolved *resolved)
+{
+    if (resolved == nullptr || alias.empty()) {
+        return false;
+    }
+
+    Options effective = {};
+    merge_options(config.global_options, &effective);
+
+    bool matched = false;
+    for (const auto &block : config.host_blocks) {
+        if (host_block_matches(block, alias)) {
+            merge_options(block.options, &effective);
+            matched = true;
+        }
+    }
+
+    if (!matched) {
+        return false;
+    }
+
+    resolved->matched = true;
+    resolved->alias = alias;
+    resolved->host_name = effective.has_host_name ? effective.host_name : alias;
+    resolved->user = effective.has_user ? effective.user : "";
+    resolved->port = effective.has_port ? effective.port : 22;
+    resolved->identities_only = effective.has_identities_only ? effective.identities_only : false;
+    resolved->identity_files = effective.identity_files;
+    resolved->strict_host_key_checking = effective.has_strict_host_key_checking
+                                             ? effective.strict_host_key_checking
+                                             : "ask";
+    resolved->network = effective.has_network ? effective.network : "";
+    return true;
+}
+
+}  // namespace ssh_config
@@ -5,27 +5,38 @@
  */
 
 #include "ssh_terminal.hpp"
+#include "board_traits.hpp"
+#include "event_trace.hpp"
+#include "history_store.hpp"
+#include "job_runner.hpp"
+#include "key_store.hpp"
+#include "mailbox.hpp"
+#include "mem_monitor.hpp"
+#include "metrics.hpp"
+#include "power_mgmt.hpp"
+#include "ssh_config.hpp"
+#include "task_layout.hpp"
+#include "task_stats.hpp"
+#include "terminal_text.hpp"
+#include "vt_screen.hpp"
+#include "work_budget.hpp"
 #include "esp_log.h"
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_netif.h"
 #include "esp_timer.h"
-#include "esp_heap_caps.h"
-#include "nvs_flash.h"
-#include "nvs.h"
+#include "esp_vfs_eventfd.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
+#include "freertos/semphr.h"
 #include "lwip/err.h"
 #include "lwip/sys.h"
 #include "lwip/sockets.h"
 #include "lwip/netdb.h"
 #if defined(TPAGER_TARGET)
-#include "esp_lvgl_port.h"
-#include "tpager_sd.hpp"
-#else
-#include "bsp/esp-bsp.h"
-#include "bsp/display.h"
+#include "input_replay.hpp"
+#include "tpager_backlight.hpp"
 #endif
 #include <cstring>
 #include <algorithm>
@@ -33,8 +44,6 @@
 #include <cctype>
 #include <cstdlib>
 #include <cstdio>
-#include <limits>
-#include <set>
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/socket.h>
@@ -43,6 +52,7 @@
 #include <unistd.h>
 #include <sys/select.h>
 #include <cerrno>
+#include <cmath>
 
 static const char *TAG = "SSH_TERMINAL";
 
@@ -51,20 +61,22 @@ namespace {
 // are disabled in sdkconfig/LVGL.
 bool display_lock(uint32_t timeout_ms)
 {
-#if defined(TPAGER_TARGET)
-    return lvgl_port_lock(timeout_ms);
-#else
-    return bsp_display_lock(timeout_ms);
-#endif
+    event_trace::record(event_trace::Event::kLvglLockWait);
+    const int64_t start_us = esp_timer_get_time();
+    const bool locked = board::Current::display_lock(timeout_ms);
+    event_trace::record(event_trace::Event::kLvglLockAcquired, locked ? 1 : 0);
+    if (locked) {
+        metrics::observe(metrics::Histogram::kLockWaitUs, (uint32_t)(esp_timer_get_time() - start_us));
+    } else {
+        metrics::add(metrics::Counter::kLockTimeouts);
+    }
+    return locked;
 }
 
 void display_unlock()
 {
-#if defined(TPAGER_TARGET)
-    lvgl_port_unlock();
-#else
-    bsp_display_unlock();
-#endif
+    event_trace::record(event_trace::Event::kLvglLockRelease);
+    board::Current::display_unlock();
 }
 
 const lv_font_t* ui_font_small()
@@ -91,14 +103,201 @@ const lv_font_t* ui_font_body()
 #endif
 }
 
-void log_heap_snapshot(const char *stage)
+// libssh2 session allocator: everything the session allocates is tagged so
+// `mem` can attribute it.
+LIBSSH2_ALLOC_FUNC(ssh_alloc)
+{
+    (void)abstract;
+    return mem_monitor::tagged_malloc(mem_monitor::Tag::kLibssh2, count);
+}
+
+LIBSSH2_REALLOC_FUNC(ssh_realloc)
+{
+    (void)abstract;
+    return mem_monitor::tagged_realloc(mem_monitor::Tag::kLibssh2, ptr, count);
+}
+
+LIBSSH2_FREE_FUNC(ssh_free)
+{
+    (void)abstract;
+    mem_monitor::tagged_free(ptr);
+}
+
+// Long-lived terminal tasks and the receive buffer live in .bss (one
+// terminal per device). ssh_rx is started with the UI and parked between
+// sessions instead of being created on each connect.
+task_layout::StaticTask<task_layout::kStatusSampler> g_status_sampler_task;
+task_layout::StaticTask<task_layout::kSshRx> g_ssh_rx_task;
+char g_rx_buffer[1024];
+
+// The session's screen. ssh_rx parses each read from g_rx_buffer into it;
+// the LVGL task copies the changed rows into g_screen_frame when a kScreen
+// nudge arrives. Both hold g_screen_lock (ScreenLock) for one read (feed)
+// or one copy (take_frame).
+vt_screen::Screen g_screen;
+StaticSemaphore_t g_screen_lock_buffer;
+SemaphoreHandle_t g_screen_lock = nullptr;
+vt_screen::Frame g_screen_frame;
+// Set while a kScreen nudge is queued, so a burst of reads costs one frame.
+std::atomic<bool> g_screen_posted{false};
+// Set from kAttachScreen until the session ends. Meanwhile session_view
+// shows the grid and its scrollback in place of the textarea, so
+// append_text() writes into the grid as well.
+std::atomic<bool> g_screen_attached{false};
+// The textarea outside sessions: append_text() starts over past 80% of
+// this, and a session handed back to it keeps its last half.
+constexpr size_t kOutputTextMax = 4096;
+
+// To ssh_rx: bytes for the channel, or a request to end the session.
+struct NetMessage {
+    enum class Kind : uint8_t { kWrite, kResetByteCount, kDisconnect };
+    Kind kind;
+    uint8_t len;
+    char data[62];
+};
+
+// To the LVGL task: one terminal_text piece, the byte counter, or a nudge
+// to refresh the status bar, report memory use, hand the widget over to
+// g_screen or redraw it from g_screen.
+struct UiMessage {
+    enum class Kind : uint8_t { kText, kByteCount, kStatusBar, kMemoryReport, kAttachScreen, kScreen };
+    Kind kind;
+    size_t bytes;
+    char text[terminal_text::kFlushChunk + 1];
+};
+
+constexpr size_t kNetMailboxDepth = 16;
+constexpr size_t kUiMailboxDepth = 16;
+// How long the input task waits for room before giving up on a post.
+constexpr TickType_t kNetPostWait = pdMS_TO_TICKS(50);
+// The command worker waits longer: its output is the only progress report
+// the user gets, and nothing else is queued behind it.
+constexpr TickType_t kJobPostWait = pdMS_TO_TICKS(200);
+constexpr uint32_t kUiDrainPeriodMs = 20;
+// Without an eventfd to wake it, ssh_rx checks its mailbox this often.
+constexpr int kNetPollFallbackMs = 20;
+
+mailbox::Mailbox<NetMessage, kNetMailboxDepth> g_net_mailbox("net", metrics::Histogram::kNetQueueDepth);
+mailbox::Mailbox<UiMessage, kUiMailboxDepth> g_ui_mailbox("ui", metrics::Histogram::kUiQueueDepth);
+// Written after each post to g_net_mailbox so ssh_rx leaves select().
+int g_net_wake_fd = -1;
+
+// Holds g_screen_lock for its scope. A mutex rather than a portMUX: a feed
+// or a render runs for tens of microseconds, too long to spin with
+// interrupts masked on the other core.
+class ScreenLock {
+public:
+    ScreenLock()
+    {
+        xSemaphoreTake(g_screen_lock, portMAX_DELAY);
+    }
+
+    ~ScreenLock()
+    {
+        xSemaphoreGive(g_screen_lock);
+    }
+
+    ScreenLock(const ScreenLock&) = delete;
+    ScreenLock& operator=(const ScreenLock&) = delete;
+};
+
+void init_mailboxes()
+{
+    g_net_mailbox.init();
+    g_ui_mailbox.init();
+    if (g_screen_lock == nullptr) {
+        g_screen_lock = xSemaphoreCreateMutexStatic(&g_screen_lock_buffer);
+    }
+    if (g_net_wake_fd >= 0) {
+        return;
+    }
+    const esp_vfs_eventfd_config_t config = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+    const esp_err_t err = esp_vfs_eventfd_register(&config);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "eventfd register failed: %s; ssh_rx polls its mailbox", esp_err_to_name(err));
+        return;
+    }
+    g_net_wake_fd = eventfd(0, 0);
+    if (g_net_wake_fd < 0) {
+        ESP_LOGW(TAG, "eventfd failed (errno=%d); ssh_rx polls its mailbox", errno);
+    }
+}
+
+bool post_net(const NetMessage &msg)
+{
+    const bool ok = g_net_mailbox.post(msg, kNetPostWait);
+    if (g_net_wake_fd >= 0) {
+        const uint64_t one = 1;
+        write(g_net_wake_fd, &one, sizeof(one));
+    }
+    return ok;
+}
+
+// Queue `len` bytes for the channel in order; false if ssh_rx fell behind.
+bool post_net_bytes(const char *data, size_t len)
+{
+    NetMessage msg = {};
+    msg.kind = NetMessage::Kind::kWrite;
+    for (size_t offset = 0; offset < len; offset += msg.len) {
+        msg.len = static_cast<uint8_t>(std::min(sizeof(msg.data), len - offset));
+        std::memcpy(msg.data, data + offset, msg.len);
+        if (!post_net(msg)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Queue `text` for the terminal widget in kFlushChunk pieces.
+bool post_ui_text(const char *text, TickType_t wait)
+{
+    UiMessage msg = {};
+    msg.kind = UiMessage::Kind::kText;
+    const size_t len = std::strlen(text);
+    for (size_t offset = 0; offset < len; offset += terminal_text::kFlushChunk) {
+        const size_t piece = std::min(terminal_text::kFlushChunk, len - offset);
+        std::memcpy(msg.text, text + offset, piece);
+        msg.text[piece] = '\0';
+        if (!g_ui_mailbox.post(msg, wait)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool post_ui(UiMessage::Kind kind, size_t bytes = 0, TickType_t wait = 0)
+{
+    UiMessage msg = {};
+    msg.kind = kind;
+    msg.bytes = bytes;
+    return g_ui_mailbox.post(msg, wait);
+}
+
+// Ask the LVGL task to redraw from g_screen, unless a nudge is already
+// queued: it renders whatever the grid holds when it gets to it. A full
+// mailbox is retried on the next call.
+void request_screen()
 {
-    const uint32_t free8 = heap_caps_get_free_size(MALLOC_CAP_8BIT);
-    const uint32_t largest8 = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
-    const uint32_t free32 = heap_caps_get_free_size(MALLOC_CAP_32BIT);
-    const uint32_t largest32 = heap_caps_get_largest_free_block(MALLOC_CAP_32BIT);
-    ESP_LOGI(TAG, "heap[%s] free8=%" PRIu32 " largest8=%" PRIu32 " free32=%" PRIu32 " largest32=%" PRIu32,
-             stage, free8, largest8, free32, largest32);
+    bool posted = false;
+    if (g_screen_posted.compare_exchange_strong(posted, true) && !post_ui(UiMessage::Kind::kScreen)) {
+        g_screen_posted = false;
+    }
+}
+
+// Start of the longest run of whole lines at the end of `text` that fits
+// in `max_len` bytes.
+const char *tail_lines(const char *text, size_t max_len)
+{
+    const size_t len = std::strlen(text);
+    if (len <= max_len) {
+        return text;
+    }
+    const char *start = text + len - max_len;
+    if (start[-1] != '\n') {
+        const char *next = std::strchr(start, '\n');
+        start = next != nullptr ? next + 1 : text + len;
+    }
+    return start;
 }
 }  // namespace
 
@@ -113,13 +312,28 @@ static esp_event_handler_instance_t s_instance_any_id = NULL;
 static esp_event_handler_instance_t s_instance_got_ip = NULL;
 
 namespace {
-#if defined(TPAGER_TARGET)
+// Where the SD card shares the display SPI bus, the mount holds the display
+// lock for its lifetime. The lock is recursive: callers on the input task
+// already hold it, the command worker does not. Boards without runtime SD
+// access leave the card alone; file opens then fail as "not found".
+constexpr uint32_t kSdLockTimeoutMs = 1000;
+
 class ScopedSDMount {
 public:
     ScopedSDMount()
     {
-        tpager::SdDiagStats stats = {};
-        const esp_err_t ret = tpager::sd_mount_and_scan_keys(&stats);
+        if (!board::Current::kRuntimeSd) {
+            return;
+        }
+        if (board::Current::kSdSharesDisplayBus) {
+            if (!display_lock(kSdLockTimeoutMs)) {
+                ESP_LOGW(TAG, "SD access skipped: display lock busy");
+                ok_ = false;
+                return;
+            }
+            locked_ = true;
+        }
+        const esp_err_t ret = board::Current::sd_mount();
         if (ret != ESP_OK) {
             ESP_LOGW(TAG, "Failed to mount SD for runtime file access: %s", esp_err_to_name(ret));
             ok_ = false;
@@ -130,76 +344,38 @@ public:
 
     ~ScopedSDMount()
     {
-        if (!mounted_) {
-            return;
+        if (mounted_) {
+            ESP_ERROR_CHECK_WITHOUT_ABORT(board::Current::sd_unmount());
+        }
+        if (locked_) {
+            display_unlock();
         }
-        ESP_ERROR_CHECK_WITHOUT_ABORT(tpager::sd_unmount());
     }
 
     bool ok() const { return ok_; }
 
 private:
     bool ok_ = true;
+    bool locked_ = false;
     bool mounted_ = false;
 };
-#endif
 
 constexpr const char *kSshConfigPath = "/sdcard/ssh_keys/ssh_config";
-constexpr const char *kSshKeysRoot = "/sdcard/ssh_keys/";
 constexpr const char *kSshKeysDir = "/sdcard/ssh_keys";
+constexpr const char *kTracePath = "/sdcard/trace.json";
+constexpr const char *kStatsPath = "/sdcard/stats.jsonl";
 
-struct SSHConfigOptions {
-    bool has_host_name = false;
-    std::string host_name;
-
-    bool has_user = false;
-    std::string user;
-
-    bool has_port = false;
-    int port = 22;
+// ETX stops the running built-in; with none running it is the remote's ^C.
+constexpr char kCancelKey = '\x03';
+// While a session is up, lines go to the remote shell; only lines starting
+// with this run built-ins (":top"), so `top` or `mem` typed for the remote
+// host are not taken over locally.
+constexpr char kBuiltinPrefix = ':';
 
-    bool has_identities_only = false;
-    bool identities_only = false;
-    std::vector<std::string> identity_files;
-
-    bool has_connect_timeout = false;
-    int connect_timeout = 0;
-
-    bool has_server_alive_interval = false;
-    int server_alive_interval = 0;
-
-    bool has_server_alive_count_max = false;
-    int server_alive_count_max = 0;
-
-    bool has_strict_host_key_checking = false;
-    std::string strict_host_key_checking;
-
-    bool has_network = false;
-    std::string network;
-};
-
-struct SSHConfigHostBlock {
-    std::vector<std::string> patterns;
-    SSHConfigOptions options;
-};
-
-struct SSHConfigFile {
-    SSHConfigOptions global_options;
-    std::vector<SSHConfigHostBlock> host_blocks;
-    std::vector<std::string> aliases;
-};
-
-struct ResolvedSSHConfig {
-    bool matched = false;
-    std::string alias;
-    std::string host_name;
-    std::string user;
-    int port = 22;
-    bool identities_only = false;
-    std::vector<std::string> identity_files;
-    std::string strict_host_key_checking = "ask";
-    std::string network;
-};
+using ssh_config::base_name;
+using ssh_config::lowercase_ascii;
+using ssh_config::split_nonempty_whitespace;
+using ssh_config::split_quoted_arguments;
 
 bool resolve_host_ipv4(const char *host, int port, struct sockaddr_in *out_addr)
 {
@@ -242,400 +418,6 @@ bool resolve_host_ipv4(const char *host, int port, struct sockaddr_in *out_addr)
     return ok;
 }
 
-std::vector<std::string> split_nonempty_whitespace(const std::string &input)
-{
-    std::vector<std::string> parts;
-    std::string token;
-    for (char c : input) {
-        if (c == ' ' || c == '\t') {
-            if (!token.empty()) {
-                parts.push_back(token);
-                token.clear();
-            }
-            continue;
-        }
-        token.push_back(c);
-    }
-    if (!token.empty()) {
-        parts.push_back(token);
-    }
-    return parts;
-}
-
-std::vector<std::string> split_quoted_arguments(const std::string &input, size_t start_pos)
-{
-    std::vector<std::string> args;
-    std::string token;
-    bool in_quotes = false;
-    char quote_char = '\0';
-
-    for (size_t i = start_pos; i < input.size(); ++i) {
-        const char c = input[i];
-
-        if ((c == '"' || c == '\'') && (!in_quotes || c == quote_char)) {
-            if (in_quotes) {
-                in_quotes = false;
-                quote_char = '\0';
-            } else {
-                in_quotes = true;
-                quote_char = c;
-            }
-            continue;
-        }
-
-        if (!in_quotes && (c == ' ' || c == '\t')) {
-            if (!token.empty()) {
-                args.push_back(token);
-                token.clear();
-            }
-            continue;
-        }
-
-        token.push_back(c);
-    }
-
-    if (!token.empty()) {
-        args.push_back(token);
-    }
-
-    return args;
-}
-
-std::string trim_ascii(const std::string &value)
-{
-    size_t start = 0;
-    while (start < value.size() && std::isspace(static_cast<unsigned char>(value[start])) != 0) {
-        ++start;
-    }
-
-    size_t end = value.size();
-    while (end > start && std::isspace(static_cast<unsigned char>(value[end - 1])) != 0) {
-        --end;
-    }
-
-    return value.substr(start, end - start);
-}
-
-std::string strip_inline_comment(const std::string &line)
-{
-    bool in_quotes = false;
-    char quote_char = '\0';
-
-    for (size_t i = 0; i < line.size(); ++i) {
-        const char c = line[i];
-        if ((c == '"' || c == '\'') && (!in_quotes || c == quote_char)) {
-            if (in_quotes) {
-                in_quotes = false;
-                quote_char = '\0';
-            } else {
-                in_quotes = true;
-                quote_char = c;
-            }
-            continue;
-        }
-        if (!in_quotes && c == '#') {
-            return line.substr(0, i);
-        }
-    }
-    return line;
-}
-
-std::string lowercase_ascii(std::string value)
-{
-    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
-        return static_cast<char>(std::tolower(c));
-    });
-    return value;
-}
-
-std::string trim_matching_quotes(const std::string &value)
-{
-    if (value.size() >= 2) {
-        const char first = value.front();
-        const char last = value.back();
-        if ((first == '"' && last == '"') || (first == '\'' && last == '\'')) {
-            return value.substr(1, value.size() - 2);
-        }
-    }
-    return value;
-}
-
-bool split_directive(const std::string &line, std::string *key, std::string *value)
-{
-    if (key == nullptr || value == nullptr) {
-        return false;
-    }
-
-    const size_t eq = line.find('=');
-    if (eq != std::string::npos) {
-        *key = trim_ascii(line.substr(0, eq));
-        *value = trim_ascii(line.substr(eq + 1));
-        return !key->empty() && !value->empty();
-    }
-
-    const size_t ws = line.find_first_of(" \t");
-    if (ws == std::string::npos) {
-        return false;
-    }
-
-    *key = trim_ascii(line.substr(0, ws));
-    *value = trim_ascii(line.substr(ws + 1));
-    return !key->empty() && !value->empty();
-}
-
-bool parse_int32(const std::string &value, int *out)
-{
-    if (out == nullptr || value.empty()) {
-        return false;
-    }
-
-    char *end = nullptr;
-    const long parsed = std::strtol(value.c_str(), &end, 10);
-    if (end == value.c_str() || *end != '\0') {
-        return false;
-    }
-    if (parsed < std::numeric_limits<int>::min() || parsed > std::numeric_limits<int>::max()) {
-        return false;
-    }
-
-    *out = static_cast<int>(parsed);
-    return true;
-}
-
-bool parse_bool_flag(const std::string &value, bool *out)
-{
-    if (out == nullptr) {
-        return false;
-    }
-
-    const std::string lowered = lowercase_ascii(trim_ascii(value));
-    if (lowered == "yes" || lowered == "true" || lowered == "on" || lowered == "1") {
-        *out = true;
-        return true;
-    }
-    if (lowered == "no" || lowered == "false" || lowered == "off" || lowered == "0") {
-        *out = false;
-        return true;
-    }
-    return false;
-}
-
-std::string expand_identity_file_path(std::string path)
-{
-    path = trim_matching_quotes(trim_ascii(path));
-    if (path.empty()) {
-        return path;
-    }
-
-    if (path.rfind("~/.ssh/", 0) == 0) {
-        return std::string(kSshKeysRoot) + path.substr(7);
-    }
-
-    if (path.rfind("/sdcard/ssh_keys/", 0) == 0) {
-        return path;
-    }
-
-    if (path[0] != '/') {
-        return std::string(kSshKeysRoot) + path;
-    }
-
-    return path;
-}
-
-std::string base_name(const std::string &path)
-{
-    const size_t sep = path.find_last_of('/');
-    if (sep == std::string::npos) {
-        return path;
-    }
-    return path.substr(sep + 1);
-}
-
-bool wildcard_match(const std::string &pattern, const std::string &candidate)
-{
-    const std::string pat = lowercase_ascii(pattern);
-    const std::string text = lowercase_ascii(candidate);
-
-    size_t p = 0;
-    size_t t = 0;
-    size_t star = std::string::npos;
-    size_t match = 0;
-
-    while (t < text.size()) {
-        if (p < pat.size() && (pat[p] == '?' || pat[p] == text[t])) {
-            ++p;
-            ++t;
-        } else if (p < pat.size() && pat[p] == '*') {
-            star = p++;
-            match = t;
-        } else if (star != std::string::npos) {
-            p = star + 1;
-            t = ++match;
-        } else {
-            return false;
-        }
-    }
-
-    while (p < pat.size() && pat[p] == '*') {
-        ++p;
-    }
-
-    return p == pat.size();
-}
-
-bool host_block_matches(const SSHConfigHostBlock &block, const std::string &alias)
-{
-    bool has_positive = false;
-    bool positive_match = false;
-
-    for (const std::string &raw_pattern : block.patterns) {
-        if (raw_pattern.empty()) {
-            continue;
-        }
-
-        if (raw_pattern[0] == '!') {
-            const std::string neg = raw_pattern.substr(1);
-            if (!neg.empty() && wildcard_match(neg, alias)) {
-                return false;
-            }
-            continue;
-        }
-
-        has_positive = true;
-        if (wildcard_match(raw_pattern, alias)) {
-            positive_match = true;
-        }
-    }
-
-    return has_positive && positive_match;
-}
-
-void apply_option(const std::string &directive, const std::string &raw_value, SSHConfigOptions *target)
-{
-    if (target == nullptr) {
-        return;
-    }
-
-    const std::string value = trim_matching_quotes(trim_ascii(raw_value));
-
-    if (directive == "hostname") {
-        target->host_name = value;
-        target->has_host_name = true;
-        return;
-    }
-    if (directive == "user") {
-        target->user = value;
-        target->has_user = true;
-        return;
-    }
-    if (directive == "port") {
-        int parsed_port = 0;
-        if (parse_int32(value, &parsed_port) && parsed_port > 0 && parsed_port <= 65535) {
-            target->port = parsed_port;
-            target->has_port = true;
-        }
-        return;
-    }
-    if (directive == "identityfile") {
-        const std::string expanded = expand_identity_file_path(value);
-        if (!expanded.empty()) {
-            target->identity_files.push_back(expanded);
-        }
-        return;
-    }
-    if (directive == "identitiesonly") {
-        bool parsed = false;
-        if (parse_bool_flag(value, &parsed)) {
-            target->identities_only = parsed;
-            target->has_identities_only = true;
-        }
-        return;
-    }
-    if (directive == "connecttimeout") {
-        int timeout = 0;
-        if (parse_int32(value, &timeout) && timeout >= 0) {
-            target->connect_timeout = timeout;
-            target->has_connect_timeout = true;
-        }
-        return;
-    }
-    if (directive == "serveraliveinterval") {
-        int interval = 0;
-        if (parse_int32(value, &interval) && interval >= 0) {
-            target->server_alive_interval = interval;
-            target->has_server_alive_interval = true;
-        }
-        return;
-    }
-    if (directive == "serveralivecountmax") {
-        int max_count = 0;
-        if (parse_int32(value, &max_count) && max_count >= 0) {
-            target->server_alive_count_max = max_count;
-            target->has_server_alive_count_max = true;
-        }
-        return;
-    }
-    if (directive == "stricthostkeychecking") {
-        target->strict_host_key_checking = lowercase_ascii(value);
-        target->has_strict_host_key_checking = true;
-        return;
-    }
-    if (directive == "network" || directive == "tpagernetwork") {
-        target->network = value;
-        target->has_network = true;
-        return;
-    }
-}
-
-void merge_options(const SSHConfigOptions &source, SSHConfigOptions *target)
-{
-    if (target == nullptr) {
-        return;
-    }
-
-    if (source.has_host_name) {
-        target->host_name = source.host_name;
-        target->has_host_name = true;
-    }
-    if (source.has_user) {
-        target->user = source.user;
-        target->has_user = true;
-    }
-    if (source.has_port) {
-        target->port = source.port;
-        target->has_port = true;
-    }
-    if (source.has_identities_only) {
-        target->identities_only = source.identities_only;
-        target->has_identities_only = true;
-    }
-    if (!source.identity_files.empty()) {
-        target->identity_files.insert(target->identity_files.end(),
-                                      source.identity_files.begin(),
-                                      source.identity_files.end());
-    }
-    if (source.has_connect_timeout) {
-        target->connect_timeout = source.connect_timeout;
-        target->has_connect_timeout = true;
-    }
-    if (source.has_server_alive_interval) {
-        target->server_alive_interval = source.server_alive_interval;
-        target->has_server_alive_interval = true;
-    }
-    if (source.has_server_alive_count_max) {
-        target->server_alive_count_max = source.server_alive_count_max;
-        target->has_server_alive_count_max = true;
-    }
-    if (source.has_strict_host_key_checking) {
-        target->strict_host_key_checking = source.strict_host_key_checking;
-        target->has_strict_host_key_checking = true;
-    }
-    if (source.has_network) {
-        target->network = source.network;
-        target->has_network = true;
-    }
-}
-
 bool path_exists_regular_file(const std::string &path)
 {
     struct stat st = {};
@@ -689,7 +471,7 @@ std::string resolve_ssh_config_path()
     return preferred;
 }
 
-bool parse_ssh_config_file(SSHConfigFile *parsed)
+bool parse_ssh_config_file(ssh_config::Config *parsed)
 {
     if (parsed == nullptr) {
         return false;
@@ -697,12 +479,10 @@ bool parse_ssh_config_file(SSHConfigFile *parsed)
 
     *parsed = {};
 
-#if defined(TPAGER_TARGET)
     ScopedSDMount mount_guard = {};
     if (!mount_guard.ok()) {
         return false;
     }
-#endif
 
     const std::string config_path = resolve_ssh_config_path();
     FILE *file = std::fopen(config_path.c_str(), "r");
@@ -713,142 +493,76 @@ bool parse_ssh_config_file(SSHConfigFile *parsed)
     }
     ESP_LOGI(TAG, "ssh_config open: %s", config_path.c_str());
 
-    std::set<std::string> alias_seen;
-    SSHConfigHostBlock *active_host = nullptr;
-    bool saw_host = false;
-    char line_buffer[512];
-    while (std::fgets(line_buffer, sizeof(line_buffer), file) != nullptr) {
-        std::string line = line_buffer;
-        line = trim_ascii(strip_inline_comment(line));
-        if (line.empty()) {
-            continue;
-        }
-
-        std::string key;
-        std::string value;
-        if (!split_directive(line, &key, &value)) {
-            continue;
-        }
-
-        const std::string directive = lowercase_ascii(key);
-        if (directive == "host") {
-            const std::vector<std::string> patterns = split_nonempty_whitespace(value);
-            if (patterns.empty()) {
-                continue;
-            }
-
-            saw_host = true;
-            parsed->host_blocks.push_back({});
-            active_host = &parsed->host_blocks.back();
-            active_host->patterns = patterns;
-
-            for (const std::string &pattern : patterns) {
-                if (pattern.empty() || pattern[0] == '!') {
-                    continue;
-                }
-                if (pattern.find('*') != std::string::npos || pattern.find('?') != std::string::npos) {
-                    continue;
-                }
-                if (alias_seen.insert(pattern).second) {
-                    parsed->aliases.push_back(pattern);
-                }
-            }
-            continue;
-        }
-
-        SSHConfigOptions *target = (!saw_host || active_host == nullptr)
-                                       ? &parsed->global_options
-                                       : &active_host->options;
-        apply_option(directive, value, target);
-    }
-
+    const bool ok = ssh_config::parse(file, parsed);
     std::fclose(file);
-    return true;
+    return ok;
 }
 
-bool resolve_ssh_alias(const std::string &alias, ResolvedSSHConfig *resolved)
+bool resolve_ssh_alias(const std::string &alias, ssh_config::Resolved *resolved)
 {
     if (resolved == nullptr || alias.empty()) {
         return false;
     }
 
-    SSHConfigFile parsed = {};
+    ssh_config::Config parsed = {};
     if (!parse_ssh_config_file(&parsed)) {
         return false;
     }
+    return ssh_config::resolve(parsed, alias, resolved);
+}
 
-    SSHConfigOptions effective = {};
-    merge_options(parsed.global_options, &effective);
-
-    bool matched = false;
-    for (const auto &block : parsed.host_blocks) {
-        if (host_block_matches(block, alias)) {
-            merge_options(block.options, &effective);
-            matched = true;
-        }
-    }
+// A key file read from the card for one connect attempt, NUL-terminated for
+// libssh2. Zeroized when it goes out of scope, whichever way that happens.
+class KeyFileBuffer {
+public:
+    KeyFileBuffer() = default;
+    KeyFileBuffer(const KeyFileBuffer&) = delete;
+    KeyFileBuffer& operator=(const KeyFileBuffer&) = delete;
 
-    if (!matched) {
-        return false;
+    ~KeyFileBuffer()
+    {
+        key_store::wipe(data_.data(), data_.size());
     }
 
-    resolved->matched = true;
-    resolved->alias = alias;
-    resolved->host_name = effective.has_host_name ? effective.host_name : alias;
-    resolved->user = effective.has_user ? effective.user : "";
-    resolved->port = effective.has_port ? effective.port : 22;
-    resolved->identities_only = effective.has_identities_only ? effective.identities_only : false;
-    resolved->identity_files = effective.identity_files;
-    resolved->strict_host_key_checking = effective.has_strict_host_key_checking
-                                             ? effective.strict_host_key_checking
-                                             : "ask";
-    resolved->network = effective.has_network ? effective.network : "";
-    return true;
-}
-
-bool read_file_contents(const std::string &path, std::string *contents)
-{
-    if (contents == nullptr) {
-        return false;
-    }
+    bool read(const std::string &path)
+    {
+        ScopedSDMount mount_guard = {};
+        if (!mount_guard.ok()) {
+            return false;
+        }
 
-#if defined(TPAGER_TARGET)
-    ScopedSDMount mount_guard = {};
-    if (!mount_guard.ok()) {
-        return false;
-    }
-#endif
+        FILE *file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
 
-    FILE *file = std::fopen(path.c_str(), "rb");
-    if (file == nullptr) {
-        return false;
-    }
+        if (std::fseek(file, 0, SEEK_END) != 0) {
+            std::fclose(file);
+            return false;
+        }
+        const long file_size = std::ftell(file);
+        if (file_size <= 0 || file_size > static_cast<long>(key_store::kMaxKeyBytes)) {
+            std::fclose(file);
+            return false;
+        }
+        if (std::fseek(file, 0, SEEK_SET) != 0) {
+            std::fclose(file);
+            return false;
+        }
 
-    if (std::fseek(file, 0, SEEK_END) != 0) {
+        // Sized once: a reallocation would leave an unwiped copy behind.
+        data_.assign(static_cast<size_t>(file_size) + 1, '\0');
+        const size_t read_count = std::fread(data_.data(), 1, static_cast<size_t>(file_size), file);
         std::fclose(file);
-        return false;
-    }
-    const long file_size = std::ftell(file);
-    if (file_size <= 0) {
-        std::fclose(file);
-        return false;
-    }
-    if (std::fseek(file, 0, SEEK_SET) != 0) {
-        std::fclose(file);
-        return false;
+        return read_count == static_cast<size_t>(file_size);
     }
 
-    std::string data(static_cast<size_t>(file_size), '\0');
-    const size_t read_count = std::fread(data.data(), 1, static_cast<size_t>(file_size), file);
-    std::fclose(file);
+    const char *data() const { return data_.data(); }
+    size_t size() const { return data_.empty() ? 0 : data_.size() - 1; }
 
-    if (read_count != static_cast<size_t>(file_size)) {
-        return false;
-    }
-
-    *contents = std::move(data);
-    return true;
-}
+private:
+    std::vector<char> data_;
+};
 
 std::string normalize_key_stem(const std::string &filename)
 {
@@ -933,7 +647,7 @@ void connect_using_ssh_alias(SSHTerminal *terminal, const std::string &alias)
         return;
     }
 
-    ResolvedSSHConfig resolved = {};
+    ssh_config::Resolved resolved = {};
     if (!resolve_ssh_alias(alias, &resolved)) {
         terminal->append_text("ERROR: Host alias not found in /sdcard/ssh_keys/ssh_config\n");
         terminal->append_text("Hint: run 'hosts' to list available aliases.\n");
@@ -963,6 +677,10 @@ void connect_using_ssh_alias(SSHTerminal *terminal, const std::string &alias)
     bool attempted_identity = false;
     bool connected = false;
     for (const std::string &identity_path : resolved.identity_files) {
+        if (job_runner::cancelled()) {
+            terminal->append_text("Cancelled\n");
+            return;
+        }
         std::string key_name = base_name(identity_path);
         size_t key_len = 0;
         const char *loaded_key = find_loaded_key_with_fallback(terminal, identity_path, &key_name, &key_len);
@@ -986,11 +704,14 @@ void connect_using_ssh_alias(SSHTerminal *terminal, const std::string &alias)
                 connected = true;
                 break;
             }
+            if (job_runner::cancelled()) {
+                return;  // connect_with_key said so
+            }
             continue;
         }
 
-        std::string key_data;
-        if (!read_file_contents(identity_path, &key_data)) {
+        KeyFileBuffer key_data;
+        if (!key_data.read(identity_path)) {
             terminal->append_text("  Skipping: unable to read key file\n");
             continue;
         }
@@ -998,11 +719,14 @@ void connect_using_ssh_alias(SSHTerminal *terminal, const std::string &alias)
         if (terminal->connect_with_key(resolved.host_name.c_str(),
                                        resolved.port,
                                        resolved.user.c_str(),
-                                       key_data.c_str(),
+                                       key_data.data(),
                                        key_data.size()) == ESP_OK) {
             connected = true;
             break;
         }
+        if (job_runner::cancelled()) {
+            return;
+        }
     }
 
     if (!connected) {
@@ -1049,6 +773,210 @@ void print_sta_netinfo(SSHTerminal *terminal)
     ESP_LOGI(TAG, "netinfo %s", line);
     terminal->append_text(line);
 }
+
+// append_text keeps only the tail of long inputs, so multi-line reports are
+// fed one line at a time.
+void append_lines(SSHTerminal *terminal, const char *text)
+{
+    if (terminal == nullptr || text == nullptr) {
+        return;
+    }
+
+    char line[128];
+    while (*text != '\0') {
+        const char *end = std::strchr(text, '\n');
+        const size_t len = end ? static_cast<size_t>(end - text) + 1 : std::strlen(text);
+        const size_t copy_len = std::min(len, sizeof(line) - 1);
+        std::memcpy(line, text, copy_len);
+        line[copy_len] = '\0';
+        terminal->append_text(line);
+        text += len;
+    }
+}
+
+void print_tasks(SSHTerminal *terminal)
+{
+    static char report[1280];
+    if (task_stats::format_tasks(report, sizeof(report)) == 0) {
+        terminal->append_text("tasks: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+void print_dfs(SSHTerminal *terminal)
+{
+    static char report[768];
+    if (power_mgmt::format_report(report, sizeof(report)) == 0) {
+        terminal->append_text("dfs: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+#if defined(TPAGER_TARGET)
+void print_power(SSHTerminal *terminal)
+{
+    static char report[512];
+    if (tpager::backlight_format_report(report, sizeof(report)) == 0) {
+        terminal->append_text("power: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+void print_input(SSHTerminal *terminal)
+{
+    static char report[256];
+    if (input_replay::format_report(report, sizeof(report)) == 0) {
+        terminal->append_text("input: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+// `input rec|stop|play [FILE]`. stop and play run on the command worker:
+// they touch the SD card, which on the T-Pager shares the display SPI bus.
+void run_input_command(SSHTerminal *terminal, const std::string &arg)
+{
+    const size_t space = arg.find(' ');
+    const std::string verb = arg.substr(0, space);
+    const std::string path = space == std::string::npos ? input_replay::kDefaultPath : arg.substr(space + 1);
+    if (verb == "rec") {
+        if (input_replay::start_recording() != ESP_OK) {
+            terminal->append_text("input: stop the replay first\n");
+        }
+        return;
+    }
+    if (verb == "stop") {
+        if (input_replay::replaying()) {
+            input_replay::stop_replay();
+            return;
+        }
+        if (!input_replay::recording()) {
+            return;
+        }
+        ScopedSDMount mount_guard = {};
+        if (!mount_guard.ok() || input_replay::stop_recording(path.c_str()) != ESP_OK) {
+            terminal->append_text("input: recording not saved (SD missing?)\n");
+            return;
+        }
+        terminal->append_text(("input: saved " + path + "\n").c_str());
+        return;
+    }
+    if (verb == "play") {
+        ScopedSDMount mount_guard = {};
+        if (!mount_guard.ok() || input_replay::start_replay(path.c_str()) != ESP_OK) {
+            terminal->append_text("input: cannot replay (busy, or file missing/invalid)\n");
+        }
+        return;
+    }
+    if (!verb.empty()) {
+        terminal->append_text("Usage: input [rec|stop [FILE]|play [FILE]]\n");
+    }
+}
+#endif
+
+void print_mem(SSHTerminal *terminal)
+{
+    static char report[768];
+    if (mem_monitor::format_report(report, sizeof(report)) == 0) {
+        terminal->append_text("mem: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+void print_trace(SSHTerminal *terminal)
+{
+    static char report[256];
+    if (event_trace::format_status(report, sizeof(report)) == 0) {
+        terminal->append_text("trace: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+}
+
+// Command worker (`trace dump`); the cancel chord stops it between records.
+void dump_trace(SSHTerminal *terminal)
+{
+    ScopedSDMount mount_guard = {};
+    if (!mount_guard.ok()) {
+        terminal->append_text("trace: SD card not available\n");
+        return;
+    }
+    size_t records = 0;
+    if (event_trace::dump_chrome_json(kTracePath, &records, job_runner::cancelled) != ESP_OK) {
+        terminal->append_text(job_runner::cancelled() ? "trace: dump cancelled, file incomplete\n"
+                                                      : "trace: failed to write trace file\n");
+        return;
+    }
+    char line[96];
+    std::snprintf(line, sizeof(line), "trace: %u events -> %s\n", static_cast<unsigned>(records), kTracePath);
+    terminal->append_text(line);
+}
+
+// Periodic metrics snapshots to SD (`stats sd on`), one JSON line per minute,
+// so builds can be compared in the field. Off by default.
+constexpr int64_t kStatsSnapshotIntervalUs = 60LL * 1000 * 1000;
+std::atomic<bool> g_stats_snapshots{false};
+
+// From the command worker (`stats sd on`) or the status sampler. On the
+// T-Pager ScopedSDMount takes the display lock: the card shares its SPI bus.
+bool write_stats_snapshot()
+{
+    ScopedSDMount mount_guard = {};
+    if (!mount_guard.ok()) {
+        return false;
+    }
+    return metrics::append_snapshot(kStatsPath) == ESP_OK;
+}
+
+void print_stats(SSHTerminal *terminal)
+{
+    static char report[1024];
+    if (metrics::format_report(report, sizeof(report)) == 0) {
+        terminal->append_text("stats: no data\n");
+        return;
+    }
+    append_lines(terminal, report);
+    if (mailbox::format_report(report, sizeof(report)) > 0) {
+        append_lines(terminal, report);
+    }
+    terminal->append_text(g_stats_snapshots.load() ? "SD snapshots: every 60 s -> /sdcard/stats.jsonl\n"
+                                                   : "SD snapshots: off\n");
+}
+
+// Status sampling runs off the display lock and never takes it: the status
+// bar refresh and the memory report go to the LVGL task as UI messages, and
+// the status bar only reads the cached, filtered values.
+constexpr uint32_t kStatusSampleMs = 5000;
+constexpr float kRssiEmaAlpha = 0.3f;
+
+// Rough average draw used for the gauge's IR-drop compensation: board at
+// 240 MHz with backlight, plus associated WiFi, plus an active SSH stream.
+constexpr float kLoadBaseMa = 110.0f;
+constexpr float kLoadWifiMa = 60.0f;
+constexpr float kLoadSshMa = 20.0f;
+
+// Remaining-time display is rounded so the label is not redrawn every minute.
+constexpr int kRemainingDisplayStepMin = 5;
+
+// Rarely used panels are built on first use and released after this long
+// hidden, so the LVGL pool stays with the terminal textarea.
+constexpr uint32_t kPanelIdleReleaseMs = 60000;
+
+void log_lvgl_mem(const char *what)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    ESP_LOGI(TAG, "LVGL mem %s: used %u / %u bytes, free %u, frag %u%%",
+             what,
+             static_cast<unsigned>(mon.total_size - mon.free_size),
+             static_cast<unsigned>(mon.total_size),
+             static_cast<unsigned>(mon.free_size),
+             static_cast<unsigned>(mon.frag_pct));
+}
 } // namespace
 
 SSHTerminal::SSHTerminal() 
@@ -1056,16 +984,26 @@ SSHTerminal::SSHTerminal()
       terminal_output(NULL), 
       input_label(NULL),
       status_bar(NULL),
+      status_battery_label(NULL),
+      status_wifi_label(NULL),
+      status_rssi_label(NULL),
+      status_ssh_label(NULL),
       byte_counter_label(NULL),
       side_panel(NULL),
+      side_panel_release_timer(NULL),
+      top_overlay(NULL),
+      top_timer(NULL),
       cursor_pos(0),
       bytes_received(0),
+      bytes_shown(0),
       history_index(-1),
       cursor_blink_timer(NULL),
       cursor_visible(true),
-      battery_update_timer(NULL),
+      status_sampler_handle(NULL),
+      ssh_rx_handle(NULL),
       history_needs_save(false),
       history_save_timer(NULL),
+      ui_mailbox_timer(NULL),
       last_display_update(0),
       wifi_connected(false),
       ssh_connected(false),
@@ -1074,7 +1012,9 @@ SSHTerminal::SSHTerminal()
       session(NULL),
       channel(NULL),
       hostname(NULL),
-      port_number(22)
+      port_number(22),
+      activity_cb(NULL),
+      activity_ctx(NULL)
 {
     vTaskDelay(pdMS_TO_TICKS(100));
     
@@ -1090,7 +1030,7 @@ SSHTerminal::SSHTerminal()
         ESP_LOGE(TAG, "Battery measurement initialization FAILED: %s", esp_err_to_name(battery_ret));
     }
     
-    load_history_from_nvs();
+    history_store::load(&command_history);
 }
 
 SSHTerminal::~SSHTerminal() 
@@ -1102,13 +1042,26 @@ SSHTerminal::~SSHTerminal()
     if (cursor_blink_timer) {
         lv_timer_del(cursor_blink_timer);
     }
-    if (battery_update_timer) {
-        lv_timer_del(battery_update_timer);
+    if (ui_mailbox_timer) {
+        lv_timer_del(ui_mailbox_timer);
+    }
+    if (status_sampler_handle) {
+        vTaskDelete(status_sampler_handle);
+    }
+    if (ssh_rx_handle) {
+        vTaskDelete(ssh_rx_handle);
+    }
+    key_store::clear();
+    if (side_panel_release_timer) {
+        lv_timer_del(side_panel_release_timer);
+    }
+    if (top_timer) {
+        lv_timer_del(top_timer);
     }
     if (history_save_timer) {
         lv_timer_del(history_save_timer);
         if (history_needs_save) {
-            save_history_to_nvs();
+            history_store::save(command_history);
         }
     }
 }
@@ -1223,39 +1176,37 @@ esp_err_t SSHTerminal::init_wifi(const char* ssid, const char* password)
             ESP_LOGI(TAG, "Connected to AP SSID:%s", ssid);
             wifi_connected = true;
             
-            if (display_lock(0)) {
-                update_status_bar();
-                append_text("WiFi Connected\n");
-                print_sta_netinfo(this);
-                display_unlock();
-            }
+            update_status_bar();
+            append_text("WiFi Connected\n");
+            print_sta_netinfo(this);
             return ESP_OK;
         } else if (bits & WIFI_FAIL_BIT) {
             ESP_LOGI(TAG, "Failed to connect to SSID:%s", ssid);
             wifi_connected = false;
             
-            if (display_lock(0)) {
-                update_status_bar();
-                display_unlock();
-            }
+            update_status_bar();
             return ESP_FAIL;
         }
         
-        if (display_lock(0)) {
-            append_text(".");
-            display_unlock();
+        if (job_runner::cancelled()) {
+            // Stop the event handler's reconnect attempts as well.
+            ESP_LOGI(TAG, "WiFi connect cancelled");
+            s_retry_num = WIFI_MAXIMUM_RETRY;
+            esp_wifi_disconnect();
+            break;
         }
+        
+        append_text(".");
         elapsed_ms += check_interval_ms;
     }
     
-    ESP_LOGE(TAG, "Connection timeout");
+    if (!job_runner::cancelled()) {
+        ESP_LOGE(TAG, "Connection timeout");
+        s_retry_num = 0;
+    }
     wifi_connected = false;
-    s_retry_num = 0;
     
-    if (display_lock(0)) {
-        update_status_bar();
-        display_unlock();
-    }
+    update_status_bar();
     return ESP_FAIL;
 }
 
@@ -1266,102 +1217,83 @@ bool SSHTerminal::is_wifi_connected()
 
 lv_obj_t* SSHTerminal::create_terminal_screen()
 {
-    // Keep a minimal side inset so the 1px border is fully visible on panel edges
-    // while maximizing horizontal character columns on the T-Pager display.
-    constexpr int kTPagerHorizontalInsetPx = 1;
+    constexpr board::TerminalLayout layout = board::Current::kLayout;
 
     terminal_screen = lv_obj_create(NULL);
     lv_obj_set_style_bg_color(terminal_screen, lv_color_black(), 0);
     lv_obj_set_style_bg_opa(terminal_screen, LV_OPA_COVER, 0);
     lv_obj_clear_flag(terminal_screen, LV_OBJ_FLAG_SCROLLABLE);
 
-    status_bar = lv_label_create(terminal_screen);
-    lv_label_set_text(status_bar, "Status: Disconnected");
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_style_text_color(status_bar, lv_color_hex(0xD9F2E6), 0);
-    #else
-    lv_obj_set_style_text_color(status_bar, lv_color_hex(0x00FF00), 0);
-    #endif
+    // Status bar is a row of labels (battery, WiFi, RSSI, SSH) so a change in
+    // one value only re-lays out that label. Text color is inherited.
+    status_bar = lv_obj_create(terminal_screen);
+    lv_obj_set_size(status_bar, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_style_bg_opa(status_bar, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(status_bar, 0, 0);
+    lv_obj_set_style_pad_all(status_bar, 0, 0);
+    lv_obj_set_style_pad_column(status_bar, 0, 0);
+    lv_obj_clear_flag(status_bar, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_flex_flow(status_bar, LV_FLEX_FLOW_ROW);
+    lv_obj_set_style_text_color(status_bar, lv_color_hex(layout.status_color), 0);
     lv_obj_set_style_text_font(status_bar, ui_font_body(), 0);
-    #if defined(TPAGER_TARGET)
-    lv_obj_align(status_bar, LV_ALIGN_TOP_LEFT, 4, 2);
-    #else
-    lv_obj_align(status_bar, LV_ALIGN_TOP_LEFT, 5, 5);
-    #endif
+    status_battery_label = lv_label_create(status_bar);
+    status_wifi_label = lv_label_create(status_bar);
+    status_rssi_label = lv_label_create(status_bar);
+    status_ssh_label = lv_label_create(status_bar);
+    lv_label_set_text(status_battery_label, "");
+    lv_label_set_text(status_wifi_label, "Status: Disconnected");
+    lv_label_set_text(status_rssi_label, "");
+    lv_label_set_text(status_ssh_label, "");
+    lv_obj_add_flag(status_battery_label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(status_rssi_label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(status_ssh_label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_align(status_bar, LV_ALIGN_TOP_LEFT, layout.edge_x, layout.edge_y);
     
     byte_counter_label = lv_label_create(terminal_screen);
     lv_label_set_text(byte_counter_label, "0 B");
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_style_text_color(byte_counter_label, lv_color_hex(0xAEE6FF), 0);
-    #else
-    lv_obj_set_style_text_color(byte_counter_label, lv_color_hex(0x00FFFF), 0);
-    #endif
+    lv_obj_set_style_text_color(byte_counter_label, lv_color_hex(layout.byte_counter_color), 0);
     lv_obj_set_style_text_font(byte_counter_label, ui_font_body(), 0);
-    #if defined(TPAGER_TARGET)
-    lv_obj_align(byte_counter_label, LV_ALIGN_TOP_RIGHT, -4, 2);
-    #else
-    lv_obj_align(byte_counter_label, LV_ALIGN_TOP_RIGHT, -5, 5);
-    #endif
+    lv_obj_align(byte_counter_label, LV_ALIGN_TOP_RIGHT, -layout.edge_x, layout.edge_y);
 
     terminal_output = lv_textarea_create(terminal_screen);
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_size(terminal_output, lv_pct(100) - (kTPagerHorizontalInsetPx * 2), lv_pct(76));
-    lv_obj_align(terminal_output, LV_ALIGN_TOP_MID, 0, 18);
-    #else
-    lv_obj_set_size(terminal_output, lv_pct(100), lv_pct(75));
-    lv_obj_align(terminal_output, LV_ALIGN_TOP_MID, 0, 25);
-    #endif
-    lv_obj_set_style_bg_color(terminal_output, lv_color_black(), 0);
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_style_text_color(terminal_output, lv_color_hex(0xF7FFF9), 0);
-    #else
-    lv_obj_set_style_text_color(terminal_output, lv_color_hex(0x00FF00), 0);
-    #endif
-    lv_obj_set_style_text_font(terminal_output, ui_font_small(), 0);
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_style_border_color(terminal_output, lv_color_hex(0x48A878), 0);
-    lv_obj_set_style_border_width(terminal_output, 1, 0);
-    #else
-    lv_obj_set_style_border_color(terminal_output, lv_color_hex(0x00FF00), 0);
-    lv_obj_set_style_border_width(terminal_output, 2, 0);
-    #endif
+    // Takes the textarea's place while a session is attached.
+    session_view.create(terminal_screen);
+    for (lv_obj_t* output : {terminal_output, session_view.obj()}) {
+        lv_obj_set_size(output, lv_pct(100) - layout.output_width_trim, lv_pct(layout.output_height_pct));
+        lv_obj_align(output, LV_ALIGN_TOP_MID, 0, layout.output_top);
+        lv_obj_set_style_bg_color(output, lv_color_black(), 0);
+        lv_obj_set_style_text_color(output, lv_color_hex(layout.output_color), 0);
+        lv_obj_set_style_text_font(output, ui_font_small(), 0);
+        lv_obj_set_style_border_color(output, lv_color_hex(layout.output_border_color), 0);
+        lv_obj_set_style_border_width(output, layout.output_border_width, 0);
+        lv_obj_set_scrollbar_mode(output, LV_SCROLLBAR_MODE_OFF);
+        lv_obj_clear_flag(output, LV_OBJ_FLAG_CLICK_FOCUSABLE);
+
+        lv_obj_set_scroll_snap_x(output, LV_SCROLL_SNAP_NONE);
+        lv_obj_set_scroll_snap_y(output, LV_SCROLL_SNAP_NONE);
+        lv_obj_clear_flag(output, LV_OBJ_FLAG_SCROLL_MOMENTUM);
+        lv_obj_clear_flag(output, LV_OBJ_FLAG_SCROLL_ELASTIC);
+    }
     lv_textarea_set_cursor_click_pos(terminal_output, false);
     lv_textarea_set_one_line(terminal_output, false);
-    lv_obj_set_scrollbar_mode(terminal_output, LV_SCROLLBAR_MODE_OFF);
-    
-    lv_obj_clear_flag(terminal_output, LV_OBJ_FLAG_CLICK_FOCUSABLE);
     lv_obj_set_style_anim_time(terminal_output, 0, LV_PART_CURSOR);
     lv_obj_set_style_opa(terminal_output, LV_OPA_TRANSP, LV_PART_CURSOR);
-    
-    lv_obj_set_scroll_snap_x(terminal_output, LV_SCROLL_SNAP_NONE);
-    lv_obj_set_scroll_snap_y(terminal_output, LV_SCROLL_SNAP_NONE);
-    lv_obj_clear_flag(terminal_output, LV_OBJ_FLAG_SCROLL_MOMENTUM);
-    lv_obj_clear_flag(terminal_output, LV_OBJ_FLAG_SCROLL_ELASTIC);
+    // The theme pads a plain object differently; line the text up.
+    lv_obj_set_style_pad_all(session_view.obj(), lv_obj_get_style_pad_top(terminal_output, LV_PART_MAIN), 0);
+    lv_obj_set_style_radius(session_view.obj(), lv_obj_get_style_radius(terminal_output, LV_PART_MAIN), 0);
 
     lv_obj_t* input_container = lv_obj_create(terminal_screen);
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_size(input_container, lv_pct(100) - (kTPagerHorizontalInsetPx * 2), 22);
-    #else
-    lv_obj_set_size(input_container, lv_pct(100) - 10, 25);
-    #endif
+    lv_obj_set_size(input_container, lv_pct(100) - layout.input_width_trim, layout.input_height);
     lv_obj_set_style_bg_opa(input_container, LV_OPA_TRANSP, 0);
     lv_obj_set_style_border_width(input_container, 0, 0);
     lv_obj_set_style_pad_all(input_container, 0, 0);
     lv_obj_set_scrollbar_mode(input_container, LV_SCROLLBAR_MODE_OFF);
     lv_obj_set_scroll_dir(input_container, LV_DIR_HOR);
-    #if defined(TPAGER_TARGET)
-    lv_obj_align(input_container, LV_ALIGN_BOTTOM_MID, 0, -2);
-    #else
-    lv_obj_align(input_container, LV_ALIGN_BOTTOM_LEFT, 5, -5);
-    #endif
+    lv_obj_align(input_container, layout.input_align, layout.input_x, layout.input_y);
     
     input_label = lv_label_create(input_container);
     lv_label_set_text(input_label, "> ");
-    #if defined(TPAGER_TARGET)
-    lv_obj_set_style_text_color(input_label, lv_color_hex(0xFFE9A8), 0);
-    #else
-    lv_obj_set_style_text_color(input_label, lv_color_hex(0xFFFF00), 0);
-    #endif
+    lv_obj_set_style_text_color(input_label, lv_color_hex(layout.input_color), 0);
     lv_obj_set_style_text_font(input_label, ui_font_body(), 0);
     lv_label_set_long_mode(input_label, LV_LABEL_LONG_CLIP);
     lv_obj_align(input_label, LV_ALIGN_LEFT_MID, 0, 0);
@@ -1370,43 +1302,31 @@ lv_obj_t* SSHTerminal::create_terminal_screen()
     lv_obj_add_flag(input_label, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_event_cb(input_label, input_touch_event_cb, LV_EVENT_CLICKED, this);
 
-    create_side_panel();
+    // Side panel is built on first swipe (see show_side_panel).
     
     lv_obj_add_event_cb(terminal_screen, gesture_event_cb, LV_EVENT_GESTURE, this);
     lv_obj_clear_flag(terminal_screen, LV_OBJ_FLAG_GESTURE_BUBBLE);
     
     cursor_blink_timer = lv_timer_create(cursor_blink_cb, 500, this);
     
-    battery_update_timer = lv_timer_create(battery_update_cb, 60000, this);
+    init_mailboxes();
+    ui_mailbox_timer = lv_timer_create(ui_mailbox_cb, kUiDrainPeriodMs, this);
+    if (!status_sampler_handle) {
+        status_sampler_handle = g_status_sampler_task.start(status_sampler_task, this);
+    }
+    if (!ssh_rx_handle) {
+        ssh_rx_handle = g_ssh_rx_task.start(ssh_receive_task, this);
+    }
+    if (job_runner::start() != ESP_OK) {
+        ESP_LOGE(TAG, "Command worker failed to start; connect/hosts unavailable");
+    }
     
     history_save_timer = lv_timer_create(history_save_cb, 5000, this);
 
-    #if defined(TPAGER_TARGET)
-    const char* logo =
-        "PocketSSH T-Pager\n"
-        "Type 'help' for commands.\n"
-        "Start with: hosts, connect <alias>, or connect <SSID> <PASSWORD>\n\n";
-    #else
-    const char* logo = 
-        "\n"
-        "  ================================================\n"
-        "           POCKET SSH TERM - ESP32-S3\n"
-        "  ================================================\n"
-        "\n"
-        "  Commands:\n"
-        "   connect <ALIAS> - Resolve via ssh_config and SSH key\n"
-        "   connect <SSID> <PASSWORD>  - WiFi connect\n"
-        "     Use quotes for spaces: connect \"My WiFi\" \"my pass\"\n"
-        "   hosts - List aliases from /sdcard/ssh_keys/ssh_config\n"
-        "   ssh <HOST> <PORT> <USER> <PASS> - SSH\n"
-        "   sshkey <HOST> <PORT> <USER> <KEYFILE> - SSH key\n"
-        "   disconnect - WiFi off | exit - SSH off\n"
-        "   clear - Clear screen | help - Show help\n"
-        "\n"
-        "  Ready. Type 'connect' to start...\n\n";
-    #endif
-    
-    lv_textarea_set_text(terminal_output, logo);
+    
+    lv_textarea_set_text(terminal_output, board::Current::kBanner);
+
+    log_lvgl_mem("after terminal screen");
 
     return terminal_screen;
 }
@@ -1416,20 +1336,34 @@ void SSHTerminal::append_text(const char* text)
     if (!terminal_output || !text) {
         return;
     }
+    if (job_runner::on_worker()) {
+        // Jobs run without the display lock; the LVGL task appends it.
+        post_ui_text(text, kJobPostWait);
+        return;
+    }
     
-    int64_t start_time = esp_timer_get_time() / 1000;
+    const int64_t start_us = esp_timer_get_time();
+    
+    if (sync_session_view()) {
+        // The grid is on show; the textarea is hidden until the session ends.
+        {
+            ScreenLock lock;
+            g_screen.write_text(text);
+        }
+        request_screen();
+        metrics::observe(metrics::Histogram::kAppendTextUs, (uint32_t)(esp_timer_get_time() - start_us));
+        return;
+    }
     
     const char* current_text = lv_textarea_get_text(terminal_output);
     size_t current_len = current_text ? strlen(current_text) : 0;
     size_t new_len = strlen(text);
     
-    const size_t MAX_BUFFER_SIZE = 4096;
-    
-    if (current_len > MAX_BUFFER_SIZE * 0.8) {
+    if (current_len > kOutputTextMax * 0.8) {
         lv_textarea_set_text(terminal_output, "...[cleared]\n");
         current_len = 14;
         
-        int64_t elapsed = (esp_timer_get_time() / 1000) - start_time;
+        int64_t elapsed = (esp_timer_get_time() - start_us) / 1000;
         if (elapsed > 500) {
             ESP_LOGW(TAG, "Text clear took %lld ms, skipping append", elapsed);
             return;
@@ -1442,175 +1376,77 @@ void SSHTerminal::append_text(const char* text)
         new_len = MAX_CHUNK;
     }
     
-    if (current_len + new_len < MAX_BUFFER_SIZE) {
+    if (current_len + new_len < kOutputTextMax) {
         lv_textarea_add_text(terminal_output, text);
     }
     
-    int64_t total_time = (esp_timer_get_time() / 1000) - start_time;
-    if (total_time > 1000) {
-        ESP_LOGW(TAG, "append_text took %lld ms - LVGL heap may be fragmented", total_time);
+    const int64_t total_us = esp_timer_get_time() - start_us;
+    metrics::observe(metrics::Histogram::kAppendTextUs, (uint32_t)total_us);
+    if (total_us > 1000 * 1000) {
+        ESP_LOGW(TAG, "append_text took %lld ms - LVGL heap may be fragmented", total_us / 1000);
     }
 }
 
 void SSHTerminal::clear_terminal()
 {
+    if (sync_session_view()) {
+        {
+            ScreenLock lock;
+            g_screen.reset();
+            g_screen.clear_scrollback();
+        }
+        session_view.clear();
+        request_screen();
+        return;
+    }
     if (terminal_output) {
         lv_textarea_set_text(terminal_output, "");
     }
 }
 
+bool SSHTerminal::deliver_key(char key)
+{
+    if (!board::with_display_lock(board::Current::kInputLockWaitMs, [&] { handle_key_input(key); })) {
+        metrics::add(metrics::Counter::kKeyDrops);
+        return false;
+    }
+    return true;
+}
+
 void SSHTerminal::handle_key_input(char key)
 {
+    // While `top` is up the keyboard only closes it.
+    if (top_overlay) {
+        hide_top_overlay();
+        return;
+    }
+    
+    if (key == kCancelKey) {
+        // Stop a running built-in first; otherwise it is the remote's ^C.
+        if (job_runner::cancel()) {
+            append_text("^C\n");
+        } else if (rx_active && !post_net_bytes(&key, 1)) {
+            ESP_LOGW(TAG, "^C dropped: ssh_rx mailbox full");
+        }
+        return;
+    }
+    
     if (key == '\n' || key == '\r') {
         if (!current_input.empty()) {
             append_text("\n> ");
             append_text(current_input.c_str());
             append_text("\n");
             
-            if (current_input.rfind("connect ", 0) == 0) {
-                const std::vector<std::string> args = split_quoted_arguments(current_input, 8);
-
-                if (args.size() == 1) {
-                    connect_using_ssh_alias(this, args[0]);
-                } else if (args.size() >= 2) {
-                    std::string ssid = args[0];
-                    std::string password = args[1];
-                    
-                    append_text("Connecting to WiFi: ");
-                    append_text(ssid.c_str());
-                    append_text("\n");
-                    
-                    if (init_wifi(ssid.c_str(), password.c_str()) == ESP_OK) {
-                        append_text("WiFi connected successfully!\n");
-                    } else {
-                        append_text("WiFi connection failed!\n");
-                    }
-                } else {
-                    append_text("Usage:\n");
-                    append_text("  connect <ALIAS>\n");
-                    append_text("  connect <SSID> <PASSWORD>\n");
-                    append_text("  Use quotes for SSIDs/passwords with spaces: connect \"My WiFi\" password\n");
-                }
-            }
-            else if (current_input.rfind("ssh ", 0) == 0) {
-                std::vector<std::string> parts = split_nonempty_whitespace(current_input);
-                
-                if (parts.size() == 2) {
-                    connect_using_ssh_alias(this, parts[1]);
-                } else if (parts.size() >= 5) {
-                    std::string host = parts[1];
-                    int port = std::atoi(parts[2].c_str());
-                    std::string user = parts[3];
-                    std::string pass = parts[4];
-
-                    if (port <= 0 || port > 65535) {
-                        append_text("ERROR: Invalid port for ssh command\n");
-                    } else {
-                        connect(host.c_str(), port, user.c_str(), pass.c_str());
-                    }
-                } else {
-                    append_text("Usage: ssh <ALIAS>\n");
-                    append_text("Usage: ssh <HOST> <PORT> <USER> <PASS>\n");
-                }
-            }
-            else if (current_input.rfind("sshkey ", 0) == 0) {
-                std::vector<std::string> parts = split_nonempty_whitespace(current_input);
-                
-                if (parts.size() >= 5) {
-                    std::string host = parts[1];
-                    int port = std::atoi(parts[2].c_str());
-                    std::string user = parts[3];
-                    std::string keyfile = parts[4];
-
-                    if (port <= 0 || port > 65535) {
-                        append_text("ERROR: Invalid port for sshkey command\n");
-                    } else {
-                        // Try to load key from memory
-                        size_t key_len = 0;
-                        const char* key_data = get_loaded_key(keyfile.c_str(), &key_len);
-
-                        if (key_data && key_len > 0) {
-                            append_text("Using key file: ");
-                            append_text(keyfile.c_str());
-                            append_text("\n");
-                            connect_with_key(host.c_str(), port, user.c_str(), key_data, key_len);
-                        } else {
-                            append_text("ERROR: Key file not found: ");
-                            append_text(keyfile.c_str());
-                            append_text("\n");
-                            append_text("Available keys: ");
-                            for (const auto& kv : loaded_keys) {
-                                append_text(kv.first.c_str());
-                                append_text(" ");
-                            }
-                            append_text("\n");
-                        }
-                    }
-                } else {
-                    append_text("Usage: sshkey <HOST> <PORT> <USER> <KEYFILE>\n");
-                    append_text("  Example: sshkey 192.168.1.100 22 pi default.pem\n");
-                }
-            }
-            else if (current_input == "disconnect") {
-                if (wifi_connected) {
-                    append_text("Disconnecting WiFi...\n");
-                    s_retry_num = WIFI_MAXIMUM_RETRY;
-                    esp_wifi_disconnect();
-                    wifi_connected = false;
-                    update_status_bar();
-                    append_text("WiFi disconnected\n");
-                } else {
-                    append_text("WiFi not connected\n");
-                }
-            }
-            else if (current_input == "exit") {
-                disconnect();
-            }
-            else if (current_input == "clear") {
-                clear_terminal();
-            }
-            else if (current_input == "help") {
-                append_text("Available commands:\n");
-                append_text("  hosts - List aliases from /sdcard/ssh_keys/ssh_config\n");
-                append_text("  connect <ALIAS> - Resolve alias from ssh_config and connect via key\n");
-                append_text("  connect <SSID> <PASSWORD> - Connect to WiFi\n");
-                append_text("    Use quotes for spaces: connect \"My WiFi\" password\n");
-                append_text("  netinfo - Show WiFi IP/netmask/gateway\n");
-                append_text("  ssh <ALIAS> - Resolve alias from ssh_config and connect via key\n");
-                append_text("  ssh <HOST> <PORT> <USER> <PASS> - Connect via SSH\n");
-                append_text("  sshkey <HOST> <PORT> <USER> <KEYFILE> - Connect via SSH with private key\n");
-                append_text("    Note: Place .pem keys in /sdcard/ssh_keys/ before use\n");
-                append_text("  disconnect - Disconnect WiFi\n");
-                append_text("  exit - Disconnect SSH\n");
-                append_text("  clear - Clear terminal\n");
-                append_text("  help - Show this help\n");
-            }
-            else if (current_input == "hosts") {
-                SSHConfigFile parsed = {};
-                if (!parse_ssh_config_file(&parsed)) {
-                    append_text("No ssh_config found at /sdcard/ssh_keys/ssh_config\n");
-                } else if (parsed.aliases.empty()) {
-                    append_text("No explicit Host aliases found in ssh_config\n");
-                } else {
-                    append_text("Configured Host aliases:\n");
-                    for (const std::string &alias : parsed.aliases) {
-                        append_text("  ");
-                        append_text(alias.c_str());
-                        append_text("\n");
-                    }
+            if (!ssh_connected) {
+                if (!run_command(current_input)) {
+                    append_text("Unknown command. Type 'help' for commands.\n");
                 }
-            }
-            else if (current_input == "netinfo") {
-                if (!wifi_connected) {
-                    append_text("WiFi not connected\n");
-                } else {
-                    print_sta_netinfo(this);
+            } else if (current_input[0] == kBuiltinPrefix) {
+                if (!run_command(current_input.substr(1))) {
+                    append_text("Unknown command. Type ':help' for commands.\n");
                 }
-            }
-            else if (ssh_connected) {
-                send_command(current_input.c_str());
             } else {
-                append_text("Unknown command. Type 'help' for commands.\n");
+                send_command(current_input.c_str());
             }
             
             auto it = std::find(command_history.begin(), command_history.end(), current_input);
@@ -1638,6 +1474,381 @@ void SSHTerminal::handle_key_input(char key)
     update_input_display();
 }
 
+namespace {
+// Built-ins that read or write the SD card only for some arguments: those
+// run as jobs, the rest in place. `args` matches ARGS or its first words.
+struct JobArgs {
+    const char* command;
+    const char* args;
+};
+
+const JobArgs kJobArgs[] = {
+    {"trace", "dump"},
+    {"stats", "sd on"},
+#if defined(TPAGER_TARGET)
+    {"input", "stop"},
+    {"input", "play"},
+#endif
+};
+
+bool is_job_args(const char* command, const std::string& args)
+{
+    for (const JobArgs& entry : kJobArgs) {
+        const size_t len = std::strlen(entry.args);
+        if (std::strcmp(command, entry.command) == 0 && args.compare(0, len, entry.args) == 0 &&
+            (args.size() == len || args[len] == ' ')) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+// Listed in `help` order.
+const SSHTerminal::CommandSpec SSHTerminal::kCommands[] = {
+    {"hosts", kCommandBare | kCommandJob, &SSHTerminal::cmd_hosts,
+     "  hosts - List aliases from /sdcard/ssh_keys/ssh_config\n"},
+    {"connect", kCommandArgs | kCommandJob, &SSHTerminal::cmd_connect,
+     "  connect <ALIAS> - Resolve alias from ssh_config and connect via key\n"
+     "  connect <SSID> <PASSWORD> - Connect to WiFi\n"
+     "    Use quotes for spaces: connect \"My WiFi\" password\n"},
+    {"netinfo", kCommandBare, &SSHTerminal::cmd_netinfo,
+     "  netinfo - Show WiFi IP/netmask/gateway\n"},
+    {"top", kCommandBare | kCommandArgs, &SSHTerminal::cmd_top,
+     "  top [SECS] - Live per-task/per-core CPU view, any key closes\n"},
+    {"tasks", kCommandBare, &SSHTerminal::cmd_tasks,
+     "  tasks - Stack high-water marks and CPU share per task\n"},
+    {"dfs", kCommandBare | kCommandArgs, &SSHTerminal::cmd_dfs,
+     "  dfs [on|off|reset] - CPU scaling stats, compare handshake/render\n"},
+    {"mem", kCommandBare, &SSHTerminal::cmd_mem,
+     "  mem - Heap free/fragmentation and per-subsystem usage\n"},
+    {"trace", kCommandBare | kCommandArgs, &SSHTerminal::cmd_trace,
+     "  trace [on|off|clear|dump] - Event trace, dump to /sdcard/trace.json\n"},
+    {"stats", kCommandBare | kCommandArgs, &SSHTerminal::cmd_stats,
+     "  stats [reset|sd on|sd off] - Counters and latency histograms\n"},
+#if defined(TPAGER_TARGET)
+    {"power", kCommandBare | kCommandArgs, &SSHTerminal::cmd_power,
+     "  power [day|night|saver] - Backlight profile and est. current\n"},
+    {"input", kCommandBare | kCommandArgs, &SSHTerminal::cmd_input,
+     "  input [rec|stop|play [FILE]] - Record/replay keys, default /sdcard/input.rec\n"},
+#endif
+    {"ssh", kCommandArgs | kCommandJob, &SSHTerminal::cmd_ssh,
+     "  ssh <ALIAS> - Resolve alias from ssh_config and connect via key\n"
+     "  ssh <HOST> <PORT> <USER> <PASS> - Connect via SSH\n"},
+    {"sshkey", kCommandArgs | kCommandJob, &SSHTerminal::cmd_sshkey,
+     "  sshkey <HOST> <PORT> <USER> <KEYFILE> - Connect via SSH with private key\n"
+     "    Note: Place .pem keys in /sdcard/ssh_keys/ before use\n"},
+    {"disconnect", kCommandBare, &SSHTerminal::cmd_disconnect,
+     "  disconnect - Disconnect WiFi\n"},
+    {"exit", kCommandBare, &SSHTerminal::cmd_exit,
+     "  exit - Disconnect SSH\n"},
+    {"clear", kCommandBare, &SSHTerminal::cmd_clear,
+     "  clear - Clear terminal\n"},
+    {"help", kCommandBare, &SSHTerminal::cmd_help,
+     "  help - Show this help\n"},
+};
+
+// False when `line` is not a built-in. Called with the display lock held.
+bool SSHTerminal::run_command(const std::string& line)
+{
+    const size_t space = line.find(' ');
+    const std::string name = line.substr(0, space);
+    const uint8_t form = space == std::string::npos ? kCommandBare : kCommandArgs;
+    for (const CommandSpec& spec : kCommands) {
+        if (name != spec.name || (spec.flags & form) == 0) {
+            continue;
+        }
+        const std::string args = form == kCommandArgs ? line.substr(space + 1) : "";
+        if ((spec.flags & kCommandJob) == 0 && !is_job_args(spec.name, args)) {
+            (this->*spec.run)(args);
+            return true;
+        }
+        const esp_err_t err = job_runner::submit(spec.name, run_job, this, line.c_str());
+        if (err == ESP_ERR_INVALID_STATE && job_runner::busy()) {
+            append_text("busy: ");
+            append_text(job_runner::current());
+            append_text(" still running (");
+            append_text(board::Current::kCancelChord);
+            append_text(" cancels)\n");
+        } else if (err == ESP_ERR_INVALID_SIZE) {
+            append_text("ERROR: command too long\n");
+        } else if (err != ESP_OK) {
+            append_text("ERROR: command worker not running\n");
+        }
+        return true;
+    }
+    return false;
+}
+
+// Command worker: `line` is the whole input line, copied at submit time.
+void SSHTerminal::run_job(void* ctx, const char* line)
+{
+    SSHTerminal* terminal = static_cast<SSHTerminal*>(ctx);
+    const char* space = std::strchr(line, ' ');
+    const std::string name(line, space != nullptr ? static_cast<size_t>(space - line) : std::strlen(line));
+    for (const CommandSpec& spec : kCommands) {
+        if (name == spec.name) {
+            (terminal->*spec.run)(space != nullptr ? space + 1 : "");
+            return;
+        }
+    }
+}
+
+void SSHTerminal::cmd_hosts(const std::string& args)
+{
+    (void)args;
+    ssh_config::Config parsed = {};
+    if (!parse_ssh_config_file(&parsed)) {
+        append_text("No ssh_config found at /sdcard/ssh_keys/ssh_config\n");
+    } else if (parsed.aliases.empty()) {
+        append_text("No explicit Host aliases found in ssh_config\n");
+    } else {
+        append_text("Configured Host aliases:\n");
+        for (const std::string &alias : parsed.aliases) {
+            append_text("  ");
+            append_text(alias.c_str());
+            append_text("\n");
+        }
+    }
+}
+
+void SSHTerminal::cmd_connect(const std::string& args)
+{
+    const std::vector<std::string> parts = split_quoted_arguments(args, 0);
+
+    if (parts.size() == 1) {
+        connect_using_ssh_alias(this, parts[0]);
+    } else if (parts.size() >= 2) {
+        const std::string& ssid = parts[0];
+        const std::string& password = parts[1];
+        
+        append_text("Connecting to WiFi: ");
+        append_text(ssid.c_str());
+        append_text("\n");
+        
+        if (init_wifi(ssid.c_str(), password.c_str()) == ESP_OK) {
+            append_text("WiFi connected successfully!\n");
+        } else if (job_runner::cancelled()) {
+            append_text("Cancelled\n");
+        } else {
+            append_text("WiFi connection failed!\n");
+        }
+    } else {
+        append_text("Usage:\n");
+        append_text("  connect <ALIAS>\n");
+        append_text("  connect <SSID> <PASSWORD>\n");
+        append_text("  Use quotes for SSIDs/passwords with spaces: connect \"My WiFi\" password\n");
+    }
+}
+
+void SSHTerminal::cmd_netinfo(const std::string& args)
+{
+    (void)args;
+    if (!wifi_connected) {
+        append_text("WiFi not connected\n");
+    } else {
+        print_sta_netinfo(this);
+    }
+}
+
+void SSHTerminal::cmd_top(const std::string& args)
+{
+    const int secs = args.empty() ? 1 : std::atoi(args.c_str());
+    if (secs < 1 || secs > 10) {
+        append_text("Usage: top [SECS]  (refresh 1-10 s)\n");
+    } else {
+        show_top_overlay((uint32_t)secs * 1000);
+    }
+}
+
+void SSHTerminal::cmd_tasks(const std::string& args)
+{
+    (void)args;
+    print_tasks(this);
+}
+
+void SSHTerminal::cmd_dfs(const std::string& args)
+{
+    if (args == "on" || args == "off") {
+        if (power_mgmt::set_dfs_enabled(args == "on") != ESP_OK) {
+            append_text("dfs: esp_pm_configure failed\n");
+        }
+    } else if (args == "reset") {
+        power_mgmt::reset_stats();
+    } else if (!args.empty()) {
+        append_text("Usage: dfs [on|off|reset]\n");
+    }
+    print_dfs(this);
+}
+
+void SSHTerminal::cmd_mem(const std::string& args)
+{
+    (void)args;
+    report_memory_usage();
+    print_mem(this);
+}
+
+void SSHTerminal::cmd_trace(const std::string& args)
+{
+    if (args == "on" || args == "off") {
+        event_trace::set_enabled(args == "on");
+    } else if (args == "clear") {
+        event_trace::clear();
+    } else if (args == "dump") {
+        dump_trace(this);
+    } else if (!args.empty()) {
+        append_text("Usage: trace [on|off|clear|dump]\n");
+    }
+    print_trace(this);
+}
+
+void SSHTerminal::cmd_stats(const std::string& args)
+{
+    if (args == "reset") {
+        metrics::reset();
+    } else if (args == "sd on" || args == "sd off") {
+        g_stats_snapshots.store(args == "sd on");
+        if (args == "sd on" && !write_stats_snapshot()) {
+            append_text("stats: SD snapshot failed (card missing?)\n");
+        }
+    } else if (!args.empty()) {
+        append_text("Usage: stats [reset|sd on|sd off]\n");
+    }
+    print_stats(this);
+}
+
+#if defined(TPAGER_TARGET)
+void SSHTerminal::cmd_power(const std::string& args)
+{
+    tpager::BacklightProfile profile;
+    if (tpager::backlight_profile_from_name(args.c_str(), &profile)) {
+        if (tpager::backlight_set_profile(profile) != ESP_OK) {
+            append_text("power: failed to apply profile\n");
+        }
+    } else if (!args.empty()) {
+        append_text("Usage: power [day|night|saver]\n");
+    }
+    print_power(this);
+}
+
+void SSHTerminal::cmd_input(const std::string& args)
+{
+    run_input_command(this, args);
+    print_input(this);
+}
+#endif
+
+void SSHTerminal::cmd_ssh(const std::string& args)
+{
+    const std::vector<std::string> parts = split_nonempty_whitespace(args);
+    
+    if (parts.size() == 1) {
+        connect_using_ssh_alias(this, parts[0]);
+    } else if (parts.size() >= 4) {
+        const int port = std::atoi(parts[1].c_str());
+        if (port <= 0 || port > 65535) {
+            append_text("ERROR: Invalid port for ssh command\n");
+        } else {
+            connect(parts[0].c_str(), port, parts[2].c_str(), parts[3].c_str());
+        }
+    } else {
+        append_text("Usage: ssh <ALIAS>\n");
+        append_text("Usage: ssh <HOST> <PORT> <USER> <PASS>\n");
+    }
+}
+
+void SSHTerminal::cmd_sshkey(const std::string& args)
+{
+    const std::vector<std::string> parts = split_nonempty_whitespace(args);
+    if (parts.size() < 4) {
+        append_text("Usage: sshkey <HOST> <PORT> <USER> <KEYFILE>\n");
+        append_text("  Example: sshkey 192.168.1.100 22 pi default.pem\n");
+        return;
+    }
+    
+    const int port = std::atoi(parts[1].c_str());
+    const std::string& keyfile = parts[3];
+    if (port <= 0 || port > 65535) {
+        append_text("ERROR: Invalid port for sshkey command\n");
+        return;
+    }
+    
+    // Try to load key from memory
+    size_t key_len = 0;
+    const char* key_data = get_loaded_key(keyfile.c_str(), &key_len);
+    if (key_data && key_len > 0) {
+        append_text("Using key file: ");
+        append_text(keyfile.c_str());
+        append_text("\n");
+        connect_with_key(parts[0].c_str(), port, parts[2].c_str(), key_data, key_len);
+    } else {
+        append_text("ERROR: Key file not found: ");
+        append_text(keyfile.c_str());
+        append_text("\n");
+        append_text("Available keys: ");
+        for (const std::string& name : get_loaded_key_names()) {
+            append_text(name.c_str());
+            append_text(" ");
+        }
+        append_text("\n");
+    }
+}
+
+void SSHTerminal::cmd_disconnect(const std::string& args)
+{
+    (void)args;
+    if (job_runner::busy()) {
+        append_text("disconnect: cancel the running command first\n");
+    } else if (wifi_connected) {
+        append_text("Disconnecting WiFi...\n");
+        s_retry_num = WIFI_MAXIMUM_RETRY;
+        esp_wifi_disconnect();
+        wifi_connected = false;
+        update_status_bar();
+        append_text("WiFi disconnected\n");
+    } else {
+        append_text("WiFi not connected\n");
+    }
+}
+
+void SSHTerminal::cmd_exit(const std::string& args)
+{
+    (void)args;
+    NetMessage msg = {};
+    msg.kind = NetMessage::Kind::kDisconnect;
+    if (rx_active) {
+        if (!post_net(msg)) {
+            append_text("exit: session busy, try again\n");
+        }
+    } else if (job_runner::busy()) {
+        // A connect still owns the half-open session; cancel it instead.
+        append_text("exit: ");
+        append_text(board::Current::kCancelChord);
+        append_text(" cancels the running command\n");
+    } else {
+        disconnect();
+    }
+}
+
+void SSHTerminal::cmd_clear(const std::string& args)
+{
+    (void)args;
+    clear_terminal();
+}
+
+void SSHTerminal::cmd_help(const std::string& args)
+{
+    (void)args;
+    append_text("Available commands:\n");
+    for (const CommandSpec& spec : kCommands) {
+        append_lines(this, spec.help);
+    }
+    append_text("  ");
+    append_text(board::Current::kCancelChord);
+    append_text(" - Cancel a running connect/ssh/hosts\n");
+    append_text("While connected, lines go to the remote shell; prefix built-ins with ':' (:top, :exit)\n");
+}
+
 void SSHTerminal::update_input_display()
 {
     if (!input_label) {
@@ -1736,15 +1947,71 @@ void SSHTerminal::cursor_blink_cb(lv_timer_t* timer)
     }
 }
 
-void SSHTerminal::battery_update_cb(lv_timer_t* timer)
+void SSHTerminal::status_sampler_task(void* param)
 {
-    SSHTerminal* terminal = (SSHTerminal*)lv_timer_get_user_data(timer);
-    if (terminal) {
-        if (display_lock(0)) {
-            terminal->update_status_bar();
-            display_unlock();
+    SSHTerminal* terminal = (SSHTerminal*)param;
+    float rssi_ema = 0.0f;
+    bool rssi_seeded = false;
+    int64_t last_stats_snapshot_us = esp_timer_get_time();
+    
+    while (true) {
+        // ADC and WiFi driver calls happen here, never under the display lock.
+        if (terminal->battery_initialized) {
+            float load_ma = kLoadBaseMa;
+            if (terminal->wifi_connected) {
+                load_ma += kLoadWifiMa;
+            }
+            if (terminal->ssh_connected) {
+                load_ma += kLoadSshMa;
+            }
+            terminal->battery.update(load_ma, esp_timer_get_time() / 1000);
+            const float voltage = terminal->battery.filteredVoltage();
+            if (voltage > 0.0f) {
+                terminal->battery_mv.store((int)lroundf(voltage * 1000.0f));
+                terminal->battery_minutes.store(terminal->battery.minutesRemaining());
+                terminal->battery_pct.store(terminal->battery.filteredPercentage());
+            }
+        }
+        
+        wifi_ap_record_t ap_info = {};
+        if (terminal->wifi_connected && esp_wifi_sta_get_ap_info(&ap_info) == ESP_OK) {
+            rssi_ema = rssi_seeded ? rssi_ema + kRssiEmaAlpha * (ap_info.rssi - rssi_ema) : ap_info.rssi;
+            rssi_seeded = true;
+            terminal->rssi_dbm.store((int)lroundf(rssi_ema));
+        } else {
+            rssi_seeded = false;
+            terminal->rssi_dbm.store(0);
+        }
+        
+        mem_monitor::sample();
+        post_ui(UiMessage::Kind::kMemoryReport);
+        
+        const int64_t now_us = esp_timer_get_time();
+        if (g_stats_snapshots.load() && now_us - last_stats_snapshot_us >= kStatsSnapshotIntervalUs) {
+            // On failure (no card, lock busy) try again next interval rather
+            // than every sample.
+            if (!write_stats_snapshot()) {
+                ESP_LOGW(TAG, "stats snapshot to %s failed", kStatsPath);
+            }
+            last_stats_snapshot_us = now_us;
         }
+        
+        post_ui(UiMessage::Kind::kStatusBar);
+        vTaskDelay(pdMS_TO_TICKS(kStatusSampleMs));
+    }
+}
+
+void SSHTerminal::report_memory_usage()
+{
+    size_t terminal_bytes = current_input.capacity();
+    for (const std::string& entry : command_history) {
+        terminal_bytes += entry.capacity();
     }
+    mem_monitor::set_usage(mem_monitor::Tag::kTerminal, terminal_bytes);
+    
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    mem_monitor::set_usage(mem_monitor::Tag::kLvgl, mon.total_size - mon.free_size);
 }
 
 void SSHTerminal::history_save_cb(lv_timer_t* timer)
@@ -1752,7 +2019,7 @@ void SSHTerminal::history_save_cb(lv_timer_t* timer)
     SSHTerminal* terminal = (SSHTerminal*)lv_timer_get_user_data(timer);
     if (terminal && terminal->history_needs_save) {
         terminal->history_needs_save = false;
-        terminal->save_history_to_nvs();
+        history_store::save(terminal->command_history);
     }
 }
 
@@ -1843,169 +2110,48 @@ void SSHTerminal::delete_current_history_entry()
         current_input.clear();
     }
     
-    std::string display_text = "> " + current_input;
-    if (input_label) {
-        lv_label_set_text(input_label, display_text.c_str());
-    }
-    
-    ESP_LOGI(TAG, "History entry deleted. Remaining entries: %d", (int)command_history.size());
-}
-
-void SSHTerminal::send_current_history_command()
-{
-    if (command_history.empty() || history_index < 0) {
-        ESP_LOGW(TAG, "No history command to send (empty or not navigating)");
-        return;
-    }
-    
-    size_t actual_index = command_history.size() - 1 - history_index;
-    std::string cmd_to_send = command_history[actual_index];
-    
-    ESP_LOGI(TAG, "Sending history command: '%s'", cmd_to_send.c_str());
-    
-    current_input = cmd_to_send;
-    
-    std::string display_text = "> " + current_input;
-    if (input_label) {
-        lv_label_set_text(input_label, display_text.c_str());
-    }
-    
-    send_command(cmd_to_send.c_str());
-    
-    auto it = std::find(command_history.begin(), command_history.end(), current_input);
-    if (it != command_history.end()) {
-        command_history.erase(it);
-    }
-    command_history.push_back(current_input);
-    history_needs_save = true;
-    current_input.clear();
-    history_index = -1;
-    
-    display_text = "> ";
-    if (input_label) {
-        lv_label_set_text(input_label, display_text.c_str());
-    }
-}
-
-void SSHTerminal::load_history_from_nvs()
-{
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-    
-    err = nvs_open("storage", NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGW(TAG, "Failed to open NVS for reading history: %s", esp_err_to_name(err));
-        return;
-    }
-    
-    uint32_t history_count = 0;
-    err = nvs_get_u32(nvs_handle, "hist_count", &history_count);
-    if (err != ESP_OK || history_count == 0) {
-        ESP_LOGI(TAG, "No command history found in NVS");
-        nvs_close(nvs_handle);
-        return;
-    }
-    
-    ESP_LOGI(TAG, "Loading %lu commands from NVS...", history_count);
-    
-    command_history.clear();
-    for (uint32_t i = 0; i < history_count && i < 100; i++) {
-        char key[16];
-        snprintf(key, sizeof(key), "hist_%lu", i);
-        
-        size_t required_size = 0;
-        err = nvs_get_str(nvs_handle, key, NULL, &required_size);
-        if (err != ESP_OK) {
-            continue;
-        }
-        
-        char* cmd = (char*)malloc(required_size);
-        if (cmd) {
-            err = nvs_get_str(nvs_handle, key, cmd, &required_size);
-            if (err == ESP_OK) {
-                command_history.push_back(std::string(cmd));
-            }
-            free(cmd);
-        }
-    }
-    
-    nvs_close(nvs_handle);
-    ESP_LOGI(TAG, "Loaded %d commands from NVS", (int)command_history.size());
-}
-
-void SSHTerminal::save_history_to_nvs()
-{
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-    
-    err = nvs_open("storage", NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS for writing history: %s", esp_err_to_name(err));
-        return;
-    }
-    
-    size_t start_idx = 0;
-    if (command_history.size() > 100) {
-        start_idx = command_history.size() - 100;
-    }
-    
-    uint32_t history_count = command_history.size() - start_idx;
-    err = nvs_set_u32(nvs_handle, "hist_count", history_count);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save history count: %s", esp_err_to_name(err));
-        nvs_close(nvs_handle);
-        return;
-    }
-    
-    int saved_count = 0;
-    for (size_t i = start_idx; i < command_history.size() && saved_count < 100; i++) {
-        char key[16];
-        snprintf(key, sizeof(key), "hist_%lu", (unsigned long)(i - start_idx));
-        
-        err = nvs_set_str(nvs_handle, key, command_history[i].c_str());
-        if (err != ESP_OK) {
-            ESP_LOGW(TAG, "Failed to save command %zu: %s", i, esp_err_to_name(err));
-        } else {
-            saved_count++;
-        }
-        
-        if (saved_count % 10 == 0) {
-            vTaskDelay(1);
-        }
-    }
-    
-    err = nvs_commit(nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to commit NVS changes: %s", esp_err_to_name(err));
-    } else {
-        ESP_LOGI(TAG, "Saved %d commands to NVS", saved_count);
+    std::string display_text = "> " + current_input;
+    if (input_label) {
+        lv_label_set_text(input_label, display_text.c_str());
     }
     
-    nvs_close(nvs_handle);
+    ESP_LOGI(TAG, "History entry deleted. Remaining entries: %d", (int)command_history.size());
 }
 
-void SSHTerminal::clear_history_nvs()
+void SSHTerminal::send_current_history_command()
 {
-    nvs_handle_t nvs_handle;
-    esp_err_t err;
-    
-    err = nvs_open("storage", NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
+    if (command_history.empty() || history_index < 0) {
+        ESP_LOGW(TAG, "No history command to send (empty or not navigating)");
         return;
     }
     
-    uint32_t history_count = 0;
-    nvs_get_u32(nvs_handle, "hist_count", &history_count);
+    size_t actual_index = command_history.size() - 1 - history_index;
+    std::string cmd_to_send = command_history[actual_index];
+    
+    ESP_LOGI(TAG, "Sending history command: '%s'", cmd_to_send.c_str());
+    
+    current_input = cmd_to_send;
+    
+    std::string display_text = "> " + current_input;
+    if (input_label) {
+        lv_label_set_text(input_label, display_text.c_str());
+    }
+    
+    send_command(cmd_to_send.c_str());
     
-    for (uint32_t i = 0; i < history_count && i < 100; i++) {
-        char key[16];
-        snprintf(key, sizeof(key), "hist_%lu", i);
-        nvs_erase_key(nvs_handle, key);
+    auto it = std::find(command_history.begin(), command_history.end(), current_input);
+    if (it != command_history.end()) {
+        command_history.erase(it);
     }
+    command_history.push_back(current_input);
+    history_needs_save = true;
+    current_input.clear();
+    history_index = -1;
     
-    nvs_erase_key(nvs_handle, "hist_count");
-    nvs_commit(nvs_handle);
-    nvs_close(nvs_handle);
+    display_text = "> ";
+    if (input_label) {
+        lv_label_set_text(input_label, display_text.c_str());
+    }
 }
 
 int SSHTerminal::waitsocket(int socket_fd, LIBSSH2_SESSION *session)
@@ -2043,7 +2189,13 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
         append_text("ERROR: WiFi not connected\n");
         return ESP_FAIL;
     }
+    if (rx_active) {
+        // The running session belongs to ssh_rx until it ends.
+        append_text("ERROR: already connected, ':exit' first\n");
+        return ESP_FAIL;
+    }
 
+    metrics::add(metrics::Counter::kSshAttempts);
     ESP_LOGI(TAG, "Connecting to %s:%d", host, port);
     append_text("Connecting to ");
     append_text(host);
@@ -2105,21 +2257,27 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
 
     ESP_LOGI(TAG, "Socket connected");
     append_text("Socket connected, initializing SSH session...\n");
-    log_heap_snapshot("pre_session_init");
+    if (!mem_monitor::check_session_headroom("pre_session_init")) {
+        // Free the scrollback up front rather than waiting for the first
+        // allocation in the handshake to fail.
+        if (display_lock(50)) {
+            clear_terminal();
+            display_unlock();
+        }
+        append_text("WARN: low memory, cleared terminal before session init\n");
+    }
 
-    session = libssh2_session_init();
+    session = libssh2_session_init_ex(ssh_alloc, ssh_free, ssh_realloc, this);
     if (!session) {
         ESP_LOGW(TAG, "Failed to create SSH session, attempting low-memory recovery");
         append_text("WARN: session alloc failed, clearing terminal and retrying...\n");
         if (display_lock(50)) {
-            if (terminal_output) {
-                lv_textarea_set_text(terminal_output, "");
-            }
+            clear_terminal();
             display_unlock();
         }
         vTaskDelay(pdMS_TO_TICKS(20));
-        log_heap_snapshot("post_recovery");
-        session = libssh2_session_init();
+        mem_monitor::check_session_headroom("post_recovery");
+        session = libssh2_session_init_ex(ssh_alloc, ssh_free, ssh_realloc, this);
     }
     if (!session) {
         ESP_LOGE(TAG, "Failed to create SSH session after recovery");
@@ -2133,11 +2291,22 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
     libssh2_session_set_blocking(session, 0);
 
     append_text("Performing SSH handshake...\n");
-    while ((rc = libssh2_session_handshake(session, ssh_socket)) == LIBSSH2_ERROR_EAGAIN);
+    {
+        power_mgmt::CpuBoost boost(power_mgmt::Lock::kHandshake);
+        const int64_t handshake_start_us = esp_timer_get_time();
+        while ((rc = libssh2_session_handshake(session, ssh_socket)) == LIBSSH2_ERROR_EAGAIN &&
+               !job_runner::cancelled()) {
+        }
+        if (rc == 0) {
+            const int64_t handshake_us = esp_timer_get_time() - handshake_start_us;
+            power_mgmt::record_handshake_us((uint32_t)handshake_us);
+            metrics::observe(metrics::Histogram::kHandshakeMs, (uint32_t)(handshake_us / 1000));
+        }
+    }
     
     if (rc) {
         ESP_LOGE(TAG, "SSH handshake failed: %d", rc);
-        append_text("ERROR: SSH handshake failed\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: SSH handshake failed\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2146,7 +2315,7 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
     append_text("SSH handshake successful\n");
 
     if (ssh_authenticate(username, password) != ESP_OK) {
-        append_text("ERROR: Authentication failed\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: Authentication failed\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2154,7 +2323,7 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
     append_text("Authentication successful\n");
 
     if (ssh_open_channel() != ESP_OK) {
-        append_text("ERROR: Failed to open channel\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: Failed to open channel\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2163,15 +2332,7 @@ esp_err_t SSHTerminal::connect(const char* host, int port, const char* username,
     ssh_connected = true;
     update_status_bar();
 
-    BaseType_t rx_task_ok = xTaskCreate(ssh_receive_task, "ssh_rx", 6144, this, 5, NULL);
-    if (rx_task_ok != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create SSH receive task");
-        append_text("ERROR: SSH receive task failed to start\n");
-        disconnect();
-        return ESP_FAIL;
-    }
-
-    return ESP_OK;
+    return start_receive();
 }
 
 esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char* username, const char* privkey_data, size_t privkey_len)
@@ -2181,7 +2342,13 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
         append_text("ERROR: WiFi not connected\n");
         return ESP_FAIL;
     }
+    if (rx_active) {
+        // The running session belongs to ssh_rx until it ends.
+        append_text("ERROR: already connected, ':exit' first\n");
+        return ESP_FAIL;
+    }
 
+    metrics::add(metrics::Counter::kSshAttempts);
     ESP_LOGI(TAG, "Connecting to %s:%d with public key", host, port);
     append_text("Connecting to ");
     append_text(host);
@@ -2243,21 +2410,27 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
 
     ESP_LOGI(TAG, "Socket connected");
     append_text("Socket connected, initializing SSH session...\n");
-    log_heap_snapshot("pre_session_init_key");
+    if (!mem_monitor::check_session_headroom("pre_session_init_key")) {
+        // Free the scrollback up front rather than waiting for the first
+        // allocation in the handshake to fail.
+        if (display_lock(50)) {
+            clear_terminal();
+            display_unlock();
+        }
+        append_text("WARN: low memory, cleared terminal before session init\n");
+    }
 
-    session = libssh2_session_init();
+    session = libssh2_session_init_ex(ssh_alloc, ssh_free, ssh_realloc, this);
     if (!session) {
         ESP_LOGW(TAG, "Failed to create SSH session, attempting low-memory recovery");
         append_text("WARN: session alloc failed, clearing terminal and retrying...\n");
         if (display_lock(50)) {
-            if (terminal_output) {
-                lv_textarea_set_text(terminal_output, "");
-            }
+            clear_terminal();
             display_unlock();
         }
         vTaskDelay(pdMS_TO_TICKS(20));
-        log_heap_snapshot("post_recovery_key");
-        session = libssh2_session_init();
+        mem_monitor::check_session_headroom("post_recovery_key");
+        session = libssh2_session_init_ex(ssh_alloc, ssh_free, ssh_realloc, this);
     }
     if (!session) {
         ESP_LOGE(TAG, "Failed to create SSH session after recovery");
@@ -2271,11 +2444,22 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
     libssh2_session_set_blocking(session, 0);
 
     append_text("Performing SSH handshake...\n");
-    while ((rc = libssh2_session_handshake(session, ssh_socket)) == LIBSSH2_ERROR_EAGAIN);
+    {
+        power_mgmt::CpuBoost boost(power_mgmt::Lock::kHandshake);
+        const int64_t handshake_start_us = esp_timer_get_time();
+        while ((rc = libssh2_session_handshake(session, ssh_socket)) == LIBSSH2_ERROR_EAGAIN &&
+               !job_runner::cancelled()) {
+        }
+        if (rc == 0) {
+            const int64_t handshake_us = esp_timer_get_time() - handshake_start_us;
+            power_mgmt::record_handshake_us((uint32_t)handshake_us);
+            metrics::observe(metrics::Histogram::kHandshakeMs, (uint32_t)(handshake_us / 1000));
+        }
+    }
     
     if (rc) {
         ESP_LOGE(TAG, "SSH handshake failed: %d", rc);
-        append_text("ERROR: SSH handshake failed\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: SSH handshake failed\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2284,7 +2468,7 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
     append_text("SSH handshake successful\n");
 
     if (ssh_authenticate_pubkey(username, privkey_data, privkey_len) != ESP_OK) {
-        append_text("ERROR: Public key authentication failed\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: Public key authentication failed\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2292,7 +2476,7 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
     append_text("Public key authentication successful\n");
 
     if (ssh_open_channel() != ESP_OK) {
-        append_text("ERROR: Failed to open channel\n");
+        append_text(job_runner::cancelled() ? "Cancelled\n" : "ERROR: Failed to open channel\n");
         disconnect();
         return ESP_FAIL;
     }
@@ -2301,15 +2485,7 @@ esp_err_t SSHTerminal::connect_with_key(const char* host, int port, const char*
     ssh_connected = true;
     update_status_bar();
 
-    BaseType_t rx_task_ok = xTaskCreate(ssh_receive_task, "ssh_rx", 6144, this, 5, NULL);
-    if (rx_task_ok != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create SSH receive task");
-        append_text("ERROR: SSH receive task failed to start\n");
-        disconnect();
-        return ESP_FAIL;
-    }
-
-    return ESP_OK;
+    return start_receive();
 }
 
 esp_err_t SSHTerminal::ssh_authenticate(const char* username, const char* password)
@@ -2318,8 +2494,11 @@ esp_err_t SSHTerminal::ssh_authenticate(const char* username, const char* passwo
     append_text(username);
     append_text("...\n");
 
+    power_mgmt::CpuBoost boost(power_mgmt::Lock::kHandshake);
     int rc;
-    while ((rc = libssh2_userauth_password(session, username, password)) == LIBSSH2_ERROR_EAGAIN);
+    while ((rc = libssh2_userauth_password(session, username, password)) == LIBSSH2_ERROR_EAGAIN &&
+           !job_runner::cancelled()) {
+    }
     
     if (rc) {
         char *err_msg;
@@ -2339,19 +2518,21 @@ esp_err_t SSHTerminal::ssh_authenticate_pubkey(const char* username, const char*
     append_text(username);
     append_text(" with public key...\n");
 
+    power_mgmt::CpuBoost boost(power_mgmt::Lock::kHandshake);
     int rc;
     // libssh2_userauth_publickey_frommemory expects the private key, public key (can be NULL), and passphrase
     while ((rc = libssh2_userauth_publickey_frommemory(session, username, strlen(username),
                                                          NULL, 0,  // public key (optional)
                                                          privkey_data, privkey_len,
-                                                         NULL)) == LIBSSH2_ERROR_EAGAIN);  // no passphrase
+                                                         NULL)) == LIBSSH2_ERROR_EAGAIN &&  // no passphrase
+           !job_runner::cancelled()) {
+    }
     
     if (rc) {
         char *err_msg;
         int err_len;
         libssh2_session_last_error(session, &err_msg, &err_len, 0);
         ESP_LOGE(TAG, "Public key authentication failed: %s (error code: %d)", err_msg, rc);
-        append_text("ERROR: Public key authentication failed\n");
         return ESP_FAIL;
     }
 
@@ -2359,13 +2540,54 @@ esp_err_t SSHTerminal::ssh_authenticate_pubkey(const char* username, const char*
     return ESP_OK;
 }
 
+namespace {
+constexpr unsigned kKeepaliveIntervalS = 45;
+// Longest a quiet ssh_rx blocks in select(); incoming traffic ends the wait
+// at once, so this only bounds how late a keepalive can go out.
+constexpr int kRxIdleWaitMaxMs = 5000;
+// ssh_rx reads and parses for this long before offering the core, and
+// sleeps a tick after this long without the channel running dry.
+constexpr uint32_t kRxSliceUs = 2000;
+constexpr uint32_t kRxBusyLimitUs = 100 * 1000;
+
+// Block until the socket is readable, something is posted to ssh_rx's
+// mailbox, or timeout_ms passes. The task sleeps in lwIP meanwhile, which
+// lets the CPU drop into light sleep when enabled.
+void wait_readable(int fd, int timeout_ms)
+{
+    if (fd < 0) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        return;
+    }
+    fd_set readfd;
+    FD_ZERO(&readfd);
+    FD_SET(fd, &readfd);
+    int max_fd = fd;
+    if (g_net_wake_fd >= 0) {
+        FD_SET(g_net_wake_fd, &readfd);
+        max_fd = std::max(max_fd, g_net_wake_fd);
+    } else {
+        timeout_ms = std::min(timeout_ms, kNetPollFallbackMs);
+    }
+    struct timeval timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_usec = (timeout_ms % 1000) * 1000;
+    if (select(max_fd + 1, &readfd, NULL, NULL, &timeout) > 0 && g_net_wake_fd >= 0 &&
+        FD_ISSET(g_net_wake_fd, &readfd)) {
+        uint64_t posts = 0;
+        read(g_net_wake_fd, &posts, sizeof(posts));
+    }
+}
+} // namespace
+
 esp_err_t SSHTerminal::ssh_open_channel()
 {
     append_text("Opening SSH channel...\n");
 
     int rc;
     while ((channel = libssh2_channel_open_session(session)) == NULL &&
-           libssh2_session_last_error(session, NULL, NULL, 0) == LIBSSH2_ERROR_EAGAIN) {
+           libssh2_session_last_error(session, NULL, NULL, 0) == LIBSSH2_ERROR_EAGAIN &&
+           !job_runner::cancelled()) {
         waitsocket(ssh_socket, session);
     }
 
@@ -2374,7 +2596,10 @@ esp_err_t SSHTerminal::ssh_open_channel()
         return ESP_FAIL;
     }
 
-    while ((rc = libssh2_channel_request_pty(channel, "vt100")) == LIBSSH2_ERROR_EAGAIN) {
+    // The PTY is the size of g_screen, so full-screen programs address it.
+    while ((rc = libssh2_channel_request_pty_ex(channel, "vt100", 5, NULL, 0, vt_screen::kCols, vt_screen::kRows, 0,
+                                                0)) == LIBSSH2_ERROR_EAGAIN &&
+           !job_runner::cancelled()) {
         waitsocket(ssh_socket, session);
     }
     
@@ -2383,7 +2608,7 @@ esp_err_t SSHTerminal::ssh_open_channel()
         return ESP_FAIL;
     }
 
-    while ((rc = libssh2_channel_shell(channel)) == LIBSSH2_ERROR_EAGAIN) {
+    while ((rc = libssh2_channel_shell(channel)) == LIBSSH2_ERROR_EAGAIN && !job_runner::cancelled()) {
         waitsocket(ssh_socket, session);
     }
     
@@ -2393,6 +2618,9 @@ esp_err_t SSHTerminal::ssh_open_channel()
     }
 
     libssh2_channel_set_blocking(channel, 0);
+    // Keepalives are sent from ssh_rx; they hold the session (and any NAT
+    // mapping) open while the device idles with the screen off.
+    libssh2_keepalive_config(session, 1, kKeepaliveIntervalS);
 
     ESP_LOGI(TAG, "SSH channel opened successfully");
     return ESP_OK;
@@ -2420,11 +2648,13 @@ esp_err_t SSHTerminal::disconnect()
 
     libssh2_exit();
     
-    if (display_lock(0)) {
-        update_status_bar();
-        append_text("\nDisconnected\n");
-        display_unlock();
-    }
+    // The LVGL task hands the screen and its scrollback back to the
+    // textarea (sync_session_view()); later output is appended below it.
+    g_screen_attached = false;
+    // Also runs on ssh_rx when a session ends, so the widgets hear about it
+    // through the UI mailbox.
+    post_ui_text("\nDisconnected\n", kNetPostWait);
+    post_ui(UiMessage::Kind::kStatusBar);
     
     ESP_LOGI(TAG, "Disconnected");
     
@@ -2438,26 +2668,29 @@ bool SSHTerminal::is_connected()
 
 void SSHTerminal::send_command(const char* cmd)
 {
-    if (!channel) {
+    if (!rx_active) {
         return;
     }
     
-    bytes_received = 0;
-    if (byte_counter_label && display_lock(0)) {
-        lv_label_set_text(byte_counter_label, "0 B");
-        display_unlock();
+    ESP_LOGI(TAG, "Sending command: %s", cmd);
+    
+    // ssh_rx writes it and restarts the byte counter for its output.
+    NetMessage reset = {};
+    reset.kind = NetMessage::Kind::kResetByteCount;
+    const std::string full_cmd = std::string(cmd) + "\n";
+    if (!post_net(reset) || !post_net_bytes(full_cmd.c_str(), full_cmd.length())) {
+        ESP_LOGW(TAG, "Command not fully queued: ssh_rx mailbox full");
     }
+}
 
-    std::string full_cmd = std::string(cmd) + "\n";
+void SSHTerminal::write_channel(const char* data, size_t len)
+{
     ssize_t nwritten = 0;
     int retry_count = 0;
     const int MAX_RETRIES = 20;
     
-    ESP_LOGI(TAG, "Sending command: %s", cmd);
-    
-    while (nwritten < (ssize_t)full_cmd.length() && retry_count < MAX_RETRIES) {
-        ssize_t n = libssh2_channel_write(channel, full_cmd.c_str() + nwritten, 
-                                          full_cmd.length() - nwritten);
+    while (nwritten < (ssize_t)len && retry_count < MAX_RETRIES) {
+        ssize_t n = libssh2_channel_write(channel, data + nwritten, len - nwritten);
         if (n == LIBSSH2_ERROR_EAGAIN) {
             retry_count++;
             vTaskDelay(1);
@@ -2471,198 +2704,372 @@ void SSHTerminal::send_command(const char* cmd)
         retry_count = 0;  // Forward progress reset.
     }
     
-    if (nwritten < (ssize_t)full_cmd.length()) {
-        ESP_LOGW(TAG, "Command partially sent (%d/%d bytes)", (int)nwritten, (int)full_cmd.length());
+    metrics::add(metrics::Counter::kTxBytes, (uint32_t)nwritten);
+    if (nwritten < (ssize_t)len) {
+        ESP_LOGW(TAG, "Write partially sent (%d/%d bytes)", (int)nwritten, (int)len);
     }
+}
 
-    ESP_LOGI(TAG, "Command sent: %d bytes", (int)nwritten);
+bool SSHTerminal::drain_net_mailbox()
+{
+    NetMessage msg;
+    while (g_net_mailbox.receive(&msg)) {
+        switch (msg.kind) {
+        case NetMessage::Kind::kWrite:
+            write_channel(msg.data, msg.len);
+            break;
+        case NetMessage::Kind::kResetByteCount:
+            bytes_received = 0;
+            bytes_shown = 0;
+            post_ui(UiMessage::Kind::kByteCount, 0);
+            break;
+        case NetMessage::Kind::kDisconnect:
+            return false;
+        }
+    }
+    return true;
 }
 
 void SSHTerminal::ssh_receive_task(void* param)
 {
     SSHTerminal* terminal = (SSHTerminal*)param;
-    char buffer[1024];
-    ssize_t rc;
 
-    ESP_LOGI(TAG, "SSH receive task started");
+    // Parked until start_receive() hands over a freshly opened channel.
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (terminal->ssh_connected && terminal->channel) {
+            terminal->receive_session();
+        }
+        terminal->rx_active = false;
+    }
+}
 
-    while (terminal->ssh_connected && terminal->channel) {
-        rc = libssh2_channel_read(terminal->channel, buffer, sizeof(buffer) - 1);
+void SSHTerminal::receive_session()
+{
+    char* buffer = g_rx_buffer;
+    const size_t buffer_size = sizeof(g_rx_buffer);
+    ssize_t rc;
+    // Held from the first chunk of a burst until the channel runs dry, so
+    // decrypt and text processing run at full clock only while data flows.
+    bool boosted = false;
+    work_budget::Budget budget(kRxSliceUs, kRxBusyLimitUs);
+    budget.start();
+
+    ESP_LOGI(TAG, "SSH receive loop started");
+
+    while (ssh_connected && channel) {
+        if (!drain_net_mailbox()) {
+            ESP_LOGI(TAG, "Disconnect requested");
+            flush_display_buffer();
+            break;
+        }
+        rc = libssh2_channel_read(channel, buffer, buffer_size - 1);
         
         if (rc > 0) {
+            event_trace::record(event_trace::Event::kChannelRead, static_cast<uint32_t>(rc));
+            metrics::add(metrics::Counter::kRxBytes, static_cast<uint32_t>(rc));
+            metrics::add(metrics::Counter::kRxReads);
+            metrics::observe(metrics::Histogram::kRxChunkBytes, static_cast<uint32_t>(rc));
+            if (!boosted) {
+                power_mgmt::acquire(power_mgmt::Lock::kNetwork);
+                boosted = true;
+            }
             buffer[rc] = '\0';
-            terminal->process_received_data(buffer, rc);
-            vTaskDelay(1);
+            process_received_data(buffer, rc);
+            if (activity_cb) {
+                activity_cb(activity_ctx);
+            }
         } else if (rc == LIBSSH2_ERROR_EAGAIN) {
-            terminal->flush_display_buffer();
-            vTaskDelay(pdMS_TO_TICKS(100));
+            flush_display_buffer();
+            if (boosted) {
+                power_mgmt::release(power_mgmt::Lock::kNetwork);
+                boosted = false;
+            }
+            int next_keepalive_s = kKeepaliveIntervalS;
+            libssh2_keepalive_send(session, &next_keepalive_s);
+            const int wait_ms = std::min(kRxIdleWaitMaxMs, std::max(1, next_keepalive_s) * 1000);
+            wait_readable(ssh_socket, wait_ms);
+            budget.start();
         } else if (rc < 0) {
             ESP_LOGE(TAG, "Read error: %d", (int)rc);
             break;
         }
 
-        if (libssh2_channel_eof(terminal->channel)) {
+        if (libssh2_channel_eof(channel)) {
             ESP_LOGI(TAG, "Channel EOF");
-            terminal->flush_display_buffer();
+            flush_display_buffer();
             break;
         }
         
-        vTaskDelay(1);
+        switch (budget.checkpoint()) {
+        case work_budget::Action::kYield:
+            metrics::add(metrics::Counter::kRxYields);
+            break;
+        case work_budget::Action::kSleep:
+            metrics::add(metrics::Counter::kRxSleeps);
+            break;
+        case work_budget::Action::kNone:
+            break;
+        }
     }
 
-    ESP_LOGI(TAG, "SSH receive task ended");
-    terminal->disconnect();
-    vTaskDelete(NULL);
+    if (boosted) {
+        power_mgmt::release(power_mgmt::Lock::kNetwork);
+    }
+    ESP_LOGI(TAG, "SSH receive loop ended");
+    disconnect();
 }
 
-std::string SSHTerminal::strip_ansi_codes(const char* data, size_t len)
+esp_err_t SSHTerminal::start_receive()
 {
-    std::string result;
-    result.reserve(len);
-    
-    for (size_t i = 0; i < len; i++) {
-        if (i > 0 && i % 1024 == 0) {
-            vTaskDelay(1);
-        }
-        
-        if (data[i] == '\x1B' || data[i] == '\033') {
-            i++;
-            if (i >= len) break;
-            
-            if (data[i] == '[') {
-                i++;
-                while (i < len && !((data[i] >= 'A' && data[i] <= 'Z') || 
-                                    (data[i] >= 'a' && data[i] <= 'z'))) {
-                    i++;
-                }
-            } else if (data[i] == ']') {
-                i++;
-                while (i < len) {
-                    if (data[i] == '\007') break;
-                    if (data[i] == '\x1B' && i + 1 < len && data[i + 1] == '\\') {
-                        i++;
-                        break;
-                    }
-                    i++;
-                }
-            } else if (data[i] == '(' || data[i] == ')') {
-                i++;
-            }
-        } else if (data[i] == '\r') {
-            continue;
-        } else {
-            result += data[i];
+    if (ssh_rx_handle == NULL) {
+        ESP_LOGE(TAG, "SSH receive task not running");
+        append_text("ERROR: SSH receive task failed to start\n");
+        disconnect();
+        return ESP_FAIL;
+    }
+    metrics::add(metrics::Counter::kSshConnects);
+    // Anything still queued was meant for an earlier session.
+    g_net_mailbox.clear();
+    rx_active = true;
+    // Queued behind the connect progress, so the LVGL task seeds the grid
+    // with it before letting ssh_rx go. Without room, start unseeded.
+    if (!post_ui(UiMessage::Kind::kAttachScreen, 0, kJobPostWait)) {
+        {
+            ScreenLock lock;
+            g_screen.reset();
         }
+        g_screen_attached = true;
+        xTaskNotifyGive(ssh_rx_handle);
     }
-    
-    return result;
+    return ESP_OK;
 }
 
 void SSHTerminal::process_received_data(const char* data, size_t len)
 {
+    event_trace::record(event_trace::Event::kParseBegin, static_cast<uint32_t>(len));
     bytes_received += len;
     
-    std::string cleaned = strip_ansi_codes(data, len);
-    text_buffer += cleaned;
+    // Parsed where libssh2 left it; printable bytes land in their cell.
+    {
+        ScreenLock lock;
+        g_screen.feed(data, len);
+    }
     
     int64_t current_time = esp_timer_get_time() / 1000;
-    
-    if (text_buffer.size() > 2048) {
-        text_buffer = text_buffer.substr(text_buffer.size() - 1024);
-    }
+    event_trace::record(event_trace::Event::kParseEnd);
     
     if (current_time - last_display_update >= 1000) {
         flush_display_buffer();
     }
-    
-    vTaskDelay(1);
 }
 
 void SSHTerminal::flush_display_buffer()
 {
-    if (text_buffer.empty() && bytes_received == 0) {
+    bool dirty;
+    {
+        ScreenLock lock;
+        dirty = g_screen.dirty();
+    }
+    // The idle wake-ups land here too: with nothing new, leave the LVGL
+    // task asleep.
+    if (!dirty && bytes_received == bytes_shown) {
         return;
     }
+    event_trace::record(event_trace::Event::kFlushBegin, static_cast<uint32_t>(dirty));
+    const int64_t flush_start_us = esp_timer_get_time();
     
-    const size_t CHUNK_SIZE = 256;
-    size_t offset = 0;
-    
-    while (offset < text_buffer.size()) {
-        if (display_lock(0)) {
-            size_t chunk_len = std::min(CHUNK_SIZE, text_buffer.size() - offset);
-            std::string chunk = text_buffer.substr(offset, chunk_len);
-            append_text(chunk.c_str());
-            display_unlock();
-            offset += chunk_len;
-            
-            vTaskDelay(1);
-        } else {
-            break;
-        }
+    if (dirty) {
+        request_screen();
     }
     
-    if (offset > 0) {
-        text_buffer = text_buffer.substr(offset);
+    if (bytes_received != bytes_shown && post_ui(UiMessage::Kind::kByteCount, bytes_received)) {
+        bytes_shown = bytes_received;
     }
     
-    if (bytes_received > 0 && byte_counter_label && display_lock(0)) {
-        char counter_text[32];
-        if (bytes_received < 1024) {
-            snprintf(counter_text, sizeof(counter_text), "%zu B", bytes_received);
-        } else if (bytes_received < 1024 * 1024) {
-            snprintf(counter_text, sizeof(counter_text), "%.1f KB", bytes_received / 1024.0);
-        } else {
-            snprintf(counter_text, sizeof(counter_text), "%.2f MB", bytes_received / (1024.0 * 1024.0));
-        }
-        lv_label_set_text(byte_counter_label, counter_text);
-        display_unlock();
+    last_display_update = esp_timer_get_time() / 1000;
+    metrics::observe(metrics::Histogram::kFlushUs, (uint32_t)(esp_timer_get_time() - flush_start_us));
+    event_trace::record(event_trace::Event::kFlushEnd);
+}
+
+// LVGL task: from here on session_view shows g_screen. The textarea's text
+// goes through the grid first, so what the user just read stays put: the
+// last lines on the screen, the rest in the scrollback. ssh_rx feeds the
+// session in after it.
+void SSHTerminal::attach_screen()
+{
+    const char* text = terminal_output ? lv_textarea_get_text(terminal_output) : nullptr;
+    {
+        ScreenLock lock;
+        g_screen.reset();
+        g_screen.clear_scrollback();
+        if (text != nullptr) {
+            g_screen.write_text(text);
+        }
+    }
+    g_screen_attached = true;
+    xTaskNotifyGive(ssh_rx_handle);
+    sync_session_view();
+    show_screen();
+}
+
+// Show session_view while g_screen_attached and the textarea otherwise.
+// The flag is flipped off the LVGL task (a session ending on ssh_rx, an
+// unseeded attach on the command worker), so everything that touches the
+// output widgets checks here first. True while session_view is shown.
+bool SSHTerminal::sync_session_view()
+{
+    const bool attached = g_screen_attached;
+    if (!terminal_output || attached == session_view.shown()) {
+        return attached;
+    }
+    if (attached) {
+        session_view.clear();
+        session_view.set_shown(true);
+        lv_obj_add_flag(terminal_output, LV_OBJ_FLAG_HIDDEN);
+        // The text lives in the grid and the scrollback now.
+        lv_textarea_set_text(terminal_output, "");
+    } else {
+        detach_screen();
     }
-    
-    if (text_buffer.empty()) {
-        last_display_update = esp_timer_get_time() / 1000;
+    return attached;
+}
+
+// LVGL task or display lock: the session is over. The textarea gets the
+// scrollback and the last screen, as much as fits, and session_view is
+// emptied.
+void SSHTerminal::detach_screen()
+{
+    show_screen();
+    std::string text;
+    session_view.text(&text);
+    lv_textarea_set_text(terminal_output, tail_lines(text.c_str(), kOutputTextMax / 2));
+    session_view.clear();
+    session_view.set_shown(false);
+    lv_obj_clear_flag(terminal_output, LV_OBJ_FLAG_HIDDEN);
+}
+
+// LVGL task: bring session_view up to date. Only the rows that changed are
+// copied out, under the lock, and handed to LVGL after it is released; a
+// row that scrolls off keeps its label as scrollback.
+void SSHTerminal::show_screen()
+{
+    g_screen_posted = false;
+    if (!session_view.shown()) {
+        return;
+    }
+    const int64_t start_us = esp_timer_get_time();
+    {
+        ScreenLock lock;
+        g_screen.take_frame(&g_screen_frame);
+    }
+    session_view.apply(g_screen_frame);
+    metrics::observe(metrics::Histogram::kScreenRenderUs, (uint32_t)(esp_timer_get_time() - start_us));
+}
+
+void SSHTerminal::set_byte_counter(size_t bytes)
+{
+    if (!byte_counter_label) {
+        return;
+    }
+    char counter_text[32];
+    if (bytes < 1024) {
+        snprintf(counter_text, sizeof(counter_text), "%zu B", bytes);
+    } else if (bytes < 1024 * 1024) {
+        snprintf(counter_text, sizeof(counter_text), "%.1f KB", bytes / 1024.0);
+    } else {
+        snprintf(counter_text, sizeof(counter_text), "%.2f MB", bytes / (1024.0 * 1024.0));
+    }
+    lv_label_set_text(byte_counter_label, counter_text);
+}
+
+// LVGL task: apply what ssh_rx queued for the widgets, at most one
+// mailbox-full per call so a burst cannot hold off the next frame.
+void SSHTerminal::ui_mailbox_cb(lv_timer_t* timer)
+{
+    SSHTerminal* terminal = (SSHTerminal*)lv_timer_get_user_data(timer);
+    static UiMessage msg;  // off the LVGL task stack
+    terminal->sync_session_view();
+    for (size_t i = 0; i < kUiMailboxDepth && g_ui_mailbox.receive(&msg); ++i) {
+        switch (msg.kind) {
+        case UiMessage::Kind::kText:
+            terminal->append_text(msg.text);
+            break;
+        case UiMessage::Kind::kByteCount:
+            terminal->set_byte_counter(msg.bytes);
+            break;
+        case UiMessage::Kind::kStatusBar:
+            terminal->update_status_bar();
+            break;
+        case UiMessage::Kind::kMemoryReport:
+            terminal->report_memory_usage();
+            break;
+        case UiMessage::Kind::kAttachScreen:
+            terminal->attach_screen();
+            break;
+        case UiMessage::Kind::kScreen:
+            terminal->show_screen();
+            break;
+        }
     }
-    
-    vTaskDelay(1);
 }
 
 void SSHTerminal::update_status_bar()
 {
     if (!status_bar) return;
-    
-    if (!display_lock(0)) {
+    if (job_runner::on_worker()) {
+        post_ui(UiMessage::Kind::kStatusBar);
         return;
     }
 
-    std::string status;
-    
-    if (battery_initialized) {
-        float voltage = battery.readBatteryVoltage();
-        if (voltage > 0.1f) {
-            char voltage_text[32];
-            snprintf(voltage_text, sizeof(voltage_text), "%.2fV | ", voltage);
-            status = voltage_text;
-            ESP_LOGD(TAG, "Battery voltage displayed: %.2fV", voltage);
+    // Only touch the labels whose displayed value changed since last time.
+    const int mv = battery_mv.load();
+    const int battery_cv = mv >= 0 ? (mv + 5) / 10 : -1;
+    const int minutes = battery_minutes.load();
+    const int remaining = minutes >= 0
+        ? (minutes + kRemainingDisplayStepMin / 2) / kRemainingDisplayStepMin * kRemainingDisplayStepMin
+        : -1;
+    if (battery_cv != status_cache.battery_cv || remaining != status_cache.remaining_min) {
+        status_cache.battery_cv = battery_cv;
+        status_cache.remaining_min = remaining;
+        if (battery_cv >= 0 && remaining >= 0) {
+            lv_label_set_text_fmt(status_battery_label, "%d.%02dV ~%dh%02dm | ",
+                                  battery_cv / 100, battery_cv % 100, remaining / 60, remaining % 60);
+            lv_obj_clear_flag(status_battery_label, LV_OBJ_FLAG_HIDDEN);
+        } else if (battery_cv >= 0) {
+            lv_label_set_text_fmt(status_battery_label, "%d.%02dV | ", battery_cv / 100, battery_cv % 100);
+            lv_obj_clear_flag(status_battery_label, LV_OBJ_FLAG_HIDDEN);
+            ESP_LOGD(TAG, "Battery voltage displayed: %d.%02dV", battery_cv / 100, battery_cv % 100);
         } else {
-            ESP_LOGW(TAG, "Battery voltage too low or invalid: %.2fV", voltage);
+            lv_obj_add_flag(status_battery_label, LV_OBJ_FLAG_HIDDEN);
         }
-    } else {
-        ESP_LOGD(TAG, "Battery not initialized, skipping voltage display");
     }
     
-    if (!wifi_connected) {
-        status += LV_SYMBOL_WIFI " OFF";
-        lv_obj_set_style_text_color(status_bar, lv_color_hex(0xFF0000), 0);
-    } else if (!ssh_connected) {
-        status += LV_SYMBOL_WIFI " | " LV_SYMBOL_CLOSE " SSH";
-        lv_obj_set_style_text_color(status_bar, lv_color_hex(0xFFFF00), 0);
-    } else {
-        status += LV_SYMBOL_WIFI " | " LV_SYMBOL_OK " SSH";
-        lv_obj_set_style_text_color(status_bar, lv_color_hex(0x00FF00), 0);
+    const int link_state = !wifi_connected ? 0 : (!ssh_connected ? 1 : 2);
+    if (link_state != status_cache.link_state) {
+        status_cache.link_state = link_state;
+        if (link_state == 0) {
+            lv_label_set_text(status_wifi_label, LV_SYMBOL_WIFI " OFF");
+            lv_obj_add_flag(status_ssh_label, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_set_style_text_color(status_bar, lv_color_hex(0xFF0000), 0);
+        } else {
+            lv_label_set_text(status_wifi_label, LV_SYMBOL_WIFI);
+            lv_label_set_text(status_ssh_label, link_state == 1 ? " | " LV_SYMBOL_CLOSE " SSH" : " | " LV_SYMBOL_OK " SSH");
+            lv_obj_clear_flag(status_ssh_label, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_set_style_text_color(status_bar, lv_color_hex(link_state == 1 ? 0xFFFF00 : 0x00FF00), 0);
+        }
     }
     
-    lv_label_set_text(status_bar, status.c_str());
-    
-    display_unlock();
+    const int rssi = wifi_connected ? rssi_dbm.load() : 0;
+    if (rssi != status_cache.rssi_dbm) {
+        status_cache.rssi_dbm = rssi;
+        if (rssi != 0) {
+            lv_label_set_text_fmt(status_rssi_label, " %ddBm", rssi);
+            lv_obj_clear_flag(status_rssi_label, LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_add_flag(status_rssi_label, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
 }
 
 void SSHTerminal::update_terminal_display()
@@ -2671,6 +3078,7 @@ void SSHTerminal::update_terminal_display()
 
 void SSHTerminal::create_side_panel()
 {
+    log_lvgl_mem("before side panel");
     side_panel = lv_obj_create(terminal_screen);
     lv_obj_set_size(side_panel, 100, lv_pct(100));
     lv_obj_set_style_bg_color(side_panel, lv_color_hex(0x101010), 0);
@@ -2719,19 +3127,119 @@ void SSHTerminal::create_side_panel()
     create_key_button("Esc", "\x1B", 350);
     create_key_button("Exit SSH", "EXIT", 385);
     create_key_button("Clear", "CLEAR", 420);
+    log_lvgl_mem("after side panel");
 }
 
-void SSHTerminal::toggle_side_panel()
+bool SSHTerminal::side_panel_visible() const
+{
+    return side_panel && !lv_obj_has_flag(side_panel, LV_OBJ_FLAG_HIDDEN);
+}
+
+void SSHTerminal::show_side_panel()
+{
+    if (side_panel_release_timer) {
+        lv_timer_delete(side_panel_release_timer);
+        side_panel_release_timer = NULL;
+    }
+    if (!side_panel) {
+        create_side_panel();
+    }
+    
+    lv_obj_clear_flag(side_panel, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_align(side_panel, LV_ALIGN_TOP_RIGHT, 0, 0);
+}
+
+void SSHTerminal::hide_side_panel()
 {
     if (!side_panel) return;
     
-    if (lv_obj_has_flag(side_panel, LV_OBJ_FLAG_HIDDEN)) {
-        lv_obj_clear_flag(side_panel, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_align(side_panel, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_obj_add_flag(side_panel, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_align(side_panel, LV_ALIGN_TOP_RIGHT, 100, 0);
+    
+    // Hiding usually happens from one of the panel's own button callbacks, so
+    // the objects are freed later from a timer rather than here.
+    if (side_panel_release_timer) {
+        lv_timer_reset(side_panel_release_timer);
+    } else {
+        side_panel_release_timer = lv_timer_create(side_panel_release_cb, kPanelIdleReleaseMs, this);
+        lv_timer_set_repeat_count(side_panel_release_timer, 1);
+    }
+}
+
+void SSHTerminal::toggle_side_panel()
+{
+    if (side_panel_visible()) {
+        hide_side_panel();
+    } else {
+        show_side_panel();
+    }
+}
+
+void SSHTerminal::side_panel_release_cb(lv_timer_t* timer)
+{
+    SSHTerminal* terminal = (SSHTerminal*)lv_timer_get_user_data(timer);
+    // Single-shot timer: LVGL deletes it after this callback returns.
+    terminal->side_panel_release_timer = NULL;
+    
+    if (!terminal->side_panel || terminal->side_panel_visible()) {
+        return;
+    }
+    
+    lv_obj_delete(terminal->side_panel);
+    terminal->side_panel = NULL;
+    log_lvgl_mem("after side panel release");
+}
+
+void SSHTerminal::show_top_overlay(uint32_t period_ms)
+{
+    if (!top_overlay) {
+        // A label drawn over the output area and rewritten in place; the
+        // textarea and its scrollback are left untouched.
+        top_overlay = lv_label_create(terminal_screen);
+        lv_obj_set_size(top_overlay, lv_obj_get_width(terminal_output), lv_obj_get_height(terminal_output));
+        lv_obj_align_to(top_overlay, terminal_output, LV_ALIGN_CENTER, 0, 0);
+        lv_obj_set_style_bg_color(top_overlay, lv_color_black(), 0);
+        lv_obj_set_style_bg_opa(top_overlay, LV_OPA_COVER, 0);
+        lv_obj_set_style_pad_all(top_overlay, 4, 0);
+        lv_obj_set_style_text_color(top_overlay, lv_obj_get_style_text_color(terminal_output, 0), 0);
+        lv_obj_set_style_text_font(top_overlay, ui_font_small(), 0);
+        lv_label_set_long_mode(top_overlay, LV_LABEL_LONG_CLIP);
+    }
+    if (top_timer) {
+        lv_timer_set_period(top_timer, period_ms);
     } else {
-        lv_obj_add_flag(side_panel, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_align(side_panel, LV_ALIGN_TOP_RIGHT, 100, 0);
+        top_timer = lv_timer_create(top_refresh_cb, period_ms, this);
+    }
+    lv_label_set_text(top_overlay, "top: sampling...");
+    // Fill the overlay on the next LVGL pass instead of a full period later.
+    lv_timer_ready(top_timer);
+}
+
+void SSHTerminal::hide_top_overlay()
+{
+    if (top_timer) {
+        lv_timer_delete(top_timer);
+        top_timer = NULL;
+    }
+    if (top_overlay) {
+        lv_obj_delete(top_overlay);
+        top_overlay = NULL;
+    }
+}
+
+void SSHTerminal::top_refresh_cb(lv_timer_t* timer)
+{
+    SSHTerminal* terminal = (SSHTerminal*)lv_timer_get_user_data(timer);
+    if (!terminal->top_overlay) {
+        return;
+    }
+    // Runs in the LVGL task with the display lock held.
+    static char report[1024];
+    if (task_stats::format_top(report, sizeof(report)) == 0) {
+        lv_label_set_text(terminal->top_overlay, "top: no data");
+        return;
     }
+    lv_label_set_text(terminal->top_overlay, report);
 }
 
 void SSHTerminal::send_special_key(const char* sequence)
@@ -2742,7 +3250,8 @@ void SSHTerminal::send_special_key(const char* sequence)
     }
     
     if (strcmp(sequence, "EXIT") == 0) {
-        disconnect();
+        // Same path as `exit`: ssh_rx owns the session while it runs.
+        cmd_exit(std::string());
         toggle_side_panel();
         return;
     }
@@ -2774,9 +3283,12 @@ void SSHTerminal::send_special_key(const char* sequence)
         return;
     }
     
-    if (ssh_connected && channel) {
-        libssh2_channel_write(channel, sequence, strlen(sequence));
-        ESP_LOGI(TAG, "Sent special key sequence");
+    if (sequence[0] == kCancelKey && sequence[1] == '\0' && job_runner::cancel()) {
+        append_text("^C\n");
+    } else if (rx_active) {
+        if (!post_net_bytes(sequence, strlen(sequence))) {
+            ESP_LOGW(TAG, "Special key dropped: ssh_rx mailbox full");
+        }
     } else {
         ESP_LOGW(TAG, "Cannot send special key - not connected");
     }
@@ -2791,13 +3303,13 @@ void SSHTerminal::gesture_event_cb(lv_event_t* e)
     
     if (dir == LV_DIR_LEFT) {
         ESP_LOGI(TAG, "Swipe left detected - showing special keys panel");
-        if (terminal->side_panel && lv_obj_has_flag(terminal->side_panel, LV_OBJ_FLAG_HIDDEN)) {
-            terminal->toggle_side_panel();
+        if (!terminal->side_panel_visible()) {
+            terminal->show_side_panel();
         }
     } else if (dir == LV_DIR_RIGHT) {
         ESP_LOGI(TAG, "Swipe right detected - hiding special keys panel");
-        if (terminal->side_panel && !lv_obj_has_flag(terminal->side_panel, LV_OBJ_FLAG_HIDDEN)) {
-            terminal->toggle_side_panel();
+        if (terminal->side_panel_visible()) {
+            terminal->hide_side_panel();
         }
     }
 }
@@ -2820,46 +3332,35 @@ void SSHTerminal::load_key_from_memory(const char* keyname, const char* key_data
         return;
     }
     
-    // Convert keyname to lowercase for case-insensitive lookup
-    std::string keyname_str(keyname);
-    std::transform(keyname_str.begin(), keyname_str.end(), keyname_str.begin(), ::tolower);
-    
-    std::string key_str(key_data, key_len);
-    
-    loaded_keys[keyname_str] = key_str;
+    esp_err_t ret = key_store::put(keyname, key_data, key_len);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store SSH key %s: %s", keyname, esp_err_to_name(ret));
+        return;
+    }
     
     ESP_LOGI(TAG, "Loaded SSH key: %s (%d bytes)", keyname, key_len);
 }
 
 const char* SSHTerminal::get_loaded_key(const char* keyname, size_t* len)
 {
-    if (!keyname) {
-        return NULL;
-    }
-    
-    // Convert keyname to lowercase for case-insensitive lookup
-    std::string keyname_str(keyname);
-    std::transform(keyname_str.begin(), keyname_str.end(), keyname_str.begin(), ::tolower);
-    
-    auto it = loaded_keys.find(keyname_str);
-    
-    if (it != loaded_keys.end()) {
-        if (len) {
-            *len = it->second.length();
-        }
-        return it->second.c_str();
-    }
-    
-    return NULL;
+    // Case-insensitive; points into the key arena, nothing is copied.
+    return key_store::find(keyname, len);
 }
 
 std::vector<std::string> SSHTerminal::get_loaded_key_names()
 {
     std::vector<std::string> key_names;
     
-    for (const auto& pair : loaded_keys) {
-        key_names.push_back(pair.first);
+    const char* name = NULL;
+    for (size_t i = 0; (name = key_store::name_at(i)) != NULL; ++i) {
+        key_names.push_back(name);
     }
     
     return key_names;
 }
+
+void SSHTerminal::set_activity_callback(activity_cb_t cb, void* ctx)
+{
+    activity_ctx = ctx;
+    activity_cb = cb;
+}
@@ -0,0 +1,252 @@
+#include "task_stats.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "report_format.hpp"
+#include "task_layout.hpp"
+
+namespace task_stats {
+namespace {
+
+constexpr const char *kTag = "task_stats";
+constexpr UBaseType_t kTaskSlack = 4;
+
+struct CoreSnapshot {
+    bool valid = false;
+    int64_t wall_us = 0;
+    configRUN_TIME_COUNTER_TYPE idle[portNUM_PROCESSORS] = {};
+};
+
+CoreSnapshot g_prev;
+
+// Per-task run-time counters from a report's previous call, so each report
+// shows the share over its own refresh interval.
+constexpr size_t kMaxTrackedTasks = 32;
+struct TaskRuntime {
+    TaskHandle_t handle = nullptr;
+    configRUN_TIME_COUNTER_TYPE runtime = 0;
+};
+
+struct RuntimeHistory {
+    TaskRuntime entries[kMaxTrackedTasks];
+    size_t count = 0;
+    int64_t at_us = 0;
+
+    // Percent of one core used by `task` since the previous store(); < 0
+    // when the task is new.
+    float share(const TaskStatus_t &task, int64_t now_us) const
+    {
+        const int64_t window_us = now_us - at_us;
+        if (window_us <= 0) {
+            return -1.0f;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (entries[i].handle == task.xHandle) {
+                // Counters tick in esp_timer microseconds.
+                const configRUN_TIME_COUNTER_TYPE delta = task.ulRunTimeCounter - entries[i].runtime;
+                return std::min(100.0f, 100.0f * static_cast<float>(delta) / static_cast<float>(window_us));
+            }
+        }
+        return -1.0f;
+    }
+
+    void store(const TaskStatus_t *tasks, UBaseType_t task_count, int64_t now_us)
+    {
+        count = std::min<size_t>(task_count, kMaxTrackedTasks);
+        for (size_t i = 0; i < count; ++i) {
+            entries[i].handle = tasks[i].xHandle;
+            entries[i].runtime = tasks[i].ulRunTimeCounter;
+        }
+        at_us = now_us;
+    }
+};
+
+RuntimeHistory g_top_history;
+RuntimeHistory g_tasks_history;
+
+// Caller owns the returned array (free()).
+TaskStatus_t *snapshot_tasks(UBaseType_t *out_count)
+{
+    const UBaseType_t capacity = uxTaskGetNumberOfTasks() + kTaskSlack;
+    auto *tasks = static_cast<TaskStatus_t *>(std::malloc(sizeof(TaskStatus_t) * capacity));
+    if (tasks == nullptr) {
+        ESP_LOGW(kTag, "snapshot alloc failed (%u tasks)", static_cast<unsigned>(capacity));
+        *out_count = 0;
+        return nullptr;
+    }
+    *out_count = uxTaskGetSystemState(tasks, capacity, nullptr);
+    return tasks;
+}
+
+void read_idle_counters(const TaskStatus_t *tasks, UBaseType_t count, configRUN_TIME_COUNTER_TYPE *idle)
+{
+    for (BaseType_t core = 0; core < portNUM_PROCESSORS; ++core) {
+        const TaskHandle_t idle_handle = xTaskGetIdleTaskHandleForCore(core);
+        idle[core] = 0;
+        for (UBaseType_t i = 0; i < count; ++i) {
+            if (tasks[i].xHandle == idle_handle) {
+                idle[core] = tasks[i].ulRunTimeCounter;
+                break;
+            }
+        }
+    }
+}
+
+bool sample_from(const TaskStatus_t *tasks, UBaseType_t count, CoreLoad *out)
+{
+    CoreSnapshot now = {};
+    now.valid = true;
+    now.wall_us = esp_timer_get_time();
+    read_idle_counters(tasks, count, now.idle);
+
+    const CoreSnapshot prev = g_prev.valid ? g_prev : CoreSnapshot{true, 0, {}};
+    g_prev = now;
+
+    const int64_t window_us = now.wall_us - prev.wall_us;
+    if (window_us <= 0) {
+        return false;
+    }
+
+    out->window_ms = static_cast<uint32_t>(window_us / 1000);
+    for (int core = 0; core < portNUM_PROCESSORS; ++core) {
+        // Run-time counters tick in esp_timer microseconds; unsigned subtraction
+        // stays correct across a single 32-bit wrap.
+        const configRUN_TIME_COUNTER_TYPE idle_us = now.idle[core] - prev.idle[core];
+        const float idle_pct = 100.0f * static_cast<float>(idle_us) / static_cast<float>(window_us);
+        out->busy_pct[core] = std::clamp(100.0f - idle_pct, 0.0f, 100.0f);
+    }
+    return true;
+}
+
+using report_format::appendf;
+
+}  // namespace
+
+bool sample_core_load(CoreLoad *out)
+{
+    if (out == nullptr) {
+        return false;
+    }
+    UBaseType_t count = 0;
+    TaskStatus_t *tasks = snapshot_tasks(&count);
+    if (tasks == nullptr) {
+        return false;
+    }
+    const bool ok = sample_from(tasks, count, out);
+    std::free(tasks);
+    return ok;
+}
+
+size_t format_top(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    UBaseType_t count = 0;
+    TaskStatus_t *tasks = snapshot_tasks(&count);
+    if (tasks == nullptr) {
+        return std::snprintf(out, out_len, "top: task snapshot failed\n");
+    }
+
+    CoreLoad load = {};
+    const bool have_load = sample_from(tasks, count, &load);
+
+    // Busiest first; tasks without a previous sample sort by priority.
+    const int64_t now_us = esp_timer_get_time();
+    std::sort(tasks, tasks + count, [now_us](const TaskStatus_t &a, const TaskStatus_t &b) {
+        const float share_a = g_top_history.share(a, now_us);
+        const float share_b = g_top_history.share(b, now_us);
+        if (share_a != share_b) {
+            return share_a > share_b;
+        }
+        return a.uxCurrentPriority > b.uxCurrentPriority;
+    });
+
+    size_t used = 0;
+    if (have_load) {
+        appendf(out, out_len, &used, "top: window %" PRIu32 " ms\n", load.window_ms);
+        for (int core = 0; core < portNUM_PROCESSORS; ++core) {
+            appendf(out, out_len, &used, "CPU%d %5.1f%%%s", core, load.busy_pct[core],
+                    core + 1 < portNUM_PROCESSORS ? " | " : "\n");
+        }
+    }
+    appendf(out, out_len, &used, "%-16s CORE PRIO    CPU\n", "TASK");
+    for (UBaseType_t i = 0; i < count; ++i) {
+        const BaseType_t core = tasks[i].xCoreID;
+        char core_text[4] = "*";
+        if (core != tskNO_AFFINITY) {
+            std::snprintf(core_text, sizeof(core_text), "%d", static_cast<int>(core));
+        }
+        const float share = g_top_history.share(tasks[i], now_us);
+        if (share >= 0.0f) {
+            appendf(out, out_len, &used, "%-16s %4s %4u %5.1f%%\n", tasks[i].pcTaskName, core_text,
+                    static_cast<unsigned>(tasks[i].uxCurrentPriority), share);
+        } else {
+            appendf(out, out_len, &used, "%-16s %4s %4u %6s\n", tasks[i].pcTaskName, core_text,
+                    static_cast<unsigned>(tasks[i].uxCurrentPriority), "-");
+        }
+    }
+
+    g_top_history.store(tasks, count, now_us);
+    std::free(tasks);
+    return used;
+}
+
+size_t format_tasks(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    UBaseType_t count = 0;
+    TaskStatus_t *tasks = snapshot_tasks(&count);
+    if (tasks == nullptr) {
+        return std::snprintf(out, out_len, "tasks: task snapshot failed\n");
+    }
+
+    const int64_t now_us = esp_timer_get_time();
+    const int64_t window_us = now_us - g_tasks_history.at_us;
+
+    std::sort(tasks, tasks + count, [](const TaskStatus_t &a, const TaskStatus_t &b) {
+        return a.ulRunTimeCounter > b.ulRunTimeCounter;
+    });
+
+    size_t used = 0;
+    appendf(out, out_len, &used, "tasks: window %" PRIu32 " ms (stack in bytes)\n",
+            static_cast<uint32_t>(window_us / 1000));
+    appendf(out, out_len, &used, "%-16s %5s %5s %6s\n", "TASK", "STACK", "FREE", "CPU");
+    for (UBaseType_t i = 0; i < count; ++i) {
+        const TaskStatus_t &task = tasks[i];
+        // On ESP-IDF the high-water mark is already in bytes.
+        const unsigned hwm = static_cast<unsigned>(task.usStackHighWaterMark);
+        const task_layout::TaskSpec *spec = task_layout::find_spec(task.pcTaskName);
+
+        char stack[8] = "-";
+        if (spec != nullptr) {
+            std::snprintf(stack, sizeof(stack), "%u", static_cast<unsigned>(spec->stack_bytes));
+        }
+
+        const float share = g_tasks_history.share(task, now_us);
+        if (share >= 0.0f) {
+            appendf(out, out_len, &used, "%-16s %5s %5u %5.1f%%\n", task.pcTaskName, stack, hwm, share);
+        } else {
+            appendf(out, out_len, &used, "%-16s %5s %5u %6s\n", task.pcTaskName, stack, hwm, "-");
+        }
+    }
+
+    g_tasks_history.store(tasks, count, now_us);
+
+    std::free(tasks);
+    return used;
+}
+
+}  // namespace task_stats
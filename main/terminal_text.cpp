@@ -0,0 +1,88 @@
+#include "terminal_text.hpp"
+
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+namespace terminal_text {
+
+void strip_ansi(const char *data, size_t len, std::string *out)
+{
+    if (data == nullptr || out == nullptr) {
+        return;
+    }
+    out->reserve(out->size() + len);
+
+    for (size_t i = 0; i < len; i++) {
+        if (i > 0 && i % 1024 == 0) {
+            vTaskDelay(1);
+        }
+
+        if (data[i] == '\x1B') {
+            i++;
+            if (i >= len) break;
+
+            if (data[i] == '[') {
+                i++;
+                while (i < len && !((data[i] >= 'A' && data[i] <= 'Z') ||
+                                    (data[i] >= 'a' && data[i] <= 'z'))) {
+                    i++;
+                }
+            } else if (data[i] == ']') {
+                i++;
+                while (i < len) {
+                    if (data[i] == '\007') break;
+                    if (data[i] == '\x1B' && i + 1 < len && data[i + 1] == '\\') {
+                        i++;
+                        break;
+                    }
+                    i++;
+                }
+            } else if (data[i] == '(' || data[i] == ')') {
+                i++;
+            }
+        } else if (data[i] == '\r') {
+            continue;
+        } else {
+            *out += data[i];
+        }
+    }
+}
+
+void buffer_output(std::string *pending, const char *data, size_t len)
+{
+    if (pending == nullptr) {
+        return;
+    }
+    strip_ansi(data, len, pending);
+    if (pending->size() > kPendingMax) {
+        pending->erase(0, pending->size() - kPendingKeep);
+    }
+}
+
+size_t flush(std::string *pending, Sink sink, void *ctx)
+{
+    if (pending == nullptr || sink == nullptr) {
+        return 0;
+    }
+
+    size_t offset = 0;
+    while (offset < pending->size()) {
+        const size_t chunk_len = std::min(kFlushChunk, pending->size() - offset);
+        const std::string chunk = pending->substr(offset, chunk_len);
+        if (!sink(chunk.c_str(), ctx)) {
+            break;
+        }
+        offset += chunk_len;
+
+        vTaskDelay(1);
+    }
+
+    if (offset > 0) {
+        pending->erase(0, offset);
+    }
+    return offset;
+}
+
+}  // namespace terminal_text
@@ -0,0 +1,276 @@
+#include "tpager_backlight.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "driver/gpio.h"
+#include "driver/ledc.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include "report_format.hpp"
+#include "soc/soc_caps.h"
+
+namespace tpager {
+namespace {
+
+constexpr const char *kTag = "tpager_backlight";
+
+constexpr gpio_num_t kBacklightPin = GPIO_NUM_42;
+constexpr ledc_mode_t kLedcMode = LEDC_LOW_SPEED_MODE;
+constexpr ledc_timer_t kLedcTimer = LEDC_TIMER_0;
+constexpr ledc_channel_t kLedcChannel = LEDC_CHANNEL_0;
+constexpr ledc_timer_bit_t kLedcResolution = LEDC_TIMER_10_BIT;
+constexpr uint32_t kLedcMaxDuty = (1u << 10) - 1;
+// Above the audible range so the backlight driver does not whine.
+constexpr uint32_t kPwmFreqHz = 20000;
+
+// Estimated backlight draw at 100% duty; LED current scales ~linearly with
+// duty. Used only for the `power` report.
+constexpr float kBacklightMaAtFull = 40.0f;
+
+constexpr const char *kNvsNamespace = "tpager";
+constexpr const char *kNvsProfileKey = "bl_profile";
+
+struct ProfileLevels {
+    const char *name;
+    uint8_t full;
+    uint8_t dim;
+};
+
+constexpr size_t kProfileCount = static_cast<size_t>(BacklightProfile::Count);
+constexpr ProfileLevels kProfiles[kProfileCount] = {
+    {"day", 100, 30},
+    {"night", 25, 5},
+    {"saver", 50, 10},
+};
+
+// Brightness caps while the battery is low, tightest last.
+struct BatteryCap {
+    int at_or_below_percent;
+    uint8_t cap;
+};
+constexpr BatteryCap kBatteryCaps[] = {
+    {10, 30},
+    {20, 60},
+};
+// Once capped, the gauge must climb this far above the threshold to lift it.
+constexpr int kBatteryHysteresis = 3;
+
+bool g_initialized = false;
+uint8_t g_percent = 0;
+BacklightProfile g_profile = BacklightProfile::Day;
+BacklightLevel g_level = BacklightLevel::Full;
+uint8_t g_battery_cap = 100;
+int g_battery_percent = -1;
+
+using report_format::appendf;
+
+uint32_t duty_for(uint8_t percent)
+{
+    return (kLedcMaxDuty * percent + 50) / 100;
+}
+
+float ma_for(uint8_t percent)
+{
+    return kBacklightMaAtFull * static_cast<float>(percent) / 100.0f;
+}
+
+uint8_t level_percent(BacklightProfile profile, BacklightLevel level, uint8_t cap)
+{
+    const ProfileLevels &levels = kProfiles[static_cast<size_t>(profile)];
+    switch (level) {
+    case BacklightLevel::Full:
+        return std::min(levels.full, cap);
+    case BacklightLevel::Dim:
+        return std::min(levels.dim, cap);
+    case BacklightLevel::Off:
+        break;
+    }
+    return 0;
+}
+
+uint8_t battery_cap_for(int percent, uint8_t current_cap)
+{
+    if (percent < 0) {
+        return 100;
+    }
+    uint8_t cap = 100;
+    for (const BatteryCap &step : kBatteryCaps) {
+        const int limit = step.at_or_below_percent + (current_cap <= step.cap ? kBatteryHysteresis : 0);
+        if (percent <= limit) {
+            cap = std::min(cap, step.cap);
+        }
+    }
+    return cap;
+}
+
+}  // namespace
+
+esp_err_t backlight_init(uint8_t percent)
+{
+    if (g_initialized) {
+        return backlight_set_percent(percent);
+    }
+    percent = std::min<uint8_t>(percent, 100);
+
+    ledc_timer_config_t timer_cfg = {};
+    timer_cfg.speed_mode = kLedcMode;
+    timer_cfg.duty_resolution = kLedcResolution;
+    timer_cfg.timer_num = kLedcTimer;
+    timer_cfg.freq_hz = kPwmFreqHz;
+    timer_cfg.clk_cfg = LEDC_AUTO_CLK;
+    ESP_RETURN_ON_ERROR(ledc_timer_config(&timer_cfg), kTag, "ledc timer config failed");
+
+    ledc_channel_config_t channel_cfg = {};
+    channel_cfg.gpio_num = kBacklightPin;
+    channel_cfg.speed_mode = kLedcMode;
+    channel_cfg.channel = kLedcChannel;
+    channel_cfg.timer_sel = kLedcTimer;
+    channel_cfg.duty = duty_for(percent);
+    channel_cfg.hpoint = 0;
+    ESP_RETURN_ON_ERROR(ledc_channel_config(&channel_cfg), kTag, "ledc channel config failed");
+
+    // Fades run in the LEDC peripheral; the CPU only starts them.
+    ESP_RETURN_ON_ERROR(ledc_fade_func_install(0), kTag, "ledc fade install failed");
+
+    g_percent = percent;
+    g_initialized = true;
+    ESP_LOGI(kTag, "backlight PWM on GPIO%d at %u%%", static_cast<int>(kBacklightPin), percent);
+    return ESP_OK;
+}
+
+esp_err_t backlight_set_percent(uint8_t percent, uint32_t fade_ms, bool wait)
+{
+    if (!g_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    percent = std::min<uint8_t>(percent, 100);
+    if (percent == g_percent) {
+        return ESP_OK;
+    }
+
+    const uint32_t duty = duty_for(percent);
+    if (fade_ms == 0) {
+#if SOC_LEDC_SUPPORT_FADE_STOP
+        // A fade in flight would otherwise hold off the new duty until done.
+        (void)ledc_fade_stop(kLedcMode, kLedcChannel);
+#endif
+        ESP_RETURN_ON_ERROR(ledc_set_duty_and_update(kLedcMode, kLedcChannel, duty, 0), kTag, "set duty failed");
+    } else {
+        ESP_RETURN_ON_ERROR(ledc_set_fade_time_and_start(kLedcMode, kLedcChannel, duty, fade_ms,
+                                                         wait ? LEDC_FADE_WAIT_DONE : LEDC_FADE_NO_WAIT),
+                            kTag, "fade start failed");
+    }
+    g_percent = percent;
+    return ESP_OK;
+}
+
+uint8_t backlight_percent()
+{
+    return g_percent;
+}
+
+esp_err_t backlight_set_level(BacklightLevel level, uint32_t fade_ms, bool wait)
+{
+    g_level = level;
+    return backlight_set_percent(level_percent(g_profile, level, g_battery_cap), fade_ms, wait);
+}
+
+esp_err_t backlight_set_profile(BacklightProfile profile, bool persist)
+{
+    ESP_RETURN_ON_FALSE(profile < BacklightProfile::Count, ESP_ERR_INVALID_ARG, kTag, "bad profile");
+    g_profile = profile;
+    if (persist) {
+        nvs_handle_t nvs = 0;
+        if (nvs_open(kNvsNamespace, NVS_READWRITE, &nvs) == ESP_OK) {
+            if (nvs_set_u8(nvs, kNvsProfileKey, static_cast<uint8_t>(profile)) == ESP_OK) {
+                ESP_ERROR_CHECK_WITHOUT_ABORT(nvs_commit(nvs));
+            }
+            nvs_close(nvs);
+        }
+    }
+    ESP_LOGI(kTag, "profile %s", backlight_profile_name(profile));
+    return backlight_set_level(g_level, 300);
+}
+
+BacklightProfile backlight_profile()
+{
+    return g_profile;
+}
+
+const char *backlight_profile_name(BacklightProfile profile)
+{
+    const size_t index = static_cast<size_t>(profile);
+    return index < kProfileCount ? kProfiles[index].name : "?";
+}
+
+bool backlight_profile_from_name(const char *name, BacklightProfile *out)
+{
+    if (name == nullptr || out == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < kProfileCount; ++i) {
+        if (std::strcmp(name, kProfiles[i].name) == 0) {
+            *out = static_cast<BacklightProfile>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void backlight_restore_profile()
+{
+    nvs_handle_t nvs = 0;
+    if (nvs_open(kNvsNamespace, NVS_READONLY, &nvs) != ESP_OK) {
+        return;
+    }
+    uint8_t stored = 0;
+    if (nvs_get_u8(nvs, kNvsProfileKey, &stored) == ESP_OK && stored < kProfileCount) {
+        ESP_ERROR_CHECK_WITHOUT_ABORT(backlight_set_profile(static_cast<BacklightProfile>(stored), false));
+    }
+    nvs_close(nvs);
+}
+
+void backlight_set_battery_percent(int percent)
+{
+    g_battery_percent = percent;
+    const uint8_t cap = battery_cap_for(percent, g_battery_cap);
+    if (cap == g_battery_cap) {
+        return;
+    }
+    ESP_LOGI(kTag, "battery %d%%: brightness cap %u%% -> %u%%", percent, g_battery_cap, cap);
+    g_battery_cap = cap;
+    if (g_level != BacklightLevel::Off) {
+        ESP_ERROR_CHECK_WITHOUT_ABORT(backlight_set_level(g_level, 1000));
+    }
+}
+
+size_t backlight_format_report(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+    out[0] = '\0';
+
+    static const char *const kLevelNames[] = {"full", "dim", "off"};
+    size_t used = 0;
+    appendf(out, out_len, &used, "backlight: %s %s, %u%% ~%.0f mA\n", backlight_profile_name(g_profile),
+            kLevelNames[static_cast<size_t>(g_level)], g_percent, ma_for(g_percent));
+    if (g_battery_cap < 100) {
+        appendf(out, out_len, &used, "low battery (%d%%): capped at %u%%\n", g_battery_percent, g_battery_cap);
+    }
+    appendf(out, out_len, &used, "%-7s %11s %11s\n", "PROFILE", "FULL", "DIM");
+    for (size_t i = 0; i < kProfileCount; ++i) {
+        const auto profile = static_cast<BacklightProfile>(i);
+        const uint8_t full = level_percent(profile, BacklightLevel::Full, g_battery_cap);
+        const uint8_t dim = level_percent(profile, BacklightLevel::Dim, g_battery_cap);
+        appendf(out, out_len, &used, "%c%-6s %3u%% %4.0fmA %3u%% %4.0fmA\n", profile == g_profile ? '*' : ' ',
+                kProfiles[i].name, full, ma_for(full), dim, ma_for(dim));
+    }
+    appendf(out, out_len, &used, "off: 0 mA (light sleep when idle)\n");
+    return used;
+}
+
+}  // namespace tpager
@@ -7,27 +7,30 @@
  * - Forward hardware keyboard/encoder events into the existing SSHTerminal flow.
  */
 
-#include <cinttypes>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <dirent.h>
-#include <strings.h>
-#include <vector>
 
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "esp_check.h"
+#include "board_traits.hpp"
 #include "esp_err.h"
 #include "esp_log.h"
-#include "esp_lvgl_port.h"
+#include "esp_timer.h"
+#include "event_trace.hpp"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "input_replay.hpp"
+#include "metrics.hpp"
 #include "nvs_flash.h"
+#include "power_mgmt.hpp"
 #include "ssh_terminal.hpp"
+#include "task_layout.hpp"
+#include "tpager_backlight.hpp"
 #include "tpager_display.hpp"
 #include "tpager_encoder.hpp"
-#include "tpager_sd.hpp"
+#include "tpager_idle.hpp"
 #include "tpager_tca8418.hpp"
 #if __has_include("tpager_test_hook_config_local.hpp")
 #include "tpager_test_hook_config_local.hpp"
@@ -56,8 +59,13 @@ constexpr bool kBootAutoTestHook = (TPAGER_BOOT_TEST_ENABLE != 0);
 constexpr const char *kBootWifiSsid = TPAGER_BOOT_WIFI_SSID;
 constexpr const char *kBootWifiPassword = TPAGER_BOOT_WIFI_PASSWORD;
 
-constexpr const char *kKeysDir = "/sdcard/ssh_keys";
-constexpr size_t kMaxKeySize = 16 * 1024;
+// Idle policy: dim after 30 s, screen off + light sleep after 60 s.
+constexpr uint32_t kIdleDimMs = 30 * 1000;
+constexpr uint32_t kIdleOffMs = 60 * 1000;
+// How often the low-battery brightness cap follows the gauge.
+constexpr uint32_t kBacklightBatteryCheckMs = 10 * 1000;
+
+constexpr uint32_t kSdLoadLockWaitMs = 1000;
 
 constexpr TickType_t ticks_from_ms(uint32_t ms)
 {
@@ -76,17 +84,27 @@ tpager::DiagDisplay g_display;
 SSHTerminal *g_terminal = nullptr;
 
 TaskHandle_t g_runtime_task_handle = nullptr;
-volatile uint32_t g_keyboard_irq_count = 0;
-
-int32_t g_keyboard_events = 0;
-int32_t g_keyboard_presses = 0;
-int32_t g_keyboard_releases = 0;
 int32_t g_encoder_net = 0;
-int32_t g_encoder_transitions = 0;
 
-void IRAM_ATTR keyboard_irq_isr(void *)
+// Key and encoder totals live in the metrics registry (`stats`); the diag
+// display shows the same numbers.
+void publish_keyboard_stats()
+{
+    tpager::diag_display_set_keyboard_stats(&g_display,
+                                            static_cast<int32_t>(metrics::value(metrics::Counter::kKeyEvents)),
+                                            static_cast<int32_t>(metrics::value(metrics::Counter::kKeyPresses)),
+                                            static_cast<int32_t>(metrics::value(metrics::Counter::kKeyReleases)),
+                                            gpio_get_level(kKeyboardIrq));
+}
+
+void publish_encoder_stats()
+{
+    tpager::diag_display_set_encoder_stats(
+        &g_display, g_encoder_net, static_cast<int32_t>(metrics::value(metrics::Counter::kEncoderTransitions)));
+}
+
+void IRAM_ATTR notify_runtime_from_isr()
 {
-    g_keyboard_irq_count = g_keyboard_irq_count + 1;
     if (g_runtime_task_handle == nullptr) {
         return;
     }
@@ -97,6 +115,21 @@ void IRAM_ATTR keyboard_irq_isr(void *)
     }
 }
 
+void IRAM_ATTR keyboard_irq_isr(void *)
+{
+    metrics::add(metrics::Counter::kKeyIrqs);
+    event_trace::record(event_trace::Event::kKeyIrq);
+    tpager::idle_wake_from_isr(kKeyboardIrq);
+    notify_runtime_from_isr();
+}
+
+// Only enabled while the idle manager has the screen off.
+void IRAM_ATTR encoder_button_isr(void *)
+{
+    tpager::idle_wake_from_isr(kEncoderCenter);
+    notify_runtime_from_isr();
+}
+
 esp_err_t i2c_init()
 {
     i2c_config_t conf = {};
@@ -150,23 +183,13 @@ void append_terminal_text(const char *text)
     if (g_terminal == nullptr || text == nullptr) {
         return;
     }
-    if (!lvgl_port_lock(25)) {
-        return;
-    }
-    g_terminal->append_text(text);
-    lvgl_port_unlock();
+    board::with_display_lock(board::Current::kInputLockWaitMs, [&] { g_terminal->append_text(text); });
 }
 
-void handle_terminal_key(char key)
+// False when the key was dropped because the UI held the LVGL lock.
+bool handle_terminal_key(char key)
 {
-    if (g_terminal == nullptr) {
-        return;
-    }
-    if (!lvgl_port_lock(25)) {
-        return;
-    }
-    g_terminal->handle_key_input(key);
-    lvgl_port_unlock();
+    return g_terminal != nullptr && g_terminal->deliver_key(key);
 }
 
 bool inject_terminal_key(char key)
@@ -177,9 +200,7 @@ bool inject_terminal_key(char key)
 
     constexpr int kAttempts = 40;
     for (int attempt = 0; attempt < kAttempts; ++attempt) {
-        if (lvgl_port_lock(25)) {
-            g_terminal->handle_key_input(key);
-            lvgl_port_unlock();
+        if (board::with_display_lock(board::Current::kInputLockWaitMs, [&] { g_terminal->handle_key_input(key); })) {
             return true;
         }
         vTaskDelay(ticks_from_ms(5));
@@ -217,118 +238,65 @@ void run_terminal_command(const char *cmd)
     run_terminal_input(cmd, true);
 }
 
-bool to_terminal_char(const tpager::Tca8418Event &ev, char *out_key)
+// Boot only: the card shares the display SPI bus, so the load holds the
+// display lock.
+void load_ssh_keys_from_sd()
 {
-    if (out_key == nullptr || !ev.pressed) {
-        return false;
+    if (g_terminal == nullptr) {
+        return;
     }
 
-    switch (ev.key) {
-    case tpager::Tca8418Key::Character:
-    case tpager::Tca8418Key::Space:
-        if (ev.ch != '\0') {
-            *out_key = ev.ch;
-            return true;
-        }
-        break;
-    case tpager::Tca8418Key::Enter:
-        *out_key = '\n';
-        return true;
-    case tpager::Tca8418Key::Backspace:
-        *out_key = '\b';
-        return true;
-    default:
-        break;
+    int keys_loaded = -1;
+    if (!board::with_display_lock(kSdLoadLockWaitMs, [&] { keys_loaded = board::load_keys_from_sd(); })) {
+        ESP_LOGW(kTag, "SD key load skipped: display lock busy");
     }
-    return false;
+    if (keys_loaded < 0) {
+        append_terminal_text("SD key scan failed (card or /sdcard/ssh_keys missing)\n");
+        return;
+    }
+
+    char summary[80];
+    std::snprintf(summary, sizeof(summary), "Loaded %d key(s) from SD\n", keys_loaded);
+    append_terminal_text(summary);
 }
 
-bool has_pem_extension(const char *name)
+// The next keyboard event: from a running input replay (in place of the
+// I2C read), else from the TCA8418, recorded when `input rec` is on.
+// `input_us` is when the key counts as pressed, for key_render latency.
+esp_err_t read_key_event(tpager::Tca8418Event *ev, int64_t *input_us)
 {
-    if (name == nullptr) {
-        return false;
+    if (input_replay::replaying()) {
+        return input_replay::next_key(ev, input_us);
     }
-    const size_t len = std::strlen(name);
-    if (len < 5) {
-        return false;
+    const esp_err_t ret = tpager::tca8418_poll_event(g_tca8418, &g_tca8418_state, ev);
+    *input_us = esp_timer_get_time();
+    if (ret == ESP_OK && ev->valid && input_replay::recording()) {
+        input_replay::record_key(*ev);
     }
-    return strcasecmp(name + len - 4, ".pem") == 0;
+    return ret;
 }
 
-void load_ssh_keys_from_sd()
+esp_err_t read_encoder_event(tpager::EncoderEvent *ev)
 {
-    if (g_terminal == nullptr) {
-        return;
-    }
-
-    tpager::SdDiagStats stats = {};
-    const esp_err_t mount_ret = tpager::sd_mount_and_scan_keys(&stats);
-    if (mount_ret != ESP_OK) {
-        ESP_LOGW(kTag, "SD mount/scan failed: %s", esp_err_to_name(mount_ret));
-        append_terminal_text("SD key scan failed\n");
-        return;
+    if (input_replay::replaying()) {
+        return input_replay::next_encoder(ev);
     }
-
-    DIR *dir = opendir(kKeysDir);
-    if (dir == nullptr) {
-        append_terminal_text("No /sdcard/ssh_keys directory\n");
-        ESP_ERROR_CHECK_WITHOUT_ABORT(tpager::sd_unmount());
-        return;
+    const esp_err_t ret = tpager::encoder_poll(&g_encoder, ev);
+    if (ret == ESP_OK && input_replay::recording()) {
+        input_replay::record_encoder(*ev);
     }
-
-    int32_t keys_loaded = 0;
-    struct dirent *entry = nullptr;
-    while ((entry = readdir(dir)) != nullptr) {
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-            continue;
-        }
-        if (!has_pem_extension(entry->d_name)) {
-            continue;
-        }
-
-        char filepath[256];
-        std::snprintf(filepath, sizeof(filepath), "%s/%s", kKeysDir, entry->d_name);
-
-        FILE *f = std::fopen(filepath, "rb");
-        if (f == nullptr) {
-            ESP_LOGW(kTag, "Failed to open key %s", filepath);
-            continue;
-        }
-
-        std::fseek(f, 0, SEEK_END);
-        const long file_size = std::ftell(f);
-        std::fseek(f, 0, SEEK_SET);
-        if (file_size <= 0 || file_size > static_cast<long>(kMaxKeySize)) {
-            ESP_LOGW(kTag, "Skipping key %s (size=%ld)", filepath, file_size);
-            std::fclose(f);
-            continue;
-        }
-
-        std::vector<char> key_data(static_cast<size_t>(file_size) + 1, '\0');
-        const size_t bytes_read = std::fread(key_data.data(), 1, static_cast<size_t>(file_size), f);
-        std::fclose(f);
-        if (bytes_read != static_cast<size_t>(file_size)) {
-            ESP_LOGW(kTag, "Short read for key %s", filepath);
-            continue;
-        }
-
-        g_terminal->load_key_from_memory(entry->d_name, key_data.data(), bytes_read);
-        keys_loaded++;
-    }
-
-    closedir(dir);
-    ESP_ERROR_CHECK_WITHOUT_ABORT(tpager::sd_unmount());
-
-    char summary[80];
-    std::snprintf(summary, sizeof(summary), "Loaded %" PRId32 " key(s) from SD\n", keys_loaded);
-    append_terminal_text(summary);
+    return ret;
 }
 
-void poll_keyboard()
+// Returns true when any key event was read. With `discard` set (screen off)
+// the events only wake the screen and are not typed.
+bool poll_keyboard(bool discard)
 {
+    bool any = false;
     while (true) {
         tpager::Tca8418Event ev = {};
-        const esp_err_t ret = tpager::tca8418_poll_event(g_tca8418, &g_tca8418_state, &ev);
+        int64_t input_us = 0;
+        const esp_err_t ret = read_key_event(&ev, &input_us);
         if (ret == ESP_ERR_NOT_FOUND) {
             break;
         }
@@ -340,66 +308,118 @@ void poll_keyboard()
             break;
         }
 
-        g_keyboard_events++;
-        if (ev.pressed) {
-            g_keyboard_presses++;
-        } else {
-            g_keyboard_releases++;
-        }
+        any = true;
+        metrics::add(metrics::Counter::kKeyEvents);
+        metrics::add(ev.pressed ? metrics::Counter::kKeyPresses : metrics::Counter::kKeyReleases);
 
         char key = '\0';
-        if (to_terminal_char(ev, &key)) {
+        if (!discard && input_replay::terminal_char(ev, &key)) {
             if (ev.erase_previous_space) {
                 handle_terminal_key('\b');
             }
-            handle_terminal_key(key);
+            if (handle_terminal_key(key)) {
+                input_replay::note_key_typed(input_us);
+            }
         }
     }
 
-    tpager::diag_display_set_keyboard_stats(&g_display, g_keyboard_events, g_keyboard_presses, g_keyboard_releases,
-                                            gpio_get_level(kKeyboardIrq));
+    publish_keyboard_stats();
+    return any;
 }
 
-void poll_encoder()
+bool poll_encoder(bool discard)
 {
     tpager::EncoderEvent ev = {};
-    if (tpager::encoder_poll(&g_encoder, &ev) != ESP_OK) {
-        return;
+    if (read_encoder_event(&ev) != ESP_OK) {
+        return false;
     }
 
-    g_encoder_transitions += ev.transitions;
+    metrics::add(metrics::Counter::kEncoderTransitions, static_cast<uint32_t>(ev.transitions));
     if (ev.moved) {
         g_encoder_net += ev.delta;
-        if (g_terminal != nullptr && lvgl_port_lock(25)) {
-            int32_t steps = ev.delta;
-            while (steps > 0) {
-                g_terminal->navigate_history(1);
-                steps--;
-            }
-            while (steps < 0) {
-                g_terminal->navigate_history(-1);
-                steps++;
-            }
-            lvgl_port_unlock();
+        if (!discard && g_terminal != nullptr) {
+            board::with_display_lock(board::Current::kInputLockWaitMs, [&] {
+                int32_t steps = ev.delta;
+                while (steps > 0) {
+                    g_terminal->navigate_history(1);
+                    steps--;
+                }
+                while (steps < 0) {
+                    g_terminal->navigate_history(-1);
+                    steps++;
+                }
+            });
         }
     }
-    if (ev.button_changed && ev.button_pressed) {
+    if (!discard && ev.button_changed && ev.button_pressed) {
         handle_terminal_key('\n');
     }
 
-    tpager::diag_display_set_encoder_stats(&g_display, g_encoder_net, g_encoder_transitions);
+    publish_encoder_stats();
+    return ev.moved || ev.button_changed;
+}
+
+void terminal_output_activity(void *)
+{
+    tpager::idle_note_output();
+}
+
+void frame_ready_cb(lv_event_t *)
+{
+    input_replay::note_frame_ready();
+}
+
+// Keys pressed during a replay sat in the TCA8418 FIFO; drop them.
+void finish_input_replay()
+{
+    ESP_ERROR_CHECK_WITHOUT_ABORT(tpager::tca8418_flush_fifo(g_tca8418));
+    static char report[256];
+    if (input_replay::format_report(report, sizeof(report)) > 0) {
+        append_terminal_text(report);
+    }
 }
 
 void runtime_task(void *)
 {
     g_runtime_task_handle = xTaskGetCurrentTaskHandle();
 
+    tpager::IdleConfig idle_cfg;
+    idle_cfg.dim_after_ms = kIdleDimMs;
+    idle_cfg.off_after_ms = kIdleOffMs;
+    idle_cfg.wake_pins[0] = {kKeyboardIrq, GPIO_INTR_NEGEDGE};
+    idle_cfg.wake_pins[1] = {kEncoderCenter, GPIO_INTR_DISABLE};
+    ESP_ERROR_CHECK_WITHOUT_ABORT(tpager::idle_init(idle_cfg, g_runtime_task_handle));
+    if (g_terminal != nullptr) {
+        g_terminal->set_activity_callback(terminal_output_activity, nullptr);
+    }
+
+    TickType_t wait = ticks_from_ms(10);
+    TickType_t last_battery_check = 0;
     while (true) {
-        // Keep a short poll timeout so brief key taps (especially Space fallback)
-        // are handled with low latency even if IRQ edges are imperfect.
-        (void)ulTaskNotifyTake(pdTRUE, ticks_from_ms(10));
-        poll_keyboard();
-        poll_encoder();
+        // While lit, keep a short poll timeout so brief key taps (especially
+        // Space fallback) are handled with low latency even if IRQ edges are
+        // imperfect. With the screen off this blocks until a wake pin or
+        // session output notifies the task.
+        (void)ulTaskNotifyTake(pdTRUE, wait);
+        const bool screen_off = tpager::idle_stage() == tpager::IdleStage::Off;
+        const bool key_input = poll_keyboard(screen_off);
+        const bool encoder_input = poll_encoder(screen_off);
+        if (key_input || encoder_input) {
+            tpager::idle_note_input();
+        }
+        const TickType_t now = xTaskGetTickCount();
+        if (g_terminal != nullptr && now - last_battery_check >= ticks_from_ms(kBacklightBatteryCheckMs)) {
+            last_battery_check = now;
+            tpager::backlight_set_battery_percent(g_terminal->battery_percent());
+        }
+        wait = tpager::idle_poll();
+        if (input_replay::take_replay_finished()) {
+            finish_input_replay();
+        }
+        if (input_replay::replaying()) {
+            // Replayed events are due on their own clock, not on an IRQ.
+            wait = 1;
+        }
     }
 }
 
@@ -427,6 +447,9 @@ void wifi_autoconnect_task(void *)
     vTaskDelete(nullptr);
 }
 
+task_layout::StaticTask<task_layout::kTPagerWifiAuto> g_wifi_auto_task_storage;
+task_layout::StaticTask<task_layout::kTPagerInput> g_runtime_task_storage;
+
 }  // namespace
 
 extern "C" void app_main(void)
@@ -441,9 +464,16 @@ extern "C" void app_main(void)
     ESP_ERROR_CHECK(ret);
 
     ESP_LOGI(kTag, "===== TPAGER TARGET BOOT =====");
+    ESP_ERROR_CHECK_WITHOUT_ABORT(power_mgmt::init());
 
     ret = tpager::diag_display_init(&g_display);
     if (ret == ESP_OK) {
+        if (board::Current::display_lock(0)) {
+            power_mgmt::attach_render_hooks(g_display.disp);
+            lv_display_add_event_cb(g_display.disp, frame_ready_cb, LV_EVENT_REFR_READY, nullptr);
+            board::Current::display_unlock();
+        }
+        tpager::backlight_restore_profile();
         tpager::diag_display_set_stage(&g_display, "Stage: init I2C");
         tpager::diag_display_set_last_line(&g_display, "Runtime booting");
     }
@@ -485,13 +515,15 @@ extern "C" void app_main(void)
 
     tpager::diag_display_set_stage(&g_display, "Stage: encoder init");
     ESP_ERROR_CHECK(tpager::encoder_init(&g_encoder, kEncoderA, kEncoderB, kEncoderCenter));
-    tpager::diag_display_set_encoder_stats(&g_display, g_encoder_net, g_encoder_transitions);
-    tpager::diag_display_set_keyboard_stats(&g_display, g_keyboard_events, g_keyboard_presses, g_keyboard_releases,
-                                            gpio_get_level(kKeyboardIrq));
+    // Wake-only: the button stays polled, the pin interrupt type is set by the
+    // idle manager while the screen is off.
+    ESP_ERROR_CHECK(gpio_isr_handler_add(kEncoderCenter, encoder_button_isr, nullptr));
+    publish_encoder_stats();
+    publish_keyboard_stats();
 
     tpager::diag_display_set_stage(&g_display, "Stage: terminal init");
     g_terminal = new SSHTerminal();
-    if (g_terminal != nullptr && lvgl_port_lock(50)) {
+    if (g_terminal != nullptr && board::Current::display_lock(50)) {
         lv_obj_t *screen = g_terminal->create_terminal_screen();
         lv_scr_load(screen);
 #ifdef POCKETSSH_VERSION
@@ -500,7 +532,7 @@ extern "C" void app_main(void)
         g_terminal->append_text("PocketSSH T-Pager\n");
 #endif
         g_terminal->append_text("Keyboard + encoder active\n");
-        lvgl_port_unlock();
+        board::Current::display_unlock();
     } else {
         ESP_LOGE(kTag, "Failed to initialize terminal UI");
     }
@@ -508,10 +540,10 @@ extern "C" void app_main(void)
     load_ssh_keys_from_sd();
 
     if (kBootAutoTestHook) {
-        xTaskCreatePinnedToCore(wifi_autoconnect_task, "tpager_wifi_auto_task", 6144, nullptr, 4, nullptr, 1);
+        g_wifi_auto_task_storage.start(wifi_autoconnect_task, nullptr);
     }
 
-    xTaskCreatePinnedToCore(runtime_task, "tpager_runtime_task", 8192, nullptr, 5, nullptr, 1);
+    g_runtime_task_storage.start(runtime_task, nullptr);
 
     while (true) {
         vTaskDelay(ticks_from_ms(1000));
@@ -14,6 +14,8 @@
 #include "esp_lcd_st7796.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "task_layout.hpp"
+#include "tpager_backlight.hpp"
 
 namespace tpager {
 namespace {
@@ -27,7 +29,6 @@ constexpr gpio_num_t kDisplaySclk = GPIO_NUM_35;
 constexpr gpio_num_t kDisplayCs = GPIO_NUM_38;
 constexpr gpio_num_t kDisplayDc = GPIO_NUM_37;
 constexpr gpio_num_t kDisplayReset = GPIO_NUM_NC;
-constexpr gpio_num_t kDisplayBacklight = GPIO_NUM_42;
 
 constexpr uint32_t kDisplayPclkHz = 40 * 1000 * 1000;
 constexpr uint16_t kDisplayHRes = 480;
@@ -50,16 +51,8 @@ void set_label_text(lv_obj_t *label, const char *text)
 
 esp_err_t init_backlight()
 {
-    gpio_config_t cfg = {};
-    cfg.mode = GPIO_MODE_OUTPUT;
-    cfg.pin_bit_mask = (1ULL << kDisplayBacklight);
-    ESP_RETURN_ON_ERROR(gpio_config(&cfg), kTag, "backlight gpio config failed");
-
-    // Simple always-on policy for bring-up: keep panel lit while diagnostics run.
-    gpio_set_level(kDisplayBacklight, 0);
-    vTaskDelay(pdMS_TO_TICKS(10));
-    gpio_set_level(kDisplayBacklight, 1);
-    return ESP_OK;
+    // Full brightness for bring-up; the runtime dims it from the idle policy.
+    return backlight_init(100);
 }
 
 esp_err_t init_spi_bus()
@@ -128,7 +121,9 @@ esp_err_t init_panel(DiagDisplay *display)
 esp_err_t init_lvgl(DiagDisplay *display)
 {
     lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
-    lvgl_cfg.task_stack = 8192;
+    lvgl_cfg.task_priority = task_layout::kLvgl.priority;
+    lvgl_cfg.task_stack = task_layout::kLvgl.stack_bytes;
+    lvgl_cfg.task_affinity = task_layout::kLvgl.core;
     lvgl_cfg.task_max_sleep_ms = 50;
     esp_err_t ret = lvgl_port_init(&lvgl_cfg);
     if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
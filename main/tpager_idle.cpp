@@ -0,0 +1,193 @@
+#include "tpager_idle.hpp"
+
+#include <atomic>
+#include <cinttypes>
+
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "power_mgmt.hpp"
+#include "tpager_backlight.hpp"
+
+namespace tpager {
+namespace {
+
+constexpr const char *kTag = "tpager_idle";
+
+// Encoder rotation has no interrupt, so the owner keeps polling while the
+// screen is lit; once Off only the wake pins and notifications matter.
+constexpr TickType_t kLitPollTicks = pdMS_TO_TICKS(10) > 0 ? pdMS_TO_TICKS(10) : 1;
+
+constexpr uint32_t kDimFadeMs = 600;
+// Waited for: LEDC stops with its clock in light sleep, so the fade has to
+// finish before sleep is allowed.
+constexpr uint32_t kOffFadeMs = 400;
+
+IdleConfig g_config;
+TaskHandle_t g_owner = nullptr;
+std::atomic<IdleStage> g_stage{IdleStage::Active};
+std::atomic<uint32_t> g_last_activity_ms{0};
+std::atomic<bool> g_activity_pending{false};
+
+volatile bool g_wake_armed = false;
+volatile bool g_wake_tripped = false;
+volatile int64_t g_wake_isr_us = 0;
+
+uint32_t now_ms()
+{
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+void note_activity()
+{
+    g_last_activity_ms.store(now_ms());
+    if (g_stage.load() != IdleStage::Active) {
+        g_activity_pending.store(true);
+        if (g_owner != nullptr) {
+            xTaskNotifyGive(g_owner);
+        }
+    }
+}
+
+void arm_wake_pins()
+{
+    for (const IdleWakePin &wake : g_config.wake_pins) {
+        if (wake.pin == GPIO_NUM_NC) {
+            continue;
+        }
+        // Edge interrupts cannot wake the chip from light sleep; switch to
+        // low level for as long as the screen is off.
+        ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_wakeup_enable(wake.pin, GPIO_INTR_LOW_LEVEL));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_intr_enable(wake.pin));
+    }
+    g_wake_tripped = false;
+    g_wake_armed = true;
+}
+
+void disarm_wake_pins()
+{
+    g_wake_armed = false;
+    for (const IdleWakePin &wake : g_config.wake_pins) {
+        if (wake.pin == GPIO_NUM_NC) {
+            continue;
+        }
+        ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_wakeup_disable(wake.pin));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_set_intr_type(wake.pin, wake.awake_intr));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(gpio_intr_enable(wake.pin));
+    }
+}
+
+void enter_stage(IdleStage next)
+{
+    const IdleStage prev = g_stage.load();
+    if (next == prev) {
+        return;
+    }
+
+    switch (next) {
+    case IdleStage::Active:
+        // Backlight first, without a fade: the panel keeps its contents, so
+        // this alone makes the screen readable again.
+        ESP_ERROR_CHECK_WITHOUT_ABORT(backlight_set_level(BacklightLevel::Full));
+        if (prev == IdleStage::Off) {
+            ESP_ERROR_CHECK_WITHOUT_ABORT(power_mgmt::set_light_sleep_enabled(false));
+            disarm_wake_pins();
+            lvgl_port_resume();
+            if (g_wake_isr_us != 0) {
+                ESP_LOGI(kTag, "wake: screen on %" PRId64 " us after wake pin",
+                         esp_timer_get_time() - g_wake_isr_us);
+                g_wake_isr_us = 0;
+            }
+        }
+        break;
+    case IdleStage::Dimmed:
+        ESP_ERROR_CHECK_WITHOUT_ABORT(backlight_set_level(BacklightLevel::Dim, kDimFadeMs));
+        break;
+    case IdleStage::Off:
+        ESP_ERROR_CHECK_WITHOUT_ABORT(backlight_set_level(BacklightLevel::Off, kOffFadeMs, true));
+        lvgl_port_stop();
+        arm_wake_pins();
+        ESP_ERROR_CHECK_WITHOUT_ABORT(power_mgmt::set_light_sleep_enabled(true));
+        break;
+    }
+
+    g_stage.store(next);
+    ESP_LOGD(kTag, "stage %d -> %d", static_cast<int>(prev), static_cast<int>(next));
+}
+
+}  // namespace
+
+esp_err_t idle_init(const IdleConfig &config, TaskHandle_t owner)
+{
+    ESP_RETURN_ON_FALSE(owner != nullptr, ESP_ERR_INVALID_ARG, kTag, "owner task required");
+    ESP_RETURN_ON_FALSE(config.off_after_ms >= config.dim_after_ms, ESP_ERR_INVALID_ARG, kTag,
+                        "off timeout shorter than dim timeout");
+    g_config = config;
+    g_owner = owner;
+    g_last_activity_ms.store(now_ms());
+    ESP_RETURN_ON_ERROR(esp_sleep_enable_gpio_wakeup(), kTag, "gpio wakeup enable failed");
+    ESP_LOGI(kTag, "dim after %" PRIu32 " s, off after %" PRIu32 " s", config.dim_after_ms / 1000,
+             config.off_after_ms / 1000);
+    return ESP_OK;
+}
+
+void idle_note_input()
+{
+    note_activity();
+}
+
+void idle_note_output()
+{
+    note_activity();
+}
+
+void IRAM_ATTR idle_wake_from_isr(gpio_num_t pin)
+{
+    if (!g_wake_armed) {
+        return;
+    }
+    // Level-triggered while armed: mask until the owner restores the pin.
+    gpio_intr_disable(pin);
+    if (!g_wake_tripped) {
+        g_wake_tripped = true;
+        g_wake_isr_us = esp_timer_get_time();
+    }
+}
+
+TickType_t idle_poll()
+{
+    if (g_wake_tripped) {
+        // A wake pin counts as input even if the key event itself is dropped.
+        g_wake_tripped = false;
+        g_last_activity_ms.store(now_ms());
+        enter_stage(IdleStage::Active);
+    }
+    if (g_activity_pending.exchange(false)) {
+        enter_stage(IdleStage::Active);
+    }
+
+    const uint32_t idle_ms = now_ms() - g_last_activity_ms.load();
+    const IdleStage stage = g_stage.load();
+    if (stage == IdleStage::Active && idle_ms >= g_config.dim_after_ms) {
+        enter_stage(IdleStage::Dimmed);
+    }
+    if (g_stage.load() == IdleStage::Dimmed && idle_ms >= g_config.off_after_ms) {
+        enter_stage(IdleStage::Off);
+        // enter_stage() blocks for the fade before publishing Off. Input in
+        // that window saw Dimmed, and its notification may already be spent,
+        // so look again rather than sleep through it.
+        if (g_activity_pending.exchange(false) || now_ms() - g_last_activity_ms.load() < idle_ms) {
+            enter_stage(IdleStage::Active);
+        }
+    }
+    return g_stage.load() == IdleStage::Off ? portMAX_DELAY : kLitPollTicks;
+}
+
+IdleStage idle_stage()
+{
+    return g_stage.load();
+}
+
+}  // namespace tpager
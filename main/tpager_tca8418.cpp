@@ -256,8 +256,12 @@ esp_err_t tca8418_poll_event(const Tca8418 &dev, Tca8418State *state, Tca8418Eve
         return ESP_OK;
     }
     if (event->matrix_index == kKeyIndexBackspace) {
+        // Alt+Backspace is ETX: cancels a running built-in, else ^C remotely.
         event->key = Tca8418Key::Backspace;
-        event->ch = '\b';
+        event->ch = state->symbol ? '\x03' : '\b';
+        if (state->symbol && event->pressed) {
+            state->symbol_chord_used = true;
+        }
         return ESP_OK;
     }
 
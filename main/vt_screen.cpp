@@ -0,0 +1,433 @@
+#include "vt_screen.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace vt_screen {
+namespace {
+
+constexpr uint16_t kTabWidth = 8;
+// Caps a runaway numeric parameter; no sequence needs more than 4 digits.
+constexpr uint16_t kMaxParamValue = 9999;
+
+// Row width without its trailing blanks.
+size_t trimmed_width(const char *cells)
+{
+    size_t width = kCols;
+    while (width > 0 && cells[width - 1] == ' ') {
+        --width;
+    }
+    return width;
+}
+
+}  // namespace
+
+Screen::Screen()
+{
+    std::memset(cells_, ' ', sizeof(cells_));
+    reset();
+}
+
+void Screen::reset()
+{
+    for (uint16_t r = 0; r < kRows; ++r) {
+        clear_cells(r, 0, kCols);
+    }
+    row_ = 0;
+    col_ = 0;
+    saved_row_ = 0;
+    saved_col_ = 0;
+    wrap_pending_ = false;
+    state_ = State::kGround;
+    param_count_ = 0;
+    utf8_remaining_ = 0;
+    csi_private_ = false;
+    dirty_ = true;
+}
+
+void Screen::feed(const char *data, size_t len)
+{
+    if (data == nullptr) {
+        return;
+    }
+    stats_.bytes_in += len;
+
+    for (size_t i = 0; i < len; ++i) {
+        const char c = data[i];
+        const uint8_t u = static_cast<uint8_t>(c);
+
+        switch (state_) {
+        case State::kGround:
+            if (u >= 0x20 && u < 0x7F) {
+                put(c);
+            } else if (u == 0x1B) {
+                state_ = State::kEscape;
+            } else if (u >= 0xC0) {
+                // One cell per character; the continuation bytes are dropped.
+                put('?');
+                utf8_remaining_ = u >= 0xF0 ? 3 : (u >= 0xE0 ? 2 : 1);
+                state_ = State::kUtf8;
+            } else if (c == '\r') {
+                col_ = 0;
+                wrap_pending_ = false;
+            } else if (c == '\n' || c == '\v' || c == '\f') {
+                line_feed();
+            } else if (c == '\b') {
+                if (col_ > 0) {
+                    col_--;
+                }
+                wrap_pending_ = false;
+            } else if (c == '\t') {
+                move_to(row_, std::min<int>(kCols - 1, (col_ / kTabWidth + 1) * kTabWidth));
+            }
+            break;
+
+        case State::kUtf8:
+            if ((u & 0xC0) == 0x80) {
+                if (--utf8_remaining_ == 0) {
+                    state_ = State::kGround;
+                }
+            } else {
+                // Truncated sequence: this byte starts something new.
+                state_ = State::kGround;
+                --i;
+            }
+            break;
+
+        case State::kEscape:
+            if (c == '[') {
+                param_count_ = 0;
+                params_[0] = 0;
+                csi_private_ = false;
+                state_ = State::kCsi;
+            } else if (c == ']') {
+                state_ = State::kOsc;
+            } else if (c == '(' || c == ')' || c == '*' || c == '+') {
+                state_ = State::kCharset;
+            } else {
+                state_ = State::kGround;
+                esc_dispatch(c);
+            }
+            break;
+
+        case State::kCsi:
+            if (c >= '0' && c <= '9') {
+                if (param_count_ == 0) {
+                    param_count_ = 1;
+                }
+                uint16_t &value = params_[param_count_ - 1];
+                value = std::min<uint16_t>(kMaxParamValue, value * 10 + (c - '0'));
+            } else if (c == ';') {
+                if (param_count_ == 0) {
+                    param_count_ = 1;
+                }
+                if (param_count_ < kMaxParams) {
+                    params_[param_count_++] = 0;
+                }
+            } else if (c == '?' || c == '>' || c == '=') {
+                csi_private_ = true;
+            } else if (u >= 0x40 && u <= 0x7E) {
+                state_ = State::kGround;
+                if (!csi_private_) {
+                    csi_dispatch(c);
+                }
+            } else if (u == 0x1B) {
+                state_ = State::kEscape;
+            }
+            break;
+
+        case State::kOsc:
+            if (c == '\007') {
+                state_ = State::kGround;
+            } else if (u == 0x1B) {
+                state_ = State::kOscEscape;
+            }
+            break;
+
+        case State::kOscEscape:
+            // ESC \ ends the string; anything else after ESC ends it too.
+            state_ = State::kGround;
+            break;
+
+        case State::kCharset:
+            state_ = State::kGround;
+            break;
+        }
+    }
+}
+
+void Screen::write_text(const char *text)
+{
+    if (text == nullptr) {
+        return;
+    }
+    for (; *text != '\0'; ++text) {
+        const char c = *text;
+        const uint8_t u = static_cast<uint8_t>(c);
+        if (u >= 0x20 && u < 0x7F) {
+            put(c);
+        } else if (c == '\n') {
+            col_ = 0;
+            line_feed();
+        } else if (c == '\r') {
+            col_ = 0;
+            wrap_pending_ = false;
+        } else if (c == '\t') {
+            move_to(row_, std::min<int>(kCols - 1, (col_ / kTabWidth + 1) * kTabWidth));
+        } else if (u >= 0xC0) {
+            put('?');
+        }
+    }
+}
+
+void Screen::take_frame(Frame *frame)
+{
+    frame->top = top_;
+    frame->history = history_;
+    frame->last_row = last_row();
+    frame->rows = dirty_rows_;
+    size_t copied = 0;
+    for (uint16_t s = 0; s < kRingRows; ++s) {
+        if ((dirty_rows_ & (RowMask{1} << s)) == 0) {
+            continue;
+        }
+        const size_t width = trimmed_width(cells_[s]);
+        std::memcpy(frame->text[s], cells_[s], width);
+        frame->text[s][width] = '\0';
+        copied += width;
+    }
+
+    dirty_rows_ = 0;
+    dirty_ = false;
+    stats_.render_bytes += copied;
+    stats_.renders++;
+}
+
+size_t Screen::render(char *out, size_t out_len)
+{
+    if (out == nullptr || out_len == 0) {
+        return 0;
+    }
+
+    const uint16_t last = last_row();
+    size_t used = 0;
+    for (uint16_t r = 0; r <= last; ++r) {
+        const char *cells = row_cells(r);
+        const size_t n = std::min(trimmed_width(cells), out_len - 1 - used);
+        std::memcpy(out + used, cells, n);
+        used += n;
+        if (r < last && used + 1 < out_len) {
+            out[used++] = '\n';
+        }
+    }
+    out[used] = '\0';
+
+    stats_.render_bytes += used;
+    return used;
+}
+
+uint16_t Screen::last_row()
+{
+    for (uint16_t r = kRows; r-- > row_ + 1;) {
+        if (trimmed_width(row_cells(r)) > 0) {
+            return r;
+        }
+    }
+    return row_;
+}
+
+void Screen::put(char c)
+{
+    if (wrap_pending_) {
+        col_ = 0;
+        line_feed();
+    }
+    row_cells(row_)[col_] = c;
+    stats_.cell_writes++;
+    dirty_ = true;
+    mark_row(row_);
+    if (col_ == kCols - 1) {
+        wrap_pending_ = true;
+    } else {
+        col_++;
+    }
+}
+
+void Screen::line_feed()
+{
+    wrap_pending_ = false;
+    dirty_ = true;
+    if (row_ < kRows - 1) {
+        row_++;
+        return;
+    }
+    // The top row stays put as the newest scrollback; the row that comes in
+    // at the bottom reuses the oldest.
+    top_ = (top_ + 1) % kRingRows;
+    history_ = std::min<uint16_t>(history_ + 1, kScrollbackRows);
+    clear_cells(kRows - 1, 0, kCols);
+    stats_.scrolls++;
+}
+
+void Screen::reverse_line_feed()
+{
+    wrap_pending_ = false;
+    dirty_ = true;
+    if (row_ > 0) {
+        row_--;
+        return;
+    }
+    // The newest scrollback row comes back as the blank top row.
+    top_ = (top_ + kRingRows - 1) % kRingRows;
+    if (history_ > 0) {
+        history_--;
+    }
+    clear_cells(0, 0, kCols);
+}
+
+void Screen::clear_cells(uint16_t row, uint16_t from, uint16_t to)
+{
+    if (from < to) {
+        std::memset(row_cells(row) + from, ' ', to - from);
+        dirty_ = true;
+        mark_row(row);
+    }
+}
+
+void Screen::erase_display(uint16_t mode)
+{
+    switch (mode) {
+    case 0:
+        erase_line(0);
+        for (uint16_t r = row_ + 1; r < kRows; ++r) {
+            clear_cells(r, 0, kCols);
+        }
+        break;
+    case 1:
+        for (uint16_t r = 0; r < row_; ++r) {
+            clear_cells(r, 0, kCols);
+        }
+        erase_line(1);
+        break;
+    default:
+        for (uint16_t r = 0; r < kRows; ++r) {
+            clear_cells(r, 0, kCols);
+        }
+        break;
+    }
+}
+
+void Screen::erase_line(uint16_t mode)
+{
+    switch (mode) {
+    case 0:
+        clear_cells(row_, col_, kCols);
+        break;
+    case 1:
+        clear_cells(row_, 0, col_ + 1);
+        break;
+    default:
+        clear_cells(row_, 0, kCols);
+        break;
+    }
+}
+
+void Screen::move_to(int row, int col)
+{
+    row_ = static_cast<uint16_t>(std::clamp(row, 0, kRows - 1));
+    col_ = static_cast<uint16_t>(std::clamp(col, 0, kCols - 1));
+    wrap_pending_ = false;
+    dirty_ = true;
+}
+
+void Screen::esc_dispatch(char c)
+{
+    switch (c) {
+    case '7':
+        saved_row_ = row_;
+        saved_col_ = col_;
+        break;
+    case '8':
+        move_to(saved_row_, saved_col_);
+        break;
+    case 'D':
+        line_feed();
+        break;
+    case 'E':
+        col_ = 0;
+        line_feed();
+        break;
+    case 'M':
+        reverse_line_feed();
+        break;
+    case 'c':
+        reset();
+        break;
+    default:
+        break;
+    }
+}
+
+void Screen::csi_dispatch(char c)
+{
+    const int n = param(0, 1);
+    switch (c) {
+    case 'A':
+        move_to(row_ - n, col_);
+        break;
+    case 'B':
+    case 'e':
+        move_to(row_ + n, col_);
+        break;
+    case 'C':
+    case 'a':
+        move_to(row_, col_ + n);
+        break;
+    case 'D':
+        move_to(row_, col_ - n);
+        break;
+    case 'E':
+        move_to(row_ + n, 0);
+        break;
+    case 'F':
+        move_to(row_ - n, 0);
+        break;
+    case 'G':
+    case '`':
+        move_to(row_, n - 1);
+        break;
+    case 'd':
+        move_to(n - 1, col_);
+        break;
+    case 'H':
+    case 'f':
+        move_to(n - 1, param(1, 1) - 1);
+        break;
+    case 'J':
+        erase_display(param(0, 0));
+        break;
+    case 'K':
+        erase_line(param(0, 0));
+        break;
+    case 'X':
+        clear_cells(row_, col_, static_cast<uint16_t>(std::min<int>(kCols, col_ + n)));
+        break;
+    case 's':
+        saved_row_ = row_;
+        saved_col_ = col_;
+        break;
+    case 'u':
+        move_to(saved_row_, saved_col_);
+        break;
+    default:
+        // SGR, modes, scroll regions, insert/delete: dropped.
+        break;
+    }
+}
+
+uint16_t Screen::param(size_t index, uint16_t fallback) const
+{
+    return index < param_count_ && params_[index] != 0 ? params_[index] : fallback;
+}
+
+}  // namespace vt_screen